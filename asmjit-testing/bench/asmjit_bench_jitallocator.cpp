@@ -0,0 +1,184 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See asmjit.h or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core.h>
+
+#include <asmjit-testing/commons/asmjitutils.h>
+#include <asmjit-testing/commons/cmdline.h>
+#include <asmjit-testing/commons/performancetimer.h>
+#include <asmjit-testing/commons/random.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <utility>
+
+using namespace asmjit;
+
+#if !defined(ASMJIT_NO_JIT)
+
+static void print_app_info(size_t object_count, size_t iterations) noexcept {
+  printf("AsmJit Benchmark JitAllocator v%u.%u.%u [Arch=%s] [Mode=%s]\n\n",
+    unsigned((ASMJIT_LIBRARY_VERSION >> 16)       ),
+    unsigned((ASMJIT_LIBRARY_VERSION >>  8) & 0xFF),
+    unsigned((ASMJIT_LIBRARY_VERSION      ) & 0xFF),
+    asmjit_arch_as_string(Arch::kHost),
+    asmjit_build_type()
+  );
+
+  printf("This benchmark was designed to benchmark JitAllocator when it's used to\n"
+         "allocate a lot of tiny spans like call trampolines or inline cache stubs.\n"
+         "Each output line provides the time of all iterations of the given test\n"
+         "case, where each iteration allocates all objects and then releases them\n"
+         "either in the allocation order (Fwd) or in a random order (Rnd). Churn (Chr)\n"
+         "keeps all objects allocated and replaces randomly chosen objects instead.\n"
+         "Objects are released either by their pointers (Ptr) or by spans (Span).\n\n");
+
+  printf("The number of objects per iteration: %zu (override by --objects=n)\n", object_count);
+  printf("The number of iterations benchmarked: %zu (override by --count=n)\n", iterations);
+  printf("\n");
+}
+
+enum class ReleaseOrder : uint32_t {
+  kForward,
+  kRandom,
+  kChurn
+};
+
+enum class ReleaseBy : uint32_t {
+  kPointer,
+  kSpan
+};
+
+static Error release_span(JitAllocator& allocator, const JitAllocator::Span& span, ReleaseBy release_by) noexcept {
+  return release_by == ReleaseBy::kSpan ? allocator.release(span) : allocator.release(span.rx());
+}
+
+static void bench_alloc_release(JitAllocator& allocator, JitAllocator::Span* spans, size_t object_count, size_t object_size, ReleaseOrder order, ReleaseBy release_by) noexcept {
+  for (size_t i = 0; i < object_count; i++) {
+    if (allocator.alloc(Out(spans[i]), object_size) != Error::kOk) {
+      printf("Failed to allocate %zu bytes\n", object_size);
+      return;
+    }
+  }
+
+  if (order == ReleaseOrder::kChurn) {
+    // Replace objects, which keeps the number of allocated objects the same.
+    TestUtils::Random rnd(0x1234u);
+    for (size_t i = 0; i < object_count; i++) {
+      JitAllocator::Span& span = spans[size_t(rnd.next_uint32()) % object_count];
+      if (release_span(allocator, span, release_by) != Error::kOk || allocator.alloc(Out(span), object_size) != Error::kOk) {
+        printf("Failed to replace %p\n", span.rx());
+        return;
+      }
+    }
+  }
+
+  if (order == ReleaseOrder::kRandom) {
+    // Shuffle by using a fixed seed, so each iteration and each allocator releases objects in the same order.
+    TestUtils::Random rnd(0x1234u);
+    for (size_t i = object_count - 1u; i > 0; i--) {
+      std::swap(spans[i], spans[size_t(rnd.next_uint32()) % (i + 1u)]);
+    }
+  }
+
+  for (size_t i = 0; i < object_count; i++) {
+    if (release_span(allocator, spans[i], release_by) != Error::kOk) {
+      printf("Failed to release %p\n", spans[i].rx());
+      return;
+    }
+  }
+}
+
+static void test_perf(const char* name, JitAllocatorOptions options, size_t object_count, size_t object_size, ReleaseOrder order, ReleaseBy release_by, size_t iterations) noexcept {
+  JitAllocator::CreateParams params {};
+  params.options = options;
+
+  JitAllocator allocator(&params);
+  JitAllocator::Span* spans = static_cast<JitAllocator::Span*>(::malloc(sizeof(JitAllocator::Span) * object_count));
+
+  if (!spans) {
+    printf("Failed to allocate the array of spans\n");
+    return;
+  }
+
+  PerformanceTimer timer;
+
+  timer.start();
+  for (size_t i = 0; i < iterations; i++) {
+    bench_alloc_release(allocator, spans, object_count, object_size, order, release_by);
+  }
+  timer.stop();
+
+  // Measure the memory needed to hold all objects separately, outside of the timed loop.
+  for (size_t i = 0; i < object_count; i++) {
+    (void)allocator.alloc(Out(spans[i]), object_size);
+  }
+  size_t used_size = allocator.statistics().used_size();
+
+  for (size_t i = 0; i < object_count; i++) {
+    (void)allocator.release(spans[i]);
+  }
+
+  printf("| %-24s | %4zu | %-3s | %-4s | %10.1f [ms] | %8zu [kB] |\n",
+    name,
+    object_size,
+    order == ReleaseOrder::kForward ? "Fwd" : order == ReleaseOrder::kRandom ? "Rnd" : "Chr",
+    release_by == ReleaseBy::kSpan ? "Span" : "Ptr",
+    timer.duration(),
+    used_size / 1024u);
+
+  ::free(spans);
+}
+
+int main(int argc, char* argv[]) {
+  CmdLine cmd_line(argc, argv);
+  size_t object_count = cmd_line.value_as_uint("--objects", 100000);
+  size_t iterations = cmd_line.value_as_uint("--count", 10);
+
+  print_app_info(object_count, iterations);
+
+  const char frame[]  = "+--------------------------+------+-----+------+-----------------+---------------+\n";
+  const char header[] = "| Allocator                | Size | Ord | Rel  |       Time [ms] |          Used |\n";
+
+  struct TestInfo {
+    const char* name;
+    JitAllocatorOptions options;
+  };
+
+  using Opt = JitAllocatorOptions;
+
+  static const TestInfo test_info_table[] = {
+    { "Default"                  , Opt::kNone },
+    { "kUseMultiplePools"        , Opt::kUseMultiplePools },
+    { "kUseSlabs"                , Opt::kUseSlabs }
+  };
+
+  static const size_t object_sizes[] = { 16, 32, 48 };
+
+  printf(frame);
+  printf(header);
+  printf(frame);
+
+  for (size_t object_size : object_sizes) {
+    for (const TestInfo& test_info : test_info_table) {
+      test_perf(test_info.name, test_info.options, object_count, object_size, ReleaseOrder::kForward, ReleaseBy::kPointer, iterations);
+      test_perf(test_info.name, test_info.options, object_count, object_size, ReleaseOrder::kRandom, ReleaseBy::kPointer, iterations);
+      test_perf(test_info.name, test_info.options, object_count, object_size, ReleaseOrder::kRandom, ReleaseBy::kSpan, iterations);
+      test_perf(test_info.name, test_info.options, object_count, object_size, ReleaseOrder::kChurn, ReleaseBy::kSpan, iterations);
+    }
+    printf(frame);
+  }
+
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("AsmJit JitAllocator benchmark is disabled in this build (ASMJIT_NO_JIT)\n");
+  return 0;
+}
+
+#endif // !ASMJIT_NO_JIT
@@ -0,0 +1,201 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See asmjit.h or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/host.h>
+
+#include <asmjit-testing/commons/asmjitutils.h>
+#include <asmjit-testing/commons/cmdline.h>
+#include <asmjit-testing/commons/performancetimer.h>
+#include <asmjit-testing/commons/random.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <utility>
+
+#if !defined(_WIN32)
+  #include <sys/resource.h>
+#endif
+
+using namespace asmjit;
+
+#if !defined(ASMJIT_NO_JIT) && defined(ASMJIT_HAS_HOST_BACKEND)
+
+static void print_app_info(size_t func_count, size_t func_size, size_t iterations) noexcept {
+  printf("AsmJit Benchmark JitExec v%u.%u.%u [Arch=%s] [Mode=%s]\n\n",
+    unsigned((ASMJIT_LIBRARY_VERSION >> 16)       ),
+    unsigned((ASMJIT_LIBRARY_VERSION >>  8) & 0xFF),
+    unsigned((ASMJIT_LIBRARY_VERSION      ) & 0xFF),
+    asmjit_arch_as_string(Arch::kHost),
+    asmjit_build_type()
+  );
+
+  printf("This benchmark was designed to benchmark the execution of many small JIT\n"
+         "functions spread across JIT memory, which is sensitive to page faults and\n"
+         "iTLB misses. Each output line provides the time of adding all functions to\n"
+         "JitRuntime (Add), the time of all iterations that call all functions in a\n"
+         "random order (Call), and the number of minor page faults of both (Faults).\n"
+         "Page faults are only reported on POSIX operating systems.\n\n");
+
+  printf("The number of functions: %zu (override by --functions=n)\n", func_count);
+  printf("The size of each function: %zu (override by --size=n)\n", func_size);
+  printf("The number of iterations benchmarked: %zu (override by --count=n)\n", iterations);
+  printf("Large page size: %zu\n", VirtMem::large_page_size());
+  printf("\n");
+}
+
+static uint64_t minor_page_faults() noexcept {
+#if !defined(_WIN32)
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    return uint64_t(usage.ru_minflt);
+  }
+#endif
+  return 0u;
+}
+
+using Func = uint32_t (*)(void);
+
+#if ASMJIT_ARCH_X86 != 0
+static void emit_func(x86::Assembler& a, uint32_t value) noexcept {
+  a.mov(x86::eax, value);
+  a.ret();
+}
+#elif ASMJIT_ARCH_ARM == 64
+static void emit_func(a64::Assembler& a, uint32_t value) noexcept {
+  a.mov(a64::w0, value);
+  a.ret(a64::x30);
+}
+#endif
+
+static void test_perf(const char* name, JitAllocatorOptions options, size_t func_count, size_t func_size, size_t iterations) noexcept {
+  JitAllocator::CreateParams params {};
+  params.options = options;
+
+  JitRuntime rt(&params);
+  Func* funcs = static_cast<Func*>(::calloc(func_count, sizeof(Func)));
+
+  if (!funcs) {
+    printf("Failed to allocate the array of functions\n");
+    return;
+  }
+
+  CodeHolder code;
+  host::Assembler a;
+
+  PerformanceTimer add_timer;
+  PerformanceTimer call_timer;
+
+  uint64_t faults_start = minor_page_faults();
+
+  add_timer.start();
+  code.init(rt.environment());
+  code.attach(&a);
+
+  for (size_t i = 0; i < func_count; i++) {
+    code.reinit();
+    emit_func(a, uint32_t(i));
+
+    // Pad each function so the functions are spread across more pages.
+    size_t padding = func_size - Support::min(func_size, code.code_size());
+    if (padding) {
+      a.embed_uint8(0, padding);
+    }
+
+    if (rt.add(&funcs[i], &code) != Error::kOk) {
+      printf("Failed to add function #%zu\n", i);
+      func_count = i;
+      break;
+    }
+  }
+  add_timer.stop();
+
+  // Shuffle by using a fixed seed, so each allocator calls functions in the same order.
+  TestUtils::Random rnd(0x1234u);
+  for (size_t i = func_count; i > 1u; i--) {
+    std::swap(funcs[i - 1u], funcs[size_t(rnd.next_uint32()) % i]);
+  }
+
+  uint32_t checksum = 0;
+
+  call_timer.start();
+  for (size_t iteration = 0; iteration < iterations; iteration++) {
+    for (size_t i = 0; i < func_count; i++) {
+      checksum += funcs[i]();
+    }
+  }
+  call_timer.stop();
+
+  uint64_t faults = minor_page_faults() - faults_start;
+  size_t reserved_size = rt.allocator().statistics().reserved_size();
+
+  printf("| %-42s | %10.1f [ms] | %10.1f [ms] | %8llu | %9zu [kB] | %08X |\n",
+    name,
+    add_timer.duration(),
+    call_timer.duration(),
+    (unsigned long long)faults,
+    reserved_size / 1024u,
+    checksum);
+
+  for (size_t i = 0; i < func_count; i++) {
+    (void)rt.release(funcs[i]);
+  }
+
+  ::free(funcs);
+}
+
+int main(int argc, char* argv[]) {
+  CmdLine cmd_line(argc, argv);
+  size_t func_count = cmd_line.value_as_uint("--functions", 20000);
+  size_t func_size = cmd_line.value_as_uint("--size", 256);
+  size_t iterations = cmd_line.value_as_uint("--count", 20);
+
+  print_app_info(func_count, func_size, iterations);
+
+  const char frame[]  = "+--------------------------------------------+-----------------+-----------------+----------+---------------+----------+\n";
+  const char header[] = "| Allocator                                  |       Add [ms]  |      Call [ms]  |   Faults |      Reserved | Checksum |\n";
+
+  struct TestInfo {
+    const char* name;
+    JitAllocatorOptions options;
+  };
+
+  using Opt = JitAllocatorOptions;
+
+  static const TestInfo test_info_table[] = {
+    { "Default"                                   , Opt::kNone },
+    { "kPrefaultBlocks"                           , Opt::kPrefaultBlocks },
+    { "kUseTransparentHugePages"                  , Opt::kUseTransparentHugePages },
+    { "kUseTransparentHugePages | kPrefaultBlocks", Opt::kUseTransparentHugePages | Opt::kPrefaultBlocks },
+    { "kUseDualMapping"                           , Opt::kUseDualMapping },
+    { "kUseDualMapping | kUseTransparentHugePages", Opt::kUseDualMapping | Opt::kUseTransparentHugePages }
+  };
+
+  VirtMem::HardenedRuntimeInfo hri = VirtMem::hardened_runtime_info();
+
+  printf(frame);
+  printf(header);
+  printf(frame);
+
+  for (const TestInfo& test_info : test_info_table) {
+    if (Support::test(test_info.options, Opt::kUseDualMapping) &&
+        !Support::test(hri.flags, VirtMem::HardenedRuntimeFlags::kDualMapping)) {
+      continue;
+    }
+
+    test_perf(test_info.name, test_info.options, func_count, func_size, iterations);
+  }
+
+  printf(frame);
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("AsmJit JitExec benchmark is disabled in this build (ASMJIT_NO_JIT or no host backend)\n");
+  return 0;
+}
+
+#endif // !ASMJIT_NO_JIT && ASMJIT_HAS_HOST_BACKEND
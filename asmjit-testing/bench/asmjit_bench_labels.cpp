@@ -0,0 +1,192 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See asmjit.h or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core.h>
+
+#if !defined(ASMJIT_NO_X86)
+  #include <asmjit/x86.h>
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+  #include <asmjit/a64.h>
+#endif // !ASMJIT_NO_AARCH64
+
+#include <asmjit-testing/commons/asmjitutils.h>
+#include <asmjit-testing/commons/cmdline.h>
+#include <asmjit-testing/commons/performancetimer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace asmjit;
+
+static void print_app_info(size_t label_count, size_t iterations) noexcept {
+  printf("AsmJit Benchmark Labels v%u.%u.%u [Arch=%s] [Mode=%s]\n\n",
+    unsigned((ASMJIT_LIBRARY_VERSION >> 16)       ),
+    unsigned((ASMJIT_LIBRARY_VERSION >>  8) & 0xFF),
+    unsigned((ASMJIT_LIBRARY_VERSION      ) & 0xFF),
+    asmjit_arch_as_string(Arch::kHost),
+    asmjit_build_type()
+  );
+
+  printf("This benchmark was designed to benchmark label-heavy code generation, which\n"
+         "means creating many labels (anonymous and named), looking up named labels,\n"
+         "and resolving forward references (fixups) when labels are bound. Each output\n"
+         "line provides the time of all iterations of the given test case.\n\n");
+
+  printf("The number of labels per iteration: %zu (override by --labels=n)\n", label_count);
+  printf("The number of iterations benchmarked: %zu (override by --count=n)\n", iterations);
+  printf("\n");
+}
+
+// Label names are formatted once before running the benchmarks, so formatting is not part of the measured time.
+static constexpr size_t kLabelNameSize = 64;
+static char* label_name_data;
+
+static bool init_label_names(size_t label_count) noexcept {
+  label_name_data = static_cast<char*>(::malloc(label_count * kLabelNameSize));
+  if (!label_name_data) {
+    return false;
+  }
+
+  for (size_t i = 0; i < label_count; i++) {
+    // Generated state machines use long names with a common prefix, which is the worst case for name hashing.
+    snprintf(label_name_data + i * kLabelNameSize, kLabelNameSize, "state_machine_transition_%zu", i);
+  }
+  return true;
+}
+
+static const char* label_name(size_t i) noexcept {
+  return label_name_data + i * kLabelNameSize;
+}
+
+static void bench_new_label_id(CodeHolder& code, size_t label_count) noexcept {
+  for (size_t i = 0; i < label_count; i++) {
+    uint32_t label_id;
+    (void)code.new_label_id(Out(label_id));
+  }
+}
+
+static void bench_new_label_ids(CodeHolder& code, size_t label_count) noexcept {
+  uint32_t first_id;
+  (void)code.new_label_ids(Out(first_id), label_count);
+}
+
+static void bench_new_named_label_id(CodeHolder& code, size_t label_count) noexcept {
+  for (size_t i = 0; i < label_count; i++) {
+    uint32_t label_id;
+    (void)code.new_named_label_id(Out(label_id), label_name(i), SIZE_MAX, LabelType::kGlobal);
+  }
+}
+
+static void bench_label_id_by_name(CodeHolder& code, size_t label_count) noexcept {
+  // Each label is looked up multiple times (as when it's referenced from multiple places), so lookups dominate.
+  constexpr size_t kLookupsPerLabel = 4;
+
+  bench_new_named_label_id(code, label_count);
+
+  for (size_t lookup = 0; lookup < kLookupsPerLabel; lookup++) {
+    for (size_t i = 0; i < label_count; i++) {
+      if (code.label_id_by_name(label_name(i)) == Globals::kInvalidId) {
+        printf("Label '%s' not found!\n", label_name(i));
+      }
+    }
+  }
+}
+
+#if !defined(ASMJIT_NO_X86)
+static void bench_x86_forward_jumps(CodeHolder& code, size_t label_count) noexcept {
+  x86::Assembler a(&code);
+
+  uint32_t first_id;
+  (void)code.new_label_ids(Out(first_id), label_count);
+
+  // Each label is referenced twice before it's bound, so each bind resolves a chain of fixups.
+  for (size_t i = 0; i < label_count; i++) {
+    a.jnz(Label(first_id + uint32_t(i)));
+    a.jmp(Label(first_id + uint32_t(i)));
+  }
+
+  for (size_t i = 0; i < label_count; i++) {
+    a.bind(Label(first_id + uint32_t(i)));
+    a.nop();
+  }
+}
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+static void bench_a64_forward_jumps(CodeHolder& code, size_t label_count) noexcept {
+  a64::Assembler a(&code);
+
+  uint32_t first_id;
+  (void)code.new_label_ids(Out(first_id), label_count);
+
+  for (size_t i = 0; i < label_count; i++) {
+    a.cbz(a64::x0, Label(first_id + uint32_t(i)));
+    a.b(Label(first_id + uint32_t(i)));
+  }
+
+  for (size_t i = 0; i < label_count; i++) {
+    a.bind(Label(first_id + uint32_t(i)));
+    a.nop();
+  }
+}
+#endif // !ASMJIT_NO_AARCH64
+
+template<typename Lambda>
+static void test_perf(const char* name, Arch arch, size_t label_count, size_t iterations, Lambda&& fn) noexcept {
+  Environment env(arch);
+  CodeHolder code;
+  PerformanceTimer timer;
+
+  timer.start();
+  for (size_t i = 0; i < iterations; i++) {
+    code.init(env);
+    fn(code, label_count);
+    code.reset();
+  }
+  timer.stop();
+
+  printf("| %-30s | %10.1f [ms] |\n", name, timer.duration());
+}
+
+int main(int argc, char* argv[]) {
+  CmdLine cmd_line(argc, argv);
+  size_t label_count = cmd_line.value_as_uint("--labels", 100000);
+  size_t iterations = cmd_line.value_as_uint("--count", 10);
+
+  print_app_info(label_count, iterations);
+
+  if (!init_label_names(label_count)) {
+    printf("Failed to allocate label names\n");
+    return 1;
+  }
+
+  const char frame[]  = "+--------------------------------+-----------------+\n";
+  const char header[] = "| Test                           |       Time [ms] |\n";
+
+  printf(frame);
+  printf(header);
+  printf(frame);
+
+  test_perf("new_label_id()"       , Arch::kHost, label_count, iterations, bench_new_label_id);
+  test_perf("new_label_ids()"      , Arch::kHost, label_count, iterations, bench_new_label_ids);
+  test_perf("new_named_label_id()" , Arch::kHost, label_count, iterations, bench_new_named_label_id);
+  test_perf("label_id_by_name()"   , Arch::kHost, label_count, iterations, bench_label_id_by_name);
+
+#if !defined(ASMJIT_NO_X86)
+  test_perf("X64 Forward Jumps"    , Arch::kX64, label_count, iterations, bench_x86_forward_jumps);
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+  test_perf("AArch64 Forward Jumps", Arch::kAArch64, label_count, iterations, bench_a64_forward_jumps);
+#endif // !ASMJIT_NO_AARCH64
+
+  printf(frame);
+
+  ::free(label_name_data);
+  return 0;
+}
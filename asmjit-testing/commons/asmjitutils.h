@@ -120,6 +120,7 @@ static void print_cpu_info() noexcept {
   print_hint(CpuHints::kVecFastIntMul64, "VecFastIntMul64");
   print_hint(CpuHints::kVecFastGather  , "VecFastGather"  );
   print_hint(CpuHints::kVecMaskedStore , "VecMaskedStore" );
+  print_hint(CpuHints::kVecFastScatter , "VecFastScatter" );
 
   printf("\n");
 }
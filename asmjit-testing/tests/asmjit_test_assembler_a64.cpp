@@ -4037,6 +4037,107 @@ static void ASMJIT_NOINLINE test_aarch64_assembler_extra(AssemblerTester<a64::As
   TEST_INSTRUCTION("C167074F", movi(v1.d2(), 0xFE000000FE000000));
 }
 
+static void ASMJIT_NOINLINE test_aarch64_assembler_sve(AssemblerTester<a64::Assembler>& tester) noexcept {
+  using namespace a64;
+
+  TEST_INSTRUCTION("2000A204", add(z0.s(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("40048004", add(z0.s(), p1.m(), z0.s(), z2.s()));
+  TEST_INSTRUCTION("20302204", and_(z0.d(), z1.d(), z2.d()));
+  TEST_INSTRUCTION("40049B04", bic(z0.s(), p1.m(), z0.s(), z2.s()));
+  TEST_INSTRUCTION("20008265", fadd(z0.s(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("40848265", fmul(z0.s(), p1.m(), z0.s(), z2.s()));
+  TEST_INSTRUCTION("40049404", sdiv(z0.s(), p1.m(), z0.s(), z2.s()));
+  TEST_INSTRUCTION("2030A205", tbl(z0.s(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("2060A205", zip1(z0.s(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("2004A265", fmla(z0.s(), p1.m(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("20448204", mla(z0.s(), p1.m(), z1.s(), z2.s()));
+  TEST_INSTRUCTION("40A49604", abs(z0.s(), p1.m(), z2.s()));
+  TEST_INSTRUCTION("40A48D65", fsqrt(z0.s(), p1.m(), z2.s()));
+  TEST_INSTRUCTION("40A48265", frintm(z0.s(), p1.m(), z2.s()));
+  TEST_INSTRUCTION("40A49465", scvtf(z0.s(), p1.m(), z2.s()));
+  TEST_INSTRUCTION("40A4D665", scvtf(z0.d(), p1.m(), z2.d()));
+  TEST_INSTRUCTION("40A49C65", fcvtzs(z0.s(), p1.m(), z2.s()));
+  TEST_INSTRUCTION("20907D04", asr(z0.s(), z1.s(), 3));
+  TEST_INSTRUCTION("20947D04", lsr(z0.s(), z1.s(), 3));
+  TEST_INSTRUCTION("209C6304", lsl(z0.s(), z1.s(), 3));
+  TEST_INSTRUCTION("20902804", asr(z0.b(), z1.b(), 8));
+  TEST_INSTRUCTION("209CFF04", lsl(z0.d(), z1.d(), 63));
+  TEST_INSTRUCTION("40849304", lsl(z0.s(), p1.m(), z0.s(), z2.s()));
+  TEST_INSTRUCTION("2038A005", dup(z0.s(), w1));
+  TEST_INSTRUCTION("2038E005", dup(z0.d(), x1));
+  TEST_INSTRUCTION("E03B2005", dup(z0.b(), wsp));
+  TEST_INSTRUCTION("E0DFB825", dup(z0.s(), -1));
+  TEST_INSTRUCTION("20E07825", dup(z0.h(), 256));
+  TEST_INSTRUCTION("41202105", dup(z1.b(), z2.b().at(0)));
+  TEST_INSTRUCTION("41202E05", dup(z1.h(), z2.h().at(3)));
+  TEST_INSTRUCTION("4120FC05", dup(z1.s(), z2.s().at(15)));
+  TEST_INSTRUCTION("4120F805", dup(z1.d(), z2.d().at(7)));
+  TEST_INSTRUCTION("41207005", dup(z1, z2.at(1)));
+  TEST_INSTRUCTION("83203005", dup(z3, z4.at(0)));
+  TEST_INSTRUCTION("E11F9205", cpy(z1.s(), p2.z(), -1));
+  TEST_INSTRUCTION("E14FDF05", cpy(z1.d(), p15.m(), 127));
+  TEST_INSTRUCTION("E33F5105", cpy(z3.h(), p1.z(), -256));
+  TEST_INSTRUCTION("E35F1105", cpy(z3.b(), p1.m(), 255));
+  TEST_INSTRUCTION("40A48324", cmpeq(p0.s(), p1.z(), z2.s(), z3.s()));
+  TEST_INSTRUCTION("50048324", cmphi(p0.s(), p1.z(), z2.s(), z3.s()));
+  TEST_INSTRUCTION("50448365", fcmgt(p0.s(), p1.z(), z2.s(), z3.s()));
+  TEST_INSTRUCTION("40E4A305", sel(z0.s(), p9, z2.s(), z3.s()));
+  TEST_INSTRUCTION("40248104", uaddv(d0, p1, z2.s()));
+  TEST_INSTRUCTION("40248804", smaxv(s0, p1, z2.s()));
+  TEST_INSTRUCTION("40248065", faddv(s0, p1, z2.s()));
+  TEST_INSTRUCTION("E0E39825", ptrue(p0.s()));
+  TEST_INSTRUCTION("80E09825", ptrue(p0.s(), 4));
+  TEST_INSTRUCTION("E0E31925", ptrues(p0.b()));
+  TEST_INSTRUCTION("03E41825", pfalse(p3.b()));
+  TEST_INSTRUCTION("03F01925", rdffr(p3.b()));
+  TEST_INSTRUCTION("00902C25", setffr());
+  TEST_INSTRUCTION("201CA225", whilelo(p0.s(), x1, x2));
+  TEST_INSTRUCTION("200C2225", whilelo(p0.b(), w1, w2));
+  TEST_INSTRUCTION("2014A225", whilelt(p0.s(), x1, x2));
+  TEST_INSTRUCTION("2010A225", whilege(p0.s(), x1, x2));
+  TEST_INSTRUCTION("E0E3A004", cntw(x0));
+  TEST_INSTRUCTION("00E1A204", cntw(x0, 8, 3));
+  TEST_INSTRUCTION("E0E3B004", incw(x0));
+  TEST_INSTRUCTION("E0E7B104", decw(x0, 31, 2));
+  TEST_INSTRUCTION("40502104", addvl(x0, x1, 2));
+  TEST_INSTRUCTION("FF573F04", addvl(sp, sp, -1));
+  TEST_INSTRUCTION("60506104", addpl(x0, x1, 3));
+  TEST_INSTRUCTION("2050BF04", rdvl(x0, 1));
+  TEST_INSTRUCTION("40382104", eor3(z0.d(), z0.d(), z1.d(), z2.d()));
+  TEST_INSTRUCTION("403CE104", nbsl(z0.d(), z0.d(), z1.d(), z2.d()));
+  TEST_INSTRUCTION("2040A204", index(z0.s(), 1, 2));
+  TEST_INSTRUCTION("204CA204", index(z0.s(), w1, w2));
+  TEST_INSTRUCTION("E04BA204", index(z0.s(), -1, w2));
+  TEST_INSTRUCTION("2044A304", index(z0.s(), w1, 3));
+  TEST_INSTRUCTION("204CE204", index(z0.d(), x1, x2));
+  TEST_INSTRUCTION("00A000A4", ld1b(z0.b(), p0.z(), ptr(x0)));
+  TEST_INSTRUCTION("00A040A5", ld1w(z0.s(), p0.z(), ptr(x0)));
+  TEST_INSTRUCTION("00A041A5", ld1w(z0.s(), p0.z(), ptr(x0, 1)));
+  TEST_INSTRUCTION("00A048A5", ld1w(z0.s(), p0.z(), ptr(x0, -8)));
+  TEST_INSTRUCTION("004041A5", ld1w(z0.s(), p0.z(), ptr(x0, x1, lsl(2))));
+  TEST_INSTRUCTION("006041A5", ldff1w(z0.s(), p0.z(), ptr(x0, x1, lsl(2))));
+  TEST_INSTRUCTION("00605FA5", ldff1w(z0.s(), p0.z(), ptr(x0)));
+  TEST_INSTRUCTION("00E040E5", st1w(z0.s(), p0, ptr(x0)));
+  TEST_INSTRUCTION("004041E5", st1w(z0.s(), p0, ptr(x0, x1, lsl(2))));
+  TEST_INSTRUCTION("00402185", ld1w(z0.s(), p0.z(), ptr(x0, z1.s(), uxtw(2))));
+  TEST_INSTRUCTION("00406185", ld1w(z0.s(), p0.z(), ptr(x0, z1.s(), sxtw(2))));
+  TEST_INSTRUCTION("00C0E1C5", ld1d(z0.d(), p0.z(), ptr(x0, z1.d(), lsl(3))));
+  TEST_INSTRUCTION("00C0C1C5", ld1d(z0.d(), p0.z(), ptr(x0, z1.d())));
+  TEST_INSTRUCTION("0040A1C5", ld1d(z0.d(), p0.z(), ptr(x0, z1.d(), uxtw(3))));
+  TEST_INSTRUCTION("00E0E1C5", ldff1d(z0.d(), p0.z(), ptr(x0, z1.d(), lsl(3))));
+  TEST_INSTRUCTION("008061E5", st1w(z0.s(), p0, ptr(x0, z1.s(), uxtw(2))));
+  TEST_INSTRUCTION("00C041E5", st1w(z0.s(), p0, ptr(x0, z1.s(), sxtw(0))));
+  TEST_INSTRUCTION("00A0A1E5", st1d(z0.d(), p0, ptr(x0, z1.d(), lsl(3))));
+  TEST_INSTRUCTION("00C0A1E5", st1d(z0.d(), p0, ptr(x0, z1.d(), sxtw(3))));
+  TEST_INSTRUCTION("41408085", ldr(z1, ptr(x2)));
+  TEST_INSTRUCTION("E143A085", ldr(z1, ptr(sp, -256)));
+  TEST_INSTRUCTION("7F5C9F85", ldr(z31, ptr(x3, 255)));
+  TEST_INSTRUCTION("415C80E5", str(z1, ptr(x2, 7)));
+  TEST_INSTRUCTION("FE5FBFE5", str(z30, ptr(sp, -1)));
+  TEST_INSTRUCTION("410C8085", ldr(p1, ptr(x2, 3)));
+  TEST_INSTRUCTION("EF0FBFE5", str(p15, ptr(sp, -5)));
+}
+
 bool test_aarch64_assembler(const TestSettings& settings) noexcept {
   using namespace a64;
 
@@ -4046,6 +4147,7 @@ bool test_aarch64_assembler(const TestSettings& settings) noexcept {
   test_aarch64_assembler_base(tester);
   test_aarch64_assembler_rel(tester);
   test_aarch64_assembler_simd(tester);
+  test_aarch64_assembler_sve(tester);
   test_aarch64_assembler_extra(tester);
 
   tester.print_summary();
@@ -14,6 +14,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if ASMJIT_ARCH_ARM == 64 && defined(__linux__)
+  #include <sys/prctl.h>
+#endif
+
 using namespace asmjit;
 
 // a64::Compiler - A64TestCase
@@ -670,6 +674,97 @@ public:
   }
 };
 
+// a64::Compiler - A64Test_SveSpill
+// ================================
+
+// Returns the SVE vector length of the host in bytes or zero if it's unknown or SVE is not available.
+static uint32_t a64_host_sve_vector_length() {
+#if ASMJIT_ARCH_ARM == 64 && defined(__linux__)
+  if (CpuInfo::host().features().arm().has_sve()) {
+    int vl = prctl(51 /* PR_SVE_GET_VL */);
+    if (vl > 0)
+      return uint32_t(vl) & 0xFFFFu;
+  }
+#endif
+  return 0;
+}
+
+class A64Test_SveSpill : public A64TestCase {
+public:
+  uint32_t _reg_count;
+
+  A64Test_SveSpill(uint32_t n)
+    : A64TestCase(),
+      _reg_count(n) {
+    _name.assign_format("SveSpill {NumRegs=%u}", n);
+  }
+
+  static void add(TestApp& app) {
+    app.add(new A64Test_SveSpill(8));
+    app.add(new A64Test_SveSpill(40));
+  }
+
+  void compile(a64::Compiler& cc) override {
+    FuncNode* func_node = cc.add_func(FuncSignature::build<void, uint32_t*, const uint32_t*>());
+
+    a64::Gp dst = cc.new_gp_ptr("dst");
+    a64::Gp src = cc.new_gp_ptr("src");
+
+    func_node->set_arg(0, dst);
+    func_node->set_arg(1, src);
+
+    // Scalable registers of 256-bit vectors - the test only runs on hardware having a vector length of 32 bytes.
+    a64::Vec* regs = static_cast<a64::Vec*>(malloc(_reg_count * sizeof(a64::Vec)));
+
+    for (uint32_t i = 0; i < _reg_count; i++) {
+      regs[i] = cc.new_reg<a64::Vec>(TypeId::kInt32x8, "z%u", i);
+      cc.dup(regs[i].s(), i + 1);
+    }
+
+    a64::Vec acc = cc.new_reg<a64::Vec>(TypeId::kInt32x8, "acc");
+    cc.ldr(acc, a64::ptr(src));
+
+    for (uint32_t i = 0; i < _reg_count; i++) {
+      cc.add(acc.s(), acc.s(), regs[i].s());
+    }
+
+    cc.str(acc, a64::ptr(dst));
+    cc.end_func();
+
+    free(regs);
+  }
+
+  bool run(void* _func, String& result, String& expect) override {
+    using Func = void (*)(uint32_t*, const uint32_t*);
+    Func func = ptr_as_func<Func>(_func);
+
+    if (a64_host_sve_vector_length() != 32u) {
+      result.assign("skipped");
+      expect.assign("skipped");
+      return true;
+    }
+
+    uint32_t dst[8];
+    uint32_t src[8] = { 0, 1, 2, 3, 100, 1000, 0xFFFFFFFFu, 7 };
+    uint32_t sum = (_reg_count * (_reg_count + 1)) / 2;
+
+    func(dst, src);
+
+    result.assign("ret={");
+    expect.assign("ret={");
+
+    for (uint32_t i = 0; i < 8; i++) {
+      result.append_format("%s%u", i ? ", " : "", dst[i]);
+      expect.append_format("%s%u", i ? ", " : "", src[i] + sum);
+    }
+
+    result.append("}");
+    expect.append("}");
+
+    return result == expect;
+  }
+};
+
 // a64::Compiler - Export
 // ======================
 
@@ -683,6 +778,7 @@ void compiler_add_a64_tests(TestApp& app) {
   app.add_t<A64Test_Invoke2>();
   app.add_t<A64Test_Invoke3>();
   app.add_t<A64Test_JumpTable>();
+  app.add_t<A64Test_SveSpill>();
 }
 
 #endif // !ASMJIT_NO_COMPILER && !ASMJIT_NO_AARCH64
@@ -19,6 +19,10 @@
 
 #include <asmjit-testing/commons/asmjitutils.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace asmjit;
 
 static void print_app_info() noexcept {
@@ -296,6 +300,592 @@ static uint32_t test_func(JitRuntime& rt, EmitterType emitter_type) noexcept {
   return out[0] == 5 && out[1] == 8 && out[2] == 4 && out[3] == 9;
 }
 
+// Parallel Serialization
+// ----------------------
+
+#if ASMJIT_ARCH_X86 != 0 && !defined(ASMJIT_NO_COMPILER)
+// A task executor that uses a fixed number of threads, which pick up tasks until all are processed.
+class ThreadTaskExecutor : public TaskExecutor {
+public:
+  size_t _thread_count;
+
+  explicit ThreadTaskExecutor(size_t thread_count) noexcept
+    : _thread_count(thread_count) {}
+
+  size_t concurrency() const noexcept override { return _thread_count; }
+
+  void run(TaskFunc func, void* data, size_t count) noexcept override {
+    std::atomic<size_t> next_index {0};
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < _thread_count; i++) {
+      threads.emplace_back([&]() {
+        size_t index;
+        while ((index = next_index.fetch_add(1)) < count) {
+          func(data, index);
+        }
+      });
+    }
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+using ChainFunc = int (*)(int x);
+
+// Generates `func_count` functions, where each function adds a constant from the global constant pool to its
+// argument and calls the next function, so calls and constant pool references cross fragment boundaries.
+static Error generate_chain(x86::Compiler& cc, size_t func_count) noexcept {
+  FuncSignature signature = FuncSignature::build<int, int>();
+  std::vector<FuncNode*> funcs;
+
+  for (size_t i = 0; i < func_count; i++) {
+    funcs.push_back(cc.new_func(signature));
+  }
+
+  for (size_t i = 0; i < func_count; i++) {
+    x86::Gp x = cc.new_gp32("x");
+    x86::Gp tmp = cc.new_gp32("tmp");
+
+    cc.add_func(funcs[i]);
+    funcs[i]->set_arg(0, x);
+
+    cc.mov(tmp, cc.new_int32_const(ConstPoolScope::kGlobal, int32_t(i + 1)));
+    cc.add(x, tmp);
+
+    if (i + 1 < func_count) {
+      InvokeNode* invoke_node;
+      cc.invoke(Out(invoke_node), funcs[i + 1]->label(), signature);
+      invoke_node->set_arg(0, x);
+      invoke_node->set_ret(0, x);
+    }
+
+    cc.ret(x);
+    cc.end_func();
+  }
+
+  return Error::kOk;
+}
+
+static uint32_t test_parallel(JitRuntime& rt) noexcept {
+  constexpr size_t kFuncCount = 64;
+  constexpr int kExpected = 100 + int(kFuncCount * (kFuncCount + 1) / 2);
+
+  printf("Using x86::Compiler::finalize_parallel():\n");
+
+  CodeHolder code;
+  code.init(rt.environment(), rt.cpu_features());
+
+  x86::Compiler cc(&code);
+  generate_chain(cc, kFuncCount);
+
+  ThreadTaskExecutor executor(4);
+  Error err = cc.finalize_parallel(executor);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to generate functions in parallel: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  ChainFunc fn;
+  err = rt.add(&fn, &code);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::add() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  int result = fn(100);
+  printf("Result = %d (expected %d)\n\n", result, kExpected);
+
+  rt.release(fn);
+  return result == kExpected;
+}
+
+// Instruction Scheduling
+// ----------------------
+
+using SchedFunc = int (*)(int a, int b, int c);
+
+static int sched_func_reference(int a, int b, int c) noexcept {
+  return (a * 3 + 1) + (b * 7 - c) + ((c ^ 0x55) + a);
+}
+
+// Uses three independent dependency chains, which the scheduler is expected to interleave.
+static void generate_sched_func(x86::Compiler& cc) noexcept {
+  x86::Gp a = cc.new_gp32("a");
+  x86::Gp b = cc.new_gp32("b");
+  x86::Gp c = cc.new_gp32("c");
+  x86::Gp t0 = cc.new_gp32("t0");
+  x86::Gp t1 = cc.new_gp32("t1");
+  x86::Gp t2 = cc.new_gp32("t2");
+
+  FuncNode* func_node = cc.add_func(FuncSignature::build<int, int, int, int>());
+  func_node->set_arg(0, a);
+  func_node->set_arg(1, b);
+  func_node->set_arg(2, c);
+
+  cc.imul(t0, a, 3);
+  cc.add(t0, 1);
+  cc.imul(t1, b, 7);
+  cc.sub(t1, c);
+  cc.mov(t2, c);
+  cc.xor_(t2, 0x55);
+  cc.add(t2, a);
+  cc.add(t0, t1);
+  cc.add(t0, t2);
+
+  cc.ret(t0);
+  cc.end_func();
+}
+
+static uint32_t test_sched(JitRuntime& rt, bool pre_ra) noexcept {
+  printf("Using x86::Compiler with %s SchedPass:\n", pre_ra ? "pre-RA" : "post-RA");
+
+  CodeHolder code;
+  code.init(rt.environment(), rt.cpu_features());
+
+  x86::Compiler cc(&code);
+  Error err = pre_ra ? cc.insert_pass<SchedPass>(0, &SchedModel::by_id(SchedModelId::kX86_Zen4))
+                     : cc.add_pass<SchedPass>(&SchedModel::by_id(SchedModelId::kX86_Skylake));
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to add SchedPass: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  generate_sched_func(cc);
+  err = cc.finalize();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to finalize: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  const SchedPass* pass = static_cast<const SchedPass*>(cc.pass_by_name("SchedPass"));
+  printf("Moved instructions: %zu\n", pass->moved_count());
+
+  // The kernel consists of independent dependency chains, so the scheduler must interleave them.
+  if (pass->moved_count() == 0u) {
+    printf("** FAILURE: SchedPass didn't move any instruction of the dependency-chain kernel **\n");
+    return 0;
+  }
+
+  SchedFunc fn;
+  err = rt.add(&fn, &code);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::add() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  uint32_t passed = 1;
+  static const int inputs[][3] = { { 0, 0, 0 }, { 1, 2, 3 }, { -7, 100, 0x1234 }, { 0x7FFF, -1, -100 } };
+
+  for (const auto& in : inputs) {
+    int result = fn(in[0], in[1], in[2]);
+    int expected = sched_func_reference(in[0], in[1], in[2]);
+
+    if (result != expected) {
+      printf("Result = %d (expected %d)\n", result, expected);
+      passed = 0;
+    }
+  }
+
+  printf("Result = %s\n\n", passed ? "OK" : "FAILED");
+
+  rt.release(fn);
+  return passed;
+}
+
+// Peephole Optimization
+// ---------------------
+
+static uint32_t test_peephole(JitRuntime& rt) noexcept {
+  printf("Using x86::Compiler with PeepholePass:\n");
+
+  CodeHolder code;
+  code.init(rt.environment(), rt.cpu_features());
+
+  x86::Compiler cc(&code);
+  Error err = cc.add_pass<PeepholePass>();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to add PeepholePass: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  generate_sched_func(cc);
+  err = cc.finalize();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to finalize: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  const PeepholePass* pass = static_cast<const PeepholePass*>(cc.pass_by_name("PeepholePass"));
+  printf("Removed instructions: %zu, rewritten instructions: %zu\n", pass->removed_count(), pass->rewritten_count());
+
+  SchedFunc fn;
+  err = rt.add(&fn, &code);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::add() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  int result = fn(1, 2, 3);
+  int expected = sched_func_reference(1, 2, 3);
+  printf("Result = %d (expected %d)\n\n", result, expected);
+
+  rt.release(fn);
+  return result == expected;
+}
+
+// Dead Code Elimination
+// ---------------------
+
+using DeadCodeFunc = int (*)(int a, int b);
+
+static int dead_code_func_reference(int a, int b) noexcept {
+  return a * 3 + b + int(a >= 0);
+}
+
+// Computes `a * 3 + b + (a >= 0)`, but also contains a dependency chain that ends with a store to a stack area that
+// is never read, and a value computed before a branch that is only modified after it - all of that code is dead.
+static void generate_dead_code_func(x86::Compiler& cc) noexcept {
+  x86::Gp a = cc.new_gp32("a");
+  x86::Gp b = cc.new_gp32("b");
+  x86::Gp r = cc.new_gp32("r");
+  x86::Gp t0 = cc.new_gp32("t0");
+  x86::Gp t1 = cc.new_gp32("t1");
+
+  FuncNode* func_node = cc.add_func(FuncSignature::build<int, int, int>());
+  func_node->set_arg(0, a);
+  func_node->set_arg(1, b);
+
+  x86::Mem stack = cc.new_stack(16, 4);
+  Label L_skip = cc.new_label();
+
+  cc.imul(r, a, 3);
+  cc.mov(t0, a);
+  cc.shl(t0, 4);
+  cc.or_(t0, b);
+  cc.mov(stack, t0);
+  cc.mov(t1, b);
+  cc.add(r, b);
+  cc.cmp(a, 0);
+  cc.jl(L_skip);
+
+  cc.add(t1, 1);
+  cc.add(r, 1);
+
+  cc.bind(L_skip);
+  cc.ret(r);
+  cc.end_func();
+}
+
+static uint32_t test_dead_code(JitRuntime& rt) noexcept {
+  printf("Using x86::Compiler with dead code:\n");
+
+  CodeHolder code;
+  code.init(rt.environment(), rt.cpu_features());
+
+#ifndef ASMJIT_NO_LOGGING
+  StringLogger logger;
+  code.set_logger(&logger);
+#endif
+
+  x86::Compiler cc(&code);
+  cc.add_compiler_options(CompilerOptions::kRemoveDeadCode);
+  cc.add_diagnostic_options(DiagnosticOptions::kRADebugDeadCode);
+
+  generate_dead_code_func(cc);
+  Error err = cc.finalize();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to finalize: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  uint32_t passed = 1;
+
+#ifndef ASMJIT_NO_LOGGING
+  const char* expected_log = "[remove_dead_code - removed 6 instructions and 1 stack slots]";
+  if (!strstr(logger.data(), expected_log)) {
+    printf("Log doesn't contain '%s':\n%s\n", expected_log, logger.data());
+    passed = 0;
+  }
+#endif
+
+  DeadCodeFunc fn;
+  err = rt.add(&fn, &code);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::add() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  static const int inputs[][2] = { { 0, 0 }, { 1, 2 }, { -7, 100 }, { 0x1234, -1 } };
+
+  for (const auto& in : inputs) {
+    int result = fn(in[0], in[1]);
+    int expected = dead_code_func_reference(in[0], in[1]);
+
+    if (result != expected) {
+      printf("Result = %d (expected %d)\n", result, expected);
+      passed = 0;
+    }
+  }
+
+  printf("Result = %s\n\n", passed ? "OK" : "FAILED");
+
+  rt.release(fn);
+  return passed;
+}
+
+using KeptCodeFunc = int (*)(const int* p, int d);
+
+// Emits loads from memory addressed by a virtual and a physical base register and an integer division, all having
+// unused results - none of them can be removed as the load could fault and the division could trap.
+static void generate_kept_code_func(x86::Compiler& cc, BaseNode** kept_nodes) noexcept {
+  x86::Gp p = cc.new_gp_ptr("p");
+  x86::Gp d = cc.new_gp32("d");
+  x86::Gp v0 = cc.new_gp32("v0");
+  x86::Gp v1 = cc.new_gp32("v1");
+  x86::Gp hi = cc.new_gp32("hi");
+  x86::Gp lo = cc.new_gp32("lo");
+  x86::Gp r = cc.new_gp32("r");
+
+  FuncNode* func_node = cc.add_func(FuncSignature::build<int, const int*, int>());
+  func_node->set_arg(0, p);
+  func_node->set_arg(1, d);
+
+  cc.mov(v0, x86::dword_ptr(p));
+  kept_nodes[0] = cc.cursor();
+
+  cc.mov(v1, x86::dword_ptr(cc.zsp()));
+  kept_nodes[1] = cc.cursor();
+
+  cc.mov(lo, 100);
+  cc.cdq(hi, lo);
+  cc.idiv(hi, lo, d);
+  kept_nodes[2] = cc.cursor();
+
+  cc.mov(r, 7);
+  cc.ret(r);
+  cc.end_func();
+}
+
+static uint32_t test_dead_code_kept(JitRuntime& rt) noexcept {
+  printf("Using x86::Compiler with unused loads and divisions:\n");
+
+  CodeHolder code;
+  code.init(rt.environment(), rt.cpu_features());
+
+  x86::Compiler cc(&code);
+  cc.add_compiler_options(CompilerOptions::kRemoveDeadCode);
+
+  BaseNode* kept_nodes[3] {};
+  generate_kept_code_func(cc, kept_nodes);
+  Error err = cc.finalize();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to finalize: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  uint32_t passed = 1;
+
+  for (BaseNode* kept_node : kept_nodes) {
+    BaseNode* node = cc.first_node();
+    while (node && node != kept_node) {
+      node = node->next();
+    }
+
+    if (!node) {
+      printf("An instruction that must be kept was removed\n");
+      passed = 0;
+    }
+  }
+
+  KeptCodeFunc fn;
+  err = rt.add(&fn, &code);
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::add() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  int value = 42;
+  int result = fn(&value, 3);
+
+  if (result != 7) {
+    printf("Result = %d (expected 7)\n", result);
+    passed = 0;
+  }
+
+  printf("Result = %s\n\n", passed ? "OK" : "FAILED");
+
+  rt.release(fn);
+  return passed;
+}
+
+// Code Compaction
+// ---------------
+
+using RelocatableFunc = int (*)(int x);
+
+static int relocatable_func_callee(int x) noexcept {
+  return x * 3;
+}
+
+// Calls an external function and adds a constant, so the code has both position dependent (call) and position
+// independent (constant pool) references. The function is padded to occupy roughly 1kB of memory.
+static void generate_relocatable_func(x86::Compiler& cc, int value) noexcept {
+  static const uint8_t padding[1000] {};
+
+  FuncSignature signature = FuncSignature::build<int, int>();
+  FuncNode* func_node = cc.add_func(signature);
+
+  x86::Gp x = cc.new_gp32("x");
+  x86::Gp r = cc.new_gp32("r");
+  func_node->set_arg(0, x);
+
+  InvokeNode* invoke_node;
+  cc.invoke(Out(invoke_node), imm((void*)relocatable_func_callee), signature);
+  invoke_node->set_arg(0, x);
+  invoke_node->set_ret(0, r);
+
+  cc.add(r, cc.new_int32_const(ConstPoolScope::kLocal, value));
+  cc.ret(r);
+  cc.end_func();
+
+  cc.embed(padding, sizeof(padding));
+}
+
+static uint32_t test_compaction() noexcept {
+  constexpr size_t kFuncCount = 256;
+
+  printf("Using JitRuntime::add_relocatable() and JitRuntime::compact():\n");
+
+  // Use a separate runtime so the statistics only reflect this test.
+  JitRuntime rt;
+  RelocatableFunc funcs[kFuncCount] {};
+
+  for (size_t i = 0; i < kFuncCount; i++) {
+    CodeHolder code;
+    code.init(rt.environment(), rt.cpu_features());
+
+    x86::Compiler cc(&code);
+    generate_relocatable_func(cc, int(i));
+
+    Error err = cc.finalize();
+    if (err == Error::kOk) {
+      err = rt.add_relocatable(&funcs[i], &code);
+    }
+
+    if (err != Error::kOk) {
+      printf("** FAILURE: JitRuntime::add_relocatable() failed: %s **\n", DebugUtils::error_as_string(err));
+      return 0;
+    }
+  }
+
+  // Release 3 of 4 functions, which leaves all blocks sparsely used.
+  for (size_t i = 0; i < kFuncCount; i++) {
+    if (i % 4u != 0u) {
+      rt.release(funcs[i]);
+      funcs[i] = nullptr;
+    }
+  }
+
+  JitAllocator::Statistics before = rt.allocator().statistics();
+  Error err = rt.compact();
+  JitAllocator::Statistics after = rt.allocator().statistics();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: JitRuntime::compact() failed: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  printf("Blocks = %zu -> %zu, Fragmented = %zu -> %zu [Bytes], Relocated = %zu [Bytes]\n",
+    before.block_count(), after.block_count(),
+    before.fragmented_size(), after.fragmented_size(),
+    after.relocated_size());
+
+  uint32_t passed = after.block_count() < before.block_count() && after.relocated_size() != 0u;
+
+  for (size_t i = 0; i < kFuncCount; i += 4) {
+    int result = funcs[i](int(i));
+    int expected = relocatable_func_callee(int(i)) + int(i);
+
+    if (result != expected) {
+      printf("Result = %d (expected %d)\n", result, expected);
+      passed = 0;
+    }
+
+    rt.release(funcs[i]);
+  }
+
+  printf("Result = %s\n\n", passed ? "OK" : "FAILED");
+  return passed;
+}
+
+// Memory Statistics
+// -----------------
+
+static uint32_t test_memory_stats() noexcept {
+  printf("Using x86::Compiler::memory_stats():\n");
+
+  Environment env(Arch::kX64);
+  CodeHolder code;
+  code.init(env);
+
+  x86::Compiler cc(&code);
+  cc.add_pass<SchedPass>();
+  generate_sched_func(cc);
+  cc.new_dword_const(ConstPoolScope::kGlobal, 0x12345678u);
+
+  BuilderMemoryStats before = cc.memory_stats();
+  Error err = cc.finalize();
+
+  if (err != Error::kOk) {
+    printf("** FAILURE: Failed to finalize: %s **\n", DebugUtils::error_as_string(err));
+    return 0;
+  }
+
+  BuilderMemoryStats after = cc.memory_stats();
+
+  static const char* const category_names[] = { "CodeHolder", "Builder", "ConstPools", "VirtRegs", "Passes", "RAFunction" };
+  size_t sum = 0;
+
+  for (uint32_t i = 0; i < BuilderMemoryStats::kCategoryCount; i++) {
+    const ArenaStatistics& stats = after.category(BuilderMemoryCategory(i));
+    printf("  %-11s: Used=%zu Reserved=%zu [Bytes]\n", category_names[i], stats.used_size(), stats.reserved_size());
+    if (i < uint32_t(BuilderMemoryCategory::kPasses)) {
+      sum += stats.used_size();
+    }
+  }
+
+  // Passes and register allocation share the same arena, thus only the greater peak contributes to the total.
+  sum += Support::max(after.category(BuilderMemoryCategory::kPasses).used_size(),
+                      after.category(BuilderMemoryCategory::kRAFunction).used_size());
+  printf("  Peak       : Used=%zu Reserved=%zu [Bytes]\n", after.peak_used_size(), after.peak_reserved_size());
+
+  uint32_t passed = uint32_t(before.category(BuilderMemoryCategory::kPasses).used_size() == 0u &&
+                             before.category(BuilderMemoryCategory::kRAFunction).used_size() == 0u);
+  for (uint32_t i = 0; i < BuilderMemoryStats::kCategoryCount; i++) {
+    passed &= uint32_t(after.category(BuilderMemoryCategory(i)).used_size() != 0u);
+  }
+  passed &= uint32_t(after.peak_used_size() == sum);
+
+  printf("Result = %s\n\n", passed ? "OK" : "FAILED");
+  return passed;
+}
+#endif // ASMJIT_ARCH_X86 != 0 && !ASMJIT_NO_COMPILER
+
 int main() {
   print_app_info();
 
@@ -312,6 +902,17 @@ int main() {
   failed_count += !test_func(rt, EmitterType::kCompiler);
 #endif
 
+#if ASMJIT_ARCH_X86 != 0 && !defined(ASMJIT_NO_COMPILER)
+  failed_count += !test_parallel(rt);
+  failed_count += !test_sched(rt, true);
+  failed_count += !test_sched(rt, false);
+  failed_count += !test_peephole(rt);
+  failed_count += !test_dead_code(rt);
+  failed_count += !test_dead_code_kept(rt);
+  failed_count += !test_compaction();
+  failed_count += !test_memory_stats();
+#endif
+
   if (!failed_count)
     printf("** SUCCESS **\n");
   else
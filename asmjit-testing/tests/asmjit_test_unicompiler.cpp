@@ -122,6 +122,11 @@ typedef void (*TestVVFunc)(void* dst, const void* src);
 typedef void (*TestVVVFunc)(void* dst, const void* src1, const void* src2);
 typedef void (*TestVVVVFunc)(void* dst, const void* src1, const void* src2, const void* src3);
 
+typedef void (*TestGatherFunc)(void* dst, const void* base, const void* indexes);
+typedef void (*TestScatterFunc)(void* base, const void* src, const void* indexes);
+typedef void (*TestReduceFunc)(void* dst, const void* src);
+typedef void (*TestLoopFunc)(void* dst, const void* src, size_t count);
+
 // ujit::UniCompiler - Tests - JIT Context Error Handler
 // =====================================================
 
@@ -153,6 +158,15 @@ public:
   CodeHolder code;
   BackendCompiler cc;
 
+#if defined(ASMJIT_UJIT_AARCH64)
+  //! SVE vector length passed to UniCompiler if non-zero, makes it possible to compile SVE code without SVE hardware.
+  uint32_t sve_vector_length {};
+#endif // ASMJIT_UJIT_AARCH64
+
+  //! Functions are only compiled and finalized (which validates all instructions), but not added to the runtime -
+  //! `finish()` returns null in this case.
+  bool compile_only {};
+
   void prepare() noexcept {
     code.reset();
     code.init(rt.environment());
@@ -169,11 +183,22 @@ public:
     cc.add_diagnostic_options(DiagnosticOptions::kValidateIntermediate);
   }
 
+  void init_vec_width(UniCompiler& uc, VecWidth vw) noexcept {
+#if defined(ASMJIT_UJIT_AARCH64)
+    if (sve_vector_length) {
+      uc.set_sve_vector_length(sve_vector_length);
+    }
+#endif // ASMJIT_UJIT_AARCH64
+    uc.init_vec_width(vw);
+  }
+
   template<typename Fn>
   Fn finish() {
-    Fn fn;
+    Fn fn = nullptr;
     EXPECT_EQ(cc.finalize(), Error::kOk);
-    EXPECT_EQ(rt.add(&fn, &code), Error::kOk);
+    if (!compile_only) {
+      EXPECT_EQ(rt.add(&fn, &code), Error::kOk);
+    }
     code.reset();
     return fn;
   }
@@ -192,7 +217,7 @@ static TestCondRRFunc create_func_cond_rr(JitContext& ctx, UniOpCond op, CondCod
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uint32_t, int32_t, int32_t>());
   EXPECT_NOT_NULL(node);
@@ -245,7 +270,7 @@ static TestCondRIFunc create_func_cond_ri(JitContext& ctx, UniOpCond op, CondCod
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uint32_t, int32_t>());
   EXPECT_NOT_NULL(node);
@@ -562,7 +587,7 @@ static TestMFunc create_func_m(JitContext& ctx, UniOpM op) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*>());
   EXPECT_NOT_NULL(node);
@@ -628,7 +653,7 @@ static TestRMFunc create_func_rm(JitContext& ctx, UniOpRM op) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uintptr_t, uintptr_t, void*>());
   EXPECT_NOT_NULL(node);
@@ -743,7 +768,7 @@ static TestMRFunc create_func_mr(JitContext& ctx, UniOpMR op) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, uintptr_t>());
   EXPECT_NOT_NULL(node);
@@ -856,7 +881,7 @@ static TestRRFunc create_func_rr(JitContext& ctx, UniOpRR op) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uint32_t, uint32_t>());
   EXPECT_NOT_NULL(node);
@@ -935,7 +960,7 @@ static TestRRRFunc create_func_rrr(JitContext& ctx, UniOpRRR op) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uint32_t, uint32_t, uint32_t>());
   EXPECT_NOT_NULL(node);
@@ -958,7 +983,7 @@ static TestRRIFunc create_func_rri(JitContext& ctx, UniOpRRR op, Imm bImm) {
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(VecWidth::k128);
+  ctx.init_vec_width(uc, VecWidth::k128);
 
   FuncNode* node = uc.add_func(FuncSignature::build<uint32_t, uint32_t>());
   EXPECT_NOT_NULL(node);
@@ -1165,7 +1190,7 @@ static TestVVFunc create_func_vv(JitContext& ctx, VecWidth vw, UniOpVV op, Varia
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(vw);
+  ctx.init_vec_width(uc, vw);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*>());
   EXPECT_NOT_NULL(node);
@@ -1255,7 +1280,7 @@ static TestVVFunc create_func_vvi(JitContext& ctx, VecWidth vw, UniOpVVI op, uin
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(vw);
+  ctx.init_vec_width(uc, vw);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*>());
   EXPECT_NOT_NULL(node);
@@ -1314,7 +1339,7 @@ static TestVVVFunc create_func_vvv(JitContext& ctx, VecWidth vw, UniOpVVV op, Va
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(vw);
+  ctx.init_vec_width(uc, vw);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*>());
   EXPECT_NOT_NULL(node);
@@ -1394,7 +1419,7 @@ static TestVVVFunc create_func_vvvi(JitContext& ctx, VecWidth vw, UniOpVVVI op,
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(vw);
+  ctx.init_vec_width(uc, vw);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*>());
   EXPECT_NOT_NULL(node);
@@ -1479,7 +1504,7 @@ static TestVVVVFunc create_func_vvvv(JitContext& ctx, VecWidth vw, UniOpVVVV op,
   ctx.prepare();
 
   UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
-  uc.init_vec_width(vw);
+  ctx.init_vec_width(uc, vw);
 
   FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*, const void*>());
   EXPECT_NOT_NULL(node);
@@ -1554,7 +1579,9 @@ enum class VecElementType : uint8_t {
   kUInt32,
   kUInt64,
   kFloat32,
-  kFloat64
+  kFloat64,
+  kFloat16,
+  kBFloat16
 };
 
 struct VecOpInfo {
@@ -1751,9 +1778,30 @@ static bool float_eq(const T& a, const T& b) noexcept {
   return a == b || (std::isnan(a) && std::isnan(b));
 }
 
+static ASMJIT_INLINE_NODEBUG bool f16_is_nan(uint16_t x) noexcept { return (x & 0x7FFFu) > 0x7C00u; }
+static ASMJIT_INLINE_NODEBUG bool bf16_is_nan(uint16_t x) noexcept { return (x & 0x7FFFu) > 0x7F80u; }
+
 template<uint32_t kW>
 static bool vec_eq(const VecOverlay<kW>& a, const VecOverlay<kW>& b, VecElementType element_type) noexcept {
-  if (element_type == VecElementType::kFloat32) {
+  if (element_type == VecElementType::kFloat16 || element_type == VecElementType::kBFloat16) {
+    size_t count = kW / sizeof(uint16_t);
+    bool is_bf16 = element_type == VecElementType::kBFloat16;
+
+    for (size_t i = 0; i < count; i++) {
+      uint16_t x = a.data_u16[i];
+      uint16_t y = b.data_u16[i];
+
+      if (x != y) {
+        bool x_nan = is_bf16 ? bf16_is_nan(x) : f16_is_nan(x);
+        bool y_nan = is_bf16 ? bf16_is_nan(y) : f16_is_nan(y);
+        if (!(x_nan && y_nan)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+  else if (element_type == VecElementType::kFloat32) {
     size_t count = kW / sizeof(float);
     for (size_t i = 0; i < count; i++) {
       if (!float_eq(a.data_f32[i], b.data_f32[i])) {
@@ -1792,6 +1840,8 @@ static ASMJIT_NOINLINE String vec_stringify(const VecOverlay<kW>& vec, VecElemen
     case VecElementType::kUInt64 : { for (uint32_t i = 0; i < kW / 8; i++) s.append_format("%s%llu", i == 0 ? "" : ", ", (unsigned long long)vec.data_u64[i]); break; }
     case VecElementType::kFloat32: { for (uint32_t i = 0; i < kW / 4; i++) s.append_format("%s%.20f"  , i == 0 ? "" : ", ", double(vec.data_f32[i])); break; }
     case VecElementType::kFloat64: { for (uint32_t i = 0; i < kW / 8; i++) s.append_format("%s%.20f"  , i == 0 ? "" : ", ", double(vec.data_f64[i])); break; }
+    case VecElementType::kFloat16:
+    case VecElementType::kBFloat16:{ for (uint32_t i = 0; i < kW / 2; i++) s.append_format("%s0x%04X", i == 0 ? "" : ", ", vec.data_u16[i]); break; }
 
     default:
       ASMJIT_NOT_REACHED();
@@ -1899,6 +1949,20 @@ static const char* vec_op_name_vv(UniOpVV op) noexcept {
     case UniOpVV::kCvtRoundF32ToI32  : return "v_cvt_round_f32_to_i32";
     case UniOpVV::kCvtRoundF64ToI32Lo: return "v_cvt_round_f64_to_i32_lo";
     case UniOpVV::kCvtRoundF64ToI32Hi: return "v_cvt_round_f64_to_i32_hi";
+    case UniOpVV::kCvtF16LoToF32     : return "v_cvt_f16_lo_to_f32";
+    case UniOpVV::kCvtF16HiToF32     : return "v_cvt_f16_hi_to_f32";
+    case UniOpVV::kCvtF32ToF16Lo     : return "v_cvt_f32_to_f16_lo";
+    case UniOpVV::kCvtBF16LoToF32    : return "v_cvt_bf16_lo_to_f32";
+    case UniOpVV::kCvtBF16HiToF32    : return "v_cvt_bf16_hi_to_f32";
+    case UniOpVV::kCvtF32ToBF16Lo    : return "v_cvt_f32_to_bf16_lo";
+    case UniOpVV::kPopcntU8          : return "v_popcnt_u8";
+    case UniOpVV::kPopcntU16         : return "v_popcnt_u16";
+    case UniOpVV::kPopcntU32         : return "v_popcnt_u32";
+    case UniOpVV::kPopcntU64         : return "v_popcnt_u64";
+    case UniOpVV::kLzcntU32          : return "v_lzcnt_u32";
+    case UniOpVV::kLzcntU64          : return "v_lzcnt_u64";
+    case UniOpVV::kTzcntU32          : return "v_tzcnt_u32";
+    case UniOpVV::kTzcntU64          : return "v_tzcnt_u64";
   }
 
   ASMJIT_NOT_REACHED();
@@ -2001,6 +2065,20 @@ static VecOpInfo vec_op_info_vv(UniOpVV op) noexcept {
     case UniOpVV::kCvtRoundF32ToI32  : return VecOpInfo::make(VE::kInt32, VE::kFloat32);
     case UniOpVV::kCvtRoundF64ToI32Lo: return VecOpInfo::make(VE::kInt32, VE::kFloat64);
     case UniOpVV::kCvtRoundF64ToI32Hi: return VecOpInfo::make(VE::kInt32, VE::kFloat64);
+    case UniOpVV::kCvtF16LoToF32     : return VecOpInfo::make(VE::kFloat32, VE::kFloat16);
+    case UniOpVV::kCvtF16HiToF32     : return VecOpInfo::make(VE::kFloat32, VE::kFloat16);
+    case UniOpVV::kCvtF32ToF16Lo     : return VecOpInfo::make(VE::kFloat16, VE::kFloat32);
+    case UniOpVV::kCvtBF16LoToF32    : return VecOpInfo::make(VE::kFloat32, VE::kBFloat16);
+    case UniOpVV::kCvtBF16HiToF32    : return VecOpInfo::make(VE::kFloat32, VE::kBFloat16);
+    case UniOpVV::kCvtF32ToBF16Lo    : return VecOpInfo::make(VE::kBFloat16, VE::kFloat32);
+    case UniOpVV::kPopcntU8          : return VecOpInfo::make(VE::kUInt8, VE::kUInt8);
+    case UniOpVV::kPopcntU16         : return VecOpInfo::make(VE::kUInt16, VE::kUInt16);
+    case UniOpVV::kPopcntU32         : return VecOpInfo::make(VE::kUInt32, VE::kUInt32);
+    case UniOpVV::kPopcntU64         : return VecOpInfo::make(VE::kUInt64, VE::kUInt64);
+    case UniOpVV::kLzcntU32          : return VecOpInfo::make(VE::kUInt32, VE::kUInt32);
+    case UniOpVV::kLzcntU64          : return VecOpInfo::make(VE::kUInt64, VE::kUInt64);
+    case UniOpVV::kTzcntU32          : return VecOpInfo::make(VE::kUInt32, VE::kUInt32);
+    case UniOpVV::kTzcntU64          : return VecOpInfo::make(VE::kUInt64, VE::kUInt64);
   }
 
   ASMJIT_NOT_REACHED();
@@ -2307,6 +2385,14 @@ static const char* vec_op_name_vvv(UniOpVVV op) noexcept {
     case UniOpVVV::kPacksI32_I16   : return "v_packs_i32_i16";
     case UniOpVVV::kPacksI32_U16   : return "v_packs_i32_u16";
     case UniOpVVV::kSwizzlev_U8    : return "v_swizzlev_u8";
+    case UniOpVVV::kAddF16         : return "v_add_f16";
+    case UniOpVVV::kSubF16         : return "v_sub_f16";
+    case UniOpVVV::kMulF16         : return "v_mul_f16";
+    case UniOpVVV::kDivF16         : return "v_div_f16";
+    case UniOpVVV::kCompressU32    : return "v_compress_u32";
+    case UniOpVVV::kCompressU64    : return "v_compress_u64";
+    case UniOpVVV::kExpandU32      : return "v_expand_u32";
+    case UniOpVVV::kExpandU64      : return "v_expand_u64";
 
 #if defined(ASMJIT_UJIT_AARCH64)
     case UniOpVVV::kMulwLoI8       : return "v_mulw_lo_i8";
@@ -2529,6 +2615,14 @@ static VecOpInfo vec_op_info_vvv(UniOpVVV op) noexcept {
     case UniOpVVV::kPacksI32_I16   : return VecOpInfo::make(VE::kInt16, VE::kInt32, VE::kInt32);
     case UniOpVVV::kPacksI32_U16   : return VecOpInfo::make(VE::kUInt16, VE::kInt32, VE::kInt32);
     case UniOpVVV::kSwizzlev_U8    : return VecOpInfo::make(VE::kUInt8, VE::kUInt8, VE::kUInt8);
+    case UniOpVVV::kAddF16         : return VecOpInfo::make(VE::kFloat16, VE::kFloat16, VE::kFloat16);
+    case UniOpVVV::kSubF16         : return VecOpInfo::make(VE::kFloat16, VE::kFloat16, VE::kFloat16);
+    case UniOpVVV::kMulF16         : return VecOpInfo::make(VE::kFloat16, VE::kFloat16, VE::kFloat16);
+    case UniOpVVV::kDivF16         : return VecOpInfo::make(VE::kFloat16, VE::kFloat16, VE::kFloat16);
+    case UniOpVVV::kCompressU32    : return VecOpInfo::make(VE::kUInt32, VE::kUInt32, VE::kUInt32);
+    case UniOpVVV::kCompressU64    : return VecOpInfo::make(VE::kUInt64, VE::kUInt64, VE::kUInt64);
+    case UniOpVVV::kExpandU32      : return VecOpInfo::make(VE::kUInt32, VE::kUInt32, VE::kUInt32);
+    case UniOpVVV::kExpandU64      : return VecOpInfo::make(VE::kUInt64, VE::kUInt64, VE::kUInt64);
 
 #if defined(ASMJIT_UJIT_AARCH64)
     case UniOpVVV::kMulwLoI8       : return VecOpInfo::make(VE::kInt16, VE::kInt8, VE::kInt8);
@@ -2632,6 +2726,10 @@ static const char* vec_op_name_vvvv(UniOpVVVV op) noexcept {
     case UniOpVVVV::kNMSubF64S: return "v_nmsub_f64s";
     case UniOpVVVV::kNMSubF32 : return "v_nmsub_f32";
     case UniOpVVVV::kNMSubF64 : return "v_nmsub_f64";
+    case UniOpVVVV::kDotI8_I32: return "v_dot_i8_i32";
+    case UniOpVVVV::kDotU8_I32: return "v_dot_u8_i32";
+    case UniOpVVVV::kDotU8I8_I32: return "v_dot_u8i8_i32";
+    case UniOpVVVV::kDotI16_I32: return "v_dot_i16_i32";
   }
 
   ASMJIT_NOT_REACHED();
@@ -2660,6 +2758,10 @@ static VecOpInfo vec_op_info_vvvv(UniOpVVVV op) noexcept {
     case UniOpVVVV::kNMSubF64S: return VecOpInfo::make(VE::kFloat64, VE::kFloat64, VE::kFloat64, VE::kFloat64);
     case UniOpVVVV::kNMSubF32 : return VecOpInfo::make(VE::kFloat32, VE::kFloat32, VE::kFloat32, VE::kFloat32);
     case UniOpVVVV::kNMSubF64 : return VecOpInfo::make(VE::kFloat64, VE::kFloat64, VE::kFloat64, VE::kFloat64);
+    case UniOpVVVV::kDotI8_I32: return VecOpInfo::make(VE::kInt32, VE::kInt8, VE::kInt8, VE::kInt32);
+    case UniOpVVVV::kDotU8_I32: return VecOpInfo::make(VE::kInt32, VE::kUInt8, VE::kUInt8, VE::kInt32);
+    case UniOpVVVV::kDotU8I8_I32: return VecOpInfo::make(VE::kInt32, VE::kUInt8, VE::kInt8, VE::kInt32);
+    case UniOpVVVV::kDotI16_I32: return VecOpInfo::make(VE::kInt32, VE::kInt16, VE::kInt16, VE::kInt32);
   }
 
   ASMJIT_NOT_REACHED();
@@ -2934,6 +3036,29 @@ struct ConstraintRangeU32 : public ConstraintBase<uint32_t, ConstraintRangeU32<k
   static ASMJIT_INLINE_NODEBUG uint32_t apply_one(uint32_t x) noexcept { return std::clamp(x, kMin, kMax); }
 };
 
+// Scales a F32 value by 2^-N, where N is taken from the low bits of the value - used to test conversions to
+// narrower floating point types, which need values close to their range (including denormals).
+template<uint32_t kShiftMask>
+struct ConstraintScaleDownF32 : public ConstraintBase<float, ConstraintScaleDownF32<kShiftMask>> {
+  static ASMJIT_INLINE_NODEBUG float apply_one(float x) noexcept {
+    return std::ldexp(x, -int(Support::bit_cast<uint32_t>(x) & kShiftMask));
+  }
+};
+
+// Shifts an integer left or right by an amount taken from its own bits (or zeroes it) - used to test bit counting
+// operations, which need inputs having a varying number of leading and trailing zeros.
+template<typename T>
+struct ConstraintRandomShift : public ConstraintBase<T, ConstraintRandomShift<T>> {
+  static ASMJIT_INLINE_NODEBUG T apply_one(T x) noexcept {
+    constexpr uint32_t kBits = uint32_t(sizeof(T) * 8u);
+    uint32_t n = uint32_t(x >> 1) % (kBits + 1u);
+
+    if (n == kBits)
+      return T(0);
+    return (x & 1u) ? T(x << n) : T(x >> n);
+  }
+};
+
 // ujit::UniCompiler - Tests - Generic Operations
 // ==============================================
 
@@ -3173,6 +3298,18 @@ template<typename T> struct vec_op_not : public op_each_vv<T, vec_op_not<T>> {
   static ASMJIT_INLINE_NODEBUG T apply_one(const T& a) noexcept { return T(~a); }
 };
 
+template<typename T> struct vec_op_popcnt : public op_each_vv<T, vec_op_popcnt<T>> {
+  static ASMJIT_INLINE_NODEBUG T apply_one(const T& a) noexcept { return T(Support::popcnt(a)); }
+};
+
+template<typename T> struct vec_op_lzcnt : public op_each_vv<T, vec_op_lzcnt<T>> {
+  static ASMJIT_INLINE_NODEBUG T apply_one(const T& a) noexcept { return a ? T(Support::clz(a)) : T(sizeof(T) * 8u); }
+};
+
+template<typename T> struct vec_op_tzcnt : public op_each_vv<T, vec_op_tzcnt<T>> {
+  static ASMJIT_INLINE_NODEBUG T apply_one(const T& a) noexcept { return a ? T(Support::ctz(a)) : T(sizeof(T) * 8u); }
+};
+
 struct vec_op_cvt_i8_lo_to_i16 {
   template<uint32_t kW>
   static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
@@ -3547,6 +3684,128 @@ struct vec_op_cvt_round_f64_to_i32_lo : vec_op_cvt_round_f64_to_i32_impl<behavio
 template<FloatToIntOutsideRangeBehavior behavior>
 struct vec_op_cvt_round_f64_to_i32_hi : vec_op_cvt_round_f64_to_i32_impl<behavior, true> {};
 
+static ASMJIT_INLINE float cvt_f16_to_f32(uint16_t h) noexcept {
+  uint32_t exp = (h >> 10) & 0x1Fu;
+  uint32_t mantissa = h & 0x3FFu;
+
+  float result;
+  if (exp == 0u) {
+    result = std::ldexp(float(mantissa), -24);
+  }
+  else if (exp == 0x1Fu) {
+    result = mantissa ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+  }
+  else {
+    result = std::ldexp(float(mantissa | 0x400u), int(exp) - 25);
+  }
+
+  return (h & 0x8000u) ? -result : result;
+}
+
+static ASMJIT_INLINE uint16_t cvt_f32_to_f16(float x) noexcept {
+  uint32_t u = Support::bit_cast<uint32_t>(x);
+  uint32_t a = u & 0x7FFFFFFFu;
+  uint16_t sign = uint16_t((u >> 16) & 0x8000u);
+
+  if (a > 0x7F800000u) {
+    return uint16_t(sign | 0x7E00u);
+  }
+
+  // Values that round to a number greater than 65504 overflow to infinity.
+  if (a >= 0x477FF000u) {
+    return uint16_t(sign | 0x7C00u);
+  }
+
+  // Values that are F16 denormals (or zero) - rounded to a multiple of 2^-24 (round to nearest even).
+  if (a < 0x38800000u) {
+    double scaled = double(Support::bit_cast<float>(a)) * 16777216.0;
+    return uint16_t(sign | uint16_t(std::nearbyint(scaled)));
+  }
+
+  uint32_t h = (((a >> 23) - 112u) << 10) | ((a >> 13) & 0x3FFu);
+  uint32_t rest = a & 0x1FFFu;
+
+  if (rest > 0x1000u || (rest == 0x1000u && (h & 1u))) {
+    h++;
+  }
+  return uint16_t(sign | h);
+}
+
+static ASMJIT_INLINE float cvt_bf16_to_f32(uint16_t h) noexcept {
+  return Support::bit_cast<float>(uint32_t(h) << 16);
+}
+
+template<FloatToBF16DenormalBehavior behavior>
+static ASMJIT_INLINE uint16_t cvt_f32_to_bf16(float x) noexcept {
+  uint32_t u = Support::bit_cast<uint32_t>(x);
+  uint32_t a = u & 0x7FFFFFFFu;
+
+  if (a > 0x7F800000u) {
+    return uint16_t((u >> 16) | 0x0040u);
+  }
+
+  if (behavior == FloatToBF16DenormalBehavior::kFlushToZero && a < 0x00800000u) {
+    return uint16_t((u >> 16) & 0x8000u);
+  }
+
+  return uint16_t((u + 0x7FFFu + ((u >> 16) & 1u)) >> 16);
+}
+
+template<bool kHi>
+struct vec_op_cvt_f16_to_f32_impl {
+  template<uint32_t kW>
+  static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
+    VecOverlay<kW> out{};
+    uint32_t adj = kHi ? kW / 4 : 0u;
+    for (uint32_t i = 0; i < kW / 4; i++) {
+      out.data_f32[i] = cvt_f16_to_f32(a.data_u16[adj + i]);
+    }
+    return out;
+  }
+};
+
+struct vec_op_cvt_f16_lo_to_f32 : public vec_op_cvt_f16_to_f32_impl<false> {};
+struct vec_op_cvt_f16_hi_to_f32 : public vec_op_cvt_f16_to_f32_impl<true> {};
+
+struct vec_op_cvt_f32_to_f16_lo {
+  template<uint32_t kW>
+  static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
+    VecOverlay<kW> out{};
+    for (uint32_t i = 0; i < kW / 4; i++) {
+      out.data_u16[i] = cvt_f32_to_f16(a.data_f32[i]);
+    }
+    return out;
+  }
+};
+
+template<bool kHi>
+struct vec_op_cvt_bf16_to_f32_impl {
+  template<uint32_t kW>
+  static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
+    VecOverlay<kW> out{};
+    uint32_t adj = kHi ? kW / 4 : 0u;
+    for (uint32_t i = 0; i < kW / 4; i++) {
+      out.data_f32[i] = cvt_bf16_to_f32(a.data_u16[adj + i]);
+    }
+    return out;
+  }
+};
+
+struct vec_op_cvt_bf16_lo_to_f32 : public vec_op_cvt_bf16_to_f32_impl<false> {};
+struct vec_op_cvt_bf16_hi_to_f32 : public vec_op_cvt_bf16_to_f32_impl<true> {};
+
+template<FloatToBF16DenormalBehavior behavior>
+struct vec_op_cvt_f32_to_bf16_lo {
+  template<uint32_t kW>
+  static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
+    VecOverlay<kW> out{};
+    for (uint32_t i = 0; i < kW / 4; i++) {
+      out.data_u16[i] = cvt_f32_to_bf16<behavior>(a.data_f32[i]);
+    }
+    return out;
+  }
+};
+
 struct scalar_op_cvt_f32_to_f64 {
   template<uint32_t kW>
   static ASMJIT_INLINE VecOverlay<kW> apply(const VecOverlay<kW>& a) noexcept {
@@ -3845,6 +4104,19 @@ template<typename T> struct vec_op_madd : public op_each_vvvv<T, vec_op_madd<T>>
   static ASMJIT_INLINE_NODEBUG T apply_one(const T& a, const T& b, const T& c) noexcept { return T((uint64_t(a) * uint64_t(b) + uint64_t(c)) & uint64_t(~T(0))); }
 };
 
+template<typename A, typename B> struct vec_op_dot_i32 : public op_each_vvvv<uint32_t, vec_op_dot_i32<A, B>> {
+  static ASMJIT_INLINE_NODEBUG uint32_t apply_one(const uint32_t& a, const uint32_t& b, const uint32_t& c) noexcept {
+    constexpr uint32_t kShift = sizeof(A) * 8u;
+    constexpr uint32_t kMask = (1u << kShift) - 1u;
+
+    uint32_t result = c;
+    for (uint32_t i = 0; i < 32u; i += kShift) {
+      result += uint32_t(int32_t(A((a >> i) & kMask)) * int32_t(B((b >> i) & kMask)));
+    }
+    return result;
+  }
+};
+
 template<typename T> struct vec_op_min : public op_each_vvv<T, vec_op_min<T>> {
   static ASMJIT_INLINE_NODEBUG T apply_one(const T& a, const T& b) noexcept { return a < b ? a : b; }
 };
@@ -3957,6 +4229,13 @@ template<typename T> struct vec_op_fdiv : public op_each_vvv<T, vec_op_fdiv<T>>
   static ASMJIT_INLINE_NODEBUG T apply_one(const T& a, const T& b) noexcept { return fdiv(a, b); }
 };
 
+// F16 arithmetic is verified by calculating in F32 - it has enough precision to round each F16 result exactly.
+template<typename F32Op> struct vec_op_f16_via_f32 : public op_each_vvv<uint16_t, vec_op_f16_via_f32<F32Op>> {
+  static ASMJIT_INLINE_NODEBUG uint16_t apply_one(const uint16_t& a, const uint16_t& b) noexcept {
+    return cvt_f32_to_f16(F32Op::apply_one(cvt_f16_to_f32(a), cvt_f16_to_f32(b)));
+  }
+};
+
 template<typename T> struct vec_op_fmin_ternary : public op_each_vvv<T, vec_op_fmin_ternary<T>> {
   static ASMJIT_INLINE_NODEBUG T apply_one(const T& a, const T& b) noexcept { return a < b ? a : b; }
 };
@@ -4553,6 +4832,10 @@ static ASMJIT_NOINLINE void test_vecop_vv_constraint(JitContext& ctx, Variation
   constexpr uint32_t kW = byte_width_from_vec_width(kVecWidth);
 
   TestVVFunc compiled_apply = create_func_vv(ctx, kVecWidth, kOp, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
   DataGenInt dg(kRandomSeed);
 
   VecOpInfo op_info = vec_op_info_vv(kOp);
@@ -4589,6 +4872,10 @@ static ASMJIT_NOINLINE void test_vecop_vvi_constraint(JitContext& ctx, uint32_t
   constexpr uint32_t kW = byte_width_from_vec_width(kVecWidth);
 
   TestVVFunc compiled_apply = create_func_vvi(ctx, kVecWidth, kOp, imm, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
   DataGenInt dg(kRandomSeed);
 
   VecOpInfo op_info = vec_op_info_vvi(kOp);
@@ -4625,6 +4912,10 @@ static ASMJIT_NOINLINE void test_vecop_vvv_constraint(JitContext& ctx, Variation
   constexpr uint32_t kW = byte_width_from_vec_width(kVecWidth);
 
   TestVVVFunc compiled_apply = create_func_vvv(ctx, kVecWidth, kOp, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
   DataGenInt dg(kRandomSeed);
 
   VecOpInfo op_info = vec_op_info_vvv(kOp);
@@ -4664,6 +4955,10 @@ static ASMJIT_NOINLINE void test_vecop_vvvi_constraint(JitContext& ctx, uint32_t
   constexpr uint32_t kW = byte_width_from_vec_width(kVecWidth);
 
   TestVVVFunc compiled_apply = create_func_vvvi(ctx, kVecWidth, kOp, imm, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
   DataGenInt dg(kRandomSeed);
 
   VecOpInfo op_info = vec_op_info_vvvi(kOp);
@@ -4703,6 +4998,10 @@ static ASMJIT_NOINLINE void test_vecop_vvvv_constraint(JitContext& ctx, Variatio
   constexpr uint32_t kW = byte_width_from_vec_width(kVecWidth);
 
   TestVVVVFunc compiled_apply = create_func_vvvv(ctx, kVecWidth, kOp, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
   DataGenInt dg(kRandomSeed);
 
   VecOpInfo op_info = vec_op_info_vvvv(kOp);
@@ -4735,126 +5034,1298 @@ static void test_vecop_vvvv(JitContext& ctx, Variation variation = Variation{0})
   return test_vecop_vvvv_constraint<kVecWidth, kOp, GenericOp, ConstraintNone>(ctx, variation);
 }
 
-// ujit::UniCompiler - Tests - SIMD - Runner
-// =========================================
+// ujit::UniCompiler - Tests - SIMD - Gather & Scatter
+// ====================================================
 
-template<VecWidth kVecWidth>
-static ASMJIT_NOINLINE void test_simd_ops(JitContext& ctx) {
-  // We need to know some behaviors in advance so we can select the right test function,
-  // so create a dummy compiler and extract the necessary information from it.
-  ScalarOpBehavior scalar_op_behavior {};
-  FMAddOpBehavior fmadd_op_behavior {};
-  FloatToIntOutsideRangeBehavior float_to_int_behavior {};
+// The following variations are supported:
+//   - 0 - separate destination & index registers
+//   - 1 - destination register is the index register as well (only gathers, scatters map to 0)
+static constexpr uint32_t kNumVariationsGather = 2;
 
-  {
-    ctx.prepare();
-    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+static TestGatherFunc create_func_gather(JitContext& ctx, VecWidth vw, UniOpGather op, uint32_t shift, int32_t disp, Variation variation = Variation{0}) {
+  ctx.prepare();
 
-    scalar_op_behavior = uc.scalar_op_behavior();
-    fmadd_op_behavior = uc.fmadd_op_behavior();
-    float_to_int_behavior = uc.float_to_int_outside_range_behavior();
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp base_ptr = uc.new_gpz("base_ptr");
+  Gp index_ptr = uc.new_gpz("index_ptr");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, base_ptr);
+  node->set_arg(2, index_ptr);
+
+  Vec index_vec = uc.new_vec_with_width(vw, "index_vec");
+  uc.v_loaduvec(index_vec, mem_ptr(index_ptr));
+
+  if (variation.value == 1u) {
+    uc.emit_gather(op, index_vec, base_ptr, index_vec, shift, disp);
+    uc.v_storeuvec(mem_ptr(dst_ptr), index_vec);
+  }
+  else {
+    Vec dst_vec = uc.new_vec_with_width(vw, "dst_vec");
+    uc.emit_gather(op, dst_vec, base_ptr, index_vec, shift, disp);
+    uc.v_storeuvec(mem_ptr(dst_ptr), dst_vec);
   }
 
-  bool valgrind_fma_bug = false;
+  uc.end_func();
+  return ctx.finish<TestGatherFunc>();
+}
 
-#if defined(ASMJIT_UJIT_X86)
-  // When running under valgrind there is a bug in its instrumentation of FMA SS/SD instructions.
-  // Instead of keeping the unaffected elements in the destination register they are cleared instead,
-  // which would cause test failures. So, detect whether we are running under Valgind that has this
-  // bug and avoid scalar FMA tests in that case.
-  if (fmadd_op_behavior != FMAddOpBehavior::kNoFMA) {
-    float a[4] = { 1, 2, 3, 4 };
-    float b[4] = { 2, 4, 8, 1 };
-    float c[4] = { 4, 7, 3, 9 };
+static TestScatterFunc create_func_scatter(JitContext& ctx, VecWidth vw, UniOpScatter op, uint32_t shift, int32_t disp) {
+  ctx.prepare();
 
-    float d[4] {};
-    madd_fma_check_valgrind_bug(a, b, c, d);
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
 
-    valgrind_fma_bug = d[1] == 0.0f;
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp base_ptr = uc.new_gpz("base_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+  Gp index_ptr = uc.new_gpz("index_ptr");
+
+  node->set_arg(0, base_ptr);
+  node->set_arg(1, src_ptr);
+  node->set_arg(2, index_ptr);
+
+  Vec src_vec = uc.new_vec_with_width(vw, "src_vec");
+  Vec index_vec = uc.new_vec_with_width(vw, "index_vec");
+
+  uc.v_loaduvec(src_vec, mem_ptr(src_ptr));
+  uc.v_loaduvec(index_vec, mem_ptr(index_ptr));
+  uc.emit_scatter(op, base_ptr, index_vec, shift, src_vec, disp);
+
+  uc.end_func();
+  return ctx.finish<TestScatterFunc>();
+}
+
+// Fills `indexes` with distinct indexes (both positive and negative) so each element addresses a different slot in
+// a table of `kGatherTableSize` bytes, where the base address points to its center.
+static constexpr uint32_t kGatherTableSize = 512u;
+
+static void fill_gather_indexes(void* indexes, uint32_t vec_size, uint32_t element_size, uint32_t shift, uint32_t seed) {
+  uint32_t count = vec_size / element_size;
+  uint32_t step = Support::max<uint32_t>(element_size, 1u << shift) >> shift;
+
+  for (uint32_t i = 0; i < count; i++) {
+    int32_t slot = int32_t((i * 7u + seed) & 15u) - 8;
+    int64_t idx = int64_t(slot) * int64_t(step);
+
+    if (element_size == 4u)
+      static_cast<int32_t*>(indexes)[i] = int32_t(idx);
+    else
+      static_cast<int64_t*>(indexes)[i] = idx;
   }
-#endif // ASMJIT_UJIT_X86
+}
 
-  INFO("  Testing mov");
-  {
-    test_vecop_vv<kVecWidth, UniOpVV::kMov, vec_op_mov>(ctx);
-    test_vecop_vv<kVecWidth, UniOpVV::kMovU64, vec_op_mov_u64>(ctx);
+static ASMJIT_NOINLINE void test_gather_op(JitContext& ctx, VecWidth vw, UniOpGather op, uint32_t shift, int32_t disp, Variation variation) {
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = vec_size / element_size;
+
+  TestGatherFunc compiled_apply = create_func_gather(ctx, vw, op, shift, disp, variation);
+  if (!compiled_apply) {
+    return;
   }
 
-  INFO("  Testing broadcast");
-  {
-    // Test all broadcasts - vector based, GP to vector, and memory to vector.
-    for (uint32_t v = 0; v < kNumVariationsVV_Broadcast; v++) {
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU8Z, vec_op_broadcast_u8>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU16Z, vec_op_broadcast_u16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU8, vec_op_broadcast_u8>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU16, vec_op_broadcast_u16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU32, vec_op_broadcast_u32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU64, vec_op_broadcast_u64>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastF32, vec_op_broadcast_u32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastF64, vec_op_broadcast_u64>(ctx, Variation{v});
+  TestUtils::Random rng(kRandomSeed);
 
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_U32, vec_op_broadcast_u128>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_U64, vec_op_broadcast_u128>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_F32, vec_op_broadcast_u128>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_F64, vec_op_broadcast_u128>(ctx, Variation{v});
+  for (uint32_t iter = 0; iter < 16u; iter++) {
+    alignas(64) uint8_t table[kGatherTableSize];
+    alignas(64) uint8_t indexes[64] {};
+    alignas(64) uint8_t observed[64] {};
+    alignas(64) uint8_t expected[64] {};
 
-      if constexpr (kVecWidth > VecWidth::k256) {
-        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_U32, vec_op_broadcast_u256>(ctx, Variation{v});
-        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_U64, vec_op_broadcast_u256>(ctx, Variation{v});
-        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_F32, vec_op_broadcast_u256>(ctx, Variation{v});
-        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_F64, vec_op_broadcast_u256>(ctx, Variation{v});
-      }
+    for (uint32_t i = 0; i < kGatherTableSize; i++) {
+      table[i] = uint8_t(rng.next_uint32());
     }
-  }
 
-  INFO("  Testing abs (int)");
-  {
-    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsI8, vec_op_abs<int8_t>>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsI16, vec_op_abs<int16_t>>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsI32, vec_op_abs<int32_t>>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsI64, vec_op_abs<int64_t>>(ctx, Variation{v});
+    fill_gather_indexes(indexes, vec_size, element_size, shift, iter);
+    const uint8_t* base = table + kGatherTableSize / 2u;
+
+    for (uint32_t i = 0; i < element_count; i++) {
+      int64_t idx = element_size == 4u ? int64_t(reinterpret_cast<const int32_t*>(indexes)[i])
+                                       : reinterpret_cast<const int64_t*>(indexes)[i];
+      memcpy(expected + i * element_size, base + (idx << shift) + disp, element_size);
     }
+
+    compiled_apply(observed, base, indexes);
+
+    EXPECT_EQ(memcmp(observed, expected, vec_size), 0)
+      .message("Gather operation %u (shift=%u disp=%d variation=%u) failed\nAssembly:\n%s",
+               unsigned(op), shift, disp, variation.value, ctx.logger_content());
   }
 
-  INFO("  Testing not (int)");
-  {
-    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
-      test_vecop_vv<kVecWidth, UniOpVV::kNotU32, vec_op_not<uint32_t>>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kNotU64, vec_op_not<uint64_t>>(ctx, Variation{v});
-    }
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_scatter_op(JitContext& ctx, VecWidth vw, UniOpScatter op, uint32_t shift, int32_t disp) {
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = vec_size / element_size;
+
+  TestScatterFunc compiled_apply = create_func_scatter(ctx, vw, op, shift, disp);
+  if (!compiled_apply) {
+    return;
   }
 
-  INFO("  Testing cvt (int)");
-  {
-    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8LoToI16, vec_op_cvt_i8_lo_to_i16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8HiToI16, vec_op_cvt_i8_hi_to_i16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8LoToU16, vec_op_cvt_u8_lo_to_u16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8HiToU16, vec_op_cvt_u8_hi_to_u16>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8ToI32, vec_op_cvt_i8_to_i32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8ToU32, vec_op_cvt_u8_to_u32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI16LoToI32, vec_op_cvt_i16_lo_to_i32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI16HiToI32, vec_op_cvt_i16_hi_to_i32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU16LoToU32, vec_op_cvt_u16_lo_to_u32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU16HiToU32, vec_op_cvt_u16_hi_to_u32>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI32LoToI64, vec_op_cvt_i32_lo_to_i64>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtI32HiToI64, vec_op_cvt_i32_hi_to_i64>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU32LoToU64, vec_op_cvt_u32_lo_to_u64>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kCvtU32HiToU64, vec_op_cvt_u32_hi_to_u64>(ctx, Variation{v});
+  TestUtils::Random rng(kRandomSeed);
+
+  for (uint32_t iter = 0; iter < 16u; iter++) {
+    alignas(64) uint8_t observed[kGatherTableSize];
+    alignas(64) uint8_t expected[kGatherTableSize];
+    alignas(64) uint8_t indexes[64] {};
+    alignas(64) uint8_t src[64] {};
+
+    for (uint32_t i = 0; i < kGatherTableSize; i++) {
+      observed[i] = uint8_t(rng.next_uint32());
     }
-  }
+    memcpy(expected, observed, kGatherTableSize);
 
-  INFO("  Testing abs (float)");
-  {
-    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsF32, vec_op_fabs<float>>(ctx, Variation{v});
-      test_vecop_vv<kVecWidth, UniOpVV::kAbsF64, vec_op_fabs<double>>(ctx, Variation{v});
+    for (uint32_t i = 0; i < vec_size; i++) {
+      src[i] = uint8_t(rng.next_uint32());
     }
-  }
 
-  INFO("  Testing not (float)");
-  {
+    fill_gather_indexes(indexes, vec_size, element_size, shift, iter);
+
+    for (uint32_t i = 0; i < element_count; i++) {
+      int64_t idx = element_size == 4u ? int64_t(reinterpret_cast<const int32_t*>(indexes)[i])
+                                       : reinterpret_cast<const int64_t*>(indexes)[i];
+      memcpy(expected + kGatherTableSize / 2u + (idx << shift) + disp, src + i * element_size, element_size);
+    }
+
+    compiled_apply(observed + kGatherTableSize / 2u, src, indexes);
+
+    EXPECT_EQ(memcmp(observed, expected, kGatherTableSize), 0)
+      .message("Scatter operation %u (shift=%u disp=%d) failed\nAssembly:\n%s",
+               unsigned(op), shift, disp, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_gather_scatter_ops(JitContext& ctx, VecWidth vw) {
+  static constexpr int32_t disp_values[] = { 0, 24 };
+
+  // Test both the scalar sequences and hardware gathers & scatters (if provided by the target).
+  CpuHints saved_hints = ctx.cpu_hints;
+  CpuHints hint_variations[] = { CpuHints::kNone, CpuHints::kVecFastGather | CpuHints::kVecFastScatter };
+
+  for (CpuHints hints : hint_variations) {
+    ctx.cpu_hints = hints;
+
+    for (uint32_t shift = 0; shift <= 3u; shift++) {
+      for (int32_t disp : disp_values) {
+        for (uint32_t v = 0; v < kNumVariationsGather; v++) {
+          test_gather_op(ctx, vw, UniOpGather::kGatherU32, shift, disp, Variation{v});
+          test_gather_op(ctx, vw, UniOpGather::kGatherU64, shift, disp, Variation{v});
+          test_gather_op(ctx, vw, UniOpGather::kGatherF32, shift, disp, Variation{v});
+          test_gather_op(ctx, vw, UniOpGather::kGatherF64, shift, disp, Variation{v});
+        }
+
+        test_scatter_op(ctx, vw, UniOpScatter::kScatterU32, shift, disp);
+        test_scatter_op(ctx, vw, UniOpScatter::kScatterU64, shift, disp);
+        test_scatter_op(ctx, vw, UniOpScatter::kScatterF32, shift, disp);
+        test_scatter_op(ctx, vw, UniOpScatter::kScatterF64, shift, disp);
+      }
+    }
+  }
+
+  ctx.cpu_hints = saved_hints;
+}
+
+// ujit::UniCompiler - Tests - SIMD - F16 & BF16 Load & Store
+// ===========================================================
+
+// Loads F16 or BF16 elements and widens them to F32 (`is_load == true`) or narrows F32 elements and stores them
+// as F16 or BF16 (`is_load == false`). The narrow side of the conversion occupies half of the vector width.
+static TestVVFunc create_func_f16_load_store(JitContext& ctx, VecWidth vw, bool is_load, bool is_bf16, uint32_t alignment) {
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, src_ptr);
+
+  Vec vec = uc.new_vec_with_width(vw, "vec");
+
+  if (is_load) {
+    UniOpVM op = is_bf16 ? UniOpVM::kLoadCvtN_BF16ToF32 : UniOpVM::kLoadCvtN_F16ToF32;
+    uc.emit_vm(op, vec, mem_ptr(src_ptr), Alignment(alignment));
+    uc.v_storeuvec(mem_ptr(dst_ptr), vec);
+  }
+  else {
+    UniOpMV op = is_bf16 ? UniOpMV::kStoreCvtN_F32ToBF16 : UniOpMV::kStoreCvtN_F32ToF16;
+    uc.v_loaduvec(vec, mem_ptr(src_ptr));
+    uc.emit_mv(op, mem_ptr(dst_ptr), vec, Alignment(alignment));
+  }
+
+  uc.end_func();
+  return ctx.finish<TestVVFunc>();
+}
+
+static ASMJIT_NOINLINE void test_f16_load_store_op(JitContext& ctx, VecWidth vw, bool is_load, bool is_bf16, uint32_t alignment, FloatToBF16DenormalBehavior bf16_behavior) {
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_count = vec_size / 4u;
+
+  // Unaligned accesses are tested by offsetting the narrow side by a single element.
+  uint32_t narrow_offset = alignment == 1u ? 2u : 0u;
+
+  TestVVFunc compiled_apply = create_func_f16_load_store(ctx, vw, is_load, is_bf16, alignment);
+  if (!compiled_apply) {
+    return;
+  }
+
+  TestUtils::Random rng(kRandomSeed);
+
+  for (uint32_t iter = 0; iter < 16u; iter++) {
+    alignas(64) uint8_t src[128] {};
+    alignas(64) uint8_t observed[128] {};
+    alignas(64) uint8_t expected[128] {};
+
+    for (uint32_t i = 0; i < 128u; i++) {
+      observed[i] = uint8_t(rng.next_uint32());
+    }
+    memcpy(expected, observed, 128u);
+
+    bool ok = true;
+
+    if (is_load) {
+      uint16_t* narrow = reinterpret_cast<uint16_t*>(src + narrow_offset);
+      for (uint32_t i = 0; i < element_count; i++) {
+        narrow[i] = uint16_t(rng.next_uint32());
+      }
+
+      compiled_apply(observed, narrow);
+
+      for (uint32_t i = 0; i < element_count; i++) {
+        float e = is_bf16 ? cvt_bf16_to_f32(narrow[i]) : cvt_f16_to_f32(narrow[i]);
+        float o;
+        memcpy(&o, observed + i * 4u, 4u);
+        ok &= float_eq(o, e);
+      }
+    }
+    else {
+      float* wide = reinterpret_cast<float*>(src);
+      for (uint32_t i = 0; i < element_count; i++) {
+        float x = std::ldexp(float(rng.next_double()) - 0.5f, int(rng.next_uint32() % (is_bf16 ? 280u : 48u)) - (is_bf16 ? 150 : 30));
+        wide[i] = x;
+      }
+
+      uint16_t* narrow = reinterpret_cast<uint16_t*>(expected + narrow_offset);
+      for (uint32_t i = 0; i < element_count; i++) {
+        if (!is_bf16)
+          narrow[i] = cvt_f32_to_f16(wide[i]);
+        else if (bf16_behavior == FloatToBF16DenormalBehavior::kFlushToZero)
+          narrow[i] = cvt_f32_to_bf16<FloatToBF16DenormalBehavior::kFlushToZero>(wide[i]);
+        else
+          narrow[i] = cvt_f32_to_bf16<FloatToBF16DenormalBehavior::kPreserve>(wide[i]);
+      }
+
+      compiled_apply(observed + narrow_offset, wide);
+
+      // Bytes that follow the stored elements must not be modified.
+      ok = memcmp(observed, expected, 128u) == 0;
+    }
+
+    EXPECT_TRUE(ok)
+      .message("%s operation (%s alignment=%u) failed\nAssembly:\n%s",
+               is_load ? "Load" : "Store", is_bf16 ? "bf16" : "f16", alignment, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_f16_load_store_ops(JitContext& ctx, VecWidth vw, FloatToBF16DenormalBehavior bf16_behavior) {
+  for (uint32_t alignment : { 0u, 1u }) {
+    for (bool is_bf16 : { false, true }) {
+      test_f16_load_store_op(ctx, vw, true, is_bf16, alignment, bf16_behavior);
+      test_f16_load_store_op(ctx, vw, false, is_bf16, alignment, bf16_behavior);
+    }
+  }
+}
+
+// ujit::UniCompiler - Tests - SIMD - Compress & Expand
+// ====================================================
+
+// Compress and expand operations require a lane mask (each lane is either all ones or all zeros) as the second
+// operand, so they cannot use random data like other VVV operations.
+static ASMJIT_NOINLINE void test_compress_expand_op(JitContext& ctx, VecWidth vw, UniOpVVV op, Variation variation) {
+  bool is_64 = op == UniOpVVV::kCompressU64 || op == UniOpVVV::kExpandU64;
+  bool is_expand = op == UniOpVVV::kExpandU32 || op == UniOpVVV::kExpandU64;
+
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_size = is_64 ? 8u : 4u;
+  uint32_t element_count = vec_size / element_size;
+
+  TestVVVFunc compiled_apply = create_func_vvv(ctx, vw, op, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
+  TestUtils::Random rng(kRandomSeed);
+
+  for (uint32_t iter = 0; iter < 64u; iter++) {
+    alignas(64) uint8_t src[64] {};
+    alignas(64) uint8_t msk[64] {};
+    alignas(64) uint8_t observed[64] {};
+    alignas(64) uint8_t expected[64] {};
+
+    for (uint32_t i = 0; i < 64u; i++) {
+      src[i] = uint8_t(rng.next_uint32());
+    }
+
+    // Include empty and full masks, the rest is random.
+    uint32_t mask_bits = iter == 0u ? 0u : iter == 1u ? 0xFFFFFFFFu : rng.next_uint32();
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < element_count; i++) {
+      if (!((mask_bits >> i) & 1u))
+        continue;
+
+      memset(msk + i * element_size, 0xFF, element_size);
+
+      uint32_t dst_index = is_expand ? i : n;
+      uint32_t src_index = is_expand ? n : i;
+      memcpy(expected + dst_index * element_size, src + src_index * element_size, element_size);
+      n++;
+    }
+
+    compiled_apply(observed, src, msk);
+
+    EXPECT_TRUE(memcmp(observed, expected, vec_size) == 0)
+      .message("Operation '%s' (variation %u) failed with mask 0x%08X\nAssembly:\n%s",
+               vec_op_name_vvv(op), variation.value, mask_bits, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_compress_expand_ops(JitContext& ctx, VecWidth vw) {
+  for (uint32_t v = 0; v < kNumVariationsVVV; v++) {
+    test_compress_expand_op(ctx, vw, UniOpVVV::kCompressU32, Variation{v});
+    test_compress_expand_op(ctx, vw, UniOpVVV::kCompressU64, Variation{v});
+    test_compress_expand_op(ctx, vw, UniOpVVV::kExpandU32, Variation{v});
+    test_compress_expand_op(ctx, vw, UniOpVVV::kExpandU64, Variation{v});
+  }
+}
+
+// ujit::UniCompiler - Tests - SIMD - Table Lookup
+// ===============================================
+
+// The following variations are supported:
+//   - 0 - table in registers, separate destination register
+//   - 1 - table in memory, index is a memory operand
+//   - 2 - table in registers, destination register is the index register as well
+static constexpr uint32_t kNumVariationsLut = 3;
+
+static TestVVVFunc create_func_lut_u8(JitContext& ctx, VecWidth vw, uint32_t table_size, Variation variation) {
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp table_ptr = uc.new_gpz("table_ptr");
+  Gp index_ptr = uc.new_gpz("index_ptr");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, table_ptr);
+  node->set_arg(2, index_ptr);
+
+  Vec dst = uc.new_vec_with_width(vw, "dst");
+
+  if (variation.value == 1u) {
+    uc.v_lut_u8(dst, mem_ptr(table_ptr), table_size, mem_ptr(index_ptr));
+  }
+  else {
+    VecArray table;
+    uc.new_vec128_array(table, table_size / 16u, "table");
+
+    for (uint32_t i = 0; i < table.size(); i++) {
+      uc.v_loadu128(table[i], mem_ptr(table_ptr, int32_t(i * 16u)));
+    }
+
+    Vec index = variation.value == 2u ? dst : uc.new_vec_with_width(vw, "index");
+    uc.v_loaduvec(index, mem_ptr(index_ptr));
+    uc.v_lut_u8(dst, table, index);
+  }
+
+  uc.v_storeuvec(mem_ptr(dst_ptr), dst);
+
+  uc.end_func();
+  return ctx.finish<TestVVVFunc>();
+}
+
+static ASMJIT_NOINLINE void test_lut_u8_op(JitContext& ctx, VecWidth vw, uint32_t table_size, Variation variation) {
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+
+  TestVVVFunc compiled_apply = create_func_lut_u8(ctx, vw, table_size, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
+  TestUtils::Random rng(kRandomSeed);
+
+  for (uint32_t iter = 0; iter < 16u; iter++) {
+    alignas(64) uint8_t table[128] {};
+    alignas(64) uint8_t index[64] {};
+    alignas(64) uint8_t observed[64] {};
+    alignas(64) uint8_t expected[64] {};
+
+    for (uint32_t i = 0; i < table_size; i++) {
+      table[i] = uint8_t(rng.next_uint32());
+    }
+
+    // Most indexes are within the table, the rest tests zeroing of out of range indexes.
+    for (uint32_t i = 0; i < vec_size; i++) {
+      uint32_t r = rng.next_uint32();
+      index[i] = uint8_t((r & 3u) ? (r >> 8) % table_size : (r >> 8));
+      expected[i] = index[i] < table_size ? table[index[i]] : uint8_t(0);
+    }
+
+    compiled_apply(observed, table, index);
+
+    EXPECT_TRUE(memcmp(observed, expected, vec_size) == 0)
+      .message("Operation 'v_lut_u8' (table_size=%u variation %u) failed\nAssembly:\n%s",
+               table_size, variation.value, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_lut_u8_ops(JitContext& ctx, VecWidth vw) {
+  for (uint32_t v = 0; v < kNumVariationsLut; v++) {
+    for (uint32_t table_size : { 16u, 32u, 64u, 128u }) {
+      test_lut_u8_op(ctx, vw, table_size, Variation{v});
+    }
+  }
+}
+
+// ujit::UniCompiler - Tests - SIMD - Reduce
+// =========================================
+
+// The following variations are supported:
+//   - 0 - general purpose destination register
+//   - 1 - separate vector destination register
+//   - 2 - vector destination register is the first source register as well
+static constexpr uint32_t kNumVariationsReduce = 3;
+
+static uint32_t reduce_element_size(UniOpReduce op) {
+  switch (op) {
+    case UniOpReduce::kMinI8: case UniOpReduce::kMinU8: case UniOpReduce::kMaxI8: case UniOpReduce::kMaxU8:
+      return 1u;
+    case UniOpReduce::kMinI16: case UniOpReduce::kMinU16: case UniOpReduce::kMaxI16: case UniOpReduce::kMaxU16:
+      return 2u;
+    case UniOpReduce::kAddU64: case UniOpReduce::kAddF64:
+    case UniOpReduce::kMinI64: case UniOpReduce::kMinU64: case UniOpReduce::kMinF64:
+    case UniOpReduce::kMaxI64: case UniOpReduce::kMaxU64: case UniOpReduce::kMaxF64:
+    case UniOpReduce::kAndU64: case UniOpReduce::kOrU64:
+      return 8u;
+    default:
+      return 4u;
+  }
+}
+
+static bool reduce_is_float(UniOpReduce op) {
+  switch (op) {
+    case UniOpReduce::kAddF32: case UniOpReduce::kAddF64:
+    case UniOpReduce::kMinF32: case UniOpReduce::kMinF64:
+    case UniOpReduce::kMaxF32: case UniOpReduce::kMaxF64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static TestReduceFunc create_func_reduce(JitContext& ctx, VecWidth vw, UniOpReduce op, uint32_t reg_count, Variation variation = Variation{0}) {
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, src_ptr);
+
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_size = reduce_element_size(op);
+
+  OpArray src_vec;
+  uc.new_vec_array(src_vec, reg_count, vw, "src_vec");
+
+  for (uint32_t i = 0; i < reg_count; i++) {
+    uc.v_loaduvec(src_vec[i].as<Vec>(), mem_ptr(src_ptr, int32_t(i * vec_size)));
+  }
+
+  // Prevent using 64-bit registers on 32-bit architectures (that would fail).
+  if (variation.value == 0u && element_size == 8u && !uc.is_64bit()) {
+    variation.value = 1u;
+  }
+
+  if (variation.value == 0u) {
+    if (element_size == 8u) {
+      Gp dst_gp = uc.new_gp64("dst_gp");
+      uc.emit_reduce(op, dst_gp, src_vec);
+      uc.store_u64(mem_ptr(dst_ptr), dst_gp);
+    }
+    else {
+      Gp dst_gp = uc.new_gp32("dst_gp");
+      uc.emit_reduce(op, dst_gp, src_vec);
+      uc.store_u32(mem_ptr(dst_ptr), dst_gp);
+    }
+  }
+  else {
+    Vec dst_vec = variation.value == 2u ? src_vec[0].as<Vec>() : uc.new_vec_with_width(vw, "dst_vec");
+
+    if (reg_count == 1u)
+      uc.emit_reduce(op, dst_vec, src_vec[0].as<Vec>());
+    else
+      uc.emit_reduce(op, dst_vec, src_vec);
+
+    uc.v_storeu64(mem_ptr(dst_ptr), dst_vec);
+  }
+
+  uc.end_func();
+  return ctx.finish<TestReduceFunc>();
+}
+
+enum class ReduceKind : uint32_t { kAdd, kMin, kMax, kAnd, kOr };
+
+static ReduceKind reduce_kind_of(UniOpReduce op) {
+  if (op <= UniOpReduce::kAddF64) return ReduceKind::kAdd;
+  if (op <= UniOpReduce::kMinF64) return ReduceKind::kMin;
+  if (op <= UniOpReduce::kMaxF64) return ReduceKind::kMax;
+  if (op <= UniOpReduce::kAndU64) return ReduceKind::kAnd;
+  return ReduceKind::kOr;
+}
+
+template<typename T>
+static uint64_t reduce_ref(ReduceKind kind, const uint8_t* data, uint32_t count) {
+  T result;
+  memcpy(&result, data, sizeof(T));
+
+  for (uint32_t i = 1; i < count; i++) {
+    T value;
+    memcpy(&value, data + i * sizeof(T), sizeof(T));
+
+    switch (kind) {
+      case ReduceKind::kAdd: result = T(result + value); break;
+      case ReduceKind::kMin: result = std::min(result, value); break;
+      default: result = std::max(result, value); break;
+    }
+  }
+
+  uint64_t out = 0;
+  memcpy(&out, &result, sizeof(T));
+  return out;
+}
+
+template<typename T>
+static uint64_t reduce_ref_bitwise(ReduceKind kind, const uint8_t* data, uint32_t count) {
+  T result;
+  memcpy(&result, data, sizeof(T));
+
+  for (uint32_t i = 1; i < count; i++) {
+    T value;
+    memcpy(&value, data + i * sizeof(T), sizeof(T));
+    result = kind == ReduceKind::kAnd ? T(result & value) : T(result | value);
+  }
+
+  return uint64_t(result);
+}
+
+static uint64_t reduce_ref_op(UniOpReduce op, const uint8_t* data, uint32_t count) {
+  ReduceKind kind = reduce_kind_of(op);
+
+  switch (op) {
+    case UniOpReduce::kMinI8:
+    case UniOpReduce::kMaxI8: return reduce_ref<int8_t>(kind, data, count);
+    case UniOpReduce::kMinU8:
+    case UniOpReduce::kMaxU8: return reduce_ref<uint8_t>(kind, data, count);
+    case UniOpReduce::kMinI16:
+    case UniOpReduce::kMaxI16: return reduce_ref<int16_t>(kind, data, count);
+    case UniOpReduce::kMinU16:
+    case UniOpReduce::kMaxU16: return reduce_ref<uint16_t>(kind, data, count);
+    case UniOpReduce::kMinI32:
+    case UniOpReduce::kMaxI32: return reduce_ref<int32_t>(kind, data, count);
+    case UniOpReduce::kAddU32:
+    case UniOpReduce::kMinU32:
+    case UniOpReduce::kMaxU32: return reduce_ref<uint32_t>(kind, data, count);
+    case UniOpReduce::kMinI64:
+    case UniOpReduce::kMaxI64: return reduce_ref<int64_t>(kind, data, count);
+    case UniOpReduce::kAddU64:
+    case UniOpReduce::kMinU64:
+    case UniOpReduce::kMaxU64: return reduce_ref<uint64_t>(kind, data, count);
+    case UniOpReduce::kAddF32:
+    case UniOpReduce::kMinF32:
+    case UniOpReduce::kMaxF32: return reduce_ref<float>(kind, data, count);
+    case UniOpReduce::kAddF64:
+    case UniOpReduce::kMinF64:
+    case UniOpReduce::kMaxF64: return reduce_ref<double>(kind, data, count);
+    case UniOpReduce::kAndU32:
+    case UniOpReduce::kOrU32: return reduce_ref_bitwise<uint32_t>(kind, data, count);
+    case UniOpReduce::kAndU64:
+    case UniOpReduce::kOrU64: return reduce_ref_bitwise<uint64_t>(kind, data, count);
+  }
+
+  ASMJIT_NOT_REACHED();
+}
+
+static ASMJIT_NOINLINE void test_reduce_op(JitContext& ctx, VecWidth vw, UniOpReduce op, uint32_t reg_count, Variation variation) {
+  uint32_t vec_size = byte_width_from_vec_width(vw);
+  uint32_t element_size = reduce_element_size(op);
+  uint32_t element_count = vec_size * reg_count / element_size;
+  bool float_op = reduce_is_float(op);
+
+  TestReduceFunc compiled_apply = create_func_reduce(ctx, vw, op, reg_count, variation);
+  if (!compiled_apply) {
+    return;
+  }
+
+  TestUtils::Random rng(kRandomSeed);
+
+  for (uint32_t iter = 0; iter < 32u; iter++) {
+    alignas(64) uint8_t src[64 * 3] {};
+    alignas(64) uint8_t observed[16] {};
+
+    // Float elements use small integral values, so the sum is exact regardless of the order of additions.
+    for (uint32_t i = 0; i < element_count; i++) {
+      uint8_t* p = src + i * element_size;
+      if (float_op && element_size == 4u) {
+        float v = float(int32_t(rng.next_uint32() % 2001u) - 1000);
+        memcpy(p, &v, 4);
+      }
+      else if (float_op) {
+        double v = double(int32_t(rng.next_uint32() % 2001u) - 1000);
+        memcpy(p, &v, 8);
+      }
+      else {
+        for (uint32_t j = 0; j < element_size; j++) {
+          p[j] = uint8_t(rng.next_uint32());
+        }
+      }
+    }
+
+    uint64_t expected = reduce_ref_op(op, src, element_count);
+    compiled_apply(observed, src);
+
+    // General purpose destination zero extends, vector destination only defines the lowest element.
+    uint64_t observed_value = 0;
+    uint32_t compared_size = variation.value == 0u ? Support::max<uint32_t>(element_size, 4u) : element_size;
+    memcpy(&observed_value, observed, compared_size);
+
+    EXPECT_EQ(observed_value, expected)
+      .message("Reduce operation %u (reg_count=%u variation=%u) failed\n"
+               "      Expected: 0x%016llX\n"
+               "      Observed: 0x%016llX\n"
+               "Assembly:\n%s",
+               unsigned(op), reg_count, variation.value,
+               (unsigned long long)expected, (unsigned long long)observed_value, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_reduce_ops(JitContext& ctx, VecWidth vw) {
+  for (uint32_t op = 0; op <= uint32_t(UniOpReduce::kMaxValue); op++) {
+    for (uint32_t reg_count = 1; reg_count <= 3u; reg_count++) {
+      for (uint32_t v = 0; v < kNumVariationsReduce; v++) {
+        test_reduce_op(ctx, vw, UniOpReduce(op), reg_count, Variation{v});
+      }
+    }
+  }
+}
+
+// ujit::UniCompiler - Tests - SIMD - Loop
+// =======================================
+
+// Creates a function that computes `dst[i] = src[i] + src[i]` for `count` elements of `element_size` bytes.
+static TestLoopFunc create_func_loop(JitContext& ctx, VecWidth vw, uint32_t element_size, uint32_t unroll, UniLoopTail tail) {
+  static constexpr UniOpVVV add_ops[] = { UniOpVVV::kAddU8, UniOpVVV::kAddU16, UniOpVVV::kAddU32, UniOpVVV::kAddU64 };
+
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, size_t>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+  Gp count = uc.new_gpz("count");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, src_ptr);
+  node->set_arg(2, count);
+
+  UniOpVVV add_op = add_ops[Support::ctz(element_size)];
+  UniLoop loop(uc, count, element_size, unroll, tail);
+
+  while (loop.next()) {
+    VecArray v;
+    uc.new_vec_array(v, loop.vec_count(), vw, "v");
+
+    for (uint32_t i = 0; i < loop.vec_count(); i++) {
+      loop.load(v[i], src_ptr, i);
+    }
+
+    uc.emit_3v(add_op, v, v, v);
+
+    for (uint32_t i = 0; i < loop.vec_count(); i++) {
+      loop.store(dst_ptr, v[i], i);
+    }
+  }
+
+  uc.end_func();
+  return ctx.finish<TestLoopFunc>();
+}
+
+static ASMJIT_NOINLINE void test_loop_op(JitContext& ctx, VecWidth vw, uint32_t element_size, uint32_t unroll, UniLoopTail tail) {
+  static constexpr uint32_t kGuardSize = 64u;
+  static constexpr uint32_t kBufferSize = 1024u;
+
+  TestLoopFunc compiled_apply = create_func_loop(ctx, vw, element_size, unroll, tail);
+  if (!compiled_apply) {
+    return;
+  }
+
+  TestUtils::Random rng(kRandomSeed);
+
+  alignas(64) uint8_t src[kBufferSize];
+  alignas(64) uint8_t observed[kBufferSize + kGuardSize];
+  alignas(64) uint8_t expected[kBufferSize + kGuardSize];
+
+  for (uint32_t i = 0; i < kBufferSize; i++) {
+    src[i] = uint8_t(rng.next_uint32());
+  }
+
+  // Covers two iterations of the main loop, a full vector, and all tails.
+  uint32_t vec_element_count = byte_width_from_vec_width(vw) / element_size;
+  uint32_t max_count = vec_element_count * (unroll * 2u + 1u) + 3u;
+
+  for (uint32_t count = 0; count <= max_count; count++) {
+    memset(observed, 0xCD, sizeof(observed));
+    memset(expected, 0xCD, sizeof(expected));
+
+    for (uint32_t i = 0; i < count; i++) {
+      uint64_t value = 0;
+      memcpy(&value, src + i * element_size, element_size);
+      value += value;
+      memcpy(expected + i * element_size, &value, element_size);
+    }
+
+    compiled_apply(observed, src, count);
+
+    EXPECT_EQ(memcmp(observed, expected, count * element_size + kGuardSize), 0)
+      .message("Loop (element_size=%u unroll=%u tail=%u count=%u) failed\nAssembly:\n%s",
+               element_size, unroll, unsigned(tail), count, ctx.logger_content());
+  }
+
+  ctx.rt.release(compiled_apply);
+}
+
+static ASMJIT_NOINLINE void test_loop_ops(JitContext& ctx, VecWidth vw) {
+  static constexpr UniLoopTail tails[] = { UniLoopTail::kAuto, UniLoopTail::kScalar, UniLoopTail::kMasked, UniLoopTail::kOverlap };
+
+  for (uint32_t element_size = 1u; element_size <= 8u; element_size *= 2u) {
+    for (uint32_t unroll = 1u; unroll <= 4u; unroll *= 2u) {
+      for (UniLoopTail tail : tails) {
+        test_loop_op(ctx, vw, element_size, unroll, tail);
+      }
+    }
+  }
+
+  // The recommended unroll factor must fit both the register file and OpArray, and it must be usable by UniLoop.
+  uint32_t auto_unroll = 0;
+  {
+    ctx.prepare();
+
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+    ctx.init_vec_width(uc, vw);
+
+    for (uint32_t i = 0; i <= uint32_t(LatencyClass::kMaxValue); i++) {
+      LatencyClass latency_class = LatencyClass(i);
+
+      for (uint32_t regs_per_vec = 1u; regs_per_vec <= 4u; regs_per_vec++) {
+        uint32_t factor = uc.unroll_factor(regs_per_vec, 4u, latency_class);
+
+        EXPECT_GE(factor, 1u);
+        EXPECT_LE(factor, uint32_t(OpArray::kMaxSize));
+        EXPECT_LE(factor * regs_per_vec + 4u, uc.vec_reg_count());
+      }
+
+      EXPECT_EQ(uc.unroll_factor(1u, uc.vec_reg_count(), latency_class), 1u);
+    }
+
+    auto_unroll = uc.unroll_factor(2u);
+  }
+
+  test_loop_op(ctx, vw, 4u, auto_unroll, UniLoopTail::kAuto);
+}
+
+// ujit::UniCompiler - Tests - SIMD - SVE
+// ======================================
+
+#if defined(ASMJIT_UJIT_AARCH64)
+// Creates a function that applies a sequence of 32-bit integer and floating point operations to `count` elements.
+// The result of each element doesn't depend on the vector width, so NEON and SVE functions must produce the same
+// output.
+static TestLoopFunc create_func_sve_kernel(JitContext& ctx, VecWidth vw) {
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*, size_t>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+  Gp count = uc.new_gpz("count");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, src_ptr);
+  node->set_arg(2, count);
+
+  Gp tmp = uc.new_gp32("tmp");
+  Vec k_mul = uc.new_vec_with_width(vw, "k_mul");
+  Vec k_low = uc.new_vec_with_width(vw, "k_low");
+  Vec k_div = uc.new_vec_with_width(vw, "k_div");
+
+  uc.mov(tmp, Imm(0x9E3779B9u));
+  uc.v_broadcast_u32(k_mul, tmp);
+  uc.mov(tmp, Imm(0xFFFFu));
+  uc.v_broadcast_u32(k_low, tmp);
+  uc.mov(tmp, Imm(0x40400000u)); // 3.0f.
+  uc.v_broadcast_f32(k_div, tmp);
+
+  UniLoop loop(uc, count, 4u, 2u);
+
+  while (loop.next()) {
+    for (uint32_t i = 0; i < loop.vec_count(); i++) {
+      Vec v = uc.new_vec_with_width(vw, "v");
+      Vec t = uc.new_vec_with_width(vw, "t");
+      Vec m = uc.new_vec_with_width(vw, "m");
+      Vec f = uc.new_vec_with_width(vw, "f");
+
+      loop.load(v, src_ptr, i);
+
+      uc.v_mul_u32(t, v, v);
+      uc.v_add_u32(t, t, k_mul);
+      uc.v_srli_u32(m, v, 3);
+      uc.v_xor_u32(t, t, m);
+      uc.v_cmp_gt_u32(m, t, v);
+      uc.v_and_u32(m, m, v);
+      uc.v_sub_u32(t, t, m);
+      uc.v_max_u32(t, t, v);
+      uc.v_min_i32(t, t, k_mul);
+      uc.v_slli_u32(t, t, 1);
+
+      uc.v_and_u32(f, v, k_low);
+      uc.v_cvt_i32_to_f32(f, f);
+      uc.v_madd_f32(f, f, k_div, f);
+      uc.v_div_f32(f, f, k_div);
+      uc.v_sqrt_f32(f, f);
+      uc.v_cvt_trunc_f32_to_i32(f, f);
+      uc.v_add_u32(t, t, f);
+
+      loop.store(dst_ptr, t, i);
+    }
+  }
+
+  uc.end_func();
+  return ctx.finish<TestLoopFunc>();
+}
+
+static ASMJIT_NOINLINE void test_sve_ops(JitContext& ctx) {
+  static constexpr uint32_t kBufferSize = 256u;
+
+  VecWidth sve_width;
+  {
+    ctx.prepare();
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+    sve_width = uc.max_vec_width_from_cpu_features();
+  }
+
+  if (sve_width == VecWidth::k128) {
+    // No SVE or a vector length that UniCompiler doesn't use - only verify that the SVE lowering compiles and
+    // finalizes, which validates all emitted instructions by the assembler.
+    CpuFeatures saved_features = ctx.features;
+    ctx.features.add(CpuFeatures::ARM::kSVE);
+
+    for (VecWidth vw : { VecWidth::k256, VecWidth::k512 }) {
+      ctx.sve_vector_length = byte_width_from_vec_width(vw);
+      TestLoopFunc fn = create_func_sve_kernel(ctx, vw);
+#if !defined(ASMJIT_NO_LOGGING)
+      EXPECT_NOT_NULL(strstr(ctx.logger_content(), "whilelo"))
+        .message("SVE kernel (%u-bit) doesn't use a predicated tail:\n%s", byte_width_from_vec_width(vw) * 8u, ctx.logger_content());
+#endif
+      ctx.rt.release(fn);
+    }
+
+    ctx.sve_vector_length = 0u;
+    ctx.features = saved_features;
+    return;
+  }
+
+  INFO("Testing JIT compiler %u-bit SVE ops against NEON", byte_width_from_vec_width(sve_width) * 8u);
+
+  TestLoopFunc neon_fn = create_func_sve_kernel(ctx, VecWidth::k128);
+  TestLoopFunc sve_fn = create_func_sve_kernel(ctx, sve_width);
+
+  TestUtils::Random rng(kRandomSeed);
+
+  uint32_t src[kBufferSize];
+  uint32_t observed[kBufferSize];
+  uint32_t expected[kBufferSize];
+
+  for (uint32_t i = 0; i < kBufferSize; i++) {
+    src[i] = rng.next_uint32();
+  }
+
+  for (uint32_t count = 0; count <= kBufferSize; count++) {
+    memset(observed, 0xCD, sizeof(observed));
+    memset(expected, 0xCD, sizeof(expected));
+
+    neon_fn(expected, src, count);
+    sve_fn(observed, src, count);
+
+    EXPECT_EQ(memcmp(observed, expected, sizeof(observed)), 0)
+      .message("SVE kernel (count=%u) doesn't match NEON", count);
+  }
+
+  ctx.rt.release(neon_fn);
+  ctx.rt.release(sve_fn);
+}
+
+typedef void (*TestVoidFunc)();
+typedef void (*TestCopyFunc)(void* dst, const void* src);
+
+// Records errors instead of failing the test, used to verify that an invalid invoke is rejected.
+class TestRecordingErrorHandler : public ErrorHandler {
+public:
+  Error last_error = Error::kOk;
+
+  void handle_error(Error err, const char* message, BaseEmitter* origin) override {
+    Support::maybe_unused(message, origin);
+    last_error = err;
+  }
+};
+
+// Creates a function that clobbers all predicate registers, which is allowed by AAPCS64.
+static TestVoidFunc create_func_sve_clobber_preds(JitContext& ctx) {
+  ctx.prepare();
+
+  FuncNode* node = ctx.cc.add_func(FuncSignature::build<void>());
+  EXPECT_NOT_NULL(node);
+
+  for (uint32_t i = 0; i < 16u; i++) {
+    ctx.cc.pfalse(a64::PReg(i).b());
+  }
+
+  ctx.cc.end_func();
+  return ctx.finish<TestVoidFunc>();
+}
+
+// Creates a function that loads a vector, calls `clobber_fn`, and stores the vector doubled - SVE operations after
+// the call must use a re-materialized all-true predicate.
+static TestCopyFunc create_func_sve_invoke(JitContext& ctx, VecWidth vw, TestVoidFunc clobber_fn) {
+  ctx.prepare();
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  ctx.init_vec_width(uc, vw);
+
+  FuncNode* node = uc.add_func(FuncSignature::build<void, void*, const void*>());
+  EXPECT_NOT_NULL(node);
+
+  Gp dst_ptr = uc.new_gpz("dst_ptr");
+  Gp src_ptr = uc.new_gpz("src_ptr");
+  Gp fn_ptr = uc.new_gpz("fn_ptr");
+  Vec v = uc.new_vec_with_width(vw, "v");
+
+  node->set_arg(0, dst_ptr);
+  node->set_arg(1, src_ptr);
+
+  uc.v_loaduvec(v, mem_ptr(src_ptr));
+  uc.v_add_u32(v, v, v);
+
+  InvokeNode* invoke_node;
+  uc.mov(fn_ptr, Imm(uint64_t(uintptr_t(clobber_fn))));
+  EXPECT_EQ(uc.add_invoke_node(Out(invoke_node), a64::Inst::kIdBlr, fn_ptr, FuncSignature::build<void>()), Error::kOk);
+
+  uc.v_add_u32(v, v, v);
+  uc.v_storeuvec(mem_ptr(dst_ptr), v);
+
+  uc.end_func();
+  return ctx.finish<TestCopyFunc>();
+}
+
+static ASMJIT_NOINLINE void test_sve_invoke(JitContext& ctx) {
+  static constexpr uint32_t kBufferSize = 16u;
+
+  VecWidth sve_width;
+  {
+    ctx.prepare();
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+    sve_width = uc.max_vec_width_from_cpu_features();
+  }
+
+  bool has_sve_hw = sve_width != VecWidth::k128;
+  CpuFeatures saved_features = ctx.features;
+
+  if (!has_sve_hw) {
+    ctx.features.add(CpuFeatures::ARM::kSVE);
+    ctx.sve_vector_length = 32u;
+    sve_width = VecWidth::k256;
+  }
+
+  // An invoke while a predicate allocated by sve_alloc_pred() is in use must be rejected as the predicate would be
+  // clobbered by the call.
+  {
+    ctx.prepare();
+
+    TestRecordingErrorHandler recording_eh;
+    ctx.code.set_error_handler(&recording_eh);
+
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+    ctx.init_vec_width(uc, sve_width);
+    uc.add_func(FuncSignature::build<void>());
+
+    Gp fn_ptr = uc.new_gpz("fn_ptr");
+    uc.mov(fn_ptr, Imm(0));
+
+    a64::PReg p = uc.sve_alloc_pred();
+    InvokeNode* invoke_node;
+    EXPECT_EQ(uc.add_invoke_node(Out(invoke_node), a64::Inst::kIdBlr, fn_ptr, FuncSignature::build<void>()), Error::kInvalidState);
+    EXPECT_NULL(invoke_node);
+    EXPECT_EQ(recording_eh.last_error, Error::kInvalidState);
+    uc.sve_release_pred(p);
+
+    ctx.code.reset();
+  }
+
+  TestVoidFunc clobber_fn = create_func_sve_clobber_preds(ctx);
+  TestCopyFunc fn = create_func_sve_invoke(ctx, sve_width, clobber_fn);
+
+#if !defined(ASMJIT_NO_LOGGING)
+  {
+    const char* log = ctx.logger_content();
+    const char* call = strstr(log, "blr");
+    EXPECT_NOT_NULL(call)
+      .message("SVE invoke test doesn't contain a call:\n%s", log);
+    if (call) {
+      EXPECT_NOT_NULL(strstr(call, "ptrue"))
+        .message("SVE predicate is not re-materialized after a call:\n%s", log);
+    }
+  }
+#endif // !ASMJIT_NO_LOGGING
+
+  if (has_sve_hw) {
+    INFO("Testing JIT compiler %u-bit SVE ops across function calls", byte_width_from_vec_width(sve_width) * 8u);
+
+    uint32_t src[kBufferSize];
+    uint32_t dst[kBufferSize];
+    uint32_t n = byte_width_from_vec_width(sve_width) / 4u;
+
+    for (uint32_t i = 0; i < kBufferSize; i++) {
+      src[i] = i * 0x01010101u + 1u;
+    }
+    memset(dst, 0, sizeof(dst));
+
+    fn(dst, src);
+
+    for (uint32_t i = 0; i < n; i++) {
+      EXPECT_EQ(dst[i], src[i] * 4u)
+        .message("SVE op after a call produced a wrong result at [%u]", i);
+    }
+  }
+
+  ctx.rt.release(fn);
+  ctx.rt.release(clobber_fn);
+  ctx.sve_vector_length = 0u;
+  ctx.features = saved_features;
+}
+
+// A vector width that doesn't match the SVE vector length must be rejected, the generated code would be wrong.
+static ASMJIT_NOINLINE void test_sve_vec_width_mismatch(JitContext& ctx) {
+  CpuFeatures saved_features = ctx.features;
+  ctx.features.add(CpuFeatures::ARM::kSVE);
+  ctx.prepare();
+
+  TestRecordingErrorHandler recording_eh;
+  ctx.code.set_error_handler(&recording_eh);
+
+  UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+  uc.set_sve_vector_length(32u);
+  uc.init_vec_width(VecWidth::k512);
+
+  EXPECT_EQ(recording_eh.last_error, Error::kInvalidArgument);
+  EXPECT_EQ(uc.vec_width(), VecWidth::k128);
+  EXPECT_FALSE(uc.use_sve());
+
+  ctx.code.reset();
+  ctx.features = saved_features;
+}
+#endif // ASMJIT_UJIT_AARCH64
+
+// ujit::UniCompiler - Tests - SIMD - Runner
+// =========================================
+
+template<VecWidth kVecWidth>
+static ASMJIT_NOINLINE void test_simd_ops(JitContext& ctx) {
+  // We need to know some behaviors in advance so we can select the right test function,
+  // so create a dummy compiler and extract the necessary information from it.
+  ScalarOpBehavior scalar_op_behavior {};
+  FMAddOpBehavior fmadd_op_behavior {};
+  FloatToIntOutsideRangeBehavior float_to_int_behavior {};
+  FloatToBF16DenormalBehavior float_to_bf16_behavior {};
+
+  {
+    ctx.prepare();
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+
+    scalar_op_behavior = uc.scalar_op_behavior();
+    fmadd_op_behavior = uc.fmadd_op_behavior();
+    float_to_int_behavior = uc.float_to_int_outside_range_behavior();
+    float_to_bf16_behavior = uc.float_to_bf16_denormal_behavior();
+  }
+
+  bool valgrind_fma_bug = false;
+
+#if defined(ASMJIT_UJIT_X86)
+  // When running under valgrind there is a bug in its instrumentation of FMA SS/SD instructions.
+  // Instead of keeping the unaffected elements in the destination register they are cleared instead,
+  // which would cause test failures. So, detect whether we are running under Valgind that has this
+  // bug and avoid scalar FMA tests in that case.
+  if (fmadd_op_behavior != FMAddOpBehavior::kNoFMA) {
+    float a[4] = { 1, 2, 3, 4 };
+    float b[4] = { 2, 4, 8, 1 };
+    float c[4] = { 4, 7, 3, 9 };
+
+    float d[4] {};
+    madd_fma_check_valgrind_bug(a, b, c, d);
+
+    valgrind_fma_bug = d[1] == 0.0f;
+  }
+#endif // ASMJIT_UJIT_X86
+
+  INFO("  Testing mov");
+  {
+    test_vecop_vv<kVecWidth, UniOpVV::kMov, vec_op_mov>(ctx);
+    test_vecop_vv<kVecWidth, UniOpVV::kMovU64, vec_op_mov_u64>(ctx);
+  }
+
+  INFO("  Testing broadcast");
+  {
+    // Test all broadcasts - vector based, GP to vector, and memory to vector.
+    for (uint32_t v = 0; v < kNumVariationsVV_Broadcast; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU8Z, vec_op_broadcast_u8>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU16Z, vec_op_broadcast_u16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU8, vec_op_broadcast_u8>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU16, vec_op_broadcast_u16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU32, vec_op_broadcast_u32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastU64, vec_op_broadcast_u64>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastF32, vec_op_broadcast_u32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastF64, vec_op_broadcast_u64>(ctx, Variation{v});
+
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_U32, vec_op_broadcast_u128>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_U64, vec_op_broadcast_u128>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_F32, vec_op_broadcast_u128>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV128_F64, vec_op_broadcast_u128>(ctx, Variation{v});
+
+      if constexpr (kVecWidth > VecWidth::k256) {
+        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_U32, vec_op_broadcast_u256>(ctx, Variation{v});
+        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_U64, vec_op_broadcast_u256>(ctx, Variation{v});
+        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_F32, vec_op_broadcast_u256>(ctx, Variation{v});
+        test_vecop_vv<kVecWidth, UniOpVV::kBroadcastV256_F64, vec_op_broadcast_u256>(ctx, Variation{v});
+      }
+    }
+  }
+
+  INFO("  Testing abs (int)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsI8, vec_op_abs<int8_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsI16, vec_op_abs<int16_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsI32, vec_op_abs<int32_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsI64, vec_op_abs<int64_t>>(ctx, Variation{v});
+    }
+  }
+
+  INFO("  Testing not (int)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kNotU32, vec_op_not<uint32_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kNotU64, vec_op_not<uint64_t>>(ctx, Variation{v});
+    }
+  }
+
+  INFO("  Testing bit count (int)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kPopcntU8, vec_op_popcnt<uint8_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kPopcntU16, vec_op_popcnt<uint16_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kPopcntU32, vec_op_popcnt<uint32_t>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kPopcntU64, vec_op_popcnt<uint64_t>>(ctx, Variation{v});
+      test_vecop_vv_constraint<kVecWidth, UniOpVV::kLzcntU32, vec_op_lzcnt<uint32_t>, ConstraintRandomShift<uint32_t>>(ctx, Variation{v});
+      test_vecop_vv_constraint<kVecWidth, UniOpVV::kLzcntU64, vec_op_lzcnt<uint64_t>, ConstraintRandomShift<uint64_t>>(ctx, Variation{v});
+      test_vecop_vv_constraint<kVecWidth, UniOpVV::kTzcntU32, vec_op_tzcnt<uint32_t>, ConstraintRandomShift<uint32_t>>(ctx, Variation{v});
+      test_vecop_vv_constraint<kVecWidth, UniOpVV::kTzcntU64, vec_op_tzcnt<uint64_t>, ConstraintRandomShift<uint64_t>>(ctx, Variation{v});
+    }
+  }
+
+  INFO("  Testing cvt (int)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8LoToI16, vec_op_cvt_i8_lo_to_i16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8HiToI16, vec_op_cvt_i8_hi_to_i16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8LoToU16, vec_op_cvt_u8_lo_to_u16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8HiToU16, vec_op_cvt_u8_hi_to_u16>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI8ToI32, vec_op_cvt_i8_to_i32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU8ToU32, vec_op_cvt_u8_to_u32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI16LoToI32, vec_op_cvt_i16_lo_to_i32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI16HiToI32, vec_op_cvt_i16_hi_to_i32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU16LoToU32, vec_op_cvt_u16_lo_to_u32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU16HiToU32, vec_op_cvt_u16_hi_to_u32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI32LoToI64, vec_op_cvt_i32_lo_to_i64>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtI32HiToI64, vec_op_cvt_i32_hi_to_i64>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU32LoToU64, vec_op_cvt_u32_lo_to_u64>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtU32HiToU64, vec_op_cvt_u32_hi_to_u64>(ctx, Variation{v});
+    }
+  }
+
+  INFO("  Testing abs (float)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsF32, vec_op_fabs<float>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kAbsF64, vec_op_fabs<double>>(ctx, Variation{v});
+    }
+  }
+
+  INFO("  Testing not (float)");
+  {
     for (uint32_t v = 0; v < kNumVariationsVV; v++) {
       test_vecop_vv<kVecWidth, UniOpVV::kNotF32, vec_op_not<uint32_t>>(ctx, Variation{v});
       test_vecop_vv<kVecWidth, UniOpVV::kNotF64, vec_op_not<uint64_t>>(ctx, Variation{v});
@@ -4970,6 +6441,36 @@ static ASMJIT_NOINLINE void test_simd_ops(JitContext& ctx) {
     }
   }
 
+  INFO("  Testing cvt (f16 & bf16)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVV; v++) {
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtF16LoToF32, vec_op_cvt_f16_lo_to_f32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtF16HiToF32, vec_op_cvt_f16_hi_to_f32>(ctx, Variation{v});
+      test_vecop_vv_constraint<kVecWidth, UniOpVV::kCvtF32ToF16Lo, vec_op_cvt_f32_to_f16_lo, ConstraintScaleDownF32<31>>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtBF16LoToF32, vec_op_cvt_bf16_lo_to_f32>(ctx, Variation{v});
+      test_vecop_vv<kVecWidth, UniOpVV::kCvtBF16HiToF32, vec_op_cvt_bf16_hi_to_f32>(ctx, Variation{v});
+
+      if (float_to_bf16_behavior == FloatToBF16DenormalBehavior::kFlushToZero) {
+        constexpr FloatToBF16DenormalBehavior behavior = FloatToBF16DenormalBehavior::kFlushToZero;
+        test_vecop_vv_constraint<kVecWidth, UniOpVV::kCvtF32ToBF16Lo, vec_op_cvt_f32_to_bf16_lo<behavior>, ConstraintScaleDownF32<255>>(ctx, Variation{v});
+      }
+      else {
+        constexpr FloatToBF16DenormalBehavior behavior = FloatToBF16DenormalBehavior::kPreserve;
+        test_vecop_vv_constraint<kVecWidth, UniOpVV::kCvtF32ToBF16Lo, vec_op_cvt_f32_to_bf16_lo<behavior>, ConstraintScaleDownF32<255>>(ctx, Variation{v});
+      }
+    }
+  }
+
+  INFO("  Testing arithmetic (f16)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVVV; v++) {
+      test_vecop_vvv<kVecWidth, UniOpVVV::kAddF16, vec_op_f16_via_f32<vec_op_fadd<float>>>(ctx, Variation{v});
+      test_vecop_vvv<kVecWidth, UniOpVVV::kSubF16, vec_op_f16_via_f32<vec_op_fsub<float>>>(ctx, Variation{v});
+      test_vecop_vvv<kVecWidth, UniOpVVV::kMulF16, vec_op_f16_via_f32<vec_op_fmul<float>>>(ctx, Variation{v});
+      test_vecop_vvv<kVecWidth, UniOpVVV::kDivF16, vec_op_f16_via_f32<vec_op_fdiv<float>>>(ctx, Variation{v});
+    }
+  }
+
   INFO("  Testing bit shift");
   {
     for (uint32_t v = 0; v < kNumVariationsVVI; v++) {
@@ -5117,6 +6618,16 @@ static ASMJIT_NOINLINE void test_simd_ops(JitContext& ctx) {
     }
   }
 
+  INFO("  Testing dot product (int)");
+  {
+    for (uint32_t v = 0; v < kNumVariationsVVVV; v++) {
+      test_vecop_vvvv<kVecWidth, UniOpVVVV::kDotI8_I32, vec_op_dot_i32<int8_t, int8_t>>(ctx, Variation{v});
+      test_vecop_vvvv<kVecWidth, UniOpVVVV::kDotU8_I32, vec_op_dot_i32<uint8_t, uint8_t>>(ctx, Variation{v});
+      test_vecop_vvvv<kVecWidth, UniOpVVVV::kDotU8I8_I32, vec_op_dot_i32<uint8_t, int8_t>>(ctx, Variation{v});
+      test_vecop_vvvv<kVecWidth, UniOpVVVV::kDotI16_I32, vec_op_dot_i32<int16_t, int16_t>>(ctx, Variation{v});
+    }
+  }
+
   INFO("  Testing min / max (int)");
   {
     for (uint32_t v = 0; v < kNumVariationsVVV; v++) {
@@ -5451,6 +6962,36 @@ static ASMJIT_NOINLINE void test_simd_ops(JitContext& ctx) {
       }
     }
   }
+
+  INFO("  Testing gather & scatter");
+  {
+    test_gather_scatter_ops(ctx, kVecWidth);
+  }
+
+  INFO("  Testing load & store (f16 & bf16)");
+  {
+    test_f16_load_store_ops(ctx, kVecWidth, float_to_bf16_behavior);
+  }
+
+  INFO("  Testing compress & expand");
+  {
+    test_compress_expand_ops(ctx, kVecWidth);
+  }
+
+  INFO("  Testing table lookup");
+  {
+    test_lut_u8_ops(ctx, kVecWidth);
+  }
+
+  INFO("  Testing reduce");
+  {
+    test_reduce_ops(ctx, kVecWidth);
+  }
+
+  INFO("  Testing loop");
+  {
+    test_loop_ops(ctx, kVecWidth);
+  }
 }
 
 static void test_gp_ops(JitContext& ctx) {
@@ -5637,11 +7178,55 @@ static void test_x86_ops(JitContext& ctx, const CpuFeatures& host_features) {
 #endif // ASMJIT_UJIT_X86
 
 #if defined(ASMJIT_UJIT_AARCH64)
+// Runs SIMD tests in SVE mode at the vector length of the host. Without SVE hardware (or with a vector length that
+// UniCompiler doesn't use) the functions are only compiled for 256-bit and 512-bit vector lengths, which validates
+// the encoding of all emitted SVE instructions.
+static void test_sve_simd_ops(JitContext& ctx) {
+  VecWidth sve_width;
+  {
+    ctx.prepare();
+    UniCompiler uc(&ctx.cc, ctx.features, ctx.cpu_hints);
+    sve_width = uc.max_vec_width_from_cpu_features();
+  }
+
+  if (sve_width == VecWidth::k256) {
+    INFO("Testing JIT compiler 256-bit SVE SIMD ops");
+    test_simd_ops<VecWidth::k256>(ctx);
+    return;
+  }
+
+  if (sve_width == VecWidth::k512) {
+    INFO("Testing JIT compiler 512-bit SVE SIMD ops");
+    test_simd_ops<VecWidth::k512>(ctx);
+    return;
+  }
+
+  CpuFeatures saved_features = ctx.features;
+  ctx.features.add(CpuFeatures::ARM::kSVE);
+  ctx.compile_only = true;
+
+  INFO("Compiling JIT compiler 256-bit SVE SIMD ops (no SVE hardware)");
+  ctx.sve_vector_length = 32u;
+  test_simd_ops<VecWidth::k256>(ctx);
+
+  INFO("Compiling JIT compiler 512-bit SVE SIMD ops (no SVE hardware)");
+  ctx.sve_vector_length = 64u;
+  test_simd_ops<VecWidth::k512>(ctx);
+
+  ctx.sve_vector_length = 0u;
+  ctx.compile_only = false;
+  ctx.features = saved_features;
+}
+
 static void test_a64_ops(JitContext& ctx, const CpuFeatures& host_features) {
   ctx.features = host_features;
 
   test_gp_ops(ctx);
   test_simd_ops<VecWidth::k128>(ctx);
+  test_sve_ops(ctx);
+  test_sve_invoke(ctx);
+  test_sve_vec_width_mismatch(ctx);
+  test_sve_simd_ops(ctx);
 }
 #endif // ASMJIT_UJIT_AARCH64
 
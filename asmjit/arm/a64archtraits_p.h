@@ -39,6 +39,7 @@ static const constexpr ArchTraits a64_arch_traits = {
      | (1u << uint32_t(RegType::kVec32 ))
      | (1u << uint32_t(RegType::kVec64 ))
      | (1u << uint32_t(RegType::kVec128))
+     | (1u << uint32_t(RegType::kVecNLen))
      | (1u << uint32_t(RegType::kMask  )),
 
   // Instruction hints [Gp, Vec, Mask, Extra].
@@ -663,7 +663,6 @@ static inline bool check_vec_id(const Operand_& o0, const Operand_& o1) noexcept
   return (id0 | id1) <= 31u;
 }
 
-/* Unused at the moment.
 static inline bool check_vec_id(const Operand_& o0, const Operand_& o1, const Operand_& o2) noexcept {
   uint32_t id0 = o0.as<Reg>().id();
   uint32_t id1 = o1.as<Reg>().id();
@@ -672,6 +671,7 @@ static inline bool check_vec_id(const Operand_& o0, const Operand_& o1, const Op
   return (id0 | id1 | id2) <= 31u;
 }
 
+/* Unused at the moment.
 static inline bool check_vec_id(const Operand_& o0, const Operand_& o1, const Operand_& o2, const Operand_& o3) noexcept {
   uint32_t id0 = o0.as<Reg>().id();
   uint32_t id1 = o1.as<Reg>().id();
@@ -714,7 +714,8 @@ static inline bool check_consecutive(const Operand_& o0, const Operand_& o1, con
                   index == uint32_t(RegType::kVec16)  ? 31u       :  \
                   index == uint32_t(RegType::kVec32)  ? 31u       :  \
                   index == uint32_t(RegType::kVec64)  ? 31u       :  \
-                  index == uint32_t(RegType::kVec128) ? 31u       : 0)
+                  index == uint32_t(RegType::kVec128) ? 31u       :  \
+                  index == uint32_t(RegType::kVecNLen) ? 31u      : 0)
 static const Support::Array<uint8_t, 32> common_hi_reg_id_of_type_table = {{
   ASMJIT_LOOKUP_TABLE_32(V, 0)
 }};
@@ -742,6 +743,81 @@ static inline bool check_valid_regs(const Operand_& o0, const Operand_& o1, cons
               (unsigned(o3.id() < 31) | unsigned(o3.id() == common_hi_reg_id_of_type_table[o3.as<Reg>().reg_type()])));
 }
 
+// a64::Assembler - SVE Utilities
+// ==============================
+
+// Maps an ASIMD instruction to an SVE instruction of the same name, which is used when the instruction has a scalable
+// vector (Z) destination. Returns `Inst::kIdNone` if there is no such SVE instruction.
+static InstId sve_inst_id_from_asimd(InstId inst_id) noexcept {
+  switch (inst_id) {
+    case Inst::kIdAdd_v : return Inst::kIdAdd_z;
+    case Inst::kIdAnd_v : return Inst::kIdAnd_z;
+    case Inst::kIdBcax_v: return Inst::kIdBcax_z;
+    case Inst::kIdBic_v : return Inst::kIdBic_z;
+    case Inst::kIdDup_v : return Inst::kIdDup_z;
+    case Inst::kIdEor_v : return Inst::kIdEor_z;
+    case Inst::kIdEor3_v: return Inst::kIdEor3_z;
+    case Inst::kIdFadd_v: return Inst::kIdFadd_z;
+    case Inst::kIdFmul_v: return Inst::kIdFmul_z;
+    case Inst::kIdFsub_v: return Inst::kIdFsub_z;
+    case Inst::kIdLdr_v : return Inst::kIdLdr_z;
+    case Inst::kIdMul_v : return Inst::kIdMul_z;
+    case Inst::kIdOrr_v : return Inst::kIdOrr_z;
+    case Inst::kIdStr_v : return Inst::kIdStr_z;
+    case Inst::kIdSub_v : return Inst::kIdSub_z;
+    case Inst::kIdTbl_v : return Inst::kIdTbl_z;
+    case Inst::kIdTrn1_v: return Inst::kIdTrn1_z;
+    case Inst::kIdTrn2_v: return Inst::kIdTrn2_z;
+    case Inst::kIdUzp1_v: return Inst::kIdUzp1_z;
+    case Inst::kIdUzp2_v: return Inst::kIdUzp2_z;
+    case Inst::kIdZip1_v: return Inst::kIdZip1_z;
+    case Inst::kIdZip2_v: return Inst::kIdZip2_z;
+    default:
+      return Inst::kIdNone;
+  }
+}
+
+static inline bool is_sve_z(const Operand_& op) noexcept { return op.as<Reg>().is_reg(RegType::kVecNLen); }
+static inline bool is_sve_p(const Operand_& op) noexcept { return op.as<Reg>().is_reg(RegType::kMask); }
+
+// Returns SVE element size (0=B, 1=H, 2=S, 3=D) of a Z or P register, or a value greater than 3 if the register
+// doesn't have B, H, S, or D element type.
+static inline uint32_t sve_element_size(const Operand_& op) noexcept {
+  return op._signature.get_field<Vec::kSignatureRegElementTypeMask>() - uint32_t(VecElementType::kB);
+}
+
+static inline bool sve_check_size(uint32_t sz, uint32_t allowed_sizes) noexcept {
+  return sz <= 3u && Support::bit_test(allowed_sizes, sz);
+}
+
+// Checks a governing predicate, which must use either no predication qualifier or `mode`, and its id must fit into
+// the Pg field (3 bits for most instructions, 4 bits for instructions that can use all predicate registers).
+static inline bool check_sve_pg(const Operand_& op, uint32_t max_id, PredMode mode) noexcept {
+  PredMode op_mode = op.as<PReg>().pred_mode();
+  return op.id() <= max_id && (op_mode == PredMode::kNone || op_mode == mode);
+}
+
+// Checks a predicate that is not governing (it cannot have a predication qualifier).
+static inline bool check_sve_pd(const Operand_& op) noexcept {
+  return op.id() <= 15u && op.as<PReg>().pred_mode() == PredMode::kNone;
+}
+
+// Opcodes of SVE loads and stores, indexed by `InstDB::SveLdStKind`.
+struct SveLdStOpcodes {
+  uint32_t imm_op;      // [Xn, #imm, MUL VL]
+  uint32_t reg_op;      // [Xn, Xm, LSL #msz]
+  uint32_t vec32_op;    // [Xn, Zm.S, UXTW|SXTW {#msz}]
+  uint32_t vec64_op;    // [Xn, Zm.D {, LSL #msz}]
+  uint32_t vec64x_op;   // [Xn, Zm.D, UXTW|SXTW {#msz}]
+  uint32_t xs_bit;      // Bit index of XS (sign-extended 32-bit offsets).
+};
+
+static const SveLdStOpcodes sve_ld_st_opcodes[3] = {
+  { 0xA400A000u, 0xA4004000u, 0x84004000u, 0xC440C000u, 0xC4004000u, 22 }, // LD1x
+  { 0x00000000u, 0xA4006000u, 0x84006000u, 0xC440E000u, 0xC4006000u, 22 }, // LDFF1x
+  { 0xE400E000u, 0xE4004000u, 0xE4408000u, 0xE400A000u, 0xE4008000u, 14 }  // ST1x
+};
+
 // a64::Assembler - Construction & Destruction
 // ===========================================
 
@@ -796,6 +872,14 @@ Error Assembler::_emit(InstId inst_id, const Operand_& o0, const Operand_& o1, c
     inst_id = 0;
   }
 
+  // ASIMD instruction used with a scalable vector (Z) destination is encoded as an SVE instruction of the same name.
+  if (ASMJIT_UNLIKELY(o0.is_reg(RegType::kVecNLen))) {
+    InstId sve_inst_id = sve_inst_id_from_asimd(inst_id);
+    if (sve_inst_id != Inst::kIdNone) {
+      inst_id = sve_inst_id;
+    }
+  }
+
   const InstDB::InstInfo* inst_info = &InstDB::_inst_info_table[inst_id];
   uint32_t encoding_index = inst_info->_encoding_data_index;
 
@@ -4964,6 +5048,755 @@ Case_SimdLdurStur:
       goto EmitOp_Rd0;
     }
 
+    // ------------------------------------------------------------------------
+    // [SVE]
+    // ------------------------------------------------------------------------
+
+    case InstDB::kEncodingSveZZZ: {
+      const InstDB::EncodingData::SveZZZ& op_data = InstDB::EncodingData::sveZZZ[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        if (!op_data.zzz_op || !is_sve_z(o0) || !check_signature(o0, o1, o2))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (op_data.zzz_unsized) {
+          if (o0.as<Vec>().has_element_type() && sz > 3u)
+            goto InvalidInstruction;
+          sz = 0;
+        }
+        else if (!sve_check_size(sz, op_data.sizes)) {
+          goto InvalidInstruction;
+        }
+
+        opcode.reset(op_data.zzz_op);
+        opcode.add_imm(sz, 22);
+        goto EmitOp_Rd0_Rn5_Rm16;
+      }
+
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!op_data.zpzz_op || !is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2, o3) || o0.id() != o2.id())
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (!sve_check_size(sz, op_data.sizes))
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o3) || !check_sve_pg(o1, 7, PredMode::kMerging))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.zpzz_op);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o3, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveZPZZa: {
+      const InstDB::EncodingData::SveZPZZa& op_data = InstDB::EncodingData::sveZPZZa[encoding_index];
+
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2, o3))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (!sve_check_size(sz, op_data.sizes))
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2, o3) || !check_sve_pg(o1, 7, PredMode::kMerging))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o3, 16);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveZPZ: {
+      const InstDB::EncodingData::SveZPZ& op_data = InstDB::EncodingData::sveZPZ[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (!sve_check_size(sz, op_data.sizes))
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2) || !check_sve_pg(o1, 7, PredMode::kMerging))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveCvt: {
+      const InstDB::EncodingData::SveCvt& op_data = InstDB::EncodingData::sveCvt[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz != 2u && sz != 3u)
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2) || !check_sve_pg(o1, 7, PredMode::kMerging))
+          goto InvalidPhysId;
+
+        opcode.reset(sz == 2u ? op_data.op_s : op_data.op_d);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveShift: {
+      const InstDB::EncodingData::SveShift& op_data = InstDB::EncodingData::sveShift[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Imm)) {
+        if (!is_sve_z(o0) || !check_signature(o0, o1))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        // The shift amount is encoded together with the element size in `tsz:imm3` fields.
+        uint32_t esize = 8u << sz;
+        uint64_t shift = o2.as<Imm>().value_as<uint64_t>();
+        uint32_t v;
+
+        if (op_data.left) {
+          if (shift >= esize)
+            goto InvalidImmediate;
+          v = esize + uint32_t(shift);
+        }
+        else {
+          if (shift == 0u || shift > esize)
+            goto InvalidImmediate;
+          v = esize * 2u - uint32_t(shift);
+        }
+
+        opcode.reset(op_data.imm_op);
+        opcode.add_imm(v >> 5, 22);
+        opcode.add_imm((v >> 3) & 0x3u, 19);
+        opcode.add_imm(v & 0x7u, 16);
+        goto EmitOp_Rd0_Rn5;
+      }
+
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2, o3) || o0.id() != o2.id())
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o3) || !check_sve_pg(o1, 7, PredMode::kMerging))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.zpzz_op);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o3, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveDup: {
+      if (!is_sve_z(o0))
+        goto InvalidInstruction;
+
+      uint32_t sz = sve_element_size(o0);
+
+      if (isign4 == ENC_OPS2(Reg, Reg) && is_sve_z(o1)) {
+        // DUP Zd.T, Zn.T[imm] - the element index and the element size are encoded together as `imm2:tsz`, where
+        // the lowest set bit of `tsz` selects the element size and the bits above it hold the index. Registers
+        // without an element type select the quadword form (DUP Zd.Q, Zn.Q[imm]).
+        if (o0.as<Vec>().has_element_type()) {
+          if (sz > 3u || sve_element_size(o1) != sz)
+            goto InvalidInstruction;
+        }
+        else {
+          if (o1.as<Vec>().has_element_type())
+            goto InvalidInstruction;
+          sz = 4u;
+        }
+
+        if (!o1.as<Vec>().has_element_index())
+          goto InvalidInstruction;
+
+        uint32_t index = o1.as<Vec>().element_index();
+        if (index >= (64u >> sz))
+          goto InvalidElementIndex;
+
+        if (!check_vec_id(o0, o1))
+          goto InvalidPhysId;
+
+        uint32_t imm7 = ((index << 1) | 1u) << sz;
+
+        opcode.reset(0x05202000u);
+        opcode.add_imm(imm7 >> 5, 22);
+        opcode.add_imm(imm7 & 0x1Fu, 16);
+        opcode.add_reg(o1, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      if (sz > 3u)
+        goto InvalidInstruction;
+
+      if (isign4 == ENC_OPS2(Reg, Reg)) {
+        // DUP Zd.T, Wn|WSP (B, H, S) or Xn|SP (D).
+        if (!check_gp_type(o1, sz == 3u ? 2u : 1u))
+          goto InvalidInstruction;
+
+        if (!check_gp_id(o1, kSP))
+          goto InvalidPhysId;
+
+        if (!check_vec_id(o0))
+          goto InvalidPhysId;
+
+        opcode.reset(0x05203800u);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      if (isign4 == ENC_OPS2(Reg, Imm)) {
+        // DUP Zd.T, #imm8 {, LSL #8}.
+        int64_t imm = o1.as<Imm>().value();
+        uint32_t sh = 0;
+
+        if (Support::is_int_n<8>(imm) || (sz == 0u && Support::is_uint_n<8>(imm))) {
+          imm &= 0xFF;
+        }
+        else if (sz != 0u && (imm & 0xFF) == 0 && Support::is_int_n<8>(imm >> 8)) {
+          imm = (imm >> 8) & 0xFF;
+          sh = 1;
+        }
+        else {
+          goto InvalidImmediate;
+        }
+
+        opcode.reset(0x2538C000u);
+        opcode.add_imm(sz, 22);
+        opcode.add_imm(sh, 13);
+        opcode.add_imm(imm, 5);
+        goto EmitOp_Rd0;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveCpy: {
+      // CPY Zd.T, Pg/Z|Pg/M, #imm8 {, LSL #8}.
+      if (isign4 == ENC_OPS3(Reg, Reg, Imm)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        PredMode pred_mode = o1.as<PReg>().pred_mode();
+        if (pred_mode == PredMode::kNone)
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0) || o1.id() > 15u)
+          goto InvalidPhysId;
+
+        int64_t imm = o2.as<Imm>().value();
+        uint32_t sh = 0;
+
+        if (Support::is_int_n<8>(imm) || (sz == 0u && Support::is_uint_n<8>(imm))) {
+          imm &= 0xFF;
+        }
+        else if (sz != 0u && (imm & 0xFF) == 0 && Support::is_int_n<8>(imm >> 8)) {
+          imm = (imm >> 8) & 0xFF;
+          sh = 1;
+        }
+        else {
+          goto InvalidImmediate;
+        }
+
+        opcode.reset(0x05100000u);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 16);
+        opcode.add_if(B(14), pred_mode == PredMode::kMerging);
+        opcode.add_imm(sh, 13);
+        opcode.add_imm(uint32_t(imm), 5);
+        goto EmitOp_Rd0;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveCmp: {
+      const InstDB::EncodingData::SveCmp& op_data = InstDB::EncodingData::sveCmp[encoding_index];
+
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!is_sve_p(o0) || !is_sve_p(o1) || !is_sve_z(o2) || !check_signature(o2, o3))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o2);
+        if (!sve_check_size(sz, op_data.sizes) || sve_element_size(o0) != sz)
+          goto InvalidInstruction;
+
+        if (!check_sve_pd(o0) || !check_vec_id(o2, o3) || !check_sve_pg(o1, 7, PredMode::kZeroing))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o3, 16);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveSel: {
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !is_sve_p(o1) || !check_signature(o0, o2, o3))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2, o3) || !check_sve_pd(o1))
+          goto InvalidPhysId;
+
+        opcode.reset(0x0520C000u);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o3, 16);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveReduce: {
+      const InstDB::EncodingData::SveReduce& op_data = InstDB::EncodingData::sveReduce[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        if (!is_sve_p(o1) || !is_sve_z(o2) || o0.as<Vec>().has_element_type())
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o2);
+        if (!sve_check_size(sz, op_data.sizes))
+          goto InvalidInstruction;
+
+        // The destination is a scalar SIMD&FP register of the element size (or always D if the result is wide).
+        RegType dst_type = op_data.wide ? RegType::kVec64 : RegType(uint32_t(RegType::kVec8) + sz);
+        if (!o0.as<Reg>().is_reg(dst_type))
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2) || !check_sve_pg(o1, 7, PredMode::kNone))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o1, 10);
+        opcode.add_reg(o2, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSvePtrue: {
+      const InstDB::EncodingData::SvePtrue& op_data = InstDB::EncodingData::svePtrue[encoding_index];
+
+      uint32_t pattern = 31;
+      if (isign4 == ENC_OPS2(Reg, Imm)) {
+        if (o1.as<Imm>().value_as<uint64_t>() > 31u)
+          goto InvalidImmediate;
+        pattern = o1.as<Imm>().value_as<uint32_t>();
+      }
+      else if (isign4 != ENC_OPS1(Reg)) {
+        break;
+      }
+
+      if (!is_sve_p(o0))
+        goto InvalidInstruction;
+
+      uint32_t sz = sve_element_size(o0);
+      if (sz > 3u)
+        goto InvalidInstruction;
+
+      if (!check_sve_pd(o0))
+        goto InvalidPhysId;
+
+      opcode.reset(op_data.opcode);
+      opcode.add_imm(sz, 22);
+      opcode.add_imm(pattern, 5);
+      opcode.add_reg(o0, 0);
+      goto EmitOp;
+    }
+
+    case InstDB::kEncodingSveP: {
+      const InstDB::EncodingData::SveP& op_data = InstDB::EncodingData::sveP[encoding_index];
+
+      if (isign4 == ENC_OPS1(Reg)) {
+        if (!is_sve_p(o0))
+          goto InvalidInstruction;
+
+        if (o0.as<PReg>().has_element_type() && sve_element_size(o0) != 0u)
+          goto InvalidInstruction;
+
+        if (!check_sve_pd(o0))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveWhile: {
+      const InstDB::EncodingData::SveWhile& op_data = InstDB::EncodingData::sveWhile[encoding_index];
+
+      if (isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        uint32_t x;
+        if (!is_sve_p(o0) || !check_gp_type(o1, o2, kWX, &x))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        if (!check_sve_pd(o0) || !check_gp_id(o1, o2))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_imm(sz, 22);
+        opcode.add_reg(o2, 16);
+        opcode.add_imm(x, 12);
+        opcode.add_reg(o1, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveCnt: {
+      const InstDB::EncodingData::SveCnt& op_data = InstDB::EncodingData::sveCnt[encoding_index];
+
+      uint32_t pattern = 31;
+      uint32_t mul = 1;
+
+      if (isign4 == ENC_OPS3(Reg, Imm, Imm)) {
+        if (o2.as<Imm>().value() < 1 || o2.as<Imm>().value() > 16)
+          goto InvalidImmediate;
+        mul = o2.as<Imm>().value_as<uint32_t>();
+      }
+      else if (isign4 != ENC_OPS2(Reg, Imm) && isign4 != ENC_OPS1(Reg)) {
+        break;
+      }
+
+      if (o1.is_imm()) {
+        if (o1.as<Imm>().value_as<uint64_t>() > 31u)
+          goto InvalidImmediate;
+        pattern = o1.as<Imm>().value_as<uint32_t>();
+      }
+
+      if (!check_gp_type(o0, 2u))
+        goto InvalidInstruction;
+
+      opcode.reset(op_data.opcode);
+      opcode.add_imm(mul - 1u, 16);
+      opcode.add_imm(pattern, 5);
+      goto EmitOp_Rd0;
+    }
+
+    case InstDB::kEncodingSveAddVl: {
+      const InstDB::EncodingData::SveAddVl& op_data = InstDB::EncodingData::sveAddVl[encoding_index];
+
+      const Operand_* imm_op;
+
+      if (op_data.has_rn) {
+        // ADDVL|ADDPL Xd|SP, Xn|SP, #imm.
+        if (isign4 != ENC_OPS3(Reg, Reg, Imm))
+          break;
+
+        if (!check_gp_type(o0, 2u) || !check_gp_type(o1, 2u))
+          goto InvalidInstruction;
+
+        if (!check_gp_id(o0, o1, kSP))
+          goto InvalidPhysId;
+
+        imm_op = &o2;
+      }
+      else {
+        // RDVL Xd, #imm.
+        if (isign4 != ENC_OPS2(Reg, Imm))
+          break;
+
+        if (!check_gp_type(o0, 2u))
+          goto InvalidInstruction;
+
+        if (!check_gp_id(o0))
+          goto InvalidPhysId;
+
+        imm_op = &o1;
+      }
+
+      int64_t imm = imm_op->as<Imm>().value();
+      if (imm < -32 || imm > 31)
+        goto InvalidImmediate;
+
+      opcode.reset(op_data.opcode);
+      opcode.add_imm(uint32_t(imm) & 0x3Fu, 5);
+      opcode.add_reg(o0, 0);
+      if (op_data.has_rn)
+        opcode.add_reg(o1, 16);
+      goto EmitOp;
+    }
+
+    case InstDB::kEncodingSveZZZZ: {
+      const InstDB::EncodingData::SveZZZZ& op_data = InstDB::EncodingData::sveZZZZ[encoding_index];
+
+      if (isign4 == ENC_OPS4(Reg, Reg, Reg, Reg)) {
+        if (!is_sve_z(o0) || !check_signature(o0, o1, o2, o3) || o0.id() != o1.id())
+          goto InvalidInstruction;
+
+        if (o0.as<Vec>().has_element_type() && sve_element_size(o0) != 3u)
+          goto InvalidInstruction;
+
+        if (!check_vec_id(o0, o2, o3))
+          goto InvalidPhysId;
+
+        opcode.reset(op_data.opcode);
+        opcode.add_reg(o2, 16);
+        opcode.add_reg(o3, 5);
+        opcode.add_reg(o0, 0);
+        goto EmitOp;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveIndex: {
+      if (isign4 == ENC_OPS3(Reg, Imm, Imm) || isign4 == ENC_OPS3(Reg, Imm, Reg) ||
+          isign4 == ENC_OPS3(Reg, Reg, Imm) || isign4 == ENC_OPS3(Reg, Reg, Reg)) {
+        if (!is_sve_z(o0))
+          goto InvalidInstruction;
+
+        uint32_t sz = sve_element_size(o0);
+        if (sz > 3u)
+          goto InvalidInstruction;
+
+        // INDEX Zd.T, imm5|Rn, imm5|Rm - registers are X if the element size is D, W otherwise.
+        uint32_t gp_allowed = sz == 3u ? 2u : 1u;
+        uint32_t fields[2];
+
+        opcode.reset(0x04204000u);
+        for (uint32_t i = 0; i < 2; i++) {
+          const Operand_& op = i == 0 ? o1 : o2;
+          if (op.is_imm()) {
+            int64_t imm = op.as<Imm>().value();
+            if (imm < -16 || imm > 15)
+              goto InvalidImmediate;
+            fields[i] = uint32_t(imm) & 0x1Fu;
+          }
+          else {
+            if (!check_gp_type(op, gp_allowed))
+              goto InvalidInstruction;
+
+            if (!check_gp_id(op))
+              goto InvalidPhysId;
+
+            fields[i] = op.id() & 0x1Fu;
+            opcode |= B(10 + i);
+          }
+        }
+
+        opcode.add_imm(sz, 22);
+        opcode.add_imm(fields[1], 16);
+        opcode.add_imm(fields[0], 5);
+        goto EmitOp_Rd0;
+      }
+
+      break;
+    }
+
+    case InstDB::kEncodingSveLdrStr: {
+      const InstDB::EncodingData::SveLdrStr& op_data = InstDB::EncodingData::sveLdrStr[encoding_index];
+
+      // LDR|STR Zt|Pt, [Xn|SP {, #imm, MUL VL}] - the offset is in multiples of the register size.
+      if (isign4 != ENC_OPS2(Reg, Mem))
+        break;
+
+      if (!is_sve_z(o0) && !is_sve_p(o0))
+        goto InvalidInstruction;
+
+      if (o0.as<Vec>().has_element_type_or_index() || (is_sve_p(o0) && o0.as<PReg>().pred_mode() != PredMode::kNone))
+        goto InvalidInstruction;
+
+      if (o0.id() > (is_sve_z(o0) ? 31u : 15u))
+        goto InvalidPhysId;
+
+      const Mem& m = o1.as<Mem>();
+      if (!check_mem_base(m) || m.has_index() || !m.is_fixed_offset())
+        goto InvalidAddress;
+
+      int64_t offset = m.offset();
+      if (offset < -256 || offset > 255)
+        goto InvalidDisplacement;
+
+      opcode.reset(op_data.opcode);
+      if (is_sve_p(o0))
+        opcode &= ~B(14);
+
+      opcode.add_imm((uint32_t(offset) >> 3) & 0x3Fu, 16);
+      opcode.add_imm(uint32_t(offset) & 0x7u, 10);
+      opcode.add_reg(m.base_id(), 5);
+      opcode.add_reg(o0, 0);
+      goto EmitOp;
+    }
+
+    case InstDB::kEncodingSveLdSt: {
+      const InstDB::EncodingData::SveLdSt& op_data = InstDB::EncodingData::sveLdSt[encoding_index];
+      const SveLdStOpcodes& ops = sve_ld_st_opcodes[op_data.kind];
+
+      if (isign4 != ENC_OPS3(Reg, Reg, Mem))
+        break;
+
+      if (!is_sve_z(o0) || !is_sve_p(o1))
+        goto InvalidInstruction;
+
+      uint32_t esz = sve_element_size(o0);
+      uint32_t msz = op_data.msz;
+
+      if (esz > 3u || esz < msz)
+        goto InvalidInstruction;
+
+      // Loads use zeroing predication, stores don't use any predication qualifier.
+      PredMode pred_mode = op_data.kind == InstDB::kSveSt ? PredMode::kNone : PredMode::kZeroing;
+      if (!check_vec_id(o0) || !check_sve_pg(o1, 7, pred_mode))
+        goto InvalidPhysId;
+
+      const Mem& m = o2.as<Mem>();
+
+      if (!check_mem_base(m) || !m.is_fixed_offset())
+        goto InvalidAddress;
+
+      if (m.index_type() == RegType::kVecNLen) {
+        // Gather load or scatter store - [Xn, Zm.T {, SHIFT_OP #msz}].
+        if (m.has_offset())
+          goto InvalidDisplacement;
+
+        if (m.index_id() > 31u)
+          goto InvalidPhysId;
+
+        ShiftOp sop = m.shift_op();
+        uint32_t shift = m.shift();
+        bool extend = sop == ShiftOp::kUXTW || sop == ShiftOp::kSXTW;
+
+        if (shift != 0u && (shift != msz || msz == 0u))
+          goto InvalidAddressScale;
+
+        if (esz == 2u) {
+          // 32-bit offsets - requires UXTW|SXTW.
+          if (!extend || msz > 2u)
+            goto InvalidAddress;
+          opcode.reset(ops.vec32_op);
+        }
+        else if (esz == 3u) {
+          // 64-bit offsets - either LSL (unpacked 64-bit offsets) or UXTW|SXTW (unpacked 32-bit offsets).
+          if (!extend && sop != ShiftOp::kLSL)
+            goto InvalidAddress;
+          opcode.reset(extend ? ops.vec64x_op : ops.vec64_op);
+        }
+        else {
+          goto InvalidInstruction;
+        }
+
+        opcode.add_imm(msz, 23);
+        opcode.add_if(B(21), shift != 0u);
+        opcode.add_if(B(ops.xs_bit), sop == ShiftOp::kSXTW);
+        opcode.add_reg(m.index_id(), 16);
+      }
+      else if (m.has_index()) {
+        // Contiguous - [Xn, Xm, LSL #msz].
+        if (m.index_type() != RegType::kGp64 || m.has_offset())
+          goto InvalidAddress;
+
+        if (m.index_id() > 30u)
+          goto InvalidPhysId;
+
+        if (m.shift_op() != ShiftOp::kLSL || m.shift() != msz)
+          goto InvalidAddressScale;
+
+        opcode.reset(ops.reg_op);
+        opcode.add_imm(msz, 23);
+        opcode.add_imm(esz, 21);
+        opcode.add_reg(m.index_id(), 16);
+      }
+      else if (op_data.kind == InstDB::kSveLdFF) {
+        // Contiguous first-faulting - [Xn] is encoded as [Xn, XZR].
+        if (m.has_offset())
+          goto InvalidDisplacement;
+
+        opcode.reset(ops.reg_op);
+        opcode.add_imm(msz, 23);
+        opcode.add_imm(esz, 21);
+        opcode.add_imm(31u, 16);
+      }
+      else {
+        // Contiguous - [Xn {, #imm, MUL VL}], where the offset is in multiples of the vector length.
+        int64_t offset = m.offset();
+        if (offset < -8 || offset > 7)
+          goto InvalidDisplacement;
+
+        opcode.reset(ops.imm_op);
+        opcode.add_imm(msz, 23);
+        opcode.add_imm(esz, 21);
+        opcode.add_imm(uint32_t(offset) & 0xFu, 16);
+      }
+
+      opcode.add_reg(o1, 10);
+      opcode.add_reg(m.base_id(), 5);
+      opcode.add_reg(o0, 0);
+      goto EmitOp;
+    }
+
     default:
       break;
   }
@@ -46,6 +46,12 @@ public:
 
   ASMJIT_API Error finalize() override;
 
+  //! Like \ref finalize(), but assembles independent parts of the code in parallel by using the given `executor`.
+  //!
+  //! The output is functionally equivalent to \ref finalize(), but it's not guaranteed to be byte-to-byte identical
+  //! as each part of the code starts at an aligned offset. See \ref BaseBuilder::serialize_parallel_to() for details.
+  ASMJIT_API Error finalize_parallel(TaskExecutor& executor);
+
   //! \}
 };
 
@@ -67,6 +67,10 @@ Error Compiler::finalize() {
   return serialize_to(&a);
 }
 
+Error Compiler::finalize_parallel(TaskExecutor& executor) {
+  return _finalize_parallel_t<Assembler>(executor);
+}
+
 ASMJIT_END_SUB_NAMESPACE
 
 #endif // !ASMJIT_NO_AARCH64 && !ASMJIT_NO_COMPILER
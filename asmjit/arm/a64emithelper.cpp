@@ -18,6 +18,24 @@
 
 ASMJIT_BEGIN_SUB_NAMESPACE(a64)
 
+// a64::EmitHelper - Utilities
+// ===========================
+
+// Scalable vector registers (Z) are loaded and stored by LDR/STR (vector), which address memory in multiples of the
+// vector length. The size of `type_id` is the vector length of the generated code (the size of the virtual register).
+// Offsets of register home slots are scaled when the RA pass rewrites them (see `ARMRAPass::rewrite()`).
+static Error scale_sve_mem_offset(Mem& mem, TypeId type_id) noexcept {
+  int64_t vl = int64_t(TypeUtils::size_of(type_id));
+  int64_t offset = mem.offset();
+
+  if (ASMJIT_UNLIKELY(!vl || (offset % vl) != 0)) {
+    return make_error(Error::kInvalidDisplacement);
+  }
+
+  mem.set_offset(offset / vl);
+  return Error::kOk;
+}
+
 // a64::EmitHelper - Emit Operations
 // =================================
 
@@ -66,6 +84,11 @@ ASMJIT_FAVOR_SIZE Error EmitHelper::emit_reg_move(
           return emitter->ldr(dst.as<Vec>().q(), src);
         }
 
+        if (dst.is_reg(RegType::kVecNLen)) {
+          ASMJIT_PROPAGATE(scale_sve_mem_offset(src, type_id));
+          return emitter->emit(Inst::kIdLdr_z, dst.as<Vec>().z(), src);
+        }
+
         break;
       }
     }
@@ -105,6 +128,11 @@ ASMJIT_FAVOR_SIZE Error EmitHelper::emit_reg_move(
           return emitter->str(src.as<Vec>().q(), dst);
         }
 
+        if (src.is_reg(RegType::kVecNLen)) {
+          ASMJIT_PROPAGATE(scale_sve_mem_offset(dst, type_id));
+          return emitter->emit(Inst::kIdStr_z, src.as<Vec>().z(), dst);
+        }
+
         break;
       }
     }
@@ -138,6 +166,11 @@ ASMJIT_FAVOR_SIZE Error EmitHelper::emit_reg_move(
           return emitter->mov(dst.as<Vec>().b16(), src.as<Vec>().b16());
         }
 
+        if (dst.is_reg(RegType::kVecNLen)) {
+          // MOV Zd.D, Zn.D is an alias of ORR Zd.D, Zn.D, Zn.D.
+          return emitter->orr(dst.as<Vec>().d(), src.as<Vec>().d(), src.as<Vec>().d());
+        }
+
         break;
       }
     }
@@ -1267,6 +1267,180 @@ struct EmitterExplicitT {
   ASMJIT_INST_3x(usmmla, Usmmla_v, Vec, Vec, Vec)
 
   //! \}
+
+  //! \name SVE Instructions
+  //! \{
+
+  // NOTE: ASIMD instructions that share their name and operands with an SVE instruction (like `add`, `and_`, `eor`,
+  // `tbl`, `zip1`, `dup`, `ldr`, or `str`) are encoded as SVE instructions when the destination is a scalable vector
+  // register (Z), thus they are not repeated here. The offset of SVE contiguous loads and stores and of `ldr` and `str`
+  // of Z and P registers (`ptr(x0, 2)`) is in multiples of the register size (`[x0, #2, MUL VL]`).
+
+  ASMJIT_INST_3x(abs, Abs_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(add, Add_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(addpl, Addpl_z, Gp, Gp, Imm)
+  ASMJIT_INST_3x(addvl, Addvl_z, Gp, Gp, Imm)
+  ASMJIT_INST_4x(and_, And_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(andv, Andv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(asr, Asr_z, Vec, Vec, Imm)
+  ASMJIT_INST_4x(asr, Asr_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(bic, Bic_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(cls, Cls_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(clz, Clz_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(cmpeq, Cmpeq_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(cmpge, Cmpge_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(cmpgt, Cmpgt_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(cmphi, Cmphi_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(cmphs, Cmphs_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(cmpne, Cmpne_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_3x(cnt, Cnt_z, Vec, PReg, Vec)
+  ASMJIT_INST_1x(cntb, Cntb_z, Gp)
+  ASMJIT_INST_2x(cntb, Cntb_z, Gp, Imm)
+  ASMJIT_INST_3x(cntb, Cntb_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(cntd, Cntd_z, Gp)
+  ASMJIT_INST_2x(cntd, Cntd_z, Gp, Imm)
+  ASMJIT_INST_3x(cntd, Cntd_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(cnth, Cnth_z, Gp)
+  ASMJIT_INST_2x(cnth, Cnth_z, Gp, Imm)
+  ASMJIT_INST_3x(cnth, Cnth_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(cntw, Cntw_z, Gp)
+  ASMJIT_INST_2x(cntw, Cntw_z, Gp, Imm)
+  ASMJIT_INST_3x(cntw, Cntw_z, Gp, Imm, Imm)
+  ASMJIT_INST_3x(cpy, Cpy_z, Vec, PReg, Imm)
+  ASMJIT_INST_1x(decb, Decb_z, Gp)
+  ASMJIT_INST_2x(decb, Decb_z, Gp, Imm)
+  ASMJIT_INST_3x(decb, Decb_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(decd, Decd_z, Gp)
+  ASMJIT_INST_2x(decd, Decd_z, Gp, Imm)
+  ASMJIT_INST_3x(decd, Decd_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(dech, Dech_z, Gp)
+  ASMJIT_INST_2x(dech, Dech_z, Gp, Imm)
+  ASMJIT_INST_3x(dech, Dech_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(decw, Decw_z, Gp)
+  ASMJIT_INST_2x(decw, Decw_z, Gp, Imm)
+  ASMJIT_INST_3x(decw, Decw_z, Gp, Imm, Imm)
+  ASMJIT_INST_2x(dup, Dup_z, Vec, Imm)
+  ASMJIT_INST_4x(eor, Eor_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(eorv, Eorv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(fabs, Fabs_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fadd, Fadd_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(faddv, Faddv_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fcmeq, Fcmeq_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fcmge, Fcmge_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fcmgt, Fcmgt_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fcmne, Fcmne_z, PReg, PReg, Vec, Vec)
+  ASMJIT_INST_3x(fcvtzs, Fcvtzs_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(fcvtzu, Fcvtzu_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fdiv, Fdiv_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fmax, Fmax_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fmaxnm, Fmaxnm_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(fmaxnmv, Fmaxnmv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(fmaxv, Fmaxv_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fmin, Fmin_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fminnm, Fminnm_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(fminnmv, Fminnmv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(fminv, Fminv_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fmla, Fmla_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fmls, Fmls_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fmul, Fmul_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(fneg, Fneg_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fnmla, Fnmla_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(fnmls, Fnmls_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(frintm, Frintm_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(frintn, Frintn_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(frintp, Frintp_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(frintz, Frintz_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(fsqrt, Fsqrt_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(fsub, Fsub_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_1x(incb, Incb_z, Gp)
+  ASMJIT_INST_2x(incb, Incb_z, Gp, Imm)
+  ASMJIT_INST_3x(incb, Incb_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(incd, Incd_z, Gp)
+  ASMJIT_INST_2x(incd, Incd_z, Gp, Imm)
+  ASMJIT_INST_3x(incd, Incd_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(inch, Inch_z, Gp)
+  ASMJIT_INST_2x(inch, Inch_z, Gp, Imm)
+  ASMJIT_INST_3x(inch, Inch_z, Gp, Imm, Imm)
+  ASMJIT_INST_1x(incw, Incw_z, Gp)
+  ASMJIT_INST_2x(incw, Incw_z, Gp, Imm)
+  ASMJIT_INST_3x(incw, Incw_z, Gp, Imm, Imm)
+  ASMJIT_INST_3x(index, Index_z, Vec, Imm, Imm)
+  ASMJIT_INST_3x(index, Index_z, Vec, Imm, Gp)
+  ASMJIT_INST_3x(index, Index_z, Vec, Gp, Imm)
+  ASMJIT_INST_3x(index, Index_z, Vec, Gp, Gp)
+  ASMJIT_INST_3x(ld1b, Ld1b_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ld1d, Ld1d_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ld1h, Ld1h_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ld1w, Ld1w_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ldff1b, Ldff1b_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ldff1d, Ldff1d_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ldff1h, Ldff1h_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(ldff1w, Ldff1w_z, Vec, PReg, Mem)
+  ASMJIT_INST_2x(ldr, Ldr_z, PReg, Mem)
+  ASMJIT_INST_3x(lsl, Lsl_z, Vec, Vec, Imm)
+  ASMJIT_INST_4x(lsl, Lsl_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(lsr, Lsr_z, Vec, Vec, Imm)
+  ASMJIT_INST_4x(lsr, Lsr_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(mla, Mla_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(mls, Mls_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(mul, Mul_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(neg, Neg_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(not_, Not_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(orr, Orr_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(orv, Orv_z, Vec, PReg, Vec)
+  ASMJIT_INST_1x(pfalse, Pfalse_z, PReg)
+  ASMJIT_INST_1x(ptrue, Ptrue_z, PReg)
+  ASMJIT_INST_2x(ptrue, Ptrue_z, PReg, Imm)
+  ASMJIT_INST_1x(ptrues, Ptrues_z, PReg)
+  ASMJIT_INST_2x(ptrues, Ptrues_z, PReg, Imm)
+  ASMJIT_INST_1x(rdffr, Rdffr_z, PReg)
+  ASMJIT_INST_2x(rdvl, Rdvl_z, Gp, Imm)
+  ASMJIT_INST_3x(saddv, Saddv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(scvtf, Scvtf_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(sdiv, Sdiv_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(sel, Sel_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_0x(setffr, Setffr_z)
+  ASMJIT_INST_4x(smax, Smax_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(smaxv, Smaxv_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(smin, Smin_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(sminv, Sminv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(smulh, Smulh_z, Vec, Vec, Vec)
+  ASMJIT_INST_4x(smulh, Smulh_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(st1b, St1b_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(st1d, St1d_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(st1h, St1h_z, Vec, PReg, Mem)
+  ASMJIT_INST_3x(st1w, St1w_z, Vec, PReg, Mem)
+  ASMJIT_INST_2x(str, Str_z, PReg, Mem)
+  ASMJIT_INST_4x(sub, Sub_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(uaddv, Uaddv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(ucvtf, Ucvtf_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(udiv, Udiv_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_4x(umax, Umax_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(umaxv, Umaxv_z, Vec, PReg, Vec)
+  ASMJIT_INST_4x(umin, Umin_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(uminv, Uminv_z, Vec, PReg, Vec)
+  ASMJIT_INST_3x(umulh, Umulh_z, Vec, Vec, Vec)
+  ASMJIT_INST_4x(umulh, Umulh_z, Vec, PReg, Vec, Vec)
+  ASMJIT_INST_3x(whilege, Whilege_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilegt, Whilegt_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilehi, Whilehi_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilehs, Whilehs_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilele, Whilele_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilelo, Whilelo_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilels, Whilels_z, PReg, Gp, Gp)
+  ASMJIT_INST_3x(whilelt, Whilelt_z, PReg, Gp, Gp)
+
+  //! \}
+
+  //! \name SVE2 Instructions
+  //! \{
+
+  ASMJIT_INST_4x(bsl, Bsl_z, Vec, Vec, Vec, Vec)
+  ASMJIT_INST_4x(bsl1n, Bsl1n_z, Vec, Vec, Vec, Vec)
+  ASMJIT_INST_4x(bsl2n, Bsl2n_z, Vec, Vec, Vec, Vec)
+  ASMJIT_INST_4x(nbsl, Nbsl_z, Vec, Vec, Vec, Vec)
+
+  //! \}
 };
 
 //! Emitter (AArch64).
@@ -801,6 +801,138 @@ namespace Inst {
     kIdXtn2_v,                           //!< Instruction 'xtn2' {ASIMD}.
     kIdZip1_v,                           //!< Instruction 'zip1' {ASIMD}.
     kIdZip2_v,                           //!< Instruction 'zip2' {ASIMD}.
+    kIdAbs_z,                            //!< Instruction 'abs' {SVE}.
+    kIdAdd_z,                            //!< Instruction 'add' {SVE}.
+    kIdAddpl_z,                          //!< Instruction 'addpl' {SVE}.
+    kIdAddvl_z,                          //!< Instruction 'addvl' {SVE}.
+    kIdAnd_z,                            //!< Instruction 'and' {SVE}.
+    kIdAndv_z,                           //!< Instruction 'andv' {SVE}.
+    kIdAsr_z,                            //!< Instruction 'asr' {SVE}.
+    kIdBcax_z,                           //!< Instruction 'bcax' {SVE}.
+    kIdBic_z,                            //!< Instruction 'bic' {SVE}.
+    kIdBsl1n_z,                          //!< Instruction 'bsl1n' {SVE}.
+    kIdBsl2n_z,                          //!< Instruction 'bsl2n' {SVE}.
+    kIdBsl_z,                            //!< Instruction 'bsl' {SVE}.
+    kIdCls_z,                            //!< Instruction 'cls' {SVE}.
+    kIdClz_z,                            //!< Instruction 'clz' {SVE}.
+    kIdCmpeq_z,                          //!< Instruction 'cmpeq' {SVE}.
+    kIdCmpge_z,                          //!< Instruction 'cmpge' {SVE}.
+    kIdCmpgt_z,                          //!< Instruction 'cmpgt' {SVE}.
+    kIdCmphi_z,                          //!< Instruction 'cmphi' {SVE}.
+    kIdCmphs_z,                          //!< Instruction 'cmphs' {SVE}.
+    kIdCmpne_z,                          //!< Instruction 'cmpne' {SVE}.
+    kIdCnt_z,                            //!< Instruction 'cnt' {SVE}.
+    kIdCntb_z,                           //!< Instruction 'cntb' {SVE}.
+    kIdCntd_z,                           //!< Instruction 'cntd' {SVE}.
+    kIdCnth_z,                           //!< Instruction 'cnth' {SVE}.
+    kIdCntw_z,                           //!< Instruction 'cntw' {SVE}.
+    kIdCpy_z,                            //!< Instruction 'cpy' {SVE}.
+    kIdDecb_z,                           //!< Instruction 'decb' {SVE}.
+    kIdDecd_z,                           //!< Instruction 'decd' {SVE}.
+    kIdDech_z,                           //!< Instruction 'dech' {SVE}.
+    kIdDecw_z,                           //!< Instruction 'decw' {SVE}.
+    kIdDup_z,                            //!< Instruction 'dup' {SVE}.
+    kIdEor3_z,                           //!< Instruction 'eor3' {SVE}.
+    kIdEor_z,                            //!< Instruction 'eor' {SVE}.
+    kIdEorv_z,                           //!< Instruction 'eorv' {SVE}.
+    kIdFabs_z,                           //!< Instruction 'fabs' {SVE}.
+    kIdFadd_z,                           //!< Instruction 'fadd' {SVE}.
+    kIdFaddv_z,                          //!< Instruction 'faddv' {SVE}.
+    kIdFcmeq_z,                          //!< Instruction 'fcmeq' {SVE}.
+    kIdFcmge_z,                          //!< Instruction 'fcmge' {SVE}.
+    kIdFcmgt_z,                          //!< Instruction 'fcmgt' {SVE}.
+    kIdFcmne_z,                          //!< Instruction 'fcmne' {SVE}.
+    kIdFcvtzs_z,                         //!< Instruction 'fcvtzs' {SVE}.
+    kIdFcvtzu_z,                         //!< Instruction 'fcvtzu' {SVE}.
+    kIdFdiv_z,                           //!< Instruction 'fdiv' {SVE}.
+    kIdFmax_z,                           //!< Instruction 'fmax' {SVE}.
+    kIdFmaxnm_z,                         //!< Instruction 'fmaxnm' {SVE}.
+    kIdFmaxnmv_z,                        //!< Instruction 'fmaxnmv' {SVE}.
+    kIdFmaxv_z,                          //!< Instruction 'fmaxv' {SVE}.
+    kIdFmin_z,                           //!< Instruction 'fmin' {SVE}.
+    kIdFminnm_z,                         //!< Instruction 'fminnm' {SVE}.
+    kIdFminnmv_z,                        //!< Instruction 'fminnmv' {SVE}.
+    kIdFminv_z,                          //!< Instruction 'fminv' {SVE}.
+    kIdFmla_z,                           //!< Instruction 'fmla' {SVE}.
+    kIdFmls_z,                           //!< Instruction 'fmls' {SVE}.
+    kIdFmul_z,                           //!< Instruction 'fmul' {SVE}.
+    kIdFneg_z,                           //!< Instruction 'fneg' {SVE}.
+    kIdFnmla_z,                          //!< Instruction 'fnmla' {SVE}.
+    kIdFnmls_z,                          //!< Instruction 'fnmls' {SVE}.
+    kIdFrintm_z,                         //!< Instruction 'frintm' {SVE}.
+    kIdFrintn_z,                         //!< Instruction 'frintn' {SVE}.
+    kIdFrintp_z,                         //!< Instruction 'frintp' {SVE}.
+    kIdFrintz_z,                         //!< Instruction 'frintz' {SVE}.
+    kIdFsqrt_z,                          //!< Instruction 'fsqrt' {SVE}.
+    kIdFsub_z,                           //!< Instruction 'fsub' {SVE}.
+    kIdIncb_z,                           //!< Instruction 'incb' {SVE}.
+    kIdIncd_z,                           //!< Instruction 'incd' {SVE}.
+    kIdInch_z,                           //!< Instruction 'inch' {SVE}.
+    kIdIncw_z,                           //!< Instruction 'incw' {SVE}.
+    kIdIndex_z,                          //!< Instruction 'index' {SVE}.
+    kIdLd1b_z,                           //!< Instruction 'ld1b' {SVE}.
+    kIdLd1d_z,                           //!< Instruction 'ld1d' {SVE}.
+    kIdLd1h_z,                           //!< Instruction 'ld1h' {SVE}.
+    kIdLd1w_z,                           //!< Instruction 'ld1w' {SVE}.
+    kIdLdff1b_z,                         //!< Instruction 'ldff1b' {SVE}.
+    kIdLdff1d_z,                         //!< Instruction 'ldff1d' {SVE}.
+    kIdLdff1h_z,                         //!< Instruction 'ldff1h' {SVE}.
+    kIdLdff1w_z,                         //!< Instruction 'ldff1w' {SVE}.
+    kIdLdr_z,                            //!< Instruction 'ldr' {SVE}.
+    kIdLsl_z,                            //!< Instruction 'lsl' {SVE}.
+    kIdLsr_z,                            //!< Instruction 'lsr' {SVE}.
+    kIdMla_z,                            //!< Instruction 'mla' {SVE}.
+    kIdMls_z,                            //!< Instruction 'mls' {SVE}.
+    kIdMul_z,                            //!< Instruction 'mul' {SVE}.
+    kIdNbsl_z,                           //!< Instruction 'nbsl' {SVE}.
+    kIdNeg_z,                            //!< Instruction 'neg' {SVE}.
+    kIdNot_z,                            //!< Instruction 'not' {SVE}.
+    kIdOrr_z,                            //!< Instruction 'orr' {SVE}.
+    kIdOrv_z,                            //!< Instruction 'orv' {SVE}.
+    kIdPfalse_z,                         //!< Instruction 'pfalse' {SVE}.
+    kIdPtrue_z,                          //!< Instruction 'ptrue' {SVE}.
+    kIdPtrues_z,                         //!< Instruction 'ptrues' {SVE}.
+    kIdRdffr_z,                          //!< Instruction 'rdffr' {SVE}.
+    kIdRdvl_z,                           //!< Instruction 'rdvl' {SVE}.
+    kIdSaddv_z,                          //!< Instruction 'saddv' {SVE}.
+    kIdScvtf_z,                          //!< Instruction 'scvtf' {SVE}.
+    kIdSdiv_z,                           //!< Instruction 'sdiv' {SVE}.
+    kIdSel_z,                            //!< Instruction 'sel' {SVE}.
+    kIdSetffr_z,                         //!< Instruction 'setffr' {SVE}.
+    kIdSmax_z,                           //!< Instruction 'smax' {SVE}.
+    kIdSmaxv_z,                          //!< Instruction 'smaxv' {SVE}.
+    kIdSmin_z,                           //!< Instruction 'smin' {SVE}.
+    kIdSminv_z,                          //!< Instruction 'sminv' {SVE}.
+    kIdSmulh_z,                          //!< Instruction 'smulh' {SVE}.
+    kIdSt1b_z,                           //!< Instruction 'st1b' {SVE}.
+    kIdSt1d_z,                           //!< Instruction 'st1d' {SVE}.
+    kIdSt1h_z,                           //!< Instruction 'st1h' {SVE}.
+    kIdSt1w_z,                           //!< Instruction 'st1w' {SVE}.
+    kIdStr_z,                            //!< Instruction 'str' {SVE}.
+    kIdSub_z,                            //!< Instruction 'sub' {SVE}.
+    kIdTbl_z,                            //!< Instruction 'tbl' {SVE}.
+    kIdTrn1_z,                           //!< Instruction 'trn1' {SVE}.
+    kIdTrn2_z,                           //!< Instruction 'trn2' {SVE}.
+    kIdUaddv_z,                          //!< Instruction 'uaddv' {SVE}.
+    kIdUcvtf_z,                          //!< Instruction 'ucvtf' {SVE}.
+    kIdUdiv_z,                           //!< Instruction 'udiv' {SVE}.
+    kIdUmax_z,                           //!< Instruction 'umax' {SVE}.
+    kIdUmaxv_z,                          //!< Instruction 'umaxv' {SVE}.
+    kIdUmin_z,                           //!< Instruction 'umin' {SVE}.
+    kIdUminv_z,                          //!< Instruction 'uminv' {SVE}.
+    kIdUmulh_z,                          //!< Instruction 'umulh' {SVE}.
+    kIdUzp1_z,                           //!< Instruction 'uzp1' {SVE}.
+    kIdUzp2_z,                           //!< Instruction 'uzp2' {SVE}.
+    kIdWhilege_z,                        //!< Instruction 'whilege' {SVE}.
+    kIdWhilegt_z,                        //!< Instruction 'whilegt' {SVE}.
+    kIdWhilehi_z,                        //!< Instruction 'whilehi' {SVE}.
+    kIdWhilehs_z,                        //!< Instruction 'whilehs' {SVE}.
+    kIdWhilele_z,                        //!< Instruction 'whilele' {SVE}.
+    kIdWhilelo_z,                        //!< Instruction 'whilelo' {SVE}.
+    kIdWhilels_z,                        //!< Instruction 'whilels' {SVE}.
+    kIdWhilelt_z,                        //!< Instruction 'whilelt' {SVE}.
+    kIdZip1_z,                           //!< Instruction 'zip1' {SVE}.
+    kIdZip2_z,                           //!< Instruction 'zip2' {SVE}.
     _kIdCount
     // ${InstId:End}
   };
@@ -97,6 +97,92 @@ static const InstRWInfoData inst_rw_info_table[] = {
 
 static const uint8_t element_type_size_table[8] = { 0, 1, 2, 4, 8, 4, 4, 0 };
 
+static constexpr CpuRWFlags kNZCV = CpuRWFlags::kARM_N | CpuRWFlags::kARM_Z | CpuRWFlags::kARM_C | CpuRWFlags::kARM_V;
+
+// Returns NZCV flags read by the instruction (conditional instructions that encode the condition in instruction id
+// such as `b.cond` are handled by the caller).
+static CpuRWFlags nzcv_read_flags(InstId real_id) noexcept {
+  switch (real_id) {
+    case Inst::kIdAdc:
+    case Inst::kIdAdcs:
+    case Inst::kIdAxflag:
+    case Inst::kIdCcmn:
+    case Inst::kIdCcmp:
+    case Inst::kIdCfinv:
+    case Inst::kIdCinc:
+    case Inst::kIdCinv:
+    case Inst::kIdCneg:
+    case Inst::kIdCsel:
+    case Inst::kIdCset:
+    case Inst::kIdCsetm:
+    case Inst::kIdCsinc:
+    case Inst::kIdCsinv:
+    case Inst::kIdCsneg:
+    case Inst::kIdFccmp_v:
+    case Inst::kIdFccmpe_v:
+    case Inst::kIdFcsel_v:
+    case Inst::kIdNgc:
+    case Inst::kIdNgcs:
+    case Inst::kIdSbc:
+    case Inst::kIdSbcs:
+    case Inst::kIdXaflag:
+      return kNZCV;
+
+    default:
+      return CpuRWFlags::kNone;
+  }
+}
+
+// Returns NZCV flags written by the instruction.
+static CpuRWFlags nzcv_write_flags(InstId real_id) noexcept {
+  switch (real_id) {
+    case Inst::kIdAdcs:
+    case Inst::kIdAdds:
+    case Inst::kIdAnds:
+    case Inst::kIdAxflag:
+    case Inst::kIdBics:
+    case Inst::kIdCcmn:
+    case Inst::kIdCcmp:
+    case Inst::kIdCfinv:
+    case Inst::kIdCmn:
+    case Inst::kIdCmp:
+    case Inst::kIdFccmp_v:
+    case Inst::kIdFccmpe_v:
+    case Inst::kIdFcmp_v:
+    case Inst::kIdFcmpe_v:
+    case Inst::kIdNegs:
+    case Inst::kIdNgcs:
+    case Inst::kIdSbcs:
+    case Inst::kIdSetf8:
+    case Inst::kIdSetf16:
+    case Inst::kIdSubps:
+    case Inst::kIdSubs:
+    case Inst::kIdTst:
+    case Inst::kIdXaflag:
+
+    // SVE instructions that set condition flags based on the resulting predicate.
+    case Inst::kIdCmpeq_z:
+    case Inst::kIdCmpge_z:
+    case Inst::kIdCmpgt_z:
+    case Inst::kIdCmphi_z:
+    case Inst::kIdCmphs_z:
+    case Inst::kIdCmpne_z:
+    case Inst::kIdPtrues_z:
+    case Inst::kIdWhilege_z:
+    case Inst::kIdWhilegt_z:
+    case Inst::kIdWhilehi_z:
+    case Inst::kIdWhilehs_z:
+    case Inst::kIdWhilele_z:
+    case Inst::kIdWhilelo_z:
+    case Inst::kIdWhilels_z:
+    case Inst::kIdWhilelt_z:
+      return kNZCV;
+
+    default:
+      return CpuRWFlags::kNone;
+  }
+}
+
 Error query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_count, InstRWInfo* out) noexcept {
   // Get the instruction data.
   uint32_t real_id = inst.inst_id() & uint32_t(InstIdParts::kRealId);
@@ -109,8 +195,13 @@ Error query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_co
   out->_op_count = uint8_t(op_count);
   out->_rm_feature = 0;
   out->_extra_reg.reset();
-  out->_read_flags = CpuRWFlags::kNone; // TODO: [ARM] Read PSTATUS.
-  out->_write_flags = CpuRWFlags::kNone; // TODO: [ARM] Write PSTATUS
+  out->_read_flags = nzcv_read_flags(real_id);
+  out->_write_flags = nzcv_write_flags(real_id);
+
+  CondCode cond_code = BaseInst::extract_arm_cond_code(inst.inst_id());
+  if (cond_code != CondCode::kAL && cond_code != CondCode::kNA) {
+    out->_read_flags |= kNZCV;
+  }
 
   const InstDB::InstInfo& inst_info = InstDB::_inst_info_table[real_id];
   const InstRWInfoData& rw_info = inst_rw_info_table[inst_info.rw_info_index()];
@@ -165,6 +256,9 @@ Error query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_co
     }
   }
   else {
+    // SVE merging predication (`Pg/M`) preserves inactive elements of the destination, so the destination is read too.
+    bool merging = op_count > 1u && operands[1].as<Reg>().is_reg(RegType::kMask) && operands[1].as<PReg>().is_merging();
+
     for (uint32_t i = 0; i < op_count; i++) {
       OpRWInfo& op = out->_operands[i];
       const Operand_& src_op = operands[i];
@@ -175,6 +269,9 @@ Error query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_co
       }
 
       OpRWFlags rw_flags = (OpRWFlags)rw_info.rwx[i];
+      if (i == 0 && merging) {
+        rw_flags |= OpRWFlags::kRead;
+      }
 
       op._op_flags = rw_flags & ~(OpRWFlags::kZExt);
       op._phys_id = Reg::kIdBad;
@@ -219,6 +316,15 @@ Error query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_co
         }
       }
     }
+
+    // TBL and TBX having more than one table register require consecutive registers, the first table register
+    // is the consecutive lead.
+    if ((real_id == Inst::kIdTbl_v || real_id == Inst::kIdTbx_v) && op_count > 3u) {
+      out->_operands[1]._consecutive_lead_count = uint8_t(op_count - 2u);
+      for (uint32_t i = 2; i < op_count - 1u; i++) {
+        out->_operands[i].add_op_flags(OpRWFlags::kConsecutive);
+      }
+    }
   }
 
   return Error::kOk;
@@ -236,6 +342,227 @@ Error query_features(const BaseInst& inst, const Operand_* operands, size_t op_c
 }
 #endif // !ASMJIT_NO_INTROSPECTION
 
+// a64::InstInternal - QuerySchedClass
+// ===================================
+
+#ifndef ASMJIT_NO_INTROSPECTION
+static InstSchedClass vec_sched_class(InstId real_id) noexcept {
+  switch (real_id) {
+    case Inst::kIdDup_v:
+    case Inst::kIdExt_v:
+    case Inst::kIdIns_v:
+    case Inst::kIdRev16_v:
+    case Inst::kIdRev32_v:
+    case Inst::kIdRev64_v:
+    case Inst::kIdSmov_v:
+    case Inst::kIdTbl_v:
+    case Inst::kIdTbx_v:
+    case Inst::kIdTrn1_v:
+    case Inst::kIdTrn2_v:
+    case Inst::kIdUmov_v:
+    case Inst::kIdUzp1_v:
+    case Inst::kIdUzp2_v:
+    case Inst::kIdZip1_v:
+    case Inst::kIdZip2_v:
+      return InstSchedClass::kVecShuffle;
+
+    case Inst::kIdMla_v:
+    case Inst::kIdMls_v:
+    case Inst::kIdMul_v:
+    case Inst::kIdPmul_v:
+    case Inst::kIdPmull_v:
+    case Inst::kIdPmull2_v:
+    case Inst::kIdSdot_v:
+    case Inst::kIdSmlal_v:
+    case Inst::kIdSmlal2_v:
+    case Inst::kIdSmlsl_v:
+    case Inst::kIdSmlsl2_v:
+    case Inst::kIdSmmla_v:
+    case Inst::kIdSmull_v:
+    case Inst::kIdSmull2_v:
+    case Inst::kIdSqdmulh_v:
+    case Inst::kIdSqrdmulh_v:
+    case Inst::kIdSudot_v:
+    case Inst::kIdUdot_v:
+    case Inst::kIdUmlal_v:
+    case Inst::kIdUmlal2_v:
+    case Inst::kIdUmlsl_v:
+    case Inst::kIdUmlsl2_v:
+    case Inst::kIdUmmla_v:
+    case Inst::kIdUmull_v:
+    case Inst::kIdUmull2_v:
+    case Inst::kIdUsdot_v:
+    case Inst::kIdUsmmla_v:
+      return InstSchedClass::kVecMul;
+
+    case Inst::kIdFdiv_v:
+    case Inst::kIdFsqrt_v:
+      return InstSchedClass::kVecDiv;
+
+    case Inst::kIdMov_v:
+    case Inst::kIdFmov_v:
+      return InstSchedClass::kMov;
+
+    default:
+      // Floating point instructions start with `F` (and there are few conversions that don't).
+      if ((real_id >= Inst::kIdFabd_v && real_id <= Inst::kIdFsub_v) ||
+          real_id == Inst::kIdScvtf_v || real_id == Inst::kIdUcvtf_v ||
+          real_id == Inst::kIdBfcvt_v || real_id == Inst::kIdBfcvtn_v || real_id == Inst::kIdBfcvtn2_v) {
+        return InstSchedClass::kVecFP;
+      }
+      return InstSchedClass::kVecALU;
+  }
+}
+
+Error query_sched_class(const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept {
+  uint32_t real_id = inst.inst_id() & uint32_t(InstIdParts::kRealId);
+
+  if (ASMJIT_UNLIKELY(!Inst::is_defined_id(real_id))) {
+    return make_error(Error::kInvalidInstruction);
+  }
+
+  *out = InstSchedClass::kBarrier;
+
+  // Instructions without operands are hints, barriers, and system instructions - they are never reordered.
+  if (op_count == 0u) {
+    return Error::kOk;
+  }
+
+  switch (real_id) {
+    // Control flow.
+    case Inst::kIdB:
+    case Inst::kIdBc:
+    case Inst::kIdBl:
+    case Inst::kIdBlr:
+    case Inst::kIdBr:
+    case Inst::kIdCbnz:
+    case Inst::kIdCbz:
+    case Inst::kIdRet:
+    case Inst::kIdTbnz:
+    case Inst::kIdTbz:
+
+    // System instructions, barriers, and exceptions.
+    case Inst::kIdAt:
+    case Inst::kIdBrk:
+    case Inst::kIdClrex:
+    case Inst::kIdDc:
+    case Inst::kIdDmb:
+    case Inst::kIdDsb:
+    case Inst::kIdHint:
+    case Inst::kIdHlt:
+    case Inst::kIdHvc:
+    case Inst::kIdIc:
+    case Inst::kIdIsb:
+    case Inst::kIdMrs:
+    case Inst::kIdMsr:
+    case Inst::kIdSmc:
+    case Inst::kIdSvc:
+    case Inst::kIdSys:
+    case Inst::kIdTlbi:
+    case Inst::kIdUdf:
+      return Error::kOk;
+
+    default:
+      break;
+  }
+
+  // Atomic, exclusive, and acquire/release memory accesses are ordered - instruction IDs are sorted alphabetically,
+  // which makes it possible to check whole families of these instructions by ranges.
+  if ((real_id >= Inst::kIdCas     && real_id <= Inst::kIdCaspl    ) ||
+      (real_id >= Inst::kIdLdadd   && real_id <= Inst::kIdLdaxrh   ) ||
+      (real_id >= Inst::kIdLdclr   && real_id <= Inst::kIdLdeorlh  ) ||
+      (real_id >= Inst::kIdLdlar   && real_id <= Inst::kIdLdlarh   ) ||
+      (real_id >= Inst::kIdLdset   && real_id <= Inst::kIdLdsminlh ) ||
+      (real_id >= Inst::kIdLdumax  && real_id <= Inst::kIdLduminlh ) ||
+      (real_id >= Inst::kIdLdxp    && real_id <= Inst::kIdLdxrh    ) ||
+      (real_id >= Inst::kIdStadd   && real_id <= Inst::kIdSteorlh  ) ||
+      (real_id >= Inst::kIdStllr   && real_id <= Inst::kIdStlxrh   ) ||
+      (real_id >= Inst::kIdStset   && real_id <= Inst::kIdStsminlh ) ||
+      (real_id >= Inst::kIdStumax  && real_id <= Inst::kIdStuminlh ) ||
+      (real_id >= Inst::kIdStxp    && real_id <= Inst::kIdStxrh    ) ||
+      (real_id >= Inst::kIdSwp     && real_id <= Inst::kIdSwplh    )) {
+    return Error::kOk;
+  }
+
+  bool uses_vec = false;
+  for (size_t i = 0; i < op_count; i++) {
+    const Operand_& op = operands[i];
+    if (op.is_reg()) {
+      RegGroup group = op.as<Reg>().reg_group();
+      if (group == RegGroup::kVec) {
+        uses_vec = true;
+      }
+      else if (group != RegGroup::kGp) {
+        return Error::kOk;
+      }
+    }
+  }
+
+  if (uses_vec || real_id >= Inst::kIdAbs_v) {
+    *out = vec_sched_class(real_id);
+    return Error::kOk;
+  }
+
+  switch (real_id) {
+    case Inst::kIdMov:
+    case Inst::kIdMovk:
+    case Inst::kIdMovn:
+    case Inst::kIdMovz:
+    case Inst::kIdLdr:
+    case Inst::kIdLdrb:
+    case Inst::kIdLdrh:
+    case Inst::kIdLdrsb:
+    case Inst::kIdLdrsh:
+    case Inst::kIdLdrsw:
+    case Inst::kIdLdur:
+    case Inst::kIdLdurb:
+    case Inst::kIdLdurh:
+    case Inst::kIdLdursb:
+    case Inst::kIdLdursh:
+    case Inst::kIdLdursw:
+    case Inst::kIdLdp:
+    case Inst::kIdLdpsw:
+    case Inst::kIdStr:
+    case Inst::kIdStrb:
+    case Inst::kIdStrh:
+    case Inst::kIdStur:
+    case Inst::kIdSturb:
+    case Inst::kIdSturh:
+    case Inst::kIdStp:
+      *out = InstSchedClass::kMov;
+      break;
+
+    case Inst::kIdMadd:
+    case Inst::kIdMneg:
+    case Inst::kIdMsub:
+    case Inst::kIdMul:
+    case Inst::kIdSmaddl:
+    case Inst::kIdSmnegl:
+    case Inst::kIdSmsubl:
+    case Inst::kIdSmulh:
+    case Inst::kIdSmull:
+    case Inst::kIdUmaddl:
+    case Inst::kIdUmnegl:
+    case Inst::kIdUmsubl:
+    case Inst::kIdUmulh:
+    case Inst::kIdUmull:
+      *out = InstSchedClass::kMul;
+      break;
+
+    case Inst::kIdSdiv:
+    case Inst::kIdUdiv:
+      *out = InstSchedClass::kDiv;
+      break;
+
+    default:
+      *out = InstSchedClass::kALU;
+      break;
+  }
+
+  return Error::kOk;
+}
+#endif // !ASMJIT_NO_INTROSPECTION
+
 } // {InstInternal}
 
 // a64::InstInternal - Unit
@@ -245,6 +572,53 @@ Error query_features(const BaseInst& inst, const Operand_* operands, size_t op_c
 UNIT(arm_inst_api_text) {
   // TODO:
 }
+
+#ifndef ASMJIT_NO_INTROSPECTION
+UNIT(arm_inst_api_nzcv) {
+  INFO("Verifying whether NZCV flags are reported by instructions that read or write them");
+  {
+    InstRWInfo rwi;
+
+    Operand_ subs_ops[] = { x0, x1, x2 };
+    EXPECT_EQ(InstInternal::query_rw_info(BaseInst(Inst::kIdSubs), subs_ops, 3, &rwi), Error::kOk);
+    EXPECT_EQ(rwi.read_flags(), CpuRWFlags::kNone);
+    EXPECT_EQ(rwi.write_flags(), InstInternal::kNZCV);
+
+    Operand_ csel_ops[] = { x0, x1, x2, Imm(CondCode::kEQ) };
+    EXPECT_EQ(InstInternal::query_rw_info(BaseInst(Inst::kIdCsel), csel_ops, 4, &rwi), Error::kOk);
+    EXPECT_EQ(rwi.read_flags(), InstInternal::kNZCV);
+    EXPECT_EQ(rwi.write_flags(), CpuRWFlags::kNone);
+
+    Operand_ add_ops[] = { x0, x1, x2 };
+    EXPECT_EQ(InstInternal::query_rw_info(BaseInst(Inst::kIdAdd), add_ops, 3, &rwi), Error::kOk);
+    EXPECT_EQ(rwi.read_flags(), CpuRWFlags::kNone);
+    EXPECT_EQ(rwi.write_flags(), CpuRWFlags::kNone);
+  }
+
+  INFO("Verifying whether scheduling classes are reported correctly");
+  {
+    InstSchedClass sched_class;
+
+    Operand_ add_ops[] = { x0, x1, x2 };
+    EXPECT_EQ(InstInternal::query_sched_class(BaseInst(Inst::kIdAdd), add_ops, 3, &sched_class), Error::kOk);
+    EXPECT_EQ(sched_class, InstSchedClass::kALU);
+
+    EXPECT_EQ(InstInternal::query_sched_class(BaseInst(Inst::kIdMul), add_ops, 3, &sched_class), Error::kOk);
+    EXPECT_EQ(sched_class, InstSchedClass::kMul);
+
+    EXPECT_EQ(InstInternal::query_sched_class(BaseInst(Inst::kIdSdiv), add_ops, 3, &sched_class), Error::kOk);
+    EXPECT_EQ(sched_class, InstSchedClass::kDiv);
+
+    Operand_ fmla_ops[] = { v0.s4(), v1.s4(), v2.s4() };
+    EXPECT_EQ(InstInternal::query_sched_class(BaseInst(Inst::kIdFmla_v), fmla_ops, 3, &sched_class), Error::kOk);
+    EXPECT_EQ(sched_class, InstSchedClass::kVecFP);
+
+    Operand_ ldaxr_ops[] = { x0, ptr(x1) };
+    EXPECT_EQ(InstInternal::query_sched_class(BaseInst(Inst::kIdLdaxr), ldaxr_ops, 2, &sched_class), Error::kOk);
+    EXPECT_EQ(sched_class, InstSchedClass::kBarrier);
+  }
+}
+#endif // !ASMJIT_NO_INTROSPECTION
 #endif
 
 ASMJIT_END_SUB_NAMESPACE
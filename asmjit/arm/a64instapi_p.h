@@ -26,6 +26,7 @@ InstId ASMJIT_CDECL string_to_inst_id(const char* s, size_t len) noexcept;
 Error ASMJIT_CDECL validate(const BaseInst& inst, const Operand_* operands, size_t op_count, ValidationFlags validation_flags) noexcept;
 Error ASMJIT_CDECL query_rw_info(const BaseInst& inst, const Operand_* operands, size_t op_count, InstRWInfo* out) noexcept;
 Error ASMJIT_CDECL query_features(const BaseInst& inst, const Operand_* operands, size_t op_count, CpuFeatures* out) noexcept;
+Error ASMJIT_CDECL query_sched_class(const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept;
 #endif // !ASMJIT_NO_INTROSPECTION
 
 } // {InstInternal}
@@ -760,7 +760,7 @@ const InstInfo _inst_info_table[] = {
   INST(Sxtl_v           , SimdSxtlUxtl       , (0b0000111100000000101001, kVO_V_B8H4S2)                                              , kRWI_W    , F(Long)                   , 0  ), // #702
   INST(Sxtl2_v          , SimdSxtlUxtl       , (0b0100111100000000101001, kVO_V_B16H8S4)                                             , kRWI_W    , F(Long)                   , 1  ), // #703
   INST(Tbl_v            , SimdTblTbx         , (0b0000111000000000000000)                                                            , kRWI_W    , 0                         , 0  ), // #704
-  INST(Tbx_v            , SimdTblTbx         , (0b0000111000000000000100)                                                            , kRWI_W    , 0                         , 1  ), // #705
+  INST(Tbx_v            , SimdTblTbx         , (0b0000111000000000000100)                                                            , kRWI_X    , 0                         , 1  ), // #705
   INST(Trn1_v           , ISimdVVV           , (0b0000111000000000001010, kVO_V_BHS_D2)                                              , kRWI_W    , 0                         , 40 ), // #706
   INST(Trn2_v           , ISimdVVV           , (0b0000111000000000011010, kVO_V_BHS_D2)                                              , kRWI_W    , 0                         , 41 ), // #707
   INST(Uaba_v           , ISimdVVV           , (0b0010111000100000011111, kVO_V_BHS)                                                 , kRWI_X    , 0                         , 42 ), // #708
@@ -830,7 +830,139 @@ const InstInfo _inst_info_table[] = {
   INST(Xtn_v            , ISimdVV            , (0b0000111000100001001010, kVO_V_B8H4S2)                                              , kRWI_W    , F(Narrow)                 , 27 ), // #772
   INST(Xtn2_v           , ISimdVV            , (0b0100111000100001001010, kVO_V_B16H8S4)                                             , kRWI_X    , F(Narrow)                 , 28 ), // #773
   INST(Zip1_v           , ISimdVVV           , (0b0000111000000000001110, kVO_V_BHS_D2)                                              , kRWI_W    , 0                         , 63 ), // #774
-  INST(Zip2_v           , ISimdVVV           , (0b0000111000000000011110, kVO_V_BHS_D2)                                              , kRWI_W    , 0                         , 64 )  // #775
+  INST(Zip2_v           , ISimdVVV           , (0b0000111000000000011110, kVO_V_BHS_D2)                                              , kRWI_W    , 0                         , 64 ), // #775
+  INST(Abs_z            , SveZPZ             , (0x0416A000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 0  ), // #776
+  INST(Add_z            , SveZZZ             , (0x04200000, 0x04000000, kSZ_BHSD, 0)                                                 , kRWI_W    , 0                         , 0  ), // #777
+  INST(Addpl_z          , SveAddVl           , (0x04605000, 1)                                                                       , kRWI_W    , 0                         , 0  ), // #778
+  INST(Addvl_z          , SveAddVl           , (0x04205000, 1)                                                                       , kRWI_W    , 0                         , 1  ), // #779
+  INST(And_z            , SveZZZ             , (0x04203000, 0x041A0000, kSZ_BHSD, 1)                                                 , kRWI_W    , 0                         , 1  ), // #780
+  INST(Andv_z           , SveReduce          , (0x041A2000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 0  ), // #781
+  INST(Asr_z            , SveShift           , (0x04209000, 0x04108000, 0)                                                           , kRWI_W    , 0                         , 0  ), // #782
+  INST(Bcax_z           , SveZZZZ            , (0x04603800)                                                                          , kRWI_X    , 0                         , 0  ), // #783
+  INST(Bic_z            , SveZZZ             , (0x04E03000, 0x041B0000, kSZ_BHSD, 1)                                                 , kRWI_W    , 0                         , 2  ), // #784
+  INST(Bsl1n_z          , SveZZZZ            , (0x04603C00)                                                                          , kRWI_X    , 0                         , 1  ), // #785
+  INST(Bsl2n_z          , SveZZZZ            , (0x04A03C00)                                                                          , kRWI_X    , 0                         , 2  ), // #786
+  INST(Bsl_z            , SveZZZZ            , (0x04203C00)                                                                          , kRWI_X    , 0                         , 3  ), // #787
+  INST(Cls_z            , SveZPZ             , (0x0418A000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 1  ), // #788
+  INST(Clz_z            , SveZPZ             , (0x0419A000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 2  ), // #789
+  INST(Cmpeq_z          , SveCmp             , (0x2400A000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 0  ), // #790
+  INST(Cmpge_z          , SveCmp             , (0x24008000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 1  ), // #791
+  INST(Cmpgt_z          , SveCmp             , (0x24008010, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 2  ), // #792
+  INST(Cmphi_z          , SveCmp             , (0x24000010, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 3  ), // #793
+  INST(Cmphs_z          , SveCmp             , (0x24000000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 4  ), // #794
+  INST(Cmpne_z          , SveCmp             , (0x2400A010, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 5  ), // #795
+  INST(Cnt_z            , SveZPZ             , (0x041AA000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 3  ), // #796
+  INST(Cntb_z           , SveCnt             , (0x0420E000)                                                                          , kRWI_W    , 0                         , 0  ), // #797
+  INST(Cntd_z           , SveCnt             , (0x04E0E000)                                                                          , kRWI_W    , 0                         , 1  ), // #798
+  INST(Cnth_z           , SveCnt             , (0x0460E000)                                                                          , kRWI_W    , 0                         , 2  ), // #799
+  INST(Cntw_z           , SveCnt             , (0x04A0E000)                                                                          , kRWI_W    , 0                         , 3  ), // #800
+  INST(Cpy_z            , SveCpy             , (_)                                                                                   , kRWI_W    , 0                         , 0  ), // #801
+  INST(Decb_z           , SveCnt             , (0x0430E400)                                                                          , kRWI_X    , 0                         , 4  ), // #802
+  INST(Decd_z           , SveCnt             , (0x04F0E400)                                                                          , kRWI_X    , 0                         , 5  ), // #803
+  INST(Dech_z           , SveCnt             , (0x0470E400)                                                                          , kRWI_X    , 0                         , 6  ), // #804
+  INST(Decw_z           , SveCnt             , (0x04B0E400)                                                                          , kRWI_X    , 0                         , 7  ), // #805
+  INST(Dup_z            , SveDup             , (_)                                                                                   , kRWI_W    , 0                         , 0  ), // #806
+  INST(Eor3_z           , SveZZZZ            , (0x04203800)                                                                          , kRWI_X    , 0                         , 4  ), // #807
+  INST(Eor_z            , SveZZZ             , (0x04A03000, 0x04190000, kSZ_BHSD, 1)                                                 , kRWI_W    , 0                         , 3  ), // #808
+  INST(Eorv_z           , SveReduce          , (0x04192000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 1  ), // #809
+  INST(Fabs_z           , SveZPZ             , (0x041CA000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 4  ), // #810
+  INST(Fadd_z           , SveZZZ             , (0x65000000, 0x65008000, kSZ_HSD, 0)                                                  , kRWI_W    , 0                         , 4  ), // #811
+  INST(Faddv_z          , SveReduce          , (0x65002000, kSZ_HSD, 0)                                                              , kRWI_W    , 0                         , 2  ), // #812
+  INST(Fcmeq_z          , SveCmp             , (0x65006000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 6  ), // #813
+  INST(Fcmge_z          , SveCmp             , (0x65004000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 7  ), // #814
+  INST(Fcmgt_z          , SveCmp             , (0x65004010, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 8  ), // #815
+  INST(Fcmne_z          , SveCmp             , (0x65006010, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 9  ), // #816
+  INST(Fcvtzs_z         , SveCvt             , (0x659CA000, 0x65DEA000)                                                              , kRWI_W    , 0                         , 0  ), // #817
+  INST(Fcvtzu_z         , SveCvt             , (0x659DA000, 0x65DFA000)                                                              , kRWI_W    , 0                         , 1  ), // #818
+  INST(Fdiv_z           , SveZZZ             , (0, 0x650D8000, kSZ_HSD, 0)                                                           , kRWI_W    , 0                         , 5  ), // #819
+  INST(Fmax_z           , SveZZZ             , (0, 0x65068000, kSZ_HSD, 0)                                                           , kRWI_W    , 0                         , 6  ), // #820
+  INST(Fmaxnm_z         , SveZZZ             , (0, 0x65048000, kSZ_HSD, 0)                                                           , kRWI_W    , 0                         , 7  ), // #821
+  INST(Fmaxnmv_z        , SveReduce          , (0x65042000, kSZ_HSD, 0)                                                              , kRWI_W    , 0                         , 3  ), // #822
+  INST(Fmaxv_z          , SveReduce          , (0x65062000, kSZ_HSD, 0)                                                              , kRWI_W    , 0                         , 4  ), // #823
+  INST(Fmin_z           , SveZZZ             , (0, 0x65078000, kSZ_HSD, 0)                                                           , kRWI_W    , 0                         , 8  ), // #824
+  INST(Fminnm_z         , SveZZZ             , (0, 0x65058000, kSZ_HSD, 0)                                                           , kRWI_W    , 0                         , 9  ), // #825
+  INST(Fminnmv_z        , SveReduce          , (0x65052000, kSZ_HSD, 0)                                                              , kRWI_W    , 0                         , 5  ), // #826
+  INST(Fminv_z          , SveReduce          , (0x65072000, kSZ_HSD, 0)                                                              , kRWI_W    , 0                         , 6  ), // #827
+  INST(Fmla_z           , SveZPZZa           , (0x65200000, kSZ_HSD)                                                                 , kRWI_X    , 0                         , 0  ), // #828
+  INST(Fmls_z           , SveZPZZa           , (0x65202000, kSZ_HSD)                                                                 , kRWI_X    , 0                         , 1  ), // #829
+  INST(Fmul_z           , SveZZZ             , (0x65000800, 0x65028000, kSZ_HSD, 0)                                                  , kRWI_W    , 0                         , 10 ), // #830
+  INST(Fneg_z           , SveZPZ             , (0x041DA000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 5  ), // #831
+  INST(Fnmla_z          , SveZPZZa           , (0x65204000, kSZ_HSD)                                                                 , kRWI_X    , 0                         , 2  ), // #832
+  INST(Fnmls_z          , SveZPZZa           , (0x65206000, kSZ_HSD)                                                                 , kRWI_X    , 0                         , 3  ), // #833
+  INST(Frintm_z         , SveZPZ             , (0x6582A000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 6  ), // #834
+  INST(Frintn_z         , SveZPZ             , (0x6580A000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 7  ), // #835
+  INST(Frintp_z         , SveZPZ             , (0x6581A000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 8  ), // #836
+  INST(Frintz_z         , SveZPZ             , (0x6583A000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 9  ), // #837
+  INST(Fsqrt_z          , SveZPZ             , (0x650DA000, kSZ_HSD)                                                                 , kRWI_W    , 0                         , 10 ), // #838
+  INST(Fsub_z           , SveZZZ             , (0x65000400, 0x65018000, kSZ_HSD, 0)                                                  , kRWI_W    , 0                         , 11 ), // #839
+  INST(Incb_z           , SveCnt             , (0x0430E000)                                                                          , kRWI_X    , 0                         , 8  ), // #840
+  INST(Incd_z           , SveCnt             , (0x04F0E000)                                                                          , kRWI_X    , 0                         , 9  ), // #841
+  INST(Inch_z           , SveCnt             , (0x0470E000)                                                                          , kRWI_X    , 0                         , 10 ), // #842
+  INST(Incw_z           , SveCnt             , (0x04B0E000)                                                                          , kRWI_X    , 0                         , 11 ), // #843
+  INST(Index_z          , SveIndex           , (_)                                                                                   , kRWI_W    , 0                         , 0  ), // #844
+  INST(Ld1b_z           , SveLdSt            , (0, kSveLd)                                                                           , kRWI_W    , 0                         , 0  ), // #845
+  INST(Ld1d_z           , SveLdSt            , (3, kSveLd)                                                                           , kRWI_W    , 0                         , 1  ), // #846
+  INST(Ld1h_z           , SveLdSt            , (1, kSveLd)                                                                           , kRWI_W    , 0                         , 2  ), // #847
+  INST(Ld1w_z           , SveLdSt            , (2, kSveLd)                                                                           , kRWI_W    , 0                         , 3  ), // #848
+  INST(Ldff1b_z         , SveLdSt            , (0, kSveLdFF)                                                                         , kRWI_W    , 0                         , 4  ), // #849
+  INST(Ldff1d_z         , SveLdSt            , (3, kSveLdFF)                                                                         , kRWI_W    , 0                         , 5  ), // #850
+  INST(Ldff1h_z         , SveLdSt            , (1, kSveLdFF)                                                                         , kRWI_W    , 0                         , 6  ), // #851
+  INST(Ldff1w_z         , SveLdSt            , (2, kSveLdFF)                                                                         , kRWI_W    , 0                         , 7  ), // #852
+  INST(Ldr_z            , SveLdrStr          , (0x85804000)                                                                          , kRWI_W    , 0                         , 0  ), // #853
+  INST(Lsl_z            , SveShift           , (0x04209C00, 0x04138000, 1)                                                           , kRWI_W    , 0                         , 1  ), // #854
+  INST(Lsr_z            , SveShift           , (0x04209400, 0x04118000, 0)                                                           , kRWI_W    , 0                         , 2  ), // #855
+  INST(Mla_z            , SveZPZZa           , (0x04004000, kSZ_BHSD)                                                                , kRWI_X    , 0                         , 4  ), // #856
+  INST(Mls_z            , SveZPZZa           , (0x04006000, kSZ_BHSD)                                                                , kRWI_X    , 0                         , 5  ), // #857
+  INST(Mul_z            , SveZZZ             , (0x04206000, 0x04100000, kSZ_BHSD, 0)                                                 , kRWI_W    , 0                         , 12 ), // #858
+  INST(Nbsl_z           , SveZZZZ            , (0x04E03C00)                                                                          , kRWI_X    , 0                         , 5  ), // #859
+  INST(Neg_z            , SveZPZ             , (0x0417A000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 11 ), // #860
+  INST(Not_z            , SveZPZ             , (0x041EA000, kSZ_BHSD)                                                                , kRWI_W    , 0                         , 12 ), // #861
+  INST(Orr_z            , SveZZZ             , (0x04603000, 0x04180000, kSZ_BHSD, 1)                                                 , kRWI_W    , 0                         , 13 ), // #862
+  INST(Orv_z            , SveReduce          , (0x04182000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 7  ), // #863
+  INST(Pfalse_z         , SveP               , (0x2518E400)                                                                          , kRWI_W    , 0                         , 0  ), // #864
+  INST(Ptrue_z          , SvePtrue           , (0x2518E000)                                                                          , kRWI_W    , 0                         , 0  ), // #865
+  INST(Ptrues_z         , SvePtrue           , (0x2519E000)                                                                          , kRWI_W    , 0                         , 1  ), // #866
+  INST(Rdffr_z          , SveP               , (0x2519F000)                                                                          , kRWI_W    , 0                         , 1  ), // #867
+  INST(Rdvl_z           , SveAddVl           , (0x04BF5000, 0)                                                                       , kRWI_W    , 0                         , 2  ), // #868
+  INST(Saddv_z          , SveReduce          , (0x04002000, kSZ_BHS, 1)                                                              , kRWI_W    , 0                         , 8  ), // #869
+  INST(Scvtf_z          , SveCvt             , (0x6594A000, 0x65D6A000)                                                              , kRWI_W    , 0                         , 2  ), // #870
+  INST(Sdiv_z           , SveZZZ             , (0, 0x04940000, kSZ_SD, 0)                                                            , kRWI_W    , 0                         , 14 ), // #871
+  INST(Sel_z            , SveSel             , (_)                                                                                   , kRWI_W    , 0                         , 0  ), // #872
+  INST(Setffr_z         , BaseOp             , (0x252C9000)                                                                          , 0         , 0                         , 24 ), // #873
+  INST(Smax_z           , SveZZZ             , (0, 0x04080000, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 15 ), // #874
+  INST(Smaxv_z          , SveReduce          , (0x04082000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 9  ), // #875
+  INST(Smin_z           , SveZZZ             , (0, 0x040A0000, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 16 ), // #876
+  INST(Sminv_z          , SveReduce          , (0x040A2000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 10 ), // #877
+  INST(Smulh_z          , SveZZZ             , (0x04206800, 0x04120000, kSZ_BHSD, 0)                                                 , kRWI_W    , 0                         , 17 ), // #878
+  INST(St1b_z           , SveLdSt            , (0, kSveSt)                                                                           , kRWI_R    , 0                         , 8  ), // #879
+  INST(St1d_z           , SveLdSt            , (3, kSveSt)                                                                           , kRWI_R    , 0                         , 9  ), // #880
+  INST(St1h_z           , SveLdSt            , (1, kSveSt)                                                                           , kRWI_R    , 0                         , 10 ), // #881
+  INST(St1w_z           , SveLdSt            , (2, kSveSt)                                                                           , kRWI_R    , 0                         , 11 ), // #882
+  INST(Str_z            , SveLdrStr          , (0xE5804000)                                                                          , kRWI_R    , 0                         , 1  ), // #883
+  INST(Sub_z            , SveZZZ             , (0x04200400, 0x04010000, kSZ_BHSD, 0)                                                 , kRWI_W    , 0                         , 18 ), // #884
+  INST(Tbl_z            , SveZZZ             , (0x05203000, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 19 ), // #885
+  INST(Trn1_z           , SveZZZ             , (0x05207000, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 20 ), // #886
+  INST(Trn2_z           , SveZZZ             , (0x05207400, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 21 ), // #887
+  INST(Uaddv_z          , SveReduce          , (0x04012000, kSZ_BHSD, 1)                                                             , kRWI_W    , 0                         , 11 ), // #888
+  INST(Ucvtf_z          , SveCvt             , (0x6595A000, 0x65D7A000)                                                              , kRWI_W    , 0                         , 3  ), // #889
+  INST(Udiv_z           , SveZZZ             , (0, 0x04950000, kSZ_SD, 0)                                                            , kRWI_W    , 0                         , 22 ), // #890
+  INST(Umax_z           , SveZZZ             , (0, 0x04090000, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 23 ), // #891
+  INST(Umaxv_z          , SveReduce          , (0x04092000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 12 ), // #892
+  INST(Umin_z           , SveZZZ             , (0, 0x040B0000, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 24 ), // #893
+  INST(Uminv_z          , SveReduce          , (0x040B2000, kSZ_BHSD, 0)                                                             , kRWI_W    , 0                         , 13 ), // #894
+  INST(Umulh_z          , SveZZZ             , (0x04206C00, 0x04130000, kSZ_BHSD, 0)                                                 , kRWI_W    , 0                         , 25 ), // #895
+  INST(Uzp1_z           , SveZZZ             , (0x05206800, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 26 ), // #896
+  INST(Uzp2_z           , SveZZZ             , (0x05206C00, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 27 ), // #897
+  INST(Whilege_z        , SveWhile           , (0x25200000)                                                                          , kRWI_W    , 0                         , 0  ), // #898
+  INST(Whilegt_z        , SveWhile           , (0x25200010)                                                                          , kRWI_W    , 0                         , 1  ), // #899
+  INST(Whilehi_z        , SveWhile           , (0x25200810)                                                                          , kRWI_W    , 0                         , 2  ), // #900
+  INST(Whilehs_z        , SveWhile           , (0x25200800)                                                                          , kRWI_W    , 0                         , 3  ), // #901
+  INST(Whilele_z        , SveWhile           , (0x25200410)                                                                          , kRWI_W    , 0                         , 4  ), // #902
+  INST(Whilelo_z        , SveWhile           , (0x25200C00)                                                                          , kRWI_W    , 0                         , 5  ), // #903
+  INST(Whilels_z        , SveWhile           , (0x25200C10)                                                                          , kRWI_W    , 0                         , 6  ), // #904
+  INST(Whilelt_z        , SveWhile           , (0x25200400)                                                                          , kRWI_W    , 0                         , 7  ), // #905
+  INST(Zip1_z           , SveZZZ             , (0x05206000, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 28 ), // #906
+  INST(Zip2_z           , SveZZZ             , (0x05206400, 0, kSZ_BHSD, 0)                                                          , kRWI_W    , 0                         , 29 )  // #907
   // ${InstInfo:End}
 };
 
@@ -1185,7 +1317,7 @@ const BaseMvnNeg baseMvnNeg[3] = {
   { 0b01101011000000000000001111100000 }  // negs
 };
 
-const BaseOp baseOp[24] = {
+const BaseOp baseOp[25] = {
   { 0b11010101000000110010000110011111 }, // autia1716
   { 0b11010101000000110010001110111111 }, // autiasp
   { 0b11010101000000110010001110011111 }, // autiaz
@@ -1209,7 +1341,8 @@ const BaseOp baseOp[24] = {
   { 0b11010101000000110010000001111111 }, // wfi
   { 0b11010101000000000100000000111111 }, // xaflag
   { 0b11010101000000110010000011111111 }, // xpaclri
-  { 0b11010101000000110010000000111111 }  // yield
+  { 0b11010101000000110010000000111111 }, // yield
+  { 0x252C9000 }  // setffr_z
 };
 
 const BaseOpImm baseOpImm[15] = {
@@ -1854,6 +1987,178 @@ const SimdTblTbx simdTblTbx[2] = {
   { 0b0000111000000000000000 }, // tbl_v
   { 0b0000111000000000000100 }  // tbx_v
 };
+
+const SveAddVl sveAddVl[3] = {
+  { 0x04605000, 1 }, // addpl_z
+  { 0x04205000, 1 }, // addvl_z
+  { 0x04BF5000, 0 }  // rdvl_z
+};
+
+const SveCmp sveCmp[10] = {
+  { 0x2400A000, kSZ_BHSD }, // cmpeq_z
+  { 0x24008000, kSZ_BHSD }, // cmpge_z
+  { 0x24008010, kSZ_BHSD }, // cmpgt_z
+  { 0x24000010, kSZ_BHSD }, // cmphi_z
+  { 0x24000000, kSZ_BHSD }, // cmphs_z
+  { 0x2400A010, kSZ_BHSD }, // cmpne_z
+  { 0x65006000, kSZ_HSD }, // fcmeq_z
+  { 0x65004000, kSZ_HSD }, // fcmge_z
+  { 0x65004010, kSZ_HSD }, // fcmgt_z
+  { 0x65006010, kSZ_HSD }  // fcmne_z
+};
+
+const SveCnt sveCnt[12] = {
+  { 0x0420E000 }, // cntb_z
+  { 0x04E0E000 }, // cntd_z
+  { 0x0460E000 }, // cnth_z
+  { 0x04A0E000 }, // cntw_z
+  { 0x0430E400 }, // decb_z
+  { 0x04F0E400 }, // decd_z
+  { 0x0470E400 }, // dech_z
+  { 0x04B0E400 }, // decw_z
+  { 0x0430E000 }, // incb_z
+  { 0x04F0E000 }, // incd_z
+  { 0x0470E000 }, // inch_z
+  { 0x04B0E000 }  // incw_z
+};
+
+const SveCvt sveCvt[4] = {
+  { 0x659CA000, 0x65DEA000 }, // fcvtzs_z
+  { 0x659DA000, 0x65DFA000 }, // fcvtzu_z
+  { 0x6594A000, 0x65D6A000 }, // scvtf_z
+  { 0x6595A000, 0x65D7A000 }  // ucvtf_z
+};
+
+const SveLdSt sveLdSt[12] = {
+  { 0, kSveLd }, // ld1b_z
+  { 3, kSveLd }, // ld1d_z
+  { 1, kSveLd }, // ld1h_z
+  { 2, kSveLd }, // ld1w_z
+  { 0, kSveLdFF }, // ldff1b_z
+  { 3, kSveLdFF }, // ldff1d_z
+  { 1, kSveLdFF }, // ldff1h_z
+  { 2, kSveLdFF }, // ldff1w_z
+  { 0, kSveSt }, // st1b_z
+  { 3, kSveSt }, // st1d_z
+  { 1, kSveSt }, // st1h_z
+  { 2, kSveSt }  // st1w_z
+};
+
+const SveLdrStr sveLdrStr[2] = {
+  { 0x85804000 }, // ldr_z
+  { 0xE5804000 }  // str_z
+};
+
+const SveP sveP[2] = {
+  { 0x2518E400 }, // pfalse_z
+  { 0x2519F000 }  // rdffr_z
+};
+
+const SvePtrue svePtrue[2] = {
+  { 0x2518E000 }, // ptrue_z
+  { 0x2519E000 }  // ptrues_z
+};
+
+const SveReduce sveReduce[14] = {
+  { 0x041A2000, kSZ_BHSD, 0 }, // andv_z
+  { 0x04192000, kSZ_BHSD, 0 }, // eorv_z
+  { 0x65002000, kSZ_HSD, 0 }, // faddv_z
+  { 0x65042000, kSZ_HSD, 0 }, // fmaxnmv_z
+  { 0x65062000, kSZ_HSD, 0 }, // fmaxv_z
+  { 0x65052000, kSZ_HSD, 0 }, // fminnmv_z
+  { 0x65072000, kSZ_HSD, 0 }, // fminv_z
+  { 0x04182000, kSZ_BHSD, 0 }, // orv_z
+  { 0x04002000, kSZ_BHS, 1 }, // saddv_z
+  { 0x04082000, kSZ_BHSD, 0 }, // smaxv_z
+  { 0x040A2000, kSZ_BHSD, 0 }, // sminv_z
+  { 0x04012000, kSZ_BHSD, 1 }, // uaddv_z
+  { 0x04092000, kSZ_BHSD, 0 }, // umaxv_z
+  { 0x040B2000, kSZ_BHSD, 0 }  // uminv_z
+};
+
+const SveShift sveShift[3] = {
+  { 0x04209000, 0x04108000, 0 }, // asr_z
+  { 0x04209C00, 0x04138000, 1 }, // lsl_z
+  { 0x04209400, 0x04118000, 0 }  // lsr_z
+};
+
+const SveWhile sveWhile[8] = {
+  { 0x25200000 }, // whilege_z
+  { 0x25200010 }, // whilegt_z
+  { 0x25200810 }, // whilehi_z
+  { 0x25200800 }, // whilehs_z
+  { 0x25200410 }, // whilele_z
+  { 0x25200C00 }, // whilelo_z
+  { 0x25200C10 }, // whilels_z
+  { 0x25200400 }  // whilelt_z
+};
+
+const SveZPZ sveZPZ[13] = {
+  { 0x0416A000, kSZ_BHSD }, // abs_z
+  { 0x0418A000, kSZ_BHSD }, // cls_z
+  { 0x0419A000, kSZ_BHSD }, // clz_z
+  { 0x041AA000, kSZ_BHSD }, // cnt_z
+  { 0x041CA000, kSZ_HSD }, // fabs_z
+  { 0x041DA000, kSZ_HSD }, // fneg_z
+  { 0x6582A000, kSZ_HSD }, // frintm_z
+  { 0x6580A000, kSZ_HSD }, // frintn_z
+  { 0x6581A000, kSZ_HSD }, // frintp_z
+  { 0x6583A000, kSZ_HSD }, // frintz_z
+  { 0x650DA000, kSZ_HSD }, // fsqrt_z
+  { 0x0417A000, kSZ_BHSD }, // neg_z
+  { 0x041EA000, kSZ_BHSD }  // not_z
+};
+
+const SveZPZZa sveZPZZa[6] = {
+  { 0x65200000, kSZ_HSD }, // fmla_z
+  { 0x65202000, kSZ_HSD }, // fmls_z
+  { 0x65204000, kSZ_HSD }, // fnmla_z
+  { 0x65206000, kSZ_HSD }, // fnmls_z
+  { 0x04004000, kSZ_BHSD }, // mla_z
+  { 0x04006000, kSZ_BHSD }  // mls_z
+};
+
+const SveZZZ sveZZZ[30] = {
+  { 0x04200000, 0x04000000, kSZ_BHSD, 0 }, // add_z
+  { 0x04203000, 0x041A0000, kSZ_BHSD, 1 }, // and_z
+  { 0x04E03000, 0x041B0000, kSZ_BHSD, 1 }, // bic_z
+  { 0x04A03000, 0x04190000, kSZ_BHSD, 1 }, // eor_z
+  { 0x65000000, 0x65008000, kSZ_HSD, 0 }, // fadd_z
+  { 0, 0x650D8000, kSZ_HSD, 0 }, // fdiv_z
+  { 0, 0x65068000, kSZ_HSD, 0 }, // fmax_z
+  { 0, 0x65048000, kSZ_HSD, 0 }, // fmaxnm_z
+  { 0, 0x65078000, kSZ_HSD, 0 }, // fmin_z
+  { 0, 0x65058000, kSZ_HSD, 0 }, // fminnm_z
+  { 0x65000800, 0x65028000, kSZ_HSD, 0 }, // fmul_z
+  { 0x65000400, 0x65018000, kSZ_HSD, 0 }, // fsub_z
+  { 0x04206000, 0x04100000, kSZ_BHSD, 0 }, // mul_z
+  { 0x04603000, 0x04180000, kSZ_BHSD, 1 }, // orr_z
+  { 0, 0x04940000, kSZ_SD, 0 }, // sdiv_z
+  { 0, 0x04080000, kSZ_BHSD, 0 }, // smax_z
+  { 0, 0x040A0000, kSZ_BHSD, 0 }, // smin_z
+  { 0x04206800, 0x04120000, kSZ_BHSD, 0 }, // smulh_z
+  { 0x04200400, 0x04010000, kSZ_BHSD, 0 }, // sub_z
+  { 0x05203000, 0, kSZ_BHSD, 0 }, // tbl_z
+  { 0x05207000, 0, kSZ_BHSD, 0 }, // trn1_z
+  { 0x05207400, 0, kSZ_BHSD, 0 }, // trn2_z
+  { 0, 0x04950000, kSZ_SD, 0 }, // udiv_z
+  { 0, 0x04090000, kSZ_BHSD, 0 }, // umax_z
+  { 0, 0x040B0000, kSZ_BHSD, 0 }, // umin_z
+  { 0x04206C00, 0x04130000, kSZ_BHSD, 0 }, // umulh_z
+  { 0x05206800, 0, kSZ_BHSD, 0 }, // uzp1_z
+  { 0x05206C00, 0, kSZ_BHSD, 0 }, // uzp2_z
+  { 0x05206000, 0, kSZ_BHSD, 0 }, // zip1_z
+  { 0x05206400, 0, kSZ_BHSD, 0 }  // zip2_z
+};
+
+const SveZZZZ sveZZZZ[6] = {
+  { 0x04603800 }, // bcax_z
+  { 0x04603C00 }, // bsl1n_z
+  { 0x04A03C00 }, // bsl2n_z
+  { 0x04203C00 }, // bsl_z
+  { 0x04203800 }, // eor3_z
+  { 0x04E03C00 }  // nbsl_z
+};
 // ----------------------------------------------------------------------------
 // ${EncodingData:End}
 
@@ -1877,32 +2182,32 @@ const InstDB::CommonInfo InstDB::commonData[] = {
 // ${NameData:Begin}
 // ------------------- Automatically generated, do not edit -------------------
 const InstNameIndex InstDB::_inst_name_index = {{
-  { Inst::kIdAbs          , Inst::kIdAnd_v         + 1 },
-  { Inst::kIdB            , Inst::kIdBsl_v         + 1 },
-  { Inst::kIdCas          , Inst::kIdCnt_v         + 1 },
-  { Inst::kIdDc           , Inst::kIdDup_v         + 1 },
-  { Inst::kIdEon          , Inst::kIdExt_v         + 1 },
-  { Inst::kIdFabd_v       , Inst::kIdFsub_v        + 1 },
+  { Inst::kIdAbs          , Inst::kIdAsr_z         + 1 },
+  { Inst::kIdB            , Inst::kIdBsl_z         + 1 },
+  { Inst::kIdCas          , Inst::kIdCpy_z         + 1 },
+  { Inst::kIdDc           , Inst::kIdDup_z         + 1 },
+  { Inst::kIdEon          , Inst::kIdEorv_z        + 1 },
+  { Inst::kIdFabd_v       , Inst::kIdFsub_z        + 1 },
   { Inst::kIdGmi          , Inst::kIdGmi           + 1 },
   { Inst::kIdHint         , Inst::kIdHvc           + 1 },
-  { Inst::kIdIc           , Inst::kIdIns_v         + 1 },
+  { Inst::kIdIc           , Inst::kIdIndex_z       + 1 },
   { Inst::kIdNone         , Inst::kIdNone          + 1 },
   { Inst::kIdNone         , Inst::kIdNone          + 1 },
-  { Inst::kIdLdadd        , Inst::kIdLdur_v        + 1 },
-  { Inst::kIdMadd         , Inst::kIdMvni_v        + 1 },
-  { Inst::kIdNeg          , Inst::kIdNot_v         + 1 },
-  { Inst::kIdOrn          , Inst::kIdOrr_v         + 1 },
-  { Inst::kIdPacda        , Inst::kIdPmull2_v      + 1 },
+  { Inst::kIdLdadd        , Inst::kIdLsr_z         + 1 },
+  { Inst::kIdMadd         , Inst::kIdMul_z         + 1 },
+  { Inst::kIdNeg          , Inst::kIdNot_z         + 1 },
+  { Inst::kIdOrn          , Inst::kIdOrv_z         + 1 },
+  { Inst::kIdPacda        , Inst::kIdPtrues_z      + 1 },
   { Inst::kIdNone         , Inst::kIdNone          + 1 },
-  { Inst::kIdRbit         , Inst::kIdRsubhn2_v     + 1 },
-  { Inst::kIdSbc          , Inst::kIdSxtl2_v       + 1 },
-  { Inst::kIdTlbi         , Inst::kIdTrn2_v        + 1 },
-  { Inst::kIdUbfiz        , Inst::kIdUzp2_v        + 1 },
+  { Inst::kIdRbit         , Inst::kIdRdvl_z        + 1 },
+  { Inst::kIdSbc          , Inst::kIdSub_z         + 1 },
+  { Inst::kIdTlbi         , Inst::kIdTrn2_z        + 1 },
+  { Inst::kIdUbfiz        , Inst::kIdUzp2_z        + 1 },
   { Inst::kIdNone         , Inst::kIdNone          + 1 },
-  { Inst::kIdWfe          , Inst::kIdWfi           + 1 },
+  { Inst::kIdWfe          , Inst::kIdWhilelt_z     + 1 },
   { Inst::kIdXaflag       , Inst::kIdXtn2_v        + 1 },
   { Inst::kIdYield        , Inst::kIdYield         + 1 },
-  { Inst::kIdZip1_v       , Inst::kIdZip2_v        + 1 }
+  { Inst::kIdZip1_v       , Inst::kIdZip2_z        + 1 }
 }, uint16_t(9)};
 
 const char InstDB::_inst_name_string_table[] =
@@ -1916,8 +2221,8 @@ const char InstDB::_inst_name_string_table[] =
   "\x32\x63\x73\x74\x61\x64\x64\x73\x74\x63\x6C\x72\x73\x74\x65\x6F\x72\x73\x74\x73\x65\x74\x78\x70\x61\x63\x6C\x62\x66"
   "\x63\x76\x74\x62\x66\x6D\x6C\x61\x6C\x74\x66\x63\x76\x74\x78\x66\x6A\x63\x76\x74\x7A\x66\x6D\x61\x78\x6E\x6D\x66\x6D"
   "\x69\x6E\x6E\x6D\x66\x72\x73\x71\x72\x72\x61\x64\x64\x72\x73\x75\x62\x73\x68\x61\x31\x73\x6D\x33\x74\x74\x31\x32\x61"
-  "\x32\x62\x73\x6D\x34\x65\x6B\x65\x79\x73\x71\x78\x74\x75\x75\x71\x73\x68\x72\x75\x72\x73\x71\x72\x73\x65\x74\x66\x72"
-  "\x65\x76\x38";
+  "\x32\x62\x73\x6D\x34\x65\x6B\x65\x79\x73\x71\x78\x74\x75\x75\x71\x73\x68\x72\x75\x72\x73\x71\x72\x77\x68\x69\x6C\x65"
+  "\x67\x68\x73\x6C\x6F\x73\x65\x74\x66\x72\x65\x76\x38";
 
 
 const uint32_t InstDB::_inst_name_index_table[] = {
@@ -2198,9 +2503,9 @@ const uint32_t InstDB::_inst_name_index_table[] = {
   0x800A2452, // Small 'rbit'.
   0x800050B2, // Small 'ret'.
   0x800058B2, // Small 'rev'.
-  0x2007313E, // Large 'rev|16'.
+  0x20073148, // Large 'rev|16'.
   0x81DF58B2, // Small 'rev32'.
-  0x208F313E, // Large 'rev|64'.
+  0x208F3148, // Large 'rev|64'.
   0x800049F2, // Small 'ror'.
   0x800B49F2, // Small 'rorv'.
   0x80000C53, // Small 'sbc'.
@@ -2209,8 +2514,8 @@ const uint32_t InstDB::_inst_name_index_table[] = {
   0x80069853, // Small 'sbfm'.
   0x800C1853, // Small 'sbfx'.
   0x800B2493, // Small 'sdiv'.
-  0x1141413A, // Large 'setf|8'.
-  0x2007413A, // Large 'setf|16'.
+  0x114B4144, // Large 'setf|8'.
+  0x20074144, // Large 'setf|16'.
   0x800058B3, // Small 'sev'.
   0x800658B3, // Small 'sevl'.
   0x984205B3, // Small 'smaddl'.
@@ -2500,9 +2805,9 @@ const uint32_t InstDB::_inst_name_index_table[] = {
   0x30B0410E, // Large 'radd|hn2'.
   0x800E6032, // Small 'rax1'.
   0x800A2452, // Small 'rbit'.
-  0x2007313E, // Large 'rev|16'.
+  0x20073148, // Large 'rev|16'.
   0x81DF58B2, // Small 'rev32'.
-  0x208F313E, // Large 'rev|64'.
+  0x208F3148, // Large 'rev|64'.
   0x80E92272, // Small 'rshrn'.
   0xBAE92272, // Small 'rshrn2'.
   0x9C815672, // Small 'rsubhn'.
@@ -2696,6 +3001,138 @@ const uint32_t InstDB::_inst_name_index_table[] = {
   0x80003A98, // Small 'xtn'.
   0x800EBA98, // Small 'xtn2'.
   0x800E413A, // Small 'zip1'.
+  0x800EC13A, // Small 'zip2'.
+  0x80004C41, // Small 'abs'.
+  0x80001081, // Small 'add'.
+  0x80C81081, // Small 'addpl'.
+  0x80CB1081, // Small 'addvl'.
+  0x800011C1, // Small 'and'.
+  0x800B11C1, // Small 'andv'.
+  0x80004A61, // Small 'asr'.
+  0x800C0462, // Small 'bcax'.
+  0x80000D22, // Small 'bic'.
+  0x80EE3262, // Small 'bsl1n'.
+  0x80EEB262, // Small 'bsl2n'.
+  0x80003262, // Small 'bsl'.
+  0x80004D83, // Small 'cls'.
+  0x80006983, // Small 'clz'.
+  0x8112C1A3, // Small 'cmpeq'.
+  0x8053C1A3, // Small 'cmpge'.
+  0x8143C1A3, // Small 'cmpgt'.
+  0x809441A3, // Small 'cmphi'.
+  0x813441A3, // Small 'cmphs'.
+  0x805741A3, // Small 'cmpne'.
+  0x800051C3, // Small 'cnt'.
+  0x800151C3, // Small 'cntb'.
+  0x800251C3, // Small 'cntd'.
+  0x800451C3, // Small 'cnth'.
+  0x800BD1C3, // Small 'cntw'.
+  0x80006603, // Small 'cpy'.
+  0x80010CA4, // Small 'decb'.
+  0x80020CA4, // Small 'decd'.
+  0x80040CA4, // Small 'dech'.
+  0x800B8CA4, // Small 'decw'.
+  0x800042A4, // Small 'dup'.
+  0x800F49E5, // Small 'eor3'.
+  0x800049E5, // Small 'eor'.
+  0x800B49E5, // Small 'eorv'.
+  0x80098826, // Small 'fabs'.
+  0x80021026, // Small 'fadd'.
+  0x81621026, // Small 'faddv'.
+  0x8112B466, // Small 'fcmeq'.
+  0x8053B466, // Small 'fcmge'.
+  0x8143B466, // Small 'fcmgt'.
+  0x80573466, // Small 'fcmne'.
+  0xA7AA5866, // Small 'fcvtzs'.
+  0xABAA5866, // Small 'fcvtzu'.
+  0x800B2486, // Small 'fdiv'.
+  0x800C05A6, // Small 'fmax'.
+  0x9AEC05A6, // Small 'fmaxnm'.
+  0x10E960FD, // Large 'fmaxnm|v'.
+  0x816C05A6, // Small 'fmaxv'.
+  0x800725A6, // Small 'fmin'.
+  0x9AE725A6, // Small 'fminnm'.
+  0x10E96103, // Large 'fminnm|v'.
+  0x816725A6, // Small 'fminv'.
+  0x8000B1A6, // Small 'fmla'.
+  0x8009B1A6, // Small 'fmls'.
+  0x800655A6, // Small 'fmul'.
+  0x800395C6, // Small 'fneg'.
+  0x801635C6, // Small 'fnmla'.
+  0x813635C6, // Small 'fnmls'.
+  0x9B472646, // Small 'frintm'.
+  0x9D472646, // Small 'frintn'.
+  0xA1472646, // Small 'frintp'.
+  0xB5472646, // Small 'frintz'.
+  0x81494666, // Small 'fsqrt'.
+  0x80015666, // Small 'fsub'.
+  0x80010DC9, // Small 'incb'.
+  0x80020DC9, // Small 'incd'.
+  0x80040DC9, // Small 'inch'.
+  0x800B8DC9, // Small 'incw'.
+  0x818291C9, // Small 'index'.
+  0x8001708C, // Small 'ld1b'.
+  0x8002708C, // Small 'ld1d'.
+  0x8004708C, // Small 'ld1h'.
+  0x800BF08C, // Small 'ld1w'.
+  0x85C3188C, // Small 'ldff1b'.
+  0x89C3188C, // Small 'ldff1d'.
+  0x91C3188C, // Small 'ldff1h'.
+  0xAFC3188C, // Small 'ldff1w'.
+  0x8000488C, // Small 'ldr'.
+  0x8000326C, // Small 'lsl'.
+  0x80004A6C, // Small 'lsr'.
+  0x8000058D, // Small 'mla'.
+  0x80004D8D, // Small 'mls'.
+  0x800032AD, // Small 'mul'.
+  0x80064C4E, // Small 'nbsl'.
+  0x80001CAE, // Small 'neg'.
+  0x800051EE, // Small 'not'.
+  0x80004A4F, // Small 'orr'.
+  0x80005A4F, // Small 'orv'.
+  0x8B3604D0, // Small 'pfalse'.
+  0x805ACA90, // Small 'ptrue'.
+  0xA65ACA90, // Small 'ptrues'.
+  0x81231892, // Small 'rdffr'.
+  0x80065892, // Small 'rdvl'.
+  0x81621033, // Small 'saddv'.
+  0x806A5873, // Small 'scvtf'.
+  0x800B2493, // Small 'sdiv'.
+  0x800030B3, // Small 'sel'.
+  0xA46350B3, // Small 'setffr'.
+  0x800C05B3, // Small 'smax'.
+  0x816C05B3, // Small 'smaxv'.
+  0x800725B3, // Small 'smin'.
+  0x816725B3, // Small 'sminv'.
+  0x808655B3, // Small 'smulh'.
+  0x80017293, // Small 'st1b'.
+  0x80027293, // Small 'st1d'.
+  0x80047293, // Small 'st1h'.
+  0x800BF293, // Small 'st1w'.
+  0x80004A93, // Small 'str'.
+  0x80000AB3, // Small 'sub'.
+  0x80003054, // Small 'tbl'.
+  0x800E3A54, // Small 'trn1'.
+  0x800EBA54, // Small 'trn2'.
+  0x81621035, // Small 'uaddv'.
+  0x806A5875, // Small 'ucvtf'.
+  0x800B2495, // Small 'udiv'.
+  0x800C05B5, // Small 'umax'.
+  0x816C05B5, // Small 'umaxv'.
+  0x800725B5, // Small 'umin'.
+  0x816725B5, // Small 'uminv'.
+  0x808655B5, // Small 'umulh'.
+  0x800E4355, // Small 'uzp1'.
+  0x800EC355, // Small 'uzp2'.
+  0x1061613A, // Large 'whileg|e'.
+  0x1002613A, // Large 'whileg|t'.
+  0x213B513A, // Large 'while|hi'.
+  0x2140513A, // Large 'while|hs'.
+  0x213D513A, // Large 'while|le'.
+  0x2142513A, // Large 'while|lo'.
+  0x202E513A, // Large 'while|ls'.
+  0x20F0513A, // Large 'while|lt'.
+  0x800E413A, // Small 'zip1'.
   0x800EC13A  // Small 'zip2'.
 };
 // ----------------------------------------------------------------------------
@@ -153,6 +153,32 @@ enum VOType : uint32_t {
   kVO_Count
 };
 
+// a64::InstDB - SVE
+// =================
+
+//! Element sizes allowed by SVE instructions (bit mask indexed by `VecElementType - VecElementType::kB`).
+enum SveSizes : uint32_t {
+  kSZ_B    = 0x1u,
+  kSZ_H    = 0x2u,
+  kSZ_S    = 0x4u,
+  kSZ_D    = 0x8u,
+
+  kSZ_SD   = kSZ_S | kSZ_D,
+  kSZ_BHS  = kSZ_B | kSZ_H | kSZ_S,
+  kSZ_HSD  = kSZ_H | kSZ_S | kSZ_D,
+  kSZ_BHSD = kSZ_B | kSZ_H | kSZ_S | kSZ_D
+};
+
+//! Kind of SVE load or store.
+enum SveLdStKind : uint32_t {
+  //! Load (LD1x).
+  kSveLd,
+  //! First-faulting load (LDFF1x).
+  kSveLdFF,
+  //! Store (ST1x).
+  kSveSt
+};
+
 // a64::InstDB - EncodingId
 // ========================
 
@@ -253,7 +279,26 @@ enum EncodingId : uint32_t {
   kEncodingSimdSm3tt,
   kEncodingSimdSmovUmov,
   kEncodingSimdSxtlUxtl,
-  kEncodingSimdTblTbx
+  kEncodingSimdTblTbx,
+  kEncodingSveAddVl,
+  kEncodingSveCmp,
+  kEncodingSveCnt,
+  kEncodingSveCpy,
+  kEncodingSveCvt,
+  kEncodingSveDup,
+  kEncodingSveIndex,
+  kEncodingSveLdSt,
+  kEncodingSveLdrStr,
+  kEncodingSveP,
+  kEncodingSvePtrue,
+  kEncodingSveReduce,
+  kEncodingSveSel,
+  kEncodingSveShift,
+  kEncodingSveWhile,
+  kEncodingSveZPZ,
+  kEncodingSveZPZZa,
+  kEncodingSveZZZ,
+  kEncodingSveZZZZ
 };
 // ----------------------------------------------------------------------------
 // ${EncodingId:End}
@@ -773,6 +818,79 @@ struct SimdTblTbx {
   uint32_t opcode;
 };
 
+struct SveAddVl {
+  uint32_t opcode;
+  uint32_t has_rn : 1;
+};
+
+struct SveCmp {
+  uint32_t opcode;
+  uint32_t sizes : 4;
+};
+
+struct SveCnt {
+  uint32_t opcode;
+};
+
+struct SveCvt {
+  uint32_t op_s;          // Opcode of S <- S conversion.
+  uint32_t op_d;          // Opcode of D <- D conversion.
+};
+
+struct SveLdSt {
+  uint32_t msz : 2;       // Memory element size.
+  uint32_t kind : 2;      // SveLdStKind.
+};
+
+struct SveLdrStr {
+  uint32_t opcode;        // Opcode of the Z form (the P form has bit 14 cleared).
+};
+
+struct SveP {
+  uint32_t opcode;
+};
+
+struct SvePtrue {
+  uint32_t opcode;
+};
+
+struct SveReduce {
+  uint32_t opcode;
+  uint32_t sizes : 4;
+  uint32_t wide : 1;      // The result is always 64-bit (D).
+};
+
+struct SveShift {
+  uint32_t imm_op;        // Unpredicated `Zd, Zn, #imm` form.
+  uint32_t zpzz_op;       // Predicated `Zdn, Pg/M, Zdn, Zm` form.
+  uint32_t left : 1;      // Shift left (affects immediate encoding).
+};
+
+struct SveWhile {
+  uint32_t opcode;
+};
+
+struct SveZPZ {
+  uint32_t opcode;
+  uint32_t sizes : 4;
+};
+
+struct SveZPZZa {
+  uint32_t opcode;
+  uint32_t sizes : 4;
+};
+
+struct SveZZZ {
+  uint32_t zzz_op;        // Unpredicated `Zd, Zn, Zm` form (zero if not available).
+  uint32_t zpzz_op;       // Predicated `Zdn, Pg/M, Zdn, Zm` form (zero if not available).
+  uint32_t sizes : 4;
+  uint32_t zzz_unsized : 1; // Unpredicated form doesn't encode element size (bitwise operations).
+};
+
+struct SveZZZZ {
+  uint32_t opcode;
+};
+
 #undef M_OPCODE
 
 // ${EncodingDataForward:Begin}
@@ -805,7 +923,7 @@ extern const BaseLogical baseLogical[8];
 extern const BaseMinMax baseMinMax[4];
 extern const BaseMovKNZ baseMovKNZ[3];
 extern const BaseMvnNeg baseMvnNeg[3];
-extern const BaseOp baseOp[24];
+extern const BaseOp baseOp[25];
 extern const BaseOpImm baseOpImm[15];
 extern const BaseOpX16 baseOpX16[1];
 extern const BasePrfm basePrfm[1];
@@ -860,6 +978,21 @@ extern const SimdSm3tt simdSm3tt[4];
 extern const SimdSmovUmov simdSmovUmov[2];
 extern const SimdSxtlUxtl simdSxtlUxtl[4];
 extern const SimdTblTbx simdTblTbx[2];
+extern const SveAddVl sveAddVl[3];
+extern const SveCmp sveCmp[10];
+extern const SveCnt sveCnt[12];
+extern const SveCvt sveCvt[4];
+extern const SveLdSt sveLdSt[12];
+extern const SveLdrStr sveLdrStr[2];
+extern const SveP sveP[2];
+extern const SvePtrue svePtrue[2];
+extern const SveReduce sveReduce[14];
+extern const SveShift sveShift[3];
+extern const SveWhile sveWhile[8];
+extern const SveZPZ sveZPZ[13];
+extern const SveZPZZa sveZPZZa[6];
+extern const SveZZZ sveZZZ[30];
+extern const SveZZZZ sveZZZZ[6];
 // ----------------------------------------------------------------------------
 // ${EncodingDataForward:End}
 
@@ -232,6 +232,17 @@ public:
     return Vec(_make_element_access_signature(element_type, element_index), reg_id);
   }
 
+  //! Creates a new scalable vector register (Z) having the given register id `reg_id` (SVE).
+  [[nodiscard]]
+  static ASMJIT_INLINE_CONSTEXPR Vec make_z(uint32_t reg_id) noexcept { return Vec(signature_of_t<RegType::kVecNLen>(), reg_id); }
+
+  //! Creates a new scalable vector register (Z) having the given vector `element_type` and register id `reg_id` (SVE).
+  [[nodiscard]]
+  static ASMJIT_INLINE_CONSTEXPR Vec make_z_with_element_type(VecElementType element_type, uint32_t reg_id) noexcept {
+    uint32_t signature = RegTraits<RegType::kVecNLen>::kSignature | uint32_t(element_type) << kSignatureRegElementTypeShift;
+    return Vec(OperandSignature{signature}, reg_id);
+  }
+
   //! \}
 
   //! \name Vector Register Accessors
@@ -243,6 +254,10 @@ public:
     return _signature.has_field<kSignatureRegElementTypeMask | kSignatureRegElementFlagMask>();
   }
 
+  //! Returns whether the register is a scalable vector register (Z) used by SVE instructions.
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR bool is_z() const noexcept { return is_reg(RegType::kVecNLen); }
+
   [[nodiscard]]
   ASMJIT_INLINE_CONSTEXPR bool is_vec_b8() const noexcept {
     return _signature.subset(kBaseSignatureMask | kSignatureRegElementTypeMask) == (RegTraits<RegType::kVec64>::kSignature | kSignatureElementB);
@@ -314,25 +329,37 @@ public:
   ASMJIT_INLINE_CONSTEXPR Vec v128() const noexcept { return make_v128(id()); }
 
   //! Clones and casts the register to an 8-bit B register (element type & index is not cloned).
+  //!
+  //! \note If this is a scalable vector register (Z) the result is Z.B register instead (SVE).
   [[nodiscard]]
-  ASMJIT_INLINE_CONSTEXPR Vec b() const noexcept { return make_v8(id()); }
+  ASMJIT_INLINE_CONSTEXPR Vec b() const noexcept { return is_z() ? make_z_with_element_type(VecElementType::kB, id()) : make_v8(id()); }
 
   //! Clones and casts the register to a 16-bit H register (element type & index is not cloned).
+  //!
+  //! \note If this is a scalable vector register (Z) the result is Z.H register instead (SVE).
   [[nodiscard]]
-  ASMJIT_INLINE_CONSTEXPR Vec h() const noexcept { return make_v16(id()); }
+  ASMJIT_INLINE_CONSTEXPR Vec h() const noexcept { return is_z() ? make_z_with_element_type(VecElementType::kH, id()) : make_v16(id()); }
 
   //! Clones and casts the register to a 32-bit S register (element type & index is not cloned).
+  //!
+  //! \note If this is a scalable vector register (Z) the result is Z.S register instead (SVE).
   [[nodiscard]]
-  ASMJIT_INLINE_CONSTEXPR Vec s() const noexcept { return make_v32(id()); }
+  ASMJIT_INLINE_CONSTEXPR Vec s() const noexcept { return is_z() ? make_z_with_element_type(VecElementType::kS, id()) : make_v32(id()); }
 
   //! Clones and casts the register to a 64-bit D register (element type & index is not cloned).
+  //!
+  //! \note If this is a scalable vector register (Z) the result is Z.D register instead (SVE).
   [[nodiscard]]
-  ASMJIT_INLINE_CONSTEXPR Vec d() const noexcept { return make_v64(id()); }
+  ASMJIT_INLINE_CONSTEXPR Vec d() const noexcept { return is_z() ? make_z_with_element_type(VecElementType::kD, id()) : make_v64(id()); }
 
   //! Clones and casts the register to a 128-bit Q register (element type & index is not cloned).
   [[nodiscard]]
   ASMJIT_INLINE_CONSTEXPR Vec q() const noexcept { return make_v128(id()); }
 
+  //! Clones and casts the register to a scalable Z register (element type & index is not cloned) (SVE).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR Vec z() const noexcept { return make_z(id()); }
+
   //! Clones and casts the register to a 128-bit V.B[element_index] register.
   [[nodiscard]]
   ASMJIT_INLINE_CONSTEXPR Vec b(uint32_t element_index) const noexcept { return make_v128_with_element_index(VecElementType::kB, element_index, id()); }
@@ -451,6 +478,114 @@ public:
   //! \}
 };
 
+//! Predication mode of a governing predicate register (AArch64 SVE).
+enum class PredMode : uint32_t {
+  //! No predication qualifier (predicates that are not governing and governing predicates of stores).
+  kNone = 0,
+  //! Zeroing predication (`/Z`) - inactive elements of the destination are set to zero.
+  kZeroing = 1,
+  //! Merging predication (`/M`) - inactive elements of the destination are preserved.
+  kMerging = 2,
+
+  //! Maximum value of \ref PredMode.
+  kMaxValue = kMerging
+};
+
+//! Predicate register (AArch64 SVE).
+//!
+//! Predicate registers hold a single bit per byte of a scalable vector register and select active elements of SVE
+//! instructions. A predicate register can have an element type (`p0.s()`), which is used when the predicate is a
+//! destination, and a predication mode (`p0.z()` or `p0.m()`), which is used when the predicate governs an instruction
+//! that distinguishes zeroing and merging predication.
+class PReg : public Reg {
+  ASMJIT_DEFINE_FINAL_REG(PReg, Reg, RegTraits<RegType::kMask>)
+
+  //! \cond
+
+  // Register element type (3 bits) - the same bits and values are used by \ref Vec.
+  // |........|........|.XXX....|........|
+  static inline constexpr uint32_t kSignatureRegElementTypeShift = Vec::kSignatureRegElementTypeShift;
+  static inline constexpr uint32_t kSignatureRegElementTypeMask = Vec::kSignatureRegElementTypeMask;
+
+  // Predication mode (2 bits).
+  // |........|......XX|........|........|
+  static inline constexpr uint32_t kSignaturePredModeShift = 16;
+  static inline constexpr uint32_t kSignaturePredModeMask = 0x03 << kSignaturePredModeShift;
+
+  //! \endcond
+
+  //! \name Static Constructors
+  //! \{
+
+  //! Creates a new predicate register having the given `element_type` and register id `reg_id`.
+  [[nodiscard]]
+  static ASMJIT_INLINE_CONSTEXPR PReg make_p_with_element_type(VecElementType element_type, uint32_t reg_id) noexcept {
+    return PReg(OperandSignature{kSignature | uint32_t(element_type) << kSignatureRegElementTypeShift}, reg_id);
+  }
+
+  //! Creates a new predicate register having the given predication `mode` and register id `reg_id`.
+  [[nodiscard]]
+  static ASMJIT_INLINE_CONSTEXPR PReg make_p_with_pred_mode(PredMode mode, uint32_t reg_id) noexcept {
+    return PReg(OperandSignature{kSignature | uint32_t(mode) << kSignaturePredModeShift}, reg_id);
+  }
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns whether the predicate register has associated an element type.
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR bool has_element_type() const noexcept { return _signature.has_field<kSignatureRegElementTypeMask>(); }
+
+  //! Returns element type of the predicate register.
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR VecElementType element_type() const noexcept { return VecElementType(_signature.get_field<kSignatureRegElementTypeMask>()); }
+
+  //! Returns predication mode of the predicate register.
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PredMode pred_mode() const noexcept { return PredMode(_signature.get_field<kSignaturePredModeMask>()); }
+
+  //! Tests whether the predicate register uses zeroing predication (`/Z`).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR bool is_zeroing() const noexcept { return pred_mode() == PredMode::kZeroing; }
+
+  //! Tests whether the predicate register uses merging predication (`/M`).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR bool is_merging() const noexcept { return pred_mode() == PredMode::kMerging; }
+
+  //! \}
+
+  //! \name Casts
+  //! \{
+
+  //! Clones and casts the register to a P.B register (predication mode is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg b() const noexcept { return make_p_with_element_type(VecElementType::kB, id()); }
+
+  //! Clones and casts the register to a P.H register (predication mode is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg h() const noexcept { return make_p_with_element_type(VecElementType::kH, id()); }
+
+  //! Clones and casts the register to a P.S register (predication mode is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg s() const noexcept { return make_p_with_element_type(VecElementType::kS, id()); }
+
+  //! Clones and casts the register to a P.D register (predication mode is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg d() const noexcept { return make_p_with_element_type(VecElementType::kD, id()); }
+
+  //! Clones the register and makes it use zeroing predication (`P/Z`) (element type is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg z() const noexcept { return make_p_with_pred_mode(PredMode::kZeroing, id()); }
+
+  //! Clones the register and makes it use merging predication (`P/M`) (element type is not cloned).
+  [[nodiscard]]
+  ASMJIT_INLINE_CONSTEXPR PReg m() const noexcept { return make_p_with_pred_mode(PredMode::kMerging, id()); }
+
+  //! \}
+};
+
 //! Memory operand (AArch64).
 class Mem : public BaseMem {
 public:
@@ -695,6 +830,14 @@ static ASMJIT_INLINE_CONSTEXPR Vec q(uint32_t id) noexcept { return Vec::make_v1
 [[nodiscard]]
 static ASMJIT_INLINE_CONSTEXPR Vec v(uint32_t id) noexcept { return Vec::make_v128(id); }
 
+//! Creates a scalable Z register operand (SVE).
+[[nodiscard]]
+static ASMJIT_INLINE_CONSTEXPR Vec z(uint32_t id) noexcept { return Vec::make_z(id); }
+
+//! Creates a predicate P register operand (SVE).
+[[nodiscard]]
+static ASMJIT_INLINE_CONSTEXPR PReg p(uint32_t id) noexcept { return PReg(id); }
+
 static constexpr Gp w0 = Gp::make_r32(0);
 static constexpr Gp w1 = Gp::make_r32(1);
 static constexpr Gp w2 = Gp::make_r32(2);
@@ -961,6 +1104,56 @@ static constexpr Vec v29 = Vec::make_v128(29);
 static constexpr Vec v30 = Vec::make_v128(30);
 static constexpr Vec v31 = Vec::make_v128(31);
 
+static constexpr Vec z0 = Vec::make_z(0);
+static constexpr Vec z1 = Vec::make_z(1);
+static constexpr Vec z2 = Vec::make_z(2);
+static constexpr Vec z3 = Vec::make_z(3);
+static constexpr Vec z4 = Vec::make_z(4);
+static constexpr Vec z5 = Vec::make_z(5);
+static constexpr Vec z6 = Vec::make_z(6);
+static constexpr Vec z7 = Vec::make_z(7);
+static constexpr Vec z8 = Vec::make_z(8);
+static constexpr Vec z9 = Vec::make_z(9);
+static constexpr Vec z10 = Vec::make_z(10);
+static constexpr Vec z11 = Vec::make_z(11);
+static constexpr Vec z12 = Vec::make_z(12);
+static constexpr Vec z13 = Vec::make_z(13);
+static constexpr Vec z14 = Vec::make_z(14);
+static constexpr Vec z15 = Vec::make_z(15);
+static constexpr Vec z16 = Vec::make_z(16);
+static constexpr Vec z17 = Vec::make_z(17);
+static constexpr Vec z18 = Vec::make_z(18);
+static constexpr Vec z19 = Vec::make_z(19);
+static constexpr Vec z20 = Vec::make_z(20);
+static constexpr Vec z21 = Vec::make_z(21);
+static constexpr Vec z22 = Vec::make_z(22);
+static constexpr Vec z23 = Vec::make_z(23);
+static constexpr Vec z24 = Vec::make_z(24);
+static constexpr Vec z25 = Vec::make_z(25);
+static constexpr Vec z26 = Vec::make_z(26);
+static constexpr Vec z27 = Vec::make_z(27);
+static constexpr Vec z28 = Vec::make_z(28);
+static constexpr Vec z29 = Vec::make_z(29);
+static constexpr Vec z30 = Vec::make_z(30);
+static constexpr Vec z31 = Vec::make_z(31);
+
+static constexpr PReg p0 = PReg(0);
+static constexpr PReg p1 = PReg(1);
+static constexpr PReg p2 = PReg(2);
+static constexpr PReg p3 = PReg(3);
+static constexpr PReg p4 = PReg(4);
+static constexpr PReg p5 = PReg(5);
+static constexpr PReg p6 = PReg(6);
+static constexpr PReg p7 = PReg(7);
+static constexpr PReg p8 = PReg(8);
+static constexpr PReg p9 = PReg(9);
+static constexpr PReg p10 = PReg(10);
+static constexpr PReg p11 = PReg(11);
+static constexpr PReg p12 = PReg(12);
+static constexpr PReg p13 = PReg(13);
+static constexpr PReg p14 = PReg(14);
+static constexpr PReg p15 = PReg(15);
+
 #ifndef _DOXYGEN
 } // {regs}
 
@@ -1074,6 +1267,18 @@ static ASMJIT_INLINE_CONSTEXPR Mem ptr(const Gp& base, const Gp& index, const Sh
   return Mem(base, index, shift);
 }
 
+//! Creates `[base, index]` memory operand having a vector `index` (SVE gather and scatter) (AArch64).
+[[nodiscard]]
+static ASMJIT_INLINE_CONSTEXPR Mem ptr(const Gp& base, const Vec& index) noexcept {
+  return Mem(base, index);
+}
+
+//! Creates `[base, index, SHIFT_OP #shift]` memory operand having a vector `index` (SVE gather and scatter) (AArch64).
+[[nodiscard]]
+static ASMJIT_INLINE_CONSTEXPR Mem ptr(const Gp& base, const Vec& index, const Shift& shift) noexcept {
+  return Mem(base, index, shift);
+}
+
 //! Creates `[base, offset]` memory operand (AArch64).
 [[nodiscard]]
 static ASMJIT_INLINE_CONSTEXPR Mem ptr(const Label& base, int32_t offset = 0) noexcept {
@@ -0,0 +1,58 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core/api-build_p.h>
+#if !defined(ASMJIT_NO_AARCH64) && !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/arm/a64globals.h>
+#include <asmjit/arm/a64operand.h>
+#include <asmjit/arm/a64peephole_p.h>
+
+ASMJIT_BEGIN_SUB_NAMESPACE(a64)
+
+namespace PeepholeInternal {
+
+// a64::PeepholeInternal - Rules
+// =============================
+
+// Removes `mov xN, xN`. The 32-bit form is kept as it zero extends the destination.
+static PeepholeResult ASMJIT_CDECL peephole_mov_self(PeepholePass& pass, InstNode* node) {
+  Support::maybe_unused(pass);
+
+  if (node->op_count() == 2u && node->op(0).is_gp64() && node->op(0) == node->op(1)) {
+    return PeepholeResult::kRemove;
+  }
+
+  return PeepholeResult::kNone;
+}
+
+// Removes `add|sub xN, xN, #0`. The 32-bit form is kept as it zero extends the destination. Flag setting forms have
+// different instruction ids, so they are never matched.
+static PeepholeResult ASMJIT_CDECL peephole_add_sub_zero(PeepholePass& pass, InstNode* node) {
+  Support::maybe_unused(pass);
+
+  if (node->op_count() == 3u && node->op(0).is_gp64() && node->op(0) == node->op(1) &&
+      node->op(2).is_imm() && node->op(2).as<Imm>().value() == 0) {
+    return PeepholeResult::kRemove;
+  }
+
+  return PeepholeResult::kNone;
+}
+
+static const PeepholeRule peephole_rules[] = {
+  { Inst::kIdAdd, peephole_add_sub_zero },
+  { Inst::kIdMov, peephole_mov_self     },
+  { Inst::kIdSub, peephole_add_sub_zero }
+};
+
+Span<const PeepholeRule> default_rules() noexcept {
+  return Span<const PeepholeRule>(peephole_rules, ASMJIT_ARRAY_SIZE(peephole_rules));
+}
+
+} // {PeepholeInternal}
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_AARCH64 && !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
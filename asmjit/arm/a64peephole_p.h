@@ -0,0 +1,33 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#ifndef ASMJIT_ARM_A64PEEPHOLE_P_H_INCLUDED
+#define ASMJIT_ARM_A64PEEPHOLE_P_H_INCLUDED
+
+#include <asmjit/core/api-config.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/peepholepass.h>
+
+ASMJIT_BEGIN_SUB_NAMESPACE(a64)
+
+//! \cond INTERNAL
+//! \addtogroup asmjit_a64
+//! \{
+
+namespace PeepholeInternal {
+
+//! Returns built-in AArch64 peephole rules used by \ref PeepholePass.
+Span<const PeepholeRule> default_rules() noexcept;
+
+} // {PeepholeInternal}
+
+//! \}
+//! \endcond
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
+#endif // ASMJIT_ARM_A64PEEPHOLE_P_H_INCLUDED
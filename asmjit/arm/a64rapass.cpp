@@ -268,12 +268,15 @@ Error RACFGBuilder::on_instruction(InstNode* inst, InstControlFlow& control_type
               }
             }
 
-            ASMJIT_PROPAGATE(ib.add(work_reg, flags, use_regs, use_id, use_rewrite_mask, out_regs, out_id, out_rewrite_mask, op_rw_info.rm_size(), consecutive_parent));
+            // Registers that follow a consecutive sequence (like the index of TBL/TBX) are not part of it.
+            bool is_consecutive = Support::test(flags, RATiedFlags::kLeadConsecutive | RATiedFlags::kUseConsecutive | RATiedFlags::kOutConsecutive);
+
+            ASMJIT_PROPAGATE(ib.add(work_reg, flags, use_regs, use_id, use_rewrite_mask, out_regs, out_id, out_rewrite_mask, op_rw_info.rm_size(), is_consecutive ? consecutive_parent : nullptr));
             if (single_reg_ops == i) {
               single_reg_ops++;
             }
 
-            if (Support::test(flags, RATiedFlags::kLeadConsecutive | RATiedFlags::kUseConsecutive | RATiedFlags::kOutConsecutive)) {
+            if (is_consecutive) {
               consecutive_parent = work_reg;
             }
           }
@@ -765,6 +768,16 @@ ASMJIT_FAVOR_SPEED Error ARMRAPass::rewrite() noexcept {
               RAStackSlot* slot = work_reg->stack_slot();
               int32_t offset = slot->offset();
 
+              // LDR/STR of a scalable vector register (Z) addresses memory in multiples of the vector length, which
+              // is the size of the virtual register.
+              if (inst->real_id() == Inst::kIdLdr_z || inst->real_id() == Inst::kIdStr_z) {
+                int32_t vl = int32_t(virt_reg->virt_size());
+                if (ASMJIT_UNLIKELY(!vl || (offset % vl) != 0)) {
+                  return make_error(Error::kInvalidDisplacement);
+                }
+                offset /= vl;
+              }
+
               mem._set_base(_sp.reg_type(), slot->base_reg_id());
               mem.clear_reg_home();
               mem.add_offset_lo32(offset);
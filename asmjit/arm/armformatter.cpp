@@ -381,6 +381,14 @@ ASMJIT_FAVOR_SIZE Error FormatterInternal::format_register(
         }
         break;
 
+      case RegType::kVecNLen:
+        letter = 'z';
+        break;
+
+      case RegType::kMask:
+        letter = 'p';
+        break;
+
       case RegType::kGp32:
         if (Environment::is_64bit(arch)) {
           letter = 'w';
@@ -435,6 +443,11 @@ ASMJIT_FAVOR_SIZE Error FormatterInternal::format_register(
       element_count /= 2u;
     }
 
+    // Scalable (SVE) registers don't have a fixed element count.
+    if (reg_type == RegType::kVecNLen || reg_type == RegType::kMask) {
+      element_count = 0u;
+    }
+
     ASMJIT_PROPAGATE(sb.append('.'));
     if (element_count) {
       ASMJIT_PROPAGATE(sb.append_uint(element_count));
@@ -508,6 +521,19 @@ ASMJIT_FAVOR_SIZE Error FormatterInternal::format_operand(
       element_index = 0xFFFFFFFFu;
     }
 
+    if (reg.is_mask_reg()) {
+      ASMJIT_PROPAGATE(format_register(sb, flags, emitter, arch, reg.reg_type(), reg.id(), element_type, 0xFFFFFFFFu));
+
+      a64::PredMode pred_mode = op.as<a64::PReg>().pred_mode();
+      if (pred_mode == a64::PredMode::kZeroing) {
+        ASMJIT_PROPAGATE(sb.append("/z"));
+      }
+      else if (pred_mode == a64::PredMode::kMerging) {
+        ASMJIT_PROPAGATE(sb.append("/m"));
+      }
+      return Error::kOk;
+    }
+
     return format_register(sb, flags, emitter, arch, reg.reg_type(), reg.id(), element_type, element_index);
   }
 
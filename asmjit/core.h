@@ -1959,6 +1959,9 @@ namespace asmjit {
 //!     static storage allocated then there will be no dynamic memory allocation during the lifetime of \ref ArenaTmp,
 //!     otherwise it would act as \ref Arena with one preallocated block at the beginning.
 //!
+//!   - \ref ArenaBlockPool - An optional process-wide pool of blocks shared by all \ref Arena instances, which can
+//!     be enabled to avoid `malloc()` and `free()` churn caused by many short-lived arenas used by multiple threads.
+//!
 //! \section arena_containers Arena-Allocated Containers
 //!
 //!   - \ref ArenaString - Arena allocated string.
@@ -2300,6 +2303,8 @@ namespace asmjit {
 #include <asmjit/core/logger.h>
 #include <asmjit/core/operand.h>
 #include <asmjit/core/osutils.h>
+#include <asmjit/core/peepholepass.h>
+#include <asmjit/core/schedpass.h>
 #include <asmjit/core/string.h>
 #include <asmjit/core/target.h>
 #include <asmjit/core/type.h>
@@ -154,6 +154,10 @@ ASMJIT_FAVOR_SIZE Error ArchUtils::type_id_to_reg_signature(Arch arch, TypeId ty
     else if (arch_traits.has_reg_type(RegType::kVec512)) {
       reg_type = RegType::kVec512;
     }
+    else if (arch_traits.has_reg_type(RegType::kVecNLen)) {
+      // Scalable vector register (AArch64 SVE) - the size of the type is the vector length used by the generated code.
+      reg_type = RegType::kVecNLen;
+    }
     else {
       return make_error(Error::kInvalidTypeId);
     }
@@ -164,4 +168,36 @@ ASMJIT_FAVOR_SIZE Error ArchUtils::type_id_to_reg_signature(Arch arch, TypeId ty
   return Error::kOk;
 }
 
+// ArchUtils - Tests
+// =================
+
+#if defined(ASMJIT_TEST)
+UNIT(arch_utils) {
+  TypeId type_id;
+  OperandSignature signature;
+
+#if !defined(ASMJIT_NO_X86)
+  INFO("Checking whether X86_64 maps vector TypeIds to XMM, YMM, and ZMM registers");
+  EXPECT_EQ(ArchUtils::type_id_to_reg_signature(Arch::kX64, TypeId::kInt32x4, Out(type_id), Out(signature)), Error::kOk);
+  EXPECT_EQ(signature.reg_type(), RegType::kVec128);
+  EXPECT_EQ(ArchUtils::type_id_to_reg_signature(Arch::kX64, TypeId::kInt32x8, Out(type_id), Out(signature)), Error::kOk);
+  EXPECT_EQ(signature.reg_type(), RegType::kVec256);
+  EXPECT_EQ(ArchUtils::type_id_to_reg_signature(Arch::kX64, TypeId::kFloat64x8, Out(type_id), Out(signature)), Error::kOk);
+  EXPECT_EQ(signature.reg_type(), RegType::kVec512);
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+  INFO("Checking whether AArch64 maps vector TypeIds wider than 128 bits to scalable vector registers");
+  EXPECT_EQ(ArchUtils::type_id_to_reg_signature(Arch::kAArch64, TypeId::kInt32x4, Out(type_id), Out(signature)), Error::kOk);
+  EXPECT_EQ(signature.reg_type(), RegType::kVec128);
+
+  for (TypeId vec_type_id : { TypeId::kInt32x8, TypeId::kFloat32x8, TypeId::kInt64x8, TypeId::kFloat64x8 }) {
+    EXPECT_EQ(ArchUtils::type_id_to_reg_signature(Arch::kAArch64, vec_type_id, Out(type_id), Out(signature)), Error::kOk);
+    EXPECT_EQ(signature.reg_type(), RegType::kVecNLen);
+    EXPECT_EQ(type_id, vec_type_id);
+  }
+#endif // !ASMJIT_NO_AARCH64
+}
+#endif
+
 ASMJIT_END_NAMESPACE
@@ -299,6 +299,12 @@ ASMJIT_INLINE_NODEBUG const ArchTraits& ArchTraits::by_arch(Arch arch) noexcept
 //! Architecture utilities.
 namespace ArchUtils {
 
+//! Maps `type_id` to a register signature of `arch` and stores the deduced TypeId to `type_id_out`.
+//!
+//! \note AArch64 has no fixed-size vector registers wider than 128 bits, so 256-bit and 512-bit vector TypeIds map
+//! to scalable vector registers (SVE Z registers, \ref RegType::kVecNLen) instead of failing with \ref
+//! Error::kInvalidTypeId. The size of such a register is the SVE vector length of the CPU that runs the generated
+//! code, which must match the size of the TypeId.
 ASMJIT_API Error type_id_to_reg_signature(Arch arch, TypeId type_id, Out<TypeId> type_id_out, Out<OperandSignature> reg_signature_out) noexcept;
 
 } // {ArchUtils}
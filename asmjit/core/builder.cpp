@@ -31,6 +31,23 @@ public:
   StringTmp<128> _message;
 };
 
+// TaskExecutor - Construction & Destruction
+// =========================================
+
+TaskExecutor::TaskExecutor() noexcept {}
+TaskExecutor::~TaskExecutor() noexcept {}
+
+// TaskExecutor - Interface
+// ========================
+
+size_t TaskExecutor::concurrency() const noexcept { return 1u; }
+
+void TaskExecutor::run(TaskFunc func, void* data, size_t count) noexcept {
+  for (size_t i = 0; i < count; i++) {
+    func(data, i);
+  }
+}
+
 // BaseBuilder - Utilities
 // =======================
 
@@ -47,6 +64,7 @@ static void BaseBuilder_delete_passes(BaseBuilder* self) noexcept {
 BaseBuilder::BaseBuilder() noexcept
   : BaseEmitter(EmitterType::kBuilder),
     _builder_arena(64u * 1024u),
+    _const_pool_arena(1024u),
     _pass_arena(64u * 1024u) {}
 
 BaseBuilder::~BaseBuilder() noexcept {
@@ -115,7 +133,7 @@ Error BaseBuilder::new_embed_data_node(Out<EmbedDataNode*> out, TypeId type_id,
 Error BaseBuilder::new_const_pool_node(Out<ConstPoolNode*> out) {
   out = nullptr;
 
-  ASMJIT_PROPAGATE(new_node_t<ConstPoolNode>(out, _builder_arena));
+  ASMJIT_PROPAGATE(new_node_t<ConstPoolNode>(out, _const_pool_arena));
   return register_label_node(*out);
 }
 
@@ -568,11 +586,31 @@ ASMJIT_FAVOR_SIZE Error BaseBuilder::_add_pass(Pass* pass) noexcept {
   return Error::kOk;
 }
 
+ASMJIT_FAVOR_SIZE Error BaseBuilder::_insert_pass(size_t index, Pass* pass) noexcept {
+  if (ASMJIT_UNLIKELY(!_code)) {
+    return make_error(Error::kNotInitialized);
+  }
+
+  if (ASMJIT_UNLIKELY(pass == nullptr)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  if (ASMJIT_UNLIKELY(&pass->_cb != this || index > _passes.size())) {
+    return make_error(Error::kInvalidState);
+  }
+
+  ASMJIT_PROPAGATE(_passes.insert(_builder_arena, index, pass));
+  return Error::kOk;
+}
+
 Error BaseBuilder::run_passes() {
   if (ASMJIT_UNLIKELY(!_code)) {
     return make_error(Error::kNotInitialized);
   }
 
+  _pass_arena_peak = ArenaStatistics{};
+  _ra_arena_peak = ArenaStatistics{};
+
   if (_passes.is_empty()) {
     return Error::kOk;
   }
@@ -586,6 +624,7 @@ Error BaseBuilder::run_passes() {
   for (Pass* pass : _passes) {
     _pass_arena.reset();
     err = pass->run(_pass_arena, _logger);
+    _record_pass_arena_usage(_pass_arena);
     if (err != Error::kOk) {
       break;
     }
@@ -600,6 +639,37 @@ Error BaseBuilder::run_passes() {
   return Error::kOk;
 }
 
+void BaseBuilder::_record_pass_arena_usage(const Arena& arena, BuilderMemoryCategory category) noexcept {
+  ASMJIT_ASSERT(category == BuilderMemoryCategory::kPasses || category == BuilderMemoryCategory::kRAFunction);
+
+  ArenaStatistics stats = arena.statistics();
+  ArenaStatistics& peak = category == BuilderMemoryCategory::kPasses ? _pass_arena_peak : _ra_arena_peak;
+
+  peak._block_count = Support::max(peak._block_count, stats._block_count);
+  peak._used_size = Support::max(peak._used_size, stats._used_size);
+  peak._reserved_size = Support::max(peak._reserved_size, stats._reserved_size);
+  peak._overhead_size = Support::max(peak._overhead_size, stats._overhead_size);
+  peak._block_pool_hits = stats._block_pool_hits;
+  peak._block_pool_misses = stats._block_pool_misses;
+}
+
+// BaseBuilder - Memory Statistics
+// ===============================
+
+BuilderMemoryStats BaseBuilder::memory_stats() const noexcept {
+  BuilderMemoryStats stats {};
+
+  if (_code) {
+    stats._categories[size_t(BuilderMemoryCategory::kCodeHolder)] = _code->arena().statistics();
+  }
+
+  stats._categories[size_t(BuilderMemoryCategory::kBuilder)] = _builder_arena.statistics();
+  stats._categories[size_t(BuilderMemoryCategory::kConstPools)] = _const_pool_arena.statistics();
+  stats._categories[size_t(BuilderMemoryCategory::kPasses)] = _pass_arena_peak;
+  stats._categories[size_t(BuilderMemoryCategory::kRAFunction)] = _ra_arena_peak;
+  return stats;
+}
+
 // BaseBuilder - Emit
 // ==================
 
@@ -782,8 +852,16 @@ Error BaseBuilder::comment(const char* data, size_t size) {
 // =========================
 
 Error BaseBuilder::serialize_to(BaseEmitter* dst) {
+  return serialize_range_to(dst, _node_list.first(), _node_list.last());
+}
+
+Error BaseBuilder::serialize_range_to(BaseEmitter* dst, BaseNode* first, BaseNode* last) {
   Error err = Error::kOk;
-  BaseNode* node_ = _node_list.first();
+  BaseNode* node_ = first;
+
+  if (ASMJIT_UNLIKELY(!node_)) {
+    return err;
+  }
 
   Operand_ op_array[Globals::kMaxOpCount];
 
@@ -853,7 +931,7 @@ Error BaseBuilder::serialize_to(BaseEmitter* dst) {
       err = dst->comment(node->inline_comment());
     }
 
-    if (err != Error::kOk) {
+    if (err != Error::kOk || node_ == last) {
       break;
     }
     node_ = node_->next();
@@ -862,6 +940,174 @@ Error BaseBuilder::serialize_to(BaseEmitter* dst) {
   return err;
 }
 
+// BaseBuilder - Parallel Serialization
+// ====================================
+
+//! A part of the node list that is serialized independently of other parts into its own CodeHolder.
+struct BuilderFragment {
+  ASMJIT_NONCOPYABLE(BuilderFragment)
+
+  BaseNode* first;
+  BaseNode* last;
+  uint32_t section_id;
+  uint32_t alignment;
+  Error err;
+  CodeHolder code;
+
+  ASMJIT_INLINE BuilderFragment(BaseNode* node, uint32_t section_id) noexcept
+    : first(node),
+      last(node),
+      section_id(section_id),
+      alignment(1u),
+      err(Error::kOk) {}
+};
+
+struct BuilderParallelContext {
+  BaseBuilder* builder;
+  BaseBuilder::SerializeFragmentFunc serialize_fragment;
+  BuilderFragment** fragments;
+};
+
+static void ASMJIT_CDECL BaseBuilder_serialize_fragment_task(void* data, size_t index) noexcept {
+  BuilderParallelContext* ctx = static_cast<BuilderParallelContext*>(data);
+  BuilderFragment& fragment = *ctx->fragments[index];
+  CodeHolder* code = ctx->builder->code();
+
+  Error err = fragment.code.init_fragment(*code);
+
+  if (err == Error::kOk) {
+    err = ctx->serialize_fragment(ctx->builder, fragment.code, fragment.first, fragment.last);
+  }
+
+  fragment.err = err;
+}
+
+Error BaseBuilder::serialize_parallel_to(BaseAssembler* dst, TaskExecutor& executor, SerializeFragmentFunc serialize_fragment) {
+  // Each task would serialize roughly `1 / (concurrency * kFragmentsPerTask)` of all nodes. Using more fragments
+  // than tasks that can run concurrently balances the work better as functions can have very different sizes.
+  constexpr size_t kFragmentsPerTask = 4u;
+
+  size_t concurrency = executor.concurrency();
+  if (concurrency <= 1u || dst->logger() || dst->code() != _code) {
+    return serialize_to(dst);
+  }
+
+  size_t node_count = 0;
+  for (BaseNode* node = _node_list.first(); node; node = node->next()) {
+    node_count++;
+  }
+
+  size_t target_size = Support::max<size_t>(node_count / (concurrency * kFragmentsPerTask), 1u);
+
+  // Split the node list into fragments. A fragment starts either after a SectionNode or at a FuncNode if the
+  // current fragment is big enough. SectionNodes are never part of a fragment as sections are not shared.
+  Arena arena(16u * 1024u);
+  ArenaVector<BuilderFragment*> fragments;
+  Error err = Error::kOk;
+
+  {
+    BuilderFragment* fragment = nullptr;
+    size_t fragment_size = 0;
+    uint32_t section_id = dst->current_section() ? dst->current_section()->section_id() : 0u;
+
+    for (BaseNode* node = _node_list.first(); node; node = node->next()) {
+      if (node->is_section()) {
+        section_id = node->as<SectionNode>()->section_id();
+        fragment = nullptr;
+        continue;
+      }
+
+      if (node->is_func() && fragment_size >= target_size) {
+        fragment = nullptr;
+      }
+
+      if (!fragment) {
+        fragment = arena.new_oneshot<BuilderFragment>(node, section_id);
+        if (ASMJIT_UNLIKELY(!fragment)) {
+          err = make_error(Error::kOutOfMemory);
+          break;
+        }
+
+        err = fragments.append(arena, fragment);
+        if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+          fragment->~BuilderFragment();
+          break;
+        }
+        fragment_size = 0;
+      }
+
+      if (node->is_align()) {
+        fragment->alignment = Support::max(fragment->alignment, node->as<AlignNode>()->alignment());
+      }
+      else if (node->is_const_pool()) {
+        fragment->alignment = Support::max(fragment->alignment, uint32_t(node->as<ConstPoolNode>()->alignment()));
+      }
+
+      fragment->last = node;
+      fragment_size++;
+    }
+  }
+
+  if (err == Error::kOk) {
+    if (fragments.size() <= 1u) {
+      err = serialize_to(dst);
+    }
+    else {
+      BuilderParallelContext ctx{this, serialize_fragment, fragments.data()};
+      executor.run(BaseBuilder_serialize_fragment_task, &ctx, fragments.size());
+
+      // Merge all fragments in order - this is the only part that is sequential.
+      for (BuilderFragment* fragment : fragments) {
+        err = fragment->err;
+        if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+          break;
+        }
+
+        Section* section = _code->section_by_id(fragment->section_id);
+        if (dst->current_section() != section) {
+          err = dst->section(section);
+          if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+            break;
+          }
+        }
+
+        AlignMode align_mode = Support::test(section->flags(), SectionFlags::kExecutable) ? AlignMode::kCode : AlignMode::kZero;
+        uint32_t alignment = Support::max<uint32_t>(fragment->alignment, dst->instruction_alignment());
+
+        if (alignment > 1u) {
+          err = dst->align(align_mode, alignment);
+          if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+            break;
+          }
+        }
+
+        const CodeBuffer& buffer = fragment->code.text_section()->buffer();
+        uint64_t base_offset = dst->offset();
+
+        err = dst->embed(buffer.data(), buffer.size());
+        if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+          break;
+        }
+
+        err = _code->merge_fragment(fragment->code, fragment->section_id, base_offset);
+        if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+          break;
+        }
+      }
+    }
+  }
+
+  for (BuilderFragment* fragment : fragments) {
+    fragment->~BuilderFragment();
+  }
+
+  if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+    return report_error(err);
+  }
+
+  return Error::kOk;
+}
+
 // BaseBuilder - Events
 // ====================
 
@@ -870,7 +1116,10 @@ static ASMJIT_INLINE void BaseBuilder_clear_all(BaseBuilder* self) noexcept {
   self->_label_nodes.reset();
 
   self->_builder_arena.reset();
+  self->_const_pool_arena.reset();
   self->_pass_arena.reset();
+  self->_pass_arena_peak = ArenaStatistics{};
+  self->_ra_arena_peak = ArenaStatistics{};
 
   self->_cursor = nullptr;
   self->_node_list.reset();
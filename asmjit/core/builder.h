@@ -178,6 +178,127 @@ public:
   //! \}
 };
 
+//! Task executor used by \ref BaseBuilder::serialize_parallel_to() to run independent tasks in parallel.
+//!
+//! AsmJit doesn't create threads on its own, thus the parallelism is provided by the user, who would usually
+//! implement `TaskExecutor` on top of an existing thread pool.
+class ASMJIT_VIRTAPI TaskExecutor {
+public:
+  ASMJIT_BASE_CLASS(TaskExecutor)
+  ASMJIT_NONCOPYABLE(TaskExecutor)
+
+  //! Function that represents a single task, which receives `data` passed to \ref run() and its index.
+  using TaskFunc = void (ASMJIT_CDECL*)(void* data, size_t index) noexcept;
+
+  //! \name Construction & Destruction
+  //! \{
+
+  //! Creates a new `TaskExecutor` instance.
+  ASMJIT_API TaskExecutor() noexcept;
+  //! Destroys the `TaskExecutor` instance.
+  ASMJIT_API virtual ~TaskExecutor() noexcept;
+
+  //! \}
+
+  //! \name Interface
+  //! \{
+
+  //! Returns the number of tasks that can run concurrently.
+  //!
+  //! If the returned value is 1 (the default) no parallelism is possible and \ref BaseBuilder::serialize_parallel_to()
+  //! would serialize the code the same way as \ref BaseBuilder::serialize_to().
+  [[nodiscard]]
+  ASMJIT_API virtual size_t concurrency() const noexcept;
+
+  //! Runs `func(data, index)` for every index in `[0, count)` and returns after all tasks have finished.
+  //!
+  //! Tasks are independent of each other and can run in any order. The default implementation runs all tasks in the
+  //! calling thread.
+  ASMJIT_API virtual void run(TaskFunc func, void* data, size_t count) noexcept;
+
+  //! \}
+};
+
+//! Category of memory reported by \ref BuilderMemoryStats.
+enum class BuilderMemoryCategory : uint32_t {
+  //! Memory used by \ref CodeHolder - sections, labels, label names, fixups, relocations, and expressions.
+  kCodeHolder = 0,
+  //! Memory used by \ref BaseBuilder - nodes (including operands of instruction nodes), passes, label and section
+  //! vectors, function argument packs, and jump annotations.
+  kBuilder = 1,
+  //! Memory used by constants stored in constant pools (see \ref ConstPoolNode).
+  kConstPools = 2,
+  //! Memory used by virtual registers and their names (only used by \ref BaseCompiler).
+  kVirtRegs = 3,
+  //! Peak memory used by passes during the last \ref BaseBuilder::run_passes(), excluding register allocation.
+  kPasses = 4,
+  //! Peak memory used by the register allocator to process a single function during the last \ref
+  //! BaseBuilder::run_passes() (only used by \ref BaseCompiler).
+  //!
+  //! The register allocator resets its arena after each function, thus this category represents the function that
+  //! required the most memory.
+  kRAFunction = 5,
+
+  //! Maximum value of `BuilderMemoryCategory`.
+  kMaxValue = kRAFunction
+};
+
+//! Memory statistics of \ref BaseBuilder or \ref BaseCompiler, attributed to \ref BuilderMemoryCategory.
+//!
+//! The statistics are returned by \ref BaseBuilder::memory_stats(). When queried after `finalize()` they describe
+//! memory used to generate the whole code, which can be used to size arenas or to find pathological inputs.
+struct BuilderMemoryStats {
+  //! \name Constants
+  //! \{
+
+  static inline constexpr uint32_t kCategoryCount = uint32_t(BuilderMemoryCategory::kMaxValue) + 1u;
+
+  //! \}
+
+  //! \name Members
+  //! \{
+
+  //! Statistics of each category.
+  Support::Array<ArenaStatistics, kCategoryCount> _categories {};
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns statistics of the given memory `category`.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const ArenaStatistics& category(BuilderMemoryCategory category) const noexcept { return _categories[size_t(category)]; }
+
+  //! Returns statistics of all categories aggregated.
+  //!
+  //! \note \ref BuilderMemoryCategory::kPasses and \ref BuilderMemoryCategory::kRAFunction represent peaks of the
+  //! same arena, which is never used by both at the same time, so only the greater of them is aggregated. Thus, the
+  //! aggregated statistics represent the peak memory used by Builder or Compiler and CodeHolder during code generation.
+  [[nodiscard]]
+  ASMJIT_INLINE ArenaStatistics total() const noexcept {
+    ArenaStatistics stats {};
+    for (uint32_t i = 0; i < uint32_t(BuilderMemoryCategory::kPasses); i++) {
+      stats.aggregate(_categories[i]);
+    }
+
+    const ArenaStatistics& passes = category(BuilderMemoryCategory::kPasses);
+    const ArenaStatistics& ra_function = category(BuilderMemoryCategory::kRAFunction);
+    stats.aggregate(passes.used_size() >= ra_function.used_size() ? passes : ra_function);
+    return stats;
+  }
+
+  //! Returns the peak number of bytes used during code generation (see \ref total()).
+  [[nodiscard]]
+  ASMJIT_INLINE size_t peak_used_size() const noexcept { return total().used_size(); }
+
+  //! Returns the peak number of bytes reserved during code generation (see \ref total()).
+  [[nodiscard]]
+  ASMJIT_INLINE size_t peak_reserved_size() const noexcept { return total().reserved_size(); }
+
+  //! \}
+};
+
 //! Builder interface.
 //!
 //! `BaseBuilder` interface was designed to be used as a \ref BaseAssembler replacement in case pre-processing or
@@ -199,8 +320,14 @@ public:
 
   //! Arena used to allocate nodes and passes.
   Arena _builder_arena;
+  //! Arena used to allocate data of constant pools.
+  Arena _const_pool_arena;
   //! Arena only used by `Pass::run()`.
   Arena _pass_arena;
+  //! Peak statistics of `_pass_arena` observed by the last \ref run_passes() (excluding register allocation).
+  ArenaStatistics _pass_arena_peak {};
+  //! Peak statistics of `_pass_arena` observed by the last \ref run_passes() while allocating registers of a function.
+  ArenaStatistics _ra_arena_peak {};
 
   //! Array of `Pass` objects.
   ArenaVector<Pass*> _passes;
@@ -249,7 +376,7 @@ public:
   ASMJIT_INLINE Error new_node_with_size_t(Out<T*> out, size_t size, Args&&... args) {
     ASMJIT_ASSERT(Support::is_aligned(size, Arena::kAlignment));
 
-    void* ptr =_builder_arena.alloc_oneshot(size);
+    void* ptr = _builder_arena.alloc_oneshot(size);
     if (ASMJIT_UNLIKELY(!ptr)) {
       return report_error(make_error(Error::kOutOfMemory));
     }
@@ -433,6 +560,11 @@ public:
   template<typename T, typename... Args>
   ASMJIT_INLINE Error add_pass(Args&&... args) { return _add_pass(new_pass<T, Args...>(std::forward<Args>(args)...)); }
 
+  //! Allocates and instantiates a new pass of type `T` and inserts it at the given `index` of the list of passes,
+  //! which makes it possible to run a pass before passes that were added by the Compiler itself.
+  template<typename T, typename... Args>
+  ASMJIT_INLINE Error insert_pass(size_t index, Args&&... args) { return _insert_pass(index, new_pass<T, Args...>(std::forward<Args>(args)...)); }
+
   //! Returns `Pass` by name.
   //!
   //! If the pass having the given `name` doesn't exist `nullptr` is returned.
@@ -442,9 +574,32 @@ public:
   //! Adds `pass` to the list of passes.
   ASMJIT_API Error _add_pass(Pass* pass) noexcept;
 
+  //! Inserts `pass` to the list of passes at the given `index`.
+  ASMJIT_API Error _insert_pass(size_t index, Pass* pass) noexcept;
+
   //! Runs all passes in order.
   ASMJIT_API Error run_passes();
 
+  //! Records the current use of `arena`, which is used by a pass, before it's reset.
+  //!
+  //! This is called by \ref run_passes() after each pass, however, passes that reset the arena on their own should
+  //! call it before each reset so the peak reported by \ref BuilderMemoryCategory::kPasses is accurate. The register
+  //! allocator records its use per function as \ref BuilderMemoryCategory::kRAFunction.
+  ASMJIT_API void _record_pass_arena_usage(const Arena& arena, BuilderMemoryCategory category = BuilderMemoryCategory::kPasses) noexcept;
+
+  //! \}
+
+  //! \name Memory Statistics
+  //! \{
+
+  //! Returns memory statistics of this Builder (or Compiler) and its attached \ref CodeHolder attributed to each
+  //! \ref BuilderMemoryCategory.
+  //!
+  //! The statistics can be queried anytime, however, the peak memory used by passes is only known after \ref
+  //! run_passes(), which is called by `finalize()`.
+  [[nodiscard]]
+  ASMJIT_API virtual BuilderMemoryStats memory_stats() const noexcept;
+
   //! \}
 
   //! \name Emit
@@ -491,6 +646,52 @@ public:
   //! there is no known use of serializing nodes held by Builder/Compiler into another Builder-like emitter.
   ASMJIT_API Error serialize_to(BaseEmitter* dst);
 
+  //! Serializes nodes in range `[first, last]` to the given emitter `dst`.
+  //!
+  //! \note The range must not contain \ref SectionNode unless `dst` is attached to the same \ref CodeHolder as the
+  //! Builder, because sections are not shared between CodeHolders.
+  ASMJIT_API Error serialize_range_to(BaseEmitter* dst, BaseNode* first, BaseNode* last);
+
+  //! Function used by \ref serialize_parallel_to() to serialize a range of nodes `[first, last]` into a fragment.
+  //!
+  //! The function must create an architecture specific assembler attached to `fragment` and call \ref
+  //! serialize_range_to(). It's called concurrently from tasks run by \ref TaskExecutor.
+  using SerializeFragmentFunc = Error (ASMJIT_CDECL*)(BaseBuilder* builder, CodeHolder& fragment, BaseNode* first, BaseNode* last);
+
+  //! Serializes everything to the given assembler `dst` by assembling independent parts of the node list in parallel.
+  //!
+  //! The node list is split into fragments at \ref SectionNode and \ref FuncNode boundaries. Each fragment is then
+  //! assembled into its own temporary \ref CodeHolder by `serialize_fragment` called from tasks run by `executor`.
+  //! Finally, fragments are concatenated in the original order into sections of `dst` and their labels, fixups,
+  //! and relocations are merged by \ref CodeHolder::merge_fragment().
+  //!
+  //! The resulting code is functionally equivalent to the code serialized by \ref serialize_to(), however, it's not
+  //! necessarily the same - for example jumps that cross fragments always use the longest displacement and each
+  //! fragment is aligned to the highest alignment it uses. When a \ref Logger is attached to `dst` or when `executor`
+  //! doesn't provide any concurrency the code is serialized the same way as \ref serialize_to() does.
+  ASMJIT_API Error serialize_parallel_to(BaseAssembler* dst, TaskExecutor& executor, SerializeFragmentFunc serialize_fragment);
+
+  //! Serializes nodes in range `[first, last]` to `fragment` by using `AssemblerT` - an implementation of \ref
+  //! SerializeFragmentFunc shared by all architectures.
+  template<typename AssemblerT>
+  static Error ASMJIT_CDECL _serialize_fragment_t(BaseBuilder* builder, CodeHolder& fragment, BaseNode* first, BaseNode* last) {
+    AssemblerT a(&fragment);
+    a.add_encoding_options(builder->encoding_options());
+    a.add_diagnostic_options(builder->diagnostic_options());
+    return builder->serialize_range_to(&a, first, last);
+  }
+
+  //! Runs all passes and serializes everything in parallel by using `AssemblerT`, which is the only architecture
+  //! specific part of `finalize_parallel()` implemented by architecture specific builders and compilers.
+  template<typename AssemblerT>
+  ASMJIT_INLINE Error _finalize_parallel_t(TaskExecutor& executor) {
+    ASMJIT_PROPAGATE(run_passes());
+    AssemblerT a(_code);
+    a.add_encoding_options(encoding_options());
+    a.add_diagnostic_options(diagnostic_options());
+    return serialize_parallel_to(&a, executor, _serialize_fragment_t<AssemblerT>);
+  }
+
   //! \}
 
   //! \name Events
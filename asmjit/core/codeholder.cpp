@@ -184,6 +184,9 @@ static ASMJIT_INLINE void CodeHolder_reset_containers(CodeHolder* self, ResetPol
   self->_fixup_data_pool.reset();
   self->_unresolved_fixup_count = 0;
 
+  self->_fragment_label_ids.reset();
+  self->_is_fragment = false;
+
   self->_sections.reset();
   self->_sections_by_order.reset();
 
@@ -222,6 +225,7 @@ CodeHolder::CodeHolder(Span<uint8_t> static_arena_memory) noexcept
     _attached_last(nullptr),
     _fixups(nullptr),
     _unresolved_fixup_count(0),
+    _is_fragment(false),
     _text_section{},
     _address_table_section(nullptr) {}
 
@@ -268,6 +272,25 @@ Error CodeHolder::init(const Environment& environment, const CpuFeatures& cpu_fe
   return Error::kOk;
 }
 
+Error CodeHolder::init_fragment(const CodeHolder& code) noexcept {
+  if (ASMJIT_UNLIKELY(!code.is_initialized())) {
+    return make_error(Error::kNotInitialized);
+  }
+
+  ASMJIT_PROPAGATE(init(code.environment(), code.cpu_features()));
+
+  uint32_t first_label_id;
+  Error err = new_label_ids(Out(first_label_id), code.label_count());
+
+  if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+    reset(ResetPolicy::kHard);
+    return err;
+  }
+
+  _is_fragment = true;
+  return Error::kOk;
+}
+
 Error CodeHolder::reinit() noexcept {
   // Cannot reinitialize if it's not initialized.
   if (ASMJIT_UNLIKELY(!is_initialized())) {
@@ -632,38 +655,36 @@ public:
   }
 };
 
-// Returns a hash of `name` and fixes `name_size` if it's `SIZE_MAX`.
+// Returns a hash of `name` and fixes `name_size` if it's `SIZE_MAX` or if the name contains a null terminator.
+//
+// The name is hashed 8 bytes at a time, which matters when the code uses many generated names that share a long
+// common prefix (hashing characters one by one was visible in profiles of label-heavy code generation).
 static uint32_t CodeHolder_hash_name_and_get_size(const char* name, size_t& name_size) noexcept {
-  uint32_t hash_code = 0;
   if (name_size == SIZE_MAX) {
-    size_t i = 0;
-    for (;;) {
-      uint8_t c = uint8_t(name[i]);
-      if (!c) {
-        break;
-      }
-      hash_code = Support::hash_char(hash_code, c);
-      i++;
-    }
-    name_size = i;
+    name_size = strlen(name);
   }
   else {
-    for (size_t i = 0; i < name_size; i++) {
-      uint8_t c = uint8_t(name[i]);
-      if (ASMJIT_UNLIKELY(!c)) {
-        name_size = i;
-        break;
-      }
-      hash_code = Support::hash_char(hash_code, c);
+    const void* null_terminator = memchr(name, 0, name_size);
+    if (ASMJIT_UNLIKELY(null_terminator)) {
+      name_size = size_t(static_cast<const char*>(null_terminator) - name);
     }
   }
-  return hash_code;
+
+  return Support::hash_bytes(name, name_size);
 }
 
 Fixup* CodeHolder::new_fixup(LabelEntry& le, uint32_t section_id, size_t offset, intptr_t rel, const OffsetFormat& format) noexcept {
   // Cannot be bound if we are creating a link.
   ASMJIT_ASSERT(!le.is_bound());
 
+  // A fragment records the label the first time it's referenced (a label that has fixups was already recorded).
+  if (_is_fragment && !le._get_fixups()) {
+    uint32_t label_id = uint32_t(size_t(&le - _label_entries.data()));
+    if (ASMJIT_UNLIKELY(_fragment_label_ids.append(_arena, label_id) != Error::kOk)) {
+      return nullptr;
+    }
+  }
+
   Fixup* link = _fixup_data_pool.alloc(_arena);
   if (ASMJIT_UNLIKELY(!link)) {
     return nullptr;
@@ -697,6 +718,28 @@ Error CodeHolder::new_label_id(Out<uint32_t> label_id_out) noexcept {
   }
 }
 
+Error CodeHolder::new_label_ids(Out<uint32_t> first_id_out, size_t count) noexcept {
+  size_t first_id = _label_entries.size();
+  first_id_out = Globals::kInvalidId;
+
+  if (ASMJIT_UNLIKELY(count > size_t(Globals::kInvalidId) - first_id)) {
+    return make_error(Error::kTooManyLabels);
+  }
+
+  ASMJIT_PROPAGATE(_label_entries.reserve_additional(_arena, count));
+
+  LabelEntry* entries = _label_entries.data() + first_id;
+  LabelEntry::ExtraData* shared_extra_data = const_cast<LabelEntry::ExtraData*>(&CodeHolder_shared_label_extra_data);
+
+  for (size_t i = 0; i < count; i++) {
+    entries[i] = LabelEntry{shared_extra_data, uint64_t(0)};
+  }
+
+  _label_entries._set_size(first_id + count);
+  first_id_out = uint32_t(first_id);
+  return Error::kOk;
+}
+
 Error CodeHolder::new_named_label_id(Out<uint32_t> label_id_out, const char* name, size_t name_size, LabelType type, uint32_t parent_id) noexcept {
   uint32_t label_id = _label_entries._size;
   uint32_t hash_code = CodeHolder_hash_name_and_get_size(name, name_size);
@@ -788,7 +831,6 @@ Error CodeHolder::new_named_label_id(Out<uint32_t> label_id_out, const char* nam
       ? LabelFlags::kHasOwnExtraData | LabelFlags::kHasName
       : LabelFlags::kHasOwnExtraData | LabelFlags::kHasName | LabelFlags::kHasParent;
 
-  named_node->_hash_next = nullptr;
   named_node->_hash_code = hash_code;
   named_node->_custom_data = label_id;
   named_node->extra_data._section_id = Globals::kInvalidId;
@@ -802,9 +844,12 @@ Error CodeHolder::new_named_label_id(Out<uint32_t> label_id_out, const char* nam
   memcpy(name_ptr, name, name_size);
   name_ptr[name_size] = '\0';
 
+  if (ASMJIT_UNLIKELY(!_named_labels.insert(_arena, named_node))) {
+    return make_error(Error::kOutOfMemory);
+  }
+
   label_id_out = label_id;
   _label_entries.append_unchecked(LabelEntry{&named_node->extra_data, uint64_t(0)});
-  _named_labels.insert(_arena, named_node);
 
   return Error::kOk;
 }
@@ -889,6 +934,11 @@ ASMJIT_API Error CodeHolder::bind_label(const Label& label, uint32_t to_section_
     return make_error(Error::kLabelAlreadyBound);
   }
 
+  // A fragment records the label when it's bound, unless it was already recorded when its first fixup was created.
+  if (_is_fragment && !le._get_fixups()) {
+    ASMJIT_PROPAGATE(_fragment_label_ids.append(_arena, label_id));
+  }
+
   Section* section = _sections[to_section_id];
   CodeBuffer& buf = section->buffer();
 
@@ -964,6 +1014,146 @@ ASMJIT_API Error CodeHolder::bind_label(const Label& label, uint32_t to_section_
   return err;
 }
 
+// CodeHolder - Fragments
+// ======================
+
+static Error CodeHolder_copy_expression(CodeHolder* self, Out<Expression*> out, const Expression* src) noexcept {
+  Expression* exp = self->_arena.new_oneshot<Expression>();
+  if (ASMJIT_UNLIKELY(!exp)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  *exp = *src;
+  for (size_t i = 0; i < 2; i++) {
+    if (src->value_type[i] == ExpressionValueType::kExpression) {
+      ASMJIT_PROPAGATE(CodeHolder_copy_expression(self, Out(exp->value[i].expression), src->value[i].expression));
+    }
+  }
+
+  out = exp;
+  return Error::kOk;
+}
+
+Error CodeHolder::merge_fragment(const CodeHolder& fragment, uint32_t section_id, uint64_t offset) noexcept {
+  if (ASMJIT_UNLIKELY(section_id >= _sections.size())) {
+    return make_error(Error::kInvalidSection);
+  }
+
+  if (ASMJIT_UNLIKELY(fragment.label_count() > label_count())) {
+    return make_error(Error::kInvalidLabel);
+  }
+
+  Section* section = _sections[section_id];
+  CodeBuffer& buf = section->buffer();
+
+  ASMJIT_ASSERT(offset <= buf.size());
+  ASMJIT_ASSERT(buf.size() - offset >= fragment._text_section.buffer_size());
+
+  // Relocations must be merged first as fixups of unbound labels can reference them.
+  uint32_t reloc_base = _relocations._size;
+  ASMJIT_PROPAGATE(_relocations.reserve_additional(_arena, fragment._relocations.size()));
+
+  for (const RelocEntry* src : fragment._relocations) {
+    ASMJIT_ASSERT(src->source_section_id() == 0u);
+
+    RelocEntry* re;
+    ASMJIT_PROPAGATE(new_reloc_entry(Out(re), src->reloc_type()));
+
+    re->_format = src->_format;
+    re->_source_section_id = section_id;
+    re->_source_offset = src->_source_offset + offset;
+    re->_target_section_id = src->_target_section_id;
+    re->_payload = src->_payload;
+
+    // Relocation that targets the fragment's .text section must now target `section_id`.
+    if (src->_target_section_id == 0u) {
+      re->_target_section_id = section_id;
+      re->_payload += offset;
+    }
+
+    if (src->reloc_type() == RelocType::kExpression) {
+      Expression* exp;
+      ASMJIT_PROPAGATE(CodeHolder_copy_expression(this, Out(exp), src->payload_as_expression()));
+      re->_payload = uint64_t(uintptr_t(exp));
+    }
+    else if (src->reloc_type() == RelocType::kX64AddressEntry) {
+      ASMJIT_PROPAGATE(add_address_to_address_table(src->payload()));
+    }
+  }
+
+  Error err = Error::kOk;
+
+  // A fragment initialized by `init_fragment()` knows which labels it used, otherwise all labels must be visited.
+  const uint32_t* fragment_label_ids = fragment.is_fragment() ? fragment._fragment_label_ids.data() : nullptr;
+  size_t fragment_label_count = fragment.is_fragment() ? fragment._fragment_label_ids.size() : fragment.label_count();
+
+  for (size_t i = 0; i < fragment_label_count; i++) {
+    uint32_t label_id = fragment_label_ids ? fragment_label_ids[i] : uint32_t(i);
+    const LabelEntry& src_le = fragment._label_entries[label_id];
+
+    if (src_le.is_bound()) {
+      Error bind_err = bind_label(Label(label_id), section_id, offset + src_le.offset());
+      if (ASMJIT_UNLIKELY(bind_err != Error::kOk)) {
+        if (bind_err != Error::kInvalidDisplacement) {
+          return bind_err;
+        }
+        err = bind_err;
+      }
+      continue;
+    }
+
+    LabelEntry& le = _label_entries[label_id];
+    for (Fixup* src_fixup = src_le._get_fixups(); src_fixup; src_fixup = src_fixup->next) {
+      uint32_t reloc_id = src_fixup->label_or_reloc_id;
+      uint64_t from_offset = offset + src_fixup->offset;
+
+      if (reloc_id != Globals::kInvalidId) {
+        reloc_id += reloc_base;
+      }
+
+      if (!le.is_bound()) {
+        // The label is bound later, `bind_label()` would resolve the fixup.
+        Fixup* fixup = new_fixup(le, section_id, size_t(from_offset), src_fixup->rel, src_fixup->format);
+        if (ASMJIT_UNLIKELY(!fixup)) {
+          return make_error(Error::kOutOfMemory);
+        }
+        fixup->label_or_reloc_id = reloc_id;
+      }
+      else if (reloc_id != Globals::kInvalidId) {
+        // The label was already bound - adjust the relocation payload (the same as `bind_label()` does).
+        RelocEntry* re = _relocations[reloc_id];
+        re->_payload += le.offset();
+        re->_target_section_id = le.section_id();
+      }
+      else if (le.section_id() == section_id) {
+        int64_t displacement = int64_t(le.offset() - from_offset + uint64_t(int64_t(src_fixup->rel)));
+        if (!CodeWriterUtils::write_offset(buf._data + from_offset, displacement, src_fixup->format)) {
+          err = make_error(Error::kInvalidDisplacement);
+        }
+      }
+      else {
+        // Cross-section fixup, which must be resolved by `resolve_cross_section_fixups()`.
+        Fixup* fixup = _fixup_data_pool.alloc(_arena);
+        if (ASMJIT_UNLIKELY(!fixup)) {
+          return make_error(Error::kOutOfMemory);
+        }
+
+        fixup->next = _fixups;
+        fixup->section_id = section_id;
+        fixup->label_or_reloc_id = label_id;
+        fixup->offset = size_t(from_offset);
+        fixup->rel = src_fixup->rel;
+        fixup->format = src_fixup->format;
+
+        _fixups = fixup;
+        _unresolved_fixup_count++;
+      }
+    }
+  }
+
+  return err;
+}
+
 // CodeHolder - Relocations
 // ========================
 
@@ -1411,6 +1601,22 @@ UNIT(code_holder) {
   EXPECT_EQ(strcmp(code.label_entry_of(label_id2).name(), "NamedLabel2"), 0);
   EXPECT_EQ(code.label_id_by_name("NamedLabel2"), label_id2);
 
+  // A name is terminated by the first null terminator even when its size is provided.
+  EXPECT_EQ(code.label_id_by_name("NamedLabel1\0Suffix", 18), label_id1);
+  EXPECT_EQ(code.label_id_by_name("NamedLabel", 10), Globals::kInvalidId);
+
+  INFO("Verifying bulk label creation");
+  uint32_t first_id;
+  size_t label_count = code.label_count();
+
+  EXPECT_EQ(code.new_label_ids(Out(first_id), 1000), Error::kOk);
+  EXPECT_EQ(first_id, label_count);
+  EXPECT_EQ(code.label_count(), label_count + 1000u);
+  EXPECT_FALSE(code.is_label_bound(first_id + 999u));
+  EXPECT_EQ(code.label_entry_of(first_id + 999u).label_type(), LabelType::kAnonymous);
+  EXPECT_EQ(code.new_label_ids(Out(first_id), size_t(Globals::kInvalidId)), Error::kTooManyLabels);
+  EXPECT_EQ(first_id, Globals::kInvalidId);
+
   INFO("Verifying .text properties");
   Section* section_text = code.text_section();
   EXPECT_TRUE(section_text->has_offset());
@@ -1446,6 +1652,48 @@ UNIT(code_holder) {
   EXPECT_EQ(code.sections_by_order()[3], section_c);
   EXPECT_FALSE(section_c->has_offset());
 }
+
+UNIT(code_holder_fragment) {
+  Environment env;
+  env.init(Arch::kX64);
+
+  CodeHolder code;
+  code.init(env);
+
+  uint32_t first_id;
+  EXPECT_EQ(code.new_label_ids(Out(first_id), 1000), Error::kOk);
+
+  INFO("Verifying CodeHolder::init_fragment()");
+  CodeHolder fragment;
+  EXPECT_EQ(fragment.init_fragment(code), Error::kOk);
+  EXPECT_TRUE(fragment.is_fragment());
+  EXPECT_FALSE(code.is_fragment());
+  EXPECT_EQ(fragment.label_count(), code.label_count());
+
+  INFO("Verifying that a fragment records each label it binds or references only once");
+  OffsetFormat format;
+  format.reset_to_simple_value(OffsetType::kSignedOffset, 4);
+
+  EXPECT_EQ(fragment.bind_label(Label(5), 0, 0), Error::kOk);
+  EXPECT_NOT_NULL(fragment.new_fixup(fragment._label_entries[700], 0, 0, -4, format));
+  EXPECT_NOT_NULL(fragment.new_fixup(fragment._label_entries[700], 0, 0, -4, format));
+
+  EXPECT_EQ(fragment._fragment_label_ids.size(), 2u);
+  EXPECT_EQ(fragment._fragment_label_ids[0], 5u);
+  EXPECT_EQ(fragment._fragment_label_ids[1], 700u);
+
+  INFO("Verifying CodeHolder::merge_fragment() merges recorded labels");
+  EXPECT_EQ(code.merge_fragment(fragment, 0, 0), Error::kOk);
+  EXPECT_TRUE(code.is_label_bound(5));
+  EXPECT_FALSE(code.is_label_bound(700));
+  EXPECT_TRUE(code.label_entry_of(700).has_fixups());
+  EXPECT_EQ(code.unresolved_fixup_count(), 2u);
+
+  INFO("Verifying that reinitialization resets the fragment state");
+  EXPECT_EQ(fragment.reinit(), Error::kOk);
+  EXPECT_FALSE(fragment.is_fragment());
+  EXPECT_EQ(fragment._fragment_label_ids.size(), 0u);
+}
 #endif
 
 ASMJIT_END_NAMESPACE
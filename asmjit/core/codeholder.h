@@ -820,6 +820,11 @@ public:
   //! Count of unresolved fixups of unbound labels (at the end of assembling this should be zero).
   size_t _unresolved_fixup_count;
 
+  //! Identifiers of labels that were bound or referenced by fixups (only tracked by fragments, see \ref init_fragment()).
+  ArenaVector<uint32_t> _fragment_label_ids;
+  //! Whether this CodeHolder was initialized by \ref init_fragment().
+  bool _is_fragment;
+
   //! Text section - always one part of a CodeHolder itself.
   Section _text_section;
 
@@ -836,7 +841,8 @@ public:
   //! Creates an uninitialized CodeHolder (you must init() it before it can be used).
   //!
   //! An optional `temporary` argument can be used to initialize the first block of \ref Arena
-  //! that \ref CodeHolder uses into a temporary memory provided by the user.
+  //! that \ref CodeHolder uses into a temporary memory provided by the user. Other blocks are
+  //! allocated by `malloc()` or acquired from \ref ArenaBlockPool if it's enabled.
   ASMJIT_API explicit CodeHolder(Span<uint8_t> static_arena_memory = Span<uint8_t>{}) noexcept;
 
   //! Destroys the CodeHolder and frees all resources it has allocated.
@@ -853,6 +859,17 @@ public:
   //! Initializes CodeHolder to hold code described by the given `environment`, `cpu_features`, and `base_address`.
   ASMJIT_API Error init(const Environment& environment, const CpuFeatures& cpu_features, uint64_t base_address = Globals::kNoBaseAddress) noexcept;
 
+  //! Initializes CodeHolder as a fragment of `code`, see \ref merge_fragment().
+  //!
+  //! The fragment uses the same environment and CPU features as `code` and shares label identifiers with it - all
+  //! labels of `code` are created in the fragment as well. In addition, the fragment records each label it binds or
+  //! references, so the fragment can be merged without visiting labels it doesn't use.
+  ASMJIT_API Error init_fragment(const CodeHolder& code) noexcept;
+
+  //! Tests whether this CodeHolder was initialized by \ref init_fragment().
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool is_fragment() const noexcept { return _is_fragment; }
+
   //! Reinitializes CodeHolder with the same environment, cpu features, and base address as it had, and notifies
   //! all attached emitters of reinitialization. If the \ref CodeHolder was not initialized, \ref Error::kNotInitialized
   //! is returned.
@@ -1176,6 +1193,16 @@ public:
   [[nodiscard]]
   ASMJIT_API Error new_label_id(Out<uint32_t> label_id_out) noexcept;
 
+  //! Creates `count` new anonymous labels at once and returns the id of the first one in `first_id_out`.
+  //!
+  //! The identifiers of the created labels are consecutive, thus the created labels are `[first_id, first_id + count)`.
+  //! This is much faster than calling \ref new_label_id() in a loop when a lot of labels is needed upfront (for
+  //! example when generating state machines or jump tables) as the storage is only reserved once.
+  //!
+  //! Returns `Error`, does not report error to `ErrorHandler`.
+  [[nodiscard]]
+  ASMJIT_API Error new_label_ids(Out<uint32_t> first_id_out, size_t count) noexcept;
+
   //! Creates a new named \ref LabelEntry of the given label `type`.
   //!
   //! \param label_id_out Where to store the created \ref Label id.
@@ -1247,6 +1274,23 @@ public:
   //! This function is generally used by `BaseAssembler::bind()` to do the heavy lifting.
   ASMJIT_API Error bind_label(const Label& label, uint32_t section_id, uint64_t offset) noexcept;
 
+  //! Merges labels, fixups, and relocations of a `fragment` into this CodeHolder.
+  //!
+  //! A fragment is a separate CodeHolder, which was used to assemble a part of the code independently of this
+  //! CodeHolder (possibly in a different thread). It must share label identifiers with this CodeHolder, which is
+  //! achieved by initializing it by \ref init_fragment(), and the fragment must only use its .text section. The
+  //! content of the fragment's .text section must already be copied to the section specified by `section_id` at
+  //! `offset` before this function is called.
+  //!
+  //! Labels bound in the fragment are bound in this CodeHolder (relative to `offset`), fixups of labels that were
+  //! not bound in the fragment are either resolved or transferred, and relocations are copied and adjusted. Only
+  //! labels recorded by the fragment are visited, thus the cost of merging doesn't depend on the number of labels
+  //! of this CodeHolder. A fragment that shares label identifiers by calling \ref new_label_ids() instead is still
+  //! supported, but all of its labels have to be visited.
+  //!
+  //! This function is used by \ref BaseBuilder::serialize_parallel_to() to merge fragments assembled in parallel.
+  ASMJIT_API Error merge_fragment(const CodeHolder& fragment, uint32_t section_id, uint64_t offset) noexcept;
+
   //! \}
 
   //! \name Relocations
@@ -50,6 +50,7 @@ public:
 
 BaseCompiler::BaseCompiler() noexcept
   : BaseBuilder(),
+    _virt_reg_arena(16u * 1024u),
     _func(nullptr),
     _virt_regs(),
     _const_pools { nullptr, nullptr } {
@@ -230,11 +231,11 @@ Error BaseCompiler::new_virt_reg(Out<VirtReg*> out, TypeId type_id, OperandSigna
     return report_error(make_error(Error::kTooManyVirtRegs));
   }
 
-  if (ASMJIT_UNLIKELY(_virt_regs.reserve_additional(_builder_arena) != Error::kOk)) {
+  if (ASMJIT_UNLIKELY(_virt_regs.reserve_additional(_virt_reg_arena) != Error::kOk)) {
     return report_error(make_error(Error::kOutOfMemory));
   }
 
-  void* virt_reg_ptr = _builder_arena.alloc_oneshot(Arena::aligned_size_of<VirtReg>());
+  void* virt_reg_ptr = _virt_reg_arena.alloc_oneshot(Arena::aligned_size_of<VirtReg>());
   if (ASMJIT_UNLIKELY(!virt_reg_ptr)) {
     return report_error(make_error(Error::kOutOfMemory));
   }
@@ -247,7 +248,7 @@ Error BaseCompiler::new_virt_reg(Out<VirtReg*> out, TypeId type_id, OperandSigna
 
 #ifndef ASMJIT_NO_LOGGING
   if (name && name[0] != '\0') {
-    virt_reg->_name.set_data(_builder_arena, name, SIZE_MAX);
+    virt_reg->_name.set_data(_virt_reg_arena, name, SIZE_MAX);
   }
 #else
   Support::maybe_unused(name);
@@ -293,7 +294,8 @@ Error BaseCompiler::_new_reg_with_name(Out<Reg> out, const Reg& ref, const char*
     uint32_t type_size = TypeUtils::size_of(type_id);
     uint32_t ref_size = ref.size();
 
-    if (type_size != ref_size) {
+    // Scalable registers have no static size, so the TypeId of the virtual register is kept as is.
+    if (ref_size != 0u && type_size != ref_size) {
       if (TypeUtils::is_int(type_id)) {
         // GP register - change TypeId to match `ref`, but keep sign of `v_ref`.
         switch (ref_size) {
@@ -476,7 +478,7 @@ void BaseCompiler::rename(const Reg& reg, const char* fmt, ...) {
     vsnprintf(buf, ASMJIT_ARRAY_SIZE(buf), fmt, ap);
     va_end(ap);
 
-    virt_reg->_name.set_data(_builder_arena, buf, SIZE_MAX);
+    virt_reg->_name.set_data(_virt_reg_arena, buf, SIZE_MAX);
   }
 }
 
@@ -530,6 +532,15 @@ JumpAnnotation* BaseCompiler::new_jump_annotation() {
   return jump_annotation;
 }
 
+// BaseCompiler - Memory Statistics
+// ================================
+
+BuilderMemoryStats BaseCompiler::memory_stats() const noexcept {
+  BuilderMemoryStats stats = Base::memory_stats();
+  stats._categories[size_t(BuilderMemoryCategory::kVirtRegs)] = _virt_reg_arena.statistics();
+  return stats;
+}
+
 // BaseCompiler - Events
 // =====================
 
@@ -538,6 +549,7 @@ static ASMJIT_INLINE void BaseCompiler_clear(BaseCompiler* self) noexcept {
   self->_const_pools[uint32_t(ConstPoolScope::kLocal)] = nullptr;
   self->_const_pools[uint32_t(ConstPoolScope::kGlobal)] = nullptr;
   self->_virt_regs.reset();
+  self->_virt_reg_arena.reset();
 }
 
 static ASMJIT_INLINE Error BaseCompiler_initDefaultPasses(BaseCompiler* self) noexcept {
@@ -31,6 +31,28 @@ class InvokeNode;
 //! \addtogroup asmjit_compiler
 //! \{
 
+//! Compiler options.
+//!
+//! Options that enable optional transformations of the code performed by \ref BaseCompiler, which are not enabled by
+//! default as they change the code the user emitted.
+enum class CompilerOptions : uint32_t {
+  //! No compiler options.
+  kNone = 0,
+
+  //! Remove dead instructions and dead stack stores before register allocation.
+  //!
+  //! When enabled, the register allocator removes instructions whose results (virtual registers, CPU flags, and
+  //! stores to stack areas created by \ref BaseCompiler::new_stack() that are never read) are not used. Instructions
+  //! that access any other memory, use physical registers, can trap (integer division), or have side effects that
+  //! are not described by their RW information are always kept.
+  //!
+  //! Use \ref DiagnosticOptions::kRADebugDeadCode to log removed instructions.
+  //!
+  //! Default: false.
+  kRemoveDeadCode = 0x00000001u
+};
+ASMJIT_DEFINE_ENUM_FLAGS(CompilerOptions)
+
 //! Code emitter that uses virtual registers and performs register allocation.
 //!
 //! Compiler is a high-level code-generation tool that provides register allocation and automatic handling of function
@@ -56,6 +78,8 @@ public:
   //! \name Members
   //! \{
 
+  //! Arena used to allocate virtual registers, their names, and the array of `VirtReg` pointers.
+  Arena _virt_reg_arena;
   //! Current function.
   FuncNode* _func;
   //! Stores array of `VirtReg` pointers.
@@ -68,6 +92,9 @@ public:
   //! Local constant pool is flushed with each function, global constant pool is flushed only by \ref finalize().
   ConstPoolNode* _const_pools[2];
 
+  //! Compiler options.
+  CompilerOptions _compiler_options = CompilerOptions::kNone;
+
   //! \}
 
   //! \name Construction & Destruction
@@ -80,6 +107,25 @@ public:
 
   //! \}
 
+  //! \name Compiler Options
+  //! \{
+
+  //! Returns compiler options.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG CompilerOptions compiler_options() const noexcept { return _compiler_options; }
+
+  //! Tests whether the compiler option `option` is enabled.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool has_compiler_option(CompilerOptions option) const noexcept { return Support::test(_compiler_options, option); }
+
+  //! Enables the given compiler `options`.
+  ASMJIT_INLINE_NODEBUG void add_compiler_options(CompilerOptions options) noexcept { _compiler_options |= options; }
+
+  //! Disables the given compiler `options`.
+  ASMJIT_INLINE_NODEBUG void clear_compiler_options(CompilerOptions options) noexcept { _compiler_options &= ~options; }
+
+  //! \}
+
   //! \name Passes
   //! \{
 
@@ -91,6 +137,16 @@ public:
   template<typename T, typename... Args>
   ASMJIT_INLINE Error add_pass(Args&&... args) { return _add_pass(new_pass<T, Args...>(std::forward<Args>(args)...)); }
 
+  template<typename T, typename... Args>
+  ASMJIT_INLINE Error insert_pass(size_t index, Args&&... args) { return _insert_pass(index, new_pass<T, Args...>(std::forward<Args>(args)...)); }
+
+  //! \}
+
+  //! \name Memory Statistics
+  //! \{
+
+  ASMJIT_API BuilderMemoryStats memory_stats() const noexcept override;
+
   //! \}
 
   //! \name Function Management
@@ -670,6 +670,12 @@ static ASMJIT_FAVOR_SIZE CpuHints recalculate_hints(const CpuInfo& cpu_info, con
           case 0xCFu: // Emerald Rapids.
           case 0xDDu: // Clearwater Forest.
             hints |= CpuHints::kVecFastGather;
+
+            // Server parts that are immune to DOWNFALL and implement AVX-512 have scatters that beat a sequence of
+            // extracts and scalar stores. AMD implements scatters in microcode, so they are never hinted there.
+            if (features.has_avx512_f()) {
+              hints |= CpuHints::kVecFastScatter;
+            }
             break;
 
           default:
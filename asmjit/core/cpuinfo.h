@@ -1186,7 +1186,10 @@ enum class CpuHints : uint32_t {
   //! CPU has fast stores with mask.
   //!
   //! \note This is a hint to the compiler to emit a masked store instead of a sequence having branches.
-  kVecMaskedStore = 0x00000080u
+  kVecMaskedStore = 0x00000080u,
+
+  //! CPU provides fast hardware scatters, which are faster than a sequence of extracts and stores.
+  kVecFastScatter = 0x00000100u
 };
 ASMJIT_DEFINE_ENUM_FLAGS(CpuHints)
 
@@ -185,6 +185,9 @@ enum class DiagnosticOptions : uint32_t {
   //! Debug the removal of code part of unreachable blocks.
   kRADebugUnreachable = 0x00000800u,
 
+  //! Debug the removal of dead instructions and dead stack stores (Compiler/RA).
+  kRADebugDeadCode = 0x00001000u,
+
   //! Enable all debug options (Compiler/RA).
   kRADebugAll = 0x0000FF00u
 };
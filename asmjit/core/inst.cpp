@@ -126,4 +126,29 @@ Error InstAPI::query_features(Arch arch, const BaseInst& inst, const Operand_* o
 }
 #endif // !ASMJIT_NO_INTROSPECTION
 
+// InstAPI - QuerySchedClass
+// =========================
+
+#ifndef ASMJIT_NO_INTROSPECTION
+Error InstAPI::query_sched_class(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept {
+  if (ASMJIT_UNLIKELY(op_count > Globals::kMaxOpCount)) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+#if !defined(ASMJIT_NO_X86)
+  if (Environment::is_family_x86(arch)) {
+    return x86::InstInternal::query_sched_class(arch, inst, operands, op_count, out);
+  }
+#endif
+
+#if !defined(ASMJIT_NO_AARCH64)
+  if (Environment::is_family_aarch64(arch)) {
+    return a64::InstInternal::query_sched_class(inst, operands, op_count, out);
+  }
+#endif
+
+  return make_error(Error::kInvalidArch);
+}
+#endif // !ASMJIT_NO_INTROSPECTION
+
 ASMJIT_END_NAMESPACE
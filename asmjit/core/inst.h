@@ -876,6 +876,41 @@ struct InstRWInfo {
   //! \}
 };
 
+//! Instruction scheduling class.
+//!
+//! Describes a coarse category of an instruction, which is used by instruction scheduling to look up latency and
+//! throughput of the instruction in a scheduling model. Memory accesses are not part of the class as they are
+//! described by \ref InstRWInfo - for example a load-op instruction would be a \ref InstSchedClass::kALU that
+//! also reads memory.
+enum class InstSchedClass : uint8_t {
+  //! Instruction that must not be reordered with respect to any other instruction.
+  //!
+  //! This class is used by control flow instructions, instructions that use implicit operands, instructions that
+  //! access system state, atomic instructions, fences, and instructions that are not known to the scheduler.
+  kBarrier = 0,
+  //! Register to register or register to memory move (either general purpose or vector).
+  kMov = 1,
+  //! General purpose arithmetic and logic instruction.
+  kALU = 2,
+  //! General purpose multiplication.
+  kMul = 3,
+  //! General purpose division.
+  kDiv = 4,
+  //! Vector integer arithmetic and logic instruction.
+  kVecALU = 5,
+  //! Vector integer multiplication.
+  kVecMul = 6,
+  //! Vector (or scalar) floating point arithmetic, FMA, and conversion.
+  kVecFP = 7,
+  //! Vector (or scalar) floating point division and square root.
+  kVecDiv = 8,
+  //! Vector shuffle, permute, insert, extract, and broadcast.
+  kVecShuffle = 9,
+
+  //! Maximum value of `InstSchedClass`.
+  kMaxValue = kVecShuffle
+};
+
 //! Validation flags that can be used with \ref InstAPI::validate().
 enum class ValidationFlags : uint8_t {
   //! No flags.
@@ -913,6 +948,12 @@ ASMJIT_API Error query_rw_info(Arch arch, const BaseInst& inst, const Operand_*
 
 //! Gets CPU features required by the given instruction.
 ASMJIT_API Error query_features(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, CpuFeatures* out) noexcept;
+
+//! Gets a scheduling class of the given instruction, see \ref InstSchedClass.
+//!
+//! \note The returned class is conservative - any instruction that cannot be safely reordered by only considering
+//! its \ref InstRWInfo is reported as \ref InstSchedClass::kBarrier.
+ASMJIT_API Error query_sched_class(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept;
 #endif // !ASMJIT_NO_INTROSPECTION
 
 } // {InstAPI}
@@ -16,8 +16,12 @@
 #include <asmjit/support/arenatree.h>
 #include <asmjit/support/support.h>
 
+#include <atomic>
+#include <thread>
+
 #if defined(ASMJIT_TEST)
 #include <asmjit-testing/commons/random.h>
+#include <chrono>
 #endif // ASMJIT_TEST
 
 ASMJIT_BEGIN_NAMESPACE
@@ -38,6 +42,24 @@ static constexpr uint32_t kJitAllocatorBaseGranularity = 64;
 //! Maximum block size (32MB).
 static constexpr uint32_t kJitAllocatorMaxBlockSize = 1024 * 1024 * 64;
 
+//! Default maximum distance of blocks from the anchor (1GB).
+static constexpr size_t kJitAllocatorDefaultAnchorRange = size_t(1024) * 1024 * 1024;
+
+//! Size of a slab (and also its alignment within a block) when `JitAllocatorOptions::kUseSlabs` is set.
+static constexpr uint32_t kJitAllocatorSlabSize = 4096;
+
+//! Granularity (and also alignment) of slab objects.
+static constexpr uint32_t kJitAllocatorSlabObjectGranularity = 16;
+
+//! Number of slab size classes (16, 32, 48, and 64 bytes).
+static constexpr uint32_t kJitAllocatorSlabClassCount = 4;
+
+//! Maximum size of an allocation that is served from a slab.
+static constexpr uint32_t kJitAllocatorSlabMaxObjectSize = kJitAllocatorSlabObjectGranularity * kJitAllocatorSlabClassCount;
+
+//! Number of attempts of a lock-free query to read blocks that are not being modified.
+static constexpr uint32_t kJitAllocatorLockFreeQueryAttempts = 64;
+
 // JitAllocator - Fill Pattern
 // ===========================
 
@@ -143,10 +165,95 @@ public:
   }
 };
 
+// JitAllocator - Shared Words
+// ============================
+
+// Bit-vectors and slab tables are read by lock-free queries while they could be modified by a writer holding the
+// lock. The sequence lock only validates such reads afterwards, the reads themselves must still be atomic, otherwise
+// they would be a data race. Thus words that lock-free queries read are always stored by relaxed atomic stores and
+// loaded by relaxed atomic loads outside of the lock. Reads guarded by the lock don't need to be atomic.
+
+template<typename T>
+static ASMJIT_INLINE T JitAllocator_load_relaxed(const T* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __atomic_load_n(p, __ATOMIC_RELAXED);
+#else
+  return *static_cast<const volatile T*>(p);
+#endif
+}
+
+template<typename T>
+static ASMJIT_INLINE void JitAllocator_store_relaxed(T* p, T value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __atomic_store_n(p, value, __ATOMIC_RELAXED);
+#else
+  *static_cast<volatile T*>(p) = value;
+#endif
+}
+
+static ASMJIT_INLINE bool JitAllocator_shared_bit_vector_get_bit(const Support::BitWord* buf, size_t index) noexcept {
+  constexpr size_t kBitWordSize = Support::bit_size_of<Support::BitWord>;
+  return bool((JitAllocator_load_relaxed(buf + index / kBitWordSize) >> (index % kBitWordSize)) & 1u);
+}
+
+static ASMJIT_INLINE void JitAllocator_shared_bit_vector_set_bit(Support::BitWord* buf, size_t index, bool value) noexcept {
+  constexpr size_t kBitWordSize = Support::bit_size_of<Support::BitWord>;
+
+  Support::BitWord* p = buf + index / kBitWordSize;
+  Support::BitWord mask = Support::BitWord(1u) << (index % kBitWordSize);
+  JitAllocator_store_relaxed(p, value ? Support::BitWord(*p | mask) : Support::BitWord(*p & ~mask));
+}
+
+// Sets `count` bits starting at `index` to `value`.
+static void JitAllocator_shared_bit_vector_fill(Support::BitWord* buf, size_t index, size_t count, bool value) noexcept {
+  constexpr size_t kBitWordSize = Support::bit_size_of<Support::BitWord>;
+  size_t end = index + count;
+
+  while (index < end) {
+    size_t bit_index = index % kBitWordSize;
+    size_t n = Support::min(kBitWordSize - bit_index, end - index);
+
+    Support::BitWord* p = buf + index / kBitWordSize;
+    Support::BitWord mask = (Support::bit_ones<Support::BitWord> >> (kBitWordSize - n)) << bit_index;
+
+    JitAllocator_store_relaxed(p, value ? Support::BitWord(*p | mask) : Support::BitWord(*p & ~mask));
+    index += n;
+  }
+}
+
+static void JitAllocator_shared_bit_vector_zero(Support::BitWord* buf, size_t bit_word_count) noexcept {
+  for (size_t i = 0; i < bit_word_count; i++) {
+    JitAllocator_store_relaxed(buf + i, Support::BitWord(0));
+  }
+}
+
+// Returns the index of the first bit equal to `value` in `[start, end)`, or `end` if there is no such bit. Unlike
+// `Support::bit_vector_index_of()` the search is bounded, as a bit-vector read concurrently could be inconsistent.
+static size_t JitAllocator_shared_bit_vector_index_of(const Support::BitWord* buf, size_t start, size_t end, bool value) noexcept {
+  constexpr size_t kBitWordSize = Support::bit_size_of<Support::BitWord>;
+
+  Support::BitWord flip_mask = value ? Support::BitWord(0) : Support::bit_ones<Support::BitWord>;
+  size_t word_index = start / kBitWordSize;
+  Support::BitWord bits = (JitAllocator_load_relaxed(buf + word_index) ^ flip_mask) & (Support::bit_ones<Support::BitWord> << (start % kBitWordSize));
+
+  for (;;) {
+    if (bits) {
+      return Support::min(word_index * kBitWordSize + Support::ctz(bits), end);
+    }
+
+    if (++word_index * kBitWordSize >= end) {
+      return end;
+    }
+
+    bits = JitAllocator_load_relaxed(buf + word_index) ^ flip_mask;
+  }
+}
+
 // JitAllocator - Pool
 // ===================
 
 class JitAllocatorBlock;
+class JitAllocatorSlab;
 
 class JitAllocatorPool {
 public:
@@ -175,6 +282,8 @@ public:
   size_t total_area_used[2] {};
   //! Overhead of all blocks (in bytes).
   size_t total_overhead_bytes = 0;
+  //! Size of pages discarded by `JitAllocator::purge()` across all blocks (in bytes).
+  size_t total_purged_bytes = 0;
 
   //! \}
 
@@ -192,6 +301,7 @@ public:
     total_area_used[0] = 0u;
     total_area_used[1] = 0u;
     total_overhead_bytes = 0u;
+    total_purged_bytes = 0u;
   }
 
   ASMJIT_INLINE_NODEBUG size_t byte_size_from_area_size(uint32_t area_size) const noexcept { return size_t(area_size) * granularity; }
@@ -223,7 +333,13 @@ public:
     //! Block represents memory that is using large pages.
     kFlagLargePages = 0x00000010u,
     //! Block represents memory that is dual-mapped.
-    kFlagDualMapped = 0x00000020u
+    kFlagDualMapped = 0x00000020u,
+    //! Block is being evacuated by `JitAllocator::compact()` - no new allocations can be placed in it.
+    kFlagEvacuating = 0x00000040u,
+    //! Block has been already visited by `JitAllocator::compact()`.
+    kFlagCompacted = 0x00000080u,
+    //! Block represents memory aligned to a large page that can be backed by transparent huge pages.
+    kFlagTransparentHugePages = 0x00000100u
   };
 
   static_assert(kFlagInitialPadding == 1, "JitAllocatorBlock::kFlagInitialPadding must be equal to 1");
@@ -252,11 +368,19 @@ public:
   uint32_t _search_start = 0;
   //! End of a search range (for unused bits).
   uint32_t _search_end = 0;
+  //! Number of pages that can be purged (zero if the block doesn't support purging).
+  uint32_t _page_count = 0;
+  //! Number of pages discarded by `JitAllocator::purge()`.
+  uint32_t _purged_page_count = 0;
 
   //! Used bit-vector (0 = unused, 1 = used).
   Support::BitWord* _used_bit_vector {};
   //! Stop bit-vector (0 = don't care, 1 = stop).
   Support::BitWord* _stop_bit_vector {};
+  //! Purged bit-vector (0 = resident, 1 = purged), one bit per page.
+  Support::BitWord* _purged_bit_vector {};
+  //! Slabs indexed by `offset / kJitAllocatorSlabSize` (only allocated when the first slab is placed in the block).
+  JitAllocatorSlab** _slabs {};
 
   ASMJIT_INLINE JitAllocatorBlock(
     JitAllocatorPool* pool,
@@ -265,7 +389,9 @@ public:
     uint32_t block_flags,
     Support::BitWord* used_bit_vector,
     Support::BitWord* stop_bit_vector,
-    uint32_t area_size
+    Support::BitWord* purged_bit_vector,
+    uint32_t area_size,
+    uint32_t page_count
   ) noexcept
     : ArenaTreeNodeT(),
       _pool(pool),
@@ -273,8 +399,11 @@ public:
       _block_size(block_size),
       _flags(block_flags),
       _area_size(area_size),
+      _page_count(page_count),
       _used_bit_vector(used_bit_vector),
-      _stop_bit_vector(stop_bit_vector) {
+      _stop_bit_vector(stop_bit_vector),
+      _purged_bit_vector(purged_bit_vector) {
+    memset(_purged_bit_vector, 0, _pool->bit_word_count_from_area_size(page_count) * sizeof(Support::BitWord));
     clear_block();
   }
 
@@ -328,15 +457,33 @@ public:
   [[nodiscard]]
   ASMJIT_INLINE_NODEBUG uint32_t largest_unused_area() const noexcept { return _largest_unused_area; }
 
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t page_count() const noexcept { return _page_count; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t purged_page_count() const noexcept { return _purged_page_count; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG size_t slab_table_size() const noexcept { return _block_size / kJitAllocatorSlabSize; }
+
+  //! Returns a slab that contains the given `offset` or null if the offset is not within a slab.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG JitAllocatorSlab* slab_at(size_t offset) const noexcept { return _slabs ? _slabs[offset / kJitAllocatorSlabSize] : nullptr; }
+
+  ASMJIT_INLINE void clear_purged_pages() noexcept {
+    memset(_purged_bit_vector, 0, _pool->bit_word_count_from_area_size(_page_count) * sizeof(Support::BitWord));
+    _purged_page_count = 0;
+  }
+
   ASMJIT_INLINE void clear_block() noexcept {
     bool bit = has_initial_padding();
     size_t bit_word_count = _pool->bit_word_count_from_area_size(_area_size);
 
-    memset(_used_bit_vector, 0, bit_word_count * sizeof(Support::BitWord));
-    memset(_stop_bit_vector, 0, bit_word_count * sizeof(Support::BitWord));
+    JitAllocator_shared_bit_vector_zero(_used_bit_vector, bit_word_count);
+    JitAllocator_shared_bit_vector_zero(_stop_bit_vector, bit_word_count);
 
-    Support::bit_vector_set_bit(_used_bit_vector, 0, bit);
-    Support::bit_vector_set_bit(_stop_bit_vector, 0, bit);
+    JitAllocator_shared_bit_vector_set_bit(_used_bit_vector, 0, bit);
+    JitAllocator_shared_bit_vector_set_bit(_stop_bit_vector, 0, bit);
 
     uint32_t start = initial_area_start_by_flags(_flags);
     _area_used = start;
@@ -352,8 +499,8 @@ public:
     uint32_t allocated_area_size = allocated_area_end - allocated_area_start;
 
     // Mark the newly allocated space as occupied and also the sentinel.
-    Support::bit_vector_fill(_used_bit_vector, allocated_area_start, allocated_area_size);
-    Support::bit_vector_set_bit(_stop_bit_vector, allocated_area_end - 1, true);
+    JitAllocator_shared_bit_vector_fill(_used_bit_vector, allocated_area_start, allocated_area_size, true);
+    JitAllocator_shared_bit_vector_set_bit(_stop_bit_vector, allocated_area_end - 1, true);
 
     // Update search region and statistics.
     _pool->total_area_used[size_t(has_large_pages())] += allocated_area_size;
@@ -388,8 +535,8 @@ public:
     _area_used -= released_area_size;
 
     // Unmark occupied bits and also the sentinel.
-    Support::bit_vector_clear(_used_bit_vector, released_area_start, released_area_size);
-    Support::bit_vector_set_bit(_stop_bit_vector, released_area_end - 1, false);
+    JitAllocator_shared_bit_vector_fill(_used_bit_vector, released_area_start, released_area_size, false);
+    JitAllocator_shared_bit_vector_set_bit(_stop_bit_vector, released_area_end - 1, false);
 
     if (Support::bool_and(is_incremental(), _search_start == released_area_end)) {
       // Incremental mode: If the area released is at the end of the fully used area, we would like to
@@ -442,9 +589,9 @@ public:
     }
 
     // Unmark the released space and move the sentinel.
-    Support::bit_vector_clear(_used_bit_vector, shrunk_area_start, shrunk_area_size);
-    Support::bit_vector_set_bit(_stop_bit_vector, shrunk_area_end - 1, false);
-    Support::bit_vector_set_bit(_stop_bit_vector, shrunk_area_start - 1, true);
+    JitAllocator_shared_bit_vector_fill(_used_bit_vector, shrunk_area_start, shrunk_area_size, false);
+    JitAllocator_shared_bit_vector_set_bit(_stop_bit_vector, shrunk_area_end - 1, false);
+    JitAllocator_shared_bit_vector_set_bit(_stop_bit_vector, shrunk_area_start - 1, true);
   }
 
   // RBTree default CMP uses '<' and '>' operators.
@@ -456,6 +603,181 @@ public:
   ASMJIT_INLINE_NODEBUG bool operator>(const uint8_t* key) const noexcept { return rx_ptr() > key; }
 };
 
+// JitAllocator - Slab
+// ===================
+
+//! A slab is an area of `kJitAllocatorSlabSize` bytes within a block, which is split into objects of the same size.
+//!
+//! Unused objects form a free list, which links are stored in the slab itself (and not in executable memory). Objects
+//! that were never allocated are not in the free list, they are allocated incrementally from `_bump_index`.
+class JitAllocatorSlab : public ArenaListNode<JitAllocatorSlab> {
+public:
+  ASMJIT_NONCOPYABLE(JitAllocatorSlab)
+
+  static inline constexpr uint32_t kMaxObjectCount = kJitAllocatorSlabSize / kJitAllocatorSlabObjectGranularity;
+  static inline constexpr uint32_t kBitWordSizeInBits = Support::bit_size_of<Support::BitWord>;
+
+  //! Block that holds the slab.
+  JitAllocatorBlock* _block;
+  //! Offset of the slab relative to the start of the block [bytes].
+  uint32_t _offset;
+  //! Size class of the slab.
+  uint32_t _class_id;
+  //! Size of a single object [bytes].
+  uint32_t _object_size;
+  //! Number of objects the slab can hold.
+  uint32_t _capacity;
+  //! Number of used objects.
+  uint32_t _used_count = 0;
+  //! Index of the first object in the free list (`_capacity` if the free list is empty).
+  uint32_t _free_head;
+  //! Index of the first object that was never allocated.
+  uint32_t _bump_index = 0;
+  //! Used bit-vector (0 = unused, 1 = used), only used to validate objects passed to `release()`.
+  Support::BitWord _used_bit_vector[kMaxObjectCount / kBitWordSizeInBits] {};
+  //! Free list links - index of the next unused object for each object in the free list.
+  uint16_t _next_free[kMaxObjectCount];
+
+  ASMJIT_INLINE JitAllocatorSlab(JitAllocatorBlock* block, uint32_t offset, uint32_t class_id) noexcept
+    : ArenaListNode(),
+      _block(block),
+      _offset(offset),
+      _class_id(class_id),
+      _object_size((class_id + 1u) * kJitAllocatorSlabObjectGranularity),
+      _capacity(kJitAllocatorSlabSize / _object_size),
+      _free_head(_capacity) {}
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG JitAllocatorBlock* block() const noexcept { return _block; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t offset() const noexcept { return _offset; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t class_id() const noexcept { return _class_id; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t object_size() const noexcept { return _object_size; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool is_empty() const noexcept { return _used_count == 0u; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool is_full() const noexcept { return _used_count == _capacity; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool is_used(uint32_t index) const noexcept {
+    return index < _capacity && JitAllocator_shared_bit_vector_get_bit(_used_bit_vector, index);
+  }
+
+  //! Returns the index of the object at `offset` (relative to the start of the block) or `_capacity` if there is no
+  //! used object starting at `offset`.
+  [[nodiscard]]
+  ASMJIT_INLINE uint32_t object_index_of(size_t offset) const noexcept {
+    size_t slab_offset = offset - _offset;
+    uint32_t index = uint32_t(slab_offset / _object_size);
+
+    if (ASMJIT_UNLIKELY(slab_offset != size_t(index) * _object_size || !is_used(index))) {
+      return _capacity;
+    }
+
+    return index;
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE uint32_t alloc_object() noexcept {
+    ASMJIT_ASSERT(!is_full());
+
+    uint32_t index = _free_head;
+    if (index != _capacity) {
+      _free_head = _next_free[index];
+    }
+    else {
+      index = _bump_index++;
+    }
+
+    JitAllocator_shared_bit_vector_set_bit(_used_bit_vector, index, true);
+    _used_count++;
+    return index;
+  }
+
+  ASMJIT_INLINE void release_object(uint32_t index) noexcept {
+    ASMJIT_ASSERT(is_used(index));
+
+    JitAllocator_shared_bit_vector_set_bit(_used_bit_vector, index, false);
+    _next_free[index] = uint16_t(_free_head);
+    _free_head = index;
+    _used_count--;
+  }
+};
+
+//! Slabs of the same size class.
+class JitAllocatorSlabClass {
+public:
+  ASMJIT_NONCOPYABLE(JitAllocatorSlabClass)
+
+  //! Slabs that have at least one unused object - partially used slabs first, empty slabs last.
+  ArenaList<JitAllocatorSlab> slabs;
+  //! Count of empty slabs (either 0 or 1 as we won't keep more slabs empty).
+  uint32_t empty_slab_count = 0;
+
+  ASMJIT_INLINE_NODEBUG JitAllocatorSlabClass() noexcept {}
+
+  ASMJIT_INLINE void reset() noexcept {
+    slabs.reset();
+    empty_slab_count = 0;
+  }
+};
+
+// JitAllocator - Snapshot
+// =======================
+
+//! An immutable array of all blocks sorted by their RX addresses, which is used by lock-free queries instead of the
+//! RB tree that is modified in place.
+//!
+//! A new snapshot is published each time a block is inserted or removed and the previous one is freed once there is
+//! no lock-free query that could still read it. Blocks are freed the same way, thus a lock-free query can always
+//! dereference blocks of the snapshot it has loaded.
+struct JitAllocatorSnapshot {
+  //! Number of blocks.
+  size_t block_count;
+  //! Blocks sorted by their RX addresses (the array has `block_count` elements).
+  JitAllocatorBlock* blocks[1];
+
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG size_t size_of(size_t block_count) noexcept {
+    return sizeof(JitAllocatorSnapshot) + (Support::max<size_t>(block_count, 1u) - 1u) * sizeof(JitAllocatorBlock*);
+  }
+
+  //! Returns a block that contains `rx`, or null if there is no such block.
+  [[nodiscard]]
+  inline JitAllocatorBlock* find(const void* rx) const noexcept {
+    const uint8_t* p = static_cast<const uint8_t*>(rx);
+    size_t lo = 0;
+    size_t hi = block_count;
+
+    while (lo < hi) {
+      size_t mid = (lo + hi) / 2u;
+      JitAllocatorBlock* block = blocks[mid];
+
+      if (p < block->rx_ptr()) {
+        hi = mid;
+      }
+      else if (p >= block->rx_ptr() + block->block_size()) {
+        lo = mid + 1u;
+      }
+      else {
+        return block;
+      }
+    }
+
+    return nullptr;
+  }
+};
+
+//! Snapshot of an allocator that has no blocks.
+static const JitAllocatorSnapshot JitAllocatorSnapshot_empty {};
+
 // JitAllocator - PrivateImpl
 // ==========================
 
@@ -468,8 +790,18 @@ public:
   mutable Lock lock;
   //! System page size (also a minimum block size).
   uint32_t page_size;
+  //! Address the blocks should be placed near to (zero if not used).
+  uintptr_t anchor;
+  //! Maximum distance of all bytes of a block from `anchor`.
+  size_t anchor_range;
   //! Number of active allocations.
   size_t allocation_count;
+  //! Number of `compact()` calls.
+  size_t compaction_count;
+  //! Number of bytes moved by `compact()`.
+  size_t relocated_size;
+  //! Heap memory used by slabs and slab tables of blocks (in bytes).
+  size_t slab_overhead_bytes;
 
   //! Blocks from all pools in RBTree.
   ArenaTree<JitAllocatorBlock> tree;
@@ -477,15 +809,35 @@ public:
   JitAllocatorPool* pools;
   //! Number of allocator pools.
   size_t pool_count;
+  //! Slab size classes (only used when `JitAllocatorOptions::kUseSlabs` is set).
+  JitAllocatorSlabClass slab_classes[kJitAllocatorSlabClassCount];
+
+  //! Blocks read by lock-free queries (null if the snapshot couldn't be allocated).
+  std::atomic<const JitAllocatorSnapshot*> snapshot;
+  //! Sequence number incremented before and after each modification of blocks, thus odd during a modification.
+  std::atomic<uint32_t> sequence;
+  //! Epoch of lock-free queries, incremented by a writer to start a grace period.
+  std::atomic<uint32_t> reader_epoch;
+  //! Number of lock-free queries in progress, indexed by the parity of the epoch they have started in.
+  mutable std::atomic<size_t> reader_count[2];
 
   //! \}
 
   ASMJIT_INLINE JitAllocatorPrivateImpl(JitAllocatorPool* pools, size_t pool_count) noexcept
     : JitAllocator::Impl {},
       page_size(0),
+      anchor(0),
+      anchor_range(0),
       allocation_count(0),
+      compaction_count(0),
+      relocated_size(0),
+      slab_overhead_bytes(0),
       pools(pools),
-      pool_count(pool_count) {}
+      pool_count(pool_count),
+      snapshot(&JitAllocatorSnapshot_empty),
+      sequence(0),
+      reader_epoch(0),
+      reader_count{} {}
   ASMJIT_INLINE ~JitAllocatorPrivateImpl() noexcept {}
 };
 
@@ -554,6 +906,11 @@ static inline JitAllocatorPrivateImpl* JitAllocator_new_impl(const JitAllocator:
   impl->fill_pattern = fill_pattern;
   impl->page_size = vm_info.page_size;
 
+  if (params->anchor && !Support::test(options, JitAllocatorOptions::kUseDualMapping)) {
+    impl->anchor = uintptr_t(params->anchor);
+    impl->anchor_range = params->anchor_range ? params->anchor_range : kJitAllocatorDefaultAnchorRange;
+  }
+
   for (size_t pool_id = 0; pool_id < pool_count; pool_id++) {
     new(Support::PlacementNew{&pools[pool_id]}) JitAllocatorPool(granularity << pool_id);
   }
@@ -610,6 +967,18 @@ static ASMJIT_INLINE size_t JitAllocator_calculate_ideal_block_size(JitAllocator
     }
   }
 
+  // Grow blocks in large page multiples so each large page of a block can be backed by a transparent huge page.
+  if (Support::test(impl->options, JitAllocatorOptions::kUseTransparentHugePages)) {
+    size_t large_page_size = VirtMem::large_page_size();
+    if (large_page_size) {
+      size_t aligned_block_size = Support::align_up(block_size, large_page_size);
+      if (ASMJIT_UNLIKELY(aligned_block_size < block_size)) {
+        return 0; // Overflown.
+      }
+      block_size = aligned_block_size;
+    }
+  }
+
   return block_size;
 }
 
@@ -641,6 +1010,18 @@ ASMJIT_FAVOR_SPEED static void JitAllocator_fill_pattern(void* mem, uint32_t pat
   }
 }
 
+// Allocates virtual memory of a block, near the anchor if the allocator has one.
+static Error JitAllocator_alloc_virt_mem(JitAllocatorPrivateImpl* impl, void** p, size_t size, VirtMem::MemoryFlags mem_flags) noexcept {
+  if (impl->anchor) {
+    // Fallback to the default placement if there is no free address range near the anchor.
+    if (VirtMem::alloc_near(p, size, mem_flags, reinterpret_cast<const void*>(impl->anchor), impl->anchor_range) == Error::kOk) {
+      return Error::kOk;
+    }
+  }
+
+  return VirtMem::alloc(p, size, mem_flags);
+}
+
 // Allocate a new `JitAllocatorBlock` for the given `block_size`.
 //
 // NOTE: The block doesn't have `kFlagEmpty` flag set, because the new block
@@ -657,6 +1038,15 @@ static Error JitAllocator_new_block(JitAllocatorPrivateImpl* impl, JitAllocatorB
   VirtMem::DualMapping virt_mem {};
   VirtMem::MemoryFlags mem_flags = VirtMem::MemoryFlags::kAccessRWX;
 
+  if (Support::test(impl->options, JitAllocatorOptions::kUseTransparentHugePages) && VirtMem::large_page_size() != 0u) {
+    mem_flags |= VirtMem::MemoryFlags::kMMapTransparentHugePages;
+    block_flags |= JitAllocatorBlock::kFlagTransparentHugePages;
+  }
+
+  if (Support::test(impl->options, JitAllocatorOptions::kPrefaultBlocks)) {
+    mem_flags |= VirtMem::MemoryFlags::kMMapPopulate;
+  }
+
   if (Support::test(impl->options, JitAllocatorOptions::kUseDualMapping)) {
     ASMJIT_PROPAGATE(VirtMem::alloc_dual_mapping(Out(virt_mem), block_size, mem_flags));
     block_flags |= JitAllocatorBlock::kFlagDualMapped;
@@ -670,28 +1060,36 @@ static Error JitAllocator_new_block(JitAllocatorPrivateImpl* impl, JitAllocatorB
       // Only proceed if we can actually allocate large pages.
       if (large_page_size && try_large_page) {
         size_t large_block_size = Support::align_up(block_size, large_page_size);
-        Error err = VirtMem::alloc(&virt_mem.rx, large_block_size, mem_flags | VirtMem::MemoryFlags::kMMapLargePages);
+        Error err = JitAllocator_alloc_virt_mem(impl, &virt_mem.rx, large_block_size, mem_flags | VirtMem::MemoryFlags::kMMapLargePages);
 
         // Fallback to regular pages if large page(s) allocation failed.
         if (err == Error::kOk) {
           allocate_regular_pages = false;
           block_size = large_block_size;
-          block_flags |= JitAllocatorBlock::kFlagLargePages;
+          block_flags = (block_flags & ~uint32_t(JitAllocatorBlock::kFlagTransparentHugePages)) | JitAllocatorBlock::kFlagLargePages;
         }
       }
     }
 
     // Called either if large pages were not requested or large page(s) allocation failed.
     if (allocate_regular_pages) {
-      ASMJIT_PROPAGATE(VirtMem::alloc(&virt_mem.rx, block_size, mem_flags));
+      ASMJIT_PROPAGATE(JitAllocator_alloc_virt_mem(impl, &virt_mem.rx, block_size, mem_flags));
     }
 
     virt_mem.rw = virt_mem.rx;
   }
 
+  // Only blocks that use regular pages of a private mapping can be purged - discarding a part of a transparent huge
+  // page would split it.
+  uint32_t page_count = 0;
+  if (!(block_flags & (JitAllocatorBlock::kFlagDualMapped | JitAllocatorBlock::kFlagLargePages | JitAllocatorBlock::kFlagTransparentHugePages))) {
+    page_count = uint32_t(block_size >> Support::ctz(impl->page_size));
+  }
+
   uint32_t area_size = uint32_t((block_size + pool->granularity - 1) >> pool->granularity_log2);
   uint32_t bit_word_count = (area_size + kBitWordSizeInBits - 1u) / kBitWordSizeInBits;
-  uint8_t* block_ptr = static_cast<uint8_t*>(::malloc(sizeof(JitAllocatorBlock) + size_t(bit_word_count) * 2u * sizeof(BitWord)));
+  uint32_t page_bit_word_count = (page_count + kBitWordSizeInBits - 1u) / kBitWordSizeInBits;
+  uint8_t* block_ptr = static_cast<uint8_t*>(::malloc(sizeof(JitAllocatorBlock) + (size_t(bit_word_count) * 2u + page_bit_word_count) * sizeof(BitWord)));
 
   // Out of memory...
   if (ASMJIT_UNLIKELY(block_ptr == nullptr)) {
@@ -711,12 +1109,34 @@ static Error JitAllocator_new_block(JitAllocatorPrivateImpl* impl, JitAllocatorB
   }
 
   BitWord* bit_words = reinterpret_cast<BitWord*>(block_ptr + sizeof(JitAllocatorBlock));
-  *dst = new(Support::PlacementNew{block_ptr}) JitAllocatorBlock(pool, virt_mem, block_size, block_flags, bit_words, bit_words + bit_word_count, area_size);
+  *dst = new(Support::PlacementNew{block_ptr}) JitAllocatorBlock(pool, virt_mem, block_size, block_flags, bit_words, bit_words + bit_word_count, bit_words + bit_word_count * 2u, area_size, page_count);
   return Error::kOk;
 }
 
+// Frees all slabs placed in `block` and its slab table.
+//
+// NOTE: This doesn't unlink the slabs from their size classes, thus it can only be used when the block is being
+// deleted or wiped out by `JitAllocator::reset()`, which resets all size classes.
+static void JitAllocatorImpl_freeSlabs(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
+  if (!block->_slabs) {
+    return;
+  }
+
+  size_t slab_table_size = block->slab_table_size();
+  for (size_t i = 0; i < slab_table_size; i++) {
+    if (block->_slabs[i]) {
+      ::free(block->_slabs[i]);
+      impl->slab_overhead_bytes -= sizeof(JitAllocatorSlab);
+    }
+  }
+
+  ::free(block->_slabs);
+  JitAllocator_store_relaxed(&block->_slabs, static_cast<JitAllocatorSlab**>(nullptr));
+  impl->slab_overhead_bytes -= slab_table_size * sizeof(JitAllocatorSlab*);
+}
+
 static void JitAllocatorImpl_deleteBlock(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
-  Support::maybe_unused(impl);
+  JitAllocatorImpl_freeSlabs(impl, block);
 
   if (block->has_flag(JitAllocatorBlock::kFlagDualMapped)) {
     (void)VirtMem::release_dual_mapping(block->_mapping, block->block_size());
@@ -728,6 +1148,129 @@ static void JitAllocatorImpl_deleteBlock(JitAllocatorPrivateImpl* impl, JitAlloc
   ::free(block);
 }
 
+static ASMJIT_INLINE size_t JitAllocator_block_overhead(const JitAllocatorBlock* block) noexcept {
+  return sizeof(JitAllocatorBlock) + JitAllocator_bit_vector_size_to_byte_size(block->area_size()) * 2u
+                                   + JitAllocator_bit_vector_size_to_byte_size(block->page_count());
+}
+
+// Marks a modification of blocks (the writer side of a sequence lock), which makes lock-free queries that read blocks
+// concurrently to retry. Must only be used while the allocator is locked, thus there is always a single writer.
+class JitAllocatorWriteSection {
+public:
+  ASMJIT_NONCOPYABLE(JitAllocatorWriteSection)
+
+  JitAllocatorPrivateImpl* _impl;
+  uint32_t _sequence;
+
+  ASMJIT_INLINE explicit JitAllocatorWriteSection(JitAllocatorPrivateImpl* impl) noexcept
+    : _impl(impl),
+      _sequence(impl->sequence.load(std::memory_order_relaxed)) {
+    impl->sequence.store(_sequence + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  ASMJIT_INLINE ~JitAllocatorWriteSection() noexcept {
+    _impl->sequence.store(_sequence + 2u, std::memory_order_release);
+  }
+};
+
+// Counts a lock-free query in progress in the current epoch, which prevents freeing of blocks and snapshots it can
+// access until the query ends.
+class JitAllocatorReadSection {
+public:
+  ASMJIT_NONCOPYABLE(JitAllocatorReadSection)
+
+  const JitAllocatorPrivateImpl* _impl;
+  std::atomic<size_t>* _counter;
+
+  ASMJIT_INLINE explicit JitAllocatorReadSection(const JitAllocatorPrivateImpl* impl) noexcept
+    : _impl(impl) {
+    for (;;) {
+      uint32_t epoch = impl->reader_epoch.load(std::memory_order_seq_cst);
+      _counter = &impl->reader_count[epoch & 1u];
+      _counter->fetch_add(1u, std::memory_order_seq_cst);
+
+      // A writer that has started a grace period after the epoch was loaded won't wait for this counter, so the
+      // query has to register again in the new epoch. The query hasn't read anything yet, so this is safe.
+      if (ASMJIT_LIKELY(impl->reader_epoch.load(std::memory_order_seq_cst) == epoch)) {
+        break;
+      }
+
+      _counter->fetch_sub(1u, std::memory_order_release);
+    }
+  }
+
+  ASMJIT_INLINE ~JitAllocatorReadSection() noexcept {
+    _counter->fetch_sub(1u, std::memory_order_release);
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE const JitAllocatorSnapshot* snapshot() const noexcept {
+    return _impl->snapshot.load(std::memory_order_seq_cst);
+  }
+};
+
+// Waits for a grace period - until all lock-free queries that have started before the call have ended, which makes
+// it possible to free memory that was made unreachable before the call. Queries that start during the wait register
+// in the next epoch, which cannot reach the memory anymore, so they are not waited for and cannot starve the writer.
+//
+// Must only be called while the allocator is locked, thus there is always a single writer changing the epoch.
+static void JitAllocatorImpl_waitForReaders(JitAllocatorPrivateImpl* impl) noexcept {
+  uint32_t epoch = impl->reader_epoch.load(std::memory_order_relaxed);
+  impl->reader_epoch.store(epoch + 1u, std::memory_order_seq_cst);
+
+  const std::atomic<size_t>& counter = impl->reader_count[epoch & 1u];
+  while (counter.load(std::memory_order_seq_cst) != 0u) {
+    std::this_thread::yield();
+  }
+}
+
+// Publishes `snapshot` and frees the previously published snapshot.
+static void JitAllocatorImpl_publishSnapshot(JitAllocatorPrivateImpl* impl, const JitAllocatorSnapshot* snapshot) noexcept {
+  const JitAllocatorSnapshot* prev = impl->snapshot.exchange(snapshot, std::memory_order_seq_cst);
+  JitAllocatorImpl_waitForReaders(impl);
+
+  if (prev && prev != &JitAllocatorSnapshot_empty) {
+    ::free(const_cast<JitAllocatorSnapshot*>(prev));
+  }
+}
+
+// Builds a snapshot of all blocks and publishes it, must be called after a block has been inserted or removed.
+static void JitAllocatorImpl_updateSnapshot(JitAllocatorPrivateImpl* impl) noexcept {
+  size_t block_count = 0;
+  for (size_t pool_id = 0; pool_id < impl->pool_count; pool_id++) {
+    block_count += impl->pools[pool_id].block_count;
+  }
+
+  if (!block_count) {
+    JitAllocatorImpl_publishSnapshot(impl, &JitAllocatorSnapshot_empty);
+    return;
+  }
+
+  // Lock-free queries fall back to locking when there is no snapshot, which is better than using a stale one.
+  JitAllocatorSnapshot* snapshot = static_cast<JitAllocatorSnapshot*>(::malloc(JitAllocatorSnapshot::size_of(block_count)));
+  if (ASMJIT_UNLIKELY(!snapshot)) {
+    JitAllocatorImpl_publishSnapshot(impl, nullptr);
+    return;
+  }
+
+  size_t i = 0;
+  for (size_t pool_id = 0; pool_id < impl->pool_count; pool_id++) {
+    for (JitAllocatorBlock* block = impl->pools[pool_id].blocks.first(); block; block = block->next()) {
+      snapshot->blocks[i++] = block;
+    }
+  }
+
+  ASMJIT_ASSERT(i == block_count);
+  snapshot->block_count = block_count;
+
+  Support::sort(snapshot->blocks, block_count, [](const JitAllocatorBlock* a, const JitAllocatorBlock* b) noexcept {
+    return int(a->rx_ptr() > b->rx_ptr()) - int(a->rx_ptr() < b->rx_ptr());
+  });
+
+  JitAllocatorImpl_publishSnapshot(impl, snapshot);
+}
+
 static void JitAllocatorImpl_insertBlock(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
   JitAllocatorPool* pool = block->pool();
 
@@ -744,7 +1287,10 @@ static void JitAllocatorImpl_insertBlock(JitAllocatorPrivateImpl* impl, JitAlloc
   pool->block_count++;
   pool->total_area_size[stat_index] += block->area_size();
   pool->total_area_used[stat_index] += block->area_used();
-  pool->total_overhead_bytes += sizeof(JitAllocatorBlock) + JitAllocator_bit_vector_size_to_byte_size(block->area_size()) * 2u;
+  pool->total_overhead_bytes += JitAllocator_block_overhead(block);
+  pool->total_purged_bytes += size_t(block->purged_page_count()) << Support::ctz(impl->page_size);
+
+  JitAllocatorImpl_updateSnapshot(impl);
 }
 
 static void JitAllocatorImpl_removeBlock(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
@@ -763,7 +1309,11 @@ static void JitAllocatorImpl_removeBlock(JitAllocatorPrivateImpl* impl, JitAlloc
   pool->block_count--;
   pool->total_area_size[stat_index] -= block->area_size();
   pool->total_area_used[stat_index] -= block->area_used();
-  pool->total_overhead_bytes -= sizeof(JitAllocatorBlock) + JitAllocator_bit_vector_size_to_byte_size(block->area_size()) * 2u;
+  pool->total_overhead_bytes -= JitAllocator_block_overhead(block);
+  pool->total_purged_bytes -= size_t(block->purged_page_count()) << Support::ctz(impl->page_size);
+
+  // The block can be deleted after it's no longer reachable by lock-free queries.
+  JitAllocatorImpl_updateSnapshot(impl);
 }
 
 static void JitAllocatorImpl_wipeOutBlock(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
@@ -771,6 +1321,8 @@ static void JitAllocatorImpl_wipeOutBlock(JitAllocatorPrivateImpl* impl, JitAllo
     return;
   }
 
+  JitAllocatorImpl_freeSlabs(impl, block);
+
   JitAllocatorPool* pool = block->pool();
   if (Support::test(impl->options, JitAllocatorOptions::kFillUnusedMemory)) {
     VirtMem::protect_jit_memory(VirtMem::ProtectJitAccess::kReadWrite);
@@ -790,11 +1342,47 @@ static void JitAllocatorImpl_wipeOutBlock(JitAllocatorPrivateImpl* impl, JitAllo
       VirtMem::flush_instruction_cache(span_ptr, span_size);
     }
     VirtMem::protect_jit_memory(VirtMem::ProtectJitAccess::kReadExecute);
+
+    // Filling made all pages resident again.
+    block->clear_purged_pages();
   }
 
   block->clear_block();
 }
 
+// Makes pages overlapping `[area_start, area_end)` that were discarded by `JitAllocator::purge()` resident again.
+static void JitAllocatorImpl_revivePages(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block, uint32_t area_start, uint32_t area_end) noexcept {
+  JitAllocatorPool* pool = block->pool();
+
+  uint32_t page_size_log2 = Support::ctz(impl->page_size);
+  uint32_t page_area_shift = page_size_log2 - pool->granularity_log2;
+
+  size_t page_start = area_start >> page_area_shift;
+  size_t page_end = ((area_end - 1u) >> page_area_shift) + 1u;
+
+  BitVectorRangeIterator<Support::BitWord, 1> it(block->_purged_bit_vector, pool->bit_word_count_from_area_size(block->page_count()), page_start, page_end);
+
+  size_t range_start;
+  size_t range_end;
+
+  while (it.next_range(Out(range_start), Out(range_end))) {
+    size_t range_size = range_end - range_start;
+
+    Support::bit_vector_clear(block->_purged_bit_vector, range_start, range_size);
+    block->_purged_page_count -= uint32_t(range_size);
+    pool->total_purged_bytes -= range_size << page_size_log2;
+
+    // The content of discarded pages is undefined, so fill them again if the secure mode is enabled.
+    if (Support::test(impl->options, JitAllocatorOptions::kFillUnusedMemory)) {
+      uint8_t* span_ptr = block->rw_ptr() + (range_start << page_size_log2);
+      size_t span_size = range_size << page_size_log2;
+
+      VirtMem::ProtectJitReadWriteScope scope(span_ptr, span_size);
+      JitAllocator_fill_pattern(span_ptr, impl->fill_pattern, span_size);
+    }
+  }
+}
+
 // JitAllocator - Construction & Destruction
 // =========================================
 
@@ -823,9 +1411,21 @@ void JitAllocator::reset(ResetPolicy reset_policy) noexcept {
   }
 
   JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+  JitAllocatorWriteSection write_section(impl);
+
+  // Blocks are deleted or wiped out, thus they must not be reachable by lock-free queries.
+  JitAllocatorImpl_publishSnapshot(impl, &JitAllocatorSnapshot_empty);
+
   impl->tree.reset();
   size_t pool_count = impl->pool_count;
 
+  for (JitAllocatorSlabClass& slab_class : impl->slab_classes) {
+    slab_class.reset();
+  }
+
+  // Kept blocks are inserted after all pools were reset as each insertion publishes blocks of all pools.
+  JitAllocatorBlock* blocks_to_keep[kJitAllocatorMultiPoolCount] {};
+
   for (size_t pool_id = 0; pool_id < pool_count; pool_id++) {
     JitAllocatorPool& pool = impl->pools[pool_id];
     JitAllocatorBlock* block = pool.blocks.first();
@@ -833,9 +1433,8 @@ void JitAllocator::reset(ResetPolicy reset_policy) noexcept {
     pool.reset();
 
     if (block) {
-      JitAllocatorBlock* block_to_keep = nullptr;
       if (reset_policy != ResetPolicy::kHard && uint32_t(impl->options & JitAllocatorOptions::kImmediateRelease) == 0) {
-        block_to_keep = block;
+        blocks_to_keep[pool_id] = block;
         block = block->next();
       }
 
@@ -844,14 +1443,18 @@ void JitAllocator::reset(ResetPolicy reset_policy) noexcept {
         JitAllocatorImpl_deleteBlock(impl, block);
         block = next;
       }
+    }
+  }
 
-      if (block_to_keep) {
-        block_to_keep->_list_nodes[0] = nullptr;
-        block_to_keep->_list_nodes[1] = nullptr;
-        JitAllocatorImpl_wipeOutBlock(impl, block_to_keep);
-        JitAllocatorImpl_insertBlock(impl, block_to_keep);
-        pool.empty_block_count = 1;
-      }
+  for (size_t pool_id = 0; pool_id < pool_count; pool_id++) {
+    JitAllocatorBlock* block_to_keep = blocks_to_keep[pool_id];
+
+    if (block_to_keep) {
+      block_to_keep->_list_nodes[0] = nullptr;
+      block_to_keep->_list_nodes[1] = nullptr;
+      JitAllocatorImpl_wipeOutBlock(impl, block_to_keep);
+      JitAllocatorImpl_insertBlock(impl, block_to_keep);
+      impl->pools[pool_id].empty_block_count = 1;
     }
   }
 }
@@ -872,11 +1475,21 @@ JitAllocator::Statistics JitAllocator::statistics() const noexcept {
       const JitAllocatorPool& pool = impl->pools[pool_id];
       statistics._block_count   += size_t(pool.block_count);
       statistics._reserved_size += size_t(pool.total_area_size[0] + pool.total_area_size[1]) * pool.granularity;
+      statistics._resident_size += size_t(pool.total_area_size[0] + pool.total_area_size[1]) * pool.granularity - pool.total_purged_bytes;
       statistics._used_size     += size_t(pool.total_area_used[0] + pool.total_area_used[1]) * pool.granularity;
       statistics._overhead_size += size_t(pool.total_overhead_bytes);
+
+      for (const JitAllocatorBlock* block = pool.blocks.first(); block; block = block->next()) {
+        if (!block->is_empty()) {
+          statistics._fragmented_size += size_t(block->area_available()) * pool.granularity;
+        }
+      }
     }
 
+    statistics._overhead_size += impl->slab_overhead_bytes;
     statistics._allocation_count = impl->allocation_count;
+    statistics._compaction_count = impl->compaction_count;
+    statistics._relocated_size = impl->relocated_size;
   }
 
   return statistics;
@@ -885,94 +1498,366 @@ JitAllocator::Statistics JitAllocator::statistics() const noexcept {
 // JitAllocator - Alloc & Release
 // ==============================
 
-Error JitAllocator::alloc(Out<Span> out, size_t size) noexcept {
-  constexpr uint32_t no_index = std::numeric_limits<uint32_t>::max();
-  constexpr size_t max_request_size = std::numeric_limits<uint32_t>::max() / 2u;
-
-  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
-  bool not_initialized = _impl == &JitAllocatorImpl_none;
-
-  // Align to the minimum granularity by default.
-  size = Support::align_up<size_t>(size, impl->granularity);
-  out = Span{};
+// Searches existing blocks of `pool` for an unused area of `area_size`, skipping blocks having any of `skip_flags`.
+static JitAllocatorBlock* JitAllocatorImpl_findArea(JitAllocatorPool* pool, uint32_t area_size, uint32_t skip_flags, uint32_t* area_index_out) noexcept {
+  JitAllocatorBlock* block = pool->cursor;
 
-  if (ASMJIT_UNLIKELY(Support::bool_or(not_initialized, size - 1u >= max_request_size))) {
-    return make_error(not_initialized ? Error::kNotInitialized  :
-                      size == 0u      ? Error::kInvalidArgument : Error::kTooLarge);
+  if (!block) {
+    return nullptr;
   }
 
-  LockGuard guard(impl->lock);
-  JitAllocatorPool* pool = &impl->pools[JitAllocator_size_to_pool_id(impl, size)];
-
-  uint32_t area_index = no_index;
-  uint32_t area_size = uint32_t(pool->area_size_from_byte_size(size));
-
-  // Try to find the requested memory area in existing blocks.
-  JitAllocatorBlock* block = pool->cursor;
-
-  if (block) {
-    JitAllocatorBlock* initial = block;
+  JitAllocatorBlock* initial = block;
 
-    do {
-      uint32_t largest_unused_area = block->largest_unused_area();
+  do {
+    uint32_t largest_unused_area = block->largest_unused_area();
 
-      if (Support::bool_and(block->is_incremental(), largest_unused_area >= area_size)) {
-        // Fast path: If the block is in incremental mode, which means that it's guaranteed it's full before
-        // `search_start` and completely empty after it, we can just quickly increment `search_start` and be
-        // done with the allocation. This is a little bit faster than constructing a BitVectorRangeIterator
-        // and searching for zero bit clusters. When a block is in incremental mode its `largest_unused_area`
-        // is basically the free space after `search_start`, so that's the only thing to check.
-        area_index = block->_search_start;
-        block->_largest_unused_area -= area_size;
-        break;
-      }
-      else if (block->area_available() >= area_size) {
-        // Regular path: Search for a cluster of bits that would mark an empty area we want to allocate.
-        if (Support::bool_or(block->is_dirty(), largest_unused_area >= area_size)) {
-          BitVectorRangeIterator<Support::BitWord, 0> it(block->_used_bit_vector, pool->bit_word_count_from_area_size(block->area_size()), block->_search_start, block->_search_end);
-
-          size_t range_start = 0;
-          size_t range_end = block->area_size();
-
-          size_t search_start = SIZE_MAX;
-          size_t largest_area = 0;
-
-          while (it.next_range(Out(range_start), Out(range_end), area_size)) {
-            size_t range_size = range_end - range_start;
-            if (range_size >= area_size) {
-              area_index = uint32_t(range_start);
-              break;
-            }
-
-            search_start = Support::min(search_start, range_start);
-            largest_area = Support::max(largest_area, range_size);
+    if (block->has_flag(skip_flags)) {
+      // Skip the block, it cannot be used (only happens during compaction).
+    }
+    else if (Support::bool_and(block->is_incremental(), largest_unused_area >= area_size)) {
+      // Fast path: If the block is in incremental mode, which means that it's guaranteed it's full before
+      // `search_start` and completely empty after it, we can just quickly increment `search_start` and be
+      // done with the allocation. This is a little bit faster than constructing a BitVectorRangeIterator
+      // and searching for zero bit clusters. When a block is in incremental mode its `largest_unused_area`
+      // is basically the free space after `search_start`, so that's the only thing to check.
+      *area_index_out = block->_search_start;
+      block->_largest_unused_area -= area_size;
+      return block;
+    }
+    else if (block->area_available() >= area_size) {
+      // Regular path: Search for a cluster of bits that would mark an empty area we want to allocate.
+      if (Support::bool_or(block->is_dirty(), largest_unused_area >= area_size)) {
+        BitVectorRangeIterator<Support::BitWord, 0> it(block->_used_bit_vector, pool->bit_word_count_from_area_size(block->area_size()), block->_search_start, block->_search_end);
+
+        size_t range_start = 0;
+        size_t range_end = block->area_size();
+
+        size_t search_start = SIZE_MAX;
+        size_t largest_area = 0;
+
+        while (it.next_range(Out(range_start), Out(range_end), area_size)) {
+          size_t range_size = range_end - range_start;
+          if (range_size >= area_size) {
+            *area_index_out = uint32_t(range_start);
+            return block;
           }
 
-          if (area_index != no_index) {
-            break;
-          }
+          search_start = Support::min(search_start, range_start);
+          largest_area = Support::max(largest_area, range_size);
+        }
 
-          if (search_start != SIZE_MAX) {
-            // Because we have iterated over the entire block, we can now mark the
-            // largest unused area that can be used to cache the next traversal.
-            size_t search_end = range_end;
+        if (search_start != SIZE_MAX) {
+          // Because we have iterated over the entire block, we can now mark the
+          // largest unused area that can be used to cache the next traversal.
+          size_t search_end = range_end;
 
-            block->_search_start = uint32_t(search_start);
-            block->_search_end = uint32_t(search_end);
-            block->_largest_unused_area = uint32_t(largest_area);
-            block->clear_flags(JitAllocatorBlock::kFlagDirty);
-          }
+          block->_search_start = uint32_t(search_start);
+          block->_search_end = uint32_t(search_end);
+          block->_largest_unused_area = uint32_t(largest_area);
+          block->clear_flags(JitAllocatorBlock::kFlagDirty);
         }
       }
+    }
 
-      // The block cursor doesn't have to start with the first block and we want to
-      // iterate all before concluding that there is no free space in any block.
-      block = block->has_next() ? block->next() : pool->blocks.first();
-    } while (block != initial);
-  }
+    // The block cursor doesn't have to start with the first block and we want to
+    // iterate all before concluding that there is no free space in any block.
+    block = block->has_next() ? block->next() : pool->blocks.first();
+  } while (block != initial);
 
-  // Allocate a new block if there is no region of a required size.
-  if (area_index == no_index) {
+  return nullptr;
+}
+
+// Marks `[area_index, area_index + area_size)` found by `JitAllocatorImpl_findArea()` as used and returns its span.
+static void JitAllocatorImpl_useArea(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block, uint32_t area_index, uint32_t area_size, JitAllocator::Span& out) noexcept {
+  JitAllocatorPool* pool = block->pool();
+
+  // Update statistics.
+  impl->allocation_count++;
+  block->mark_allocated_area(area_index, area_index + area_size);
+
+  if (block->purged_page_count()) {
+    JitAllocatorImpl_revivePages(impl, block, area_index, area_index + area_size);
+  }
+
+  // Return a span referencing the allocated memory.
+  size_t offset = pool->byte_size_from_area_size(area_index);
+  size_t size = pool->byte_size_from_area_size(area_size);
+  ASMJIT_ASSERT(offset <= block->block_size() - size);
+
+  out._rx = block->rx_ptr() + offset;
+  out._rw = block->rw_ptr() + offset;
+  out._size = size;
+  out._block = static_cast<void*>(block);
+}
+
+// Releases `[area_index, area_end)` of `block`, but doesn't release the block if it became empty.
+static void JitAllocatorImpl_releaseArea(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block, uint32_t area_index, uint32_t area_end) noexcept {
+  JitAllocatorPool* pool = block->pool();
+  uint32_t area_size = area_end - area_index;
+
+  impl->allocation_count--;
+  block->mark_released_area(area_index, area_end);
+
+  // Fill the released memory if the secure mode is enabled.
+  if (Support::test(impl->options, JitAllocatorOptions::kFillUnusedMemory)) {
+    uint8_t* span_ptr = block->rw_ptr() + area_index * pool->granularity;
+    size_t span_size = area_size * pool->granularity;
+
+    VirtMem::ProtectJitReadWriteScope scope(span_ptr, span_size);
+    JitAllocator_fill_pattern(span_ptr, impl->fill_pattern, span_size);
+  }
+}
+
+// Releases `block` if it's empty and the pool already has an empty block (or immediate release is enabled).
+static void JitAllocatorImpl_releaseBlockIfEmpty(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block) noexcept {
+  if (block->is_empty()) {
+    JitAllocatorPool* pool = block->pool();
+
+    if (pool->empty_block_count || Support::test(impl->options, JitAllocatorOptions::kImmediateRelease)) {
+      JitAllocatorImpl_removeBlock(impl, block);
+      JitAllocatorImpl_deleteBlock(impl, block);
+    }
+    else {
+      pool->empty_block_count++;
+    }
+  }
+}
+
+// Searches blocks of `pool` for an unused area of `area_size` aligned to `area_size`.
+//
+// NOTE: Unlike `JitAllocatorImpl_findArea()` this doesn't update search hints of blocks as an aligned area may not
+// be found even if the largest unused area is big enough. Blocks are searched from the last one as the most recently
+// allocated blocks are the most likely to have space.
+static JitAllocatorBlock* JitAllocatorImpl_findSlabArea(JitAllocatorPool* pool, uint32_t area_size, uint32_t* area_index_out) noexcept {
+  for (JitAllocatorBlock* block = pool->blocks.last(); block; block = block->prev()) {
+    if (block->area_available() < area_size || (!block->is_dirty() && block->largest_unused_area() < area_size)) {
+      continue;
+    }
+
+    BitVectorRangeIterator<Support::BitWord, 0> it(block->_used_bit_vector, pool->bit_word_count_from_area_size(block->area_size()), block->_search_start, block->_search_end);
+
+    size_t range_start;
+    size_t range_end;
+
+    while (it.next_range(Out(range_start), Out(range_end))) {
+      size_t aligned_start = Support::align_up(range_start, area_size);
+      if (aligned_start < range_end && range_end - aligned_start >= area_size) {
+        *area_index_out = uint32_t(aligned_start);
+        return block;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+// Creates a new slab of the given `class_id` and adds it to its size class.
+static Error JitAllocatorImpl_newSlab(JitAllocatorPrivateImpl* impl, uint32_t class_id, JitAllocatorSlab** out) noexcept {
+  // Slabs always use the first pool, which has the smallest granularity.
+  JitAllocatorPool* pool = &impl->pools[0];
+  uint32_t area_size = pool->area_size_from_byte_size(kJitAllocatorSlabSize);
+
+  void* p = ::malloc(sizeof(JitAllocatorSlab));
+  if (ASMJIT_UNLIKELY(!p)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  uint32_t area_index = 0;
+  JitAllocatorBlock* block = JitAllocatorImpl_findSlabArea(pool, area_size, &area_index);
+  bool is_new_block = false;
+
+  if (!block) {
+    // Twice the slab size guarantees that an aligned slab fits even when the block has an initial padding.
+    size_t block_size = JitAllocator_calculate_ideal_block_size(impl, pool, kJitAllocatorSlabSize * 2u);
+    Error err = block_size ? JitAllocator_new_block(impl, &block, pool, block_size) : make_error(Error::kOutOfMemory);
+
+    if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+      ::free(p);
+      return err;
+    }
+
+    area_index = Support::align_up(block->initial_area_start(), area_size);
+    is_new_block = true;
+    JitAllocatorImpl_insertBlock(impl, block);
+  }
+
+  if (!block->_slabs) {
+    size_t slab_table_size = block->slab_table_size();
+    JitAllocatorSlab** slabs = static_cast<JitAllocatorSlab**>(::calloc(slab_table_size, sizeof(JitAllocatorSlab*)));
+
+    if (ASMJIT_UNLIKELY(!slabs)) {
+      if (is_new_block) {
+        JitAllocatorImpl_removeBlock(impl, block);
+        JitAllocatorImpl_deleteBlock(impl, block);
+      }
+      ::free(p);
+      return make_error(Error::kOutOfMemory);
+    }
+
+    JitAllocator_store_relaxed(&block->_slabs, slabs);
+    impl->slab_overhead_bytes += slab_table_size * sizeof(JitAllocatorSlab*);
+  }
+
+  if (!is_new_block && block->is_empty()) {
+    pool->empty_block_count--;
+  }
+
+  // The slab is not placed at the start of the unused area in most cases, which breaks the incremental mode.
+  if (Support::bool_and(block->is_incremental(), area_index == block->_search_start)) {
+    block->_largest_unused_area -= area_size;
+  }
+  else {
+    block->clear_flags(JitAllocatorBlock::kFlagIncremental);
+  }
+
+  block->mark_allocated_area(area_index, area_index + area_size);
+  if (block->purged_page_count()) {
+    JitAllocatorImpl_revivePages(impl, block, area_index, area_index + area_size);
+  }
+
+  uint32_t offset = uint32_t(pool->byte_size_from_area_size(area_index));
+  JitAllocatorSlab* slab = new(Support::PlacementNew{p}) JitAllocatorSlab(block, offset, class_id);
+
+  JitAllocator_store_relaxed(&block->_slabs[offset / kJitAllocatorSlabSize], slab);
+  impl->slab_classes[class_id].slabs.append(slab);
+  impl->slab_overhead_bytes += sizeof(JitAllocatorSlab);
+
+  *out = slab;
+  return Error::kOk;
+}
+
+// Releases an empty `slab` and its block if it became empty.
+static void JitAllocatorImpl_deleteSlab(JitAllocatorPrivateImpl* impl, JitAllocatorSlab* slab) noexcept {
+  JitAllocatorBlock* block = slab->block();
+  JitAllocatorPool* pool = block->pool();
+
+  uint32_t area_index = uint32_t(slab->offset() >> pool->granularity_log2);
+  uint32_t area_size = pool->area_size_from_byte_size(kJitAllocatorSlabSize);
+
+  impl->slab_classes[slab->class_id()].slabs.unlink(slab);
+  JitAllocator_store_relaxed(&block->_slabs[slab->offset() / kJitAllocatorSlabSize], static_cast<JitAllocatorSlab*>(nullptr));
+
+  // Objects were filled on release if the secure mode is enabled, so the area doesn't have to be filled again.
+  block->mark_released_area(area_index, area_index + area_size);
+
+  // A lock-free query could have loaded the slab before it was removed from the slab table.
+  JitAllocatorImpl_waitForReaders(impl);
+  ::free(slab);
+  impl->slab_overhead_bytes -= sizeof(JitAllocatorSlab);
+
+  JitAllocatorImpl_releaseBlockIfEmpty(impl, block);
+}
+
+// Allocates an object of `size` bytes from a slab, must be called with the lock held.
+static Error JitAllocatorImpl_allocObject(JitAllocatorPrivateImpl* impl, size_t size, JitAllocator::Span& out) noexcept {
+  uint32_t class_id = uint32_t((size - 1u) / kJitAllocatorSlabObjectGranularity);
+  JitAllocatorSlabClass& slab_class = impl->slab_classes[class_id];
+
+  JitAllocatorSlab* slab = slab_class.slabs.first();
+  if (!slab) {
+    ASMJIT_PROPAGATE(JitAllocatorImpl_newSlab(impl, class_id, &slab));
+  }
+  else if (slab->is_empty()) {
+    slab_class.empty_slab_count--;
+  }
+
+  uint32_t index = slab->alloc_object();
+  if (slab->is_full()) {
+    slab_class.slabs.unlink(slab);
+  }
+
+  impl->allocation_count++;
+
+  JitAllocatorBlock* block = slab->block();
+  size_t offset = size_t(slab->offset()) + size_t(index) * slab->object_size();
+
+  out._rx = block->rx_ptr() + offset;
+  out._rw = block->rw_ptr() + offset;
+  out._size = slab->object_size();
+  out._block = static_cast<void*>(block);
+  return Error::kOk;
+}
+
+// Releases an object at `offset` (relative to the start of the block) from `slab`, must be called with the lock held.
+static Error JitAllocatorImpl_releaseObject(JitAllocatorPrivateImpl* impl, JitAllocatorSlab* slab, size_t offset) noexcept {
+  uint32_t index = slab->object_index_of(offset);
+  if (ASMJIT_UNLIKELY(index == slab->_capacity)) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  // Fill the released memory if the secure mode is enabled.
+  if (Support::test(impl->options, JitAllocatorOptions::kFillUnusedMemory)) {
+    uint8_t* object_ptr = slab->block()->rw_ptr() + offset;
+    size_t object_size = slab->object_size();
+
+    VirtMem::ProtectJitReadWriteScope scope(object_ptr, object_size);
+    JitAllocator_fill_pattern(object_ptr, impl->fill_pattern, object_size);
+  }
+
+  JitAllocatorSlabClass& slab_class = impl->slab_classes[slab->class_id()];
+  bool was_full = slab->is_full();
+
+  slab->release_object(index);
+  impl->allocation_count--;
+
+  if (slab->is_empty()) {
+    // A slab holds more than a single object, so it couldn't be full.
+    ASMJIT_ASSERT(!was_full);
+
+    if (slab_class.empty_slab_count || Support::test(impl->options, JitAllocatorOptions::kImmediateRelease)) {
+      JitAllocatorImpl_deleteSlab(impl, slab);
+    }
+    else {
+      // Keep the empty slab, but prefer partially used slabs for new allocations.
+      slab_class.empty_slab_count++;
+      slab_class.slabs.unlink(slab);
+      slab_class.slabs.append(slab);
+    }
+  }
+  else if (was_full) {
+    slab_class.slabs.prepend(slab);
+  }
+
+  return Error::kOk;
+}
+
+Error JitAllocator::alloc(Out<Span> out, size_t size) noexcept {
+  constexpr uint32_t no_index = std::numeric_limits<uint32_t>::max();
+  constexpr size_t max_request_size = std::numeric_limits<uint32_t>::max() / 2u;
+
+  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+  bool not_initialized = _impl == &JitAllocatorImpl_none;
+
+  // Tiny allocations are served from slabs (options of a not initialized allocator are always zero).
+  if (Support::bool_and(Support::test(impl->options, JitAllocatorOptions::kUseSlabs), size - 1u < kJitAllocatorSlabMaxObjectSize)) {
+    out = Span{};
+
+    LockGuard guard(impl->lock);
+    JitAllocatorWriteSection write_section(impl);
+    return JitAllocatorImpl_allocObject(impl, size, *out);
+  }
+
+  // Align to the minimum granularity by default.
+  size = Support::align_up<size_t>(size, impl->granularity);
+  out = Span{};
+
+  if (ASMJIT_UNLIKELY(Support::bool_or(not_initialized, size - 1u >= max_request_size))) {
+    return make_error(not_initialized ? Error::kNotInitialized  :
+                      size == 0u      ? Error::kInvalidArgument : Error::kTooLarge);
+  }
+
+  LockGuard guard(impl->lock);
+  JitAllocatorWriteSection write_section(impl);
+  JitAllocatorPool* pool = &impl->pools[JitAllocator_size_to_pool_id(impl, size)];
+
+  uint32_t area_index = no_index;
+  uint32_t area_size = uint32_t(pool->area_size_from_byte_size(size));
+
+  // Try to find the requested memory area in existing blocks.
+  JitAllocatorBlock* block = JitAllocatorImpl_findArea(pool, area_size, 0u, &area_index);
+
+  // Allocate a new block if there is no region of a required size.
+  if (!block) {
     size_t block_size = JitAllocator_calculate_ideal_block_size(impl, pool, size);
     if (ASMJIT_UNLIKELY(!block_size)) {
       return make_error(Error::kOutOfMemory);
@@ -990,18 +1875,31 @@ Error JitAllocator::alloc(Out<Span> out, size_t size) noexcept {
     block->clear_flags(JitAllocatorBlock::kFlagEmpty);
   }
 
-  // Update statistics.
-  impl->allocation_count++;
-  block->mark_allocated_area(area_index, area_index + area_size);
+  JitAllocatorImpl_useArea(impl, block, area_index, area_size, *out);
+  ASMJIT_ASSERT(out->size() == size);
 
-  // Return a span referencing the allocated memory.
-  size_t offset = pool->byte_size_from_area_size(area_index);
-  ASMJIT_ASSERT(offset <= block->block_size() - size);
+  return Error::kOk;
+}
 
-  out->_rx = block->rx_ptr() + offset;
-  out->_rw = block->rw_ptr() + offset;
-  out->_size = size;
-  out->_block = static_cast<void*>(block);
+// Releases memory at `rx` held by `block`, must be called with the lock held.
+static Error JitAllocatorImpl_release(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block, void* rx) noexcept {
+  // Offset relative to the start of the block.
+  JitAllocatorPool* pool = block->pool();
+  size_t offset = (size_t)((uint8_t*)rx - block->rx_ptr());
+
+  JitAllocatorSlab* slab = block->slab_at(offset);
+  if (slab) {
+    return JitAllocatorImpl_releaseObject(impl, slab, offset);
+  }
+
+  // The first bit representing the allocated area and its size.
+  uint32_t area_index = uint32_t(offset >> pool->granularity_log2);
+  uint32_t area_end = uint32_t(Support::bit_vector_index_of(block->_stop_bit_vector, area_index, true)) + 1;
+
+  JitAllocatorImpl_releaseArea(impl, block, area_index, area_end);
+
+  // Release the whole block if it became empty.
+  JitAllocatorImpl_releaseBlockIfEmpty(impl, block);
 
   return Error::kOk;
 }
@@ -1015,45 +1913,28 @@ Error JitAllocator::release(void* rx) noexcept {
 
   JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
   LockGuard guard(impl->lock);
+  JitAllocatorWriteSection write_section(impl);
 
   JitAllocatorBlock* block = impl->tree.get(static_cast<uint8_t*>(rx));
   if (ASMJIT_UNLIKELY(!block)) {
     return make_error(Error::kInvalidState);
   }
 
-  // Offset relative to the start of the block.
-  JitAllocatorPool* pool = block->pool();
-  size_t offset = (size_t)((uint8_t*)rx - block->rx_ptr());
-
-  // The first bit representing the allocated area and its size.
-  uint32_t area_index = uint32_t(offset >> pool->granularity_log2);
-  uint32_t area_end = uint32_t(Support::bit_vector_index_of(block->_stop_bit_vector, area_index, true)) + 1;
-  uint32_t area_size = area_end - area_index;
-
-  impl->allocation_count--;
-  block->mark_released_area(area_index, area_end);
+  return JitAllocatorImpl_release(impl, block, rx);
+}
 
-  // Fill the released memory if the secure mode is enabled.
-  if (Support::test(impl->options, JitAllocatorOptions::kFillUnusedMemory)) {
-    uint8_t* span_ptr = block->rw_ptr() + area_index * pool->granularity;
-    size_t span_size = area_size * pool->granularity;
+Error JitAllocator::release(const Span& span) noexcept {
+  bool not_initialized = _impl == &JitAllocatorImpl_none;
 
-    VirtMem::ProtectJitReadWriteScope scope(span_ptr, span_size);
-    JitAllocator_fill_pattern(span_ptr, impl->fill_pattern, span_size);
+  if (ASMJIT_UNLIKELY(Support::bool_or(not_initialized, !span._block))) {
+    return make_error(not_initialized ? Error::kNotInitialized : Error::kInvalidArgument);
   }
 
-  // Release the whole block if it became empty.
-  if (block->is_empty()) {
-    if (pool->empty_block_count || Support::test(impl->options, JitAllocatorOptions::kImmediateRelease)) {
-      JitAllocatorImpl_removeBlock(impl, block);
-      JitAllocatorImpl_deleteBlock(impl, block);
-    }
-    else {
-      pool->empty_block_count++;
-    }
-  }
+  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+  LockGuard guard(impl->lock);
+  JitAllocatorWriteSection write_section(impl);
 
-  return Error::kOk;
+  return JitAllocatorImpl_release(impl, static_cast<JitAllocatorBlock*>(span._block), span.rx());
 }
 
 static Error JitAllocatorImpl_shrink(JitAllocatorPrivateImpl* impl, JitAllocator::Span& span, size_t new_size, bool already_under_write_scope) noexcept {
@@ -1063,11 +1944,21 @@ static Error JitAllocatorImpl_shrink(JitAllocatorPrivateImpl* impl, JitAllocator
   }
 
   LockGuard guard(impl->lock);
+  JitAllocatorWriteSection write_section(impl);
 
   // Offset relative to the start of the block.
   JitAllocatorPool* pool = block->pool();
   size_t offset = (size_t)((uint8_t*)span.rx() - block->rx_ptr());
 
+  // Slab objects have a fixed size, so there is nothing to release.
+  JitAllocatorSlab* slab = block->slab_at(offset);
+  if (slab) {
+    if (ASMJIT_UNLIKELY(slab->object_index_of(offset) == slab->_capacity || new_size > slab->object_size())) {
+      return make_error(Error::kInvalidArgument);
+    }
+    return Error::kOk;
+  }
+
   // The first bit representing the allocated area and its size.
   uint32_t area_start = uint32_t(offset >> pool->granularity_log2);
 
@@ -1125,6 +2016,88 @@ Error JitAllocator::shrink(Span& span, size_t new_size) noexcept {
   return JitAllocatorImpl_shrink(static_cast<JitAllocatorPrivateImpl*>(_impl), span, new_size, false);
 }
 
+// Queries a span that contains `rx` without locking the allocator.
+//
+// Blocks are read from the published snapshot and their bit-vectors are read optimistically - the sequence number is
+// validated after the reads and the query is repeated if blocks were modified meanwhile. Returns `Error::kInvalidState`
+// if blocks were being modified during all attempts or if there is no snapshot (it couldn't be allocated).
+static Error JitAllocatorImpl_queryLockFree(const JitAllocatorPrivateImpl* impl, JitAllocator::Span& out, void* rx) noexcept {
+  JitAllocatorReadSection read_section(impl);
+
+  const JitAllocatorSnapshot* snapshot = read_section.snapshot();
+  if (ASMJIT_UNLIKELY(!snapshot)) {
+    return make_error(Error::kInvalidState);
+  }
+
+  JitAllocatorBlock* block = snapshot->find(rx);
+  if (ASMJIT_UNLIKELY(!block)) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  // Offset relative to the start of the block.
+  JitAllocatorPool* pool = block->pool();
+  size_t offset = (size_t)((uint8_t*)rx - block->rx_ptr());
+
+  for (uint32_t attempt = 0; attempt < kJitAllocatorLockFreeQueryAttempts; attempt++) {
+    uint32_t sequence = impl->sequence.load(std::memory_order_acquire);
+    if (sequence & 1u) {
+      continue;
+    }
+
+    JitAllocatorSlab** slabs = JitAllocator_load_relaxed(&block->_slabs);
+    JitAllocatorSlab* slab = slabs ? JitAllocator_load_relaxed(&slabs[offset / kJitAllocatorSlabSize]) : nullptr;
+
+    if (slab) {
+      // The slab pointer must be validated before it's dereferenced, it could have been read from a slab table that
+      // is being initialized.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (impl->sequence.load(std::memory_order_relaxed) != sequence) {
+        continue;
+      }
+    }
+
+    size_t byte_offset = 0;
+    size_t byte_size = 0;
+
+    if (slab) {
+      if (slab->object_index_of(offset) != slab->_capacity) {
+        byte_offset = offset;
+        byte_size = slab->object_size();
+      }
+    }
+    else {
+      uint32_t area_start = uint32_t(offset >> pool->granularity_log2);
+
+      if (JitAllocator_shared_bit_vector_get_bit(block->_used_bit_vector, area_start)) {
+        // The stop bit must be searched within the block as the bit-vectors could be inconsistent.
+        size_t area_end = JitAllocator_shared_bit_vector_index_of(block->_stop_bit_vector, area_start, block->area_size(), true);
+
+        if (area_end != block->area_size()) {
+          byte_offset = pool->byte_size_from_area_size(area_start);
+          byte_size = pool->byte_size_from_area_size(uint32_t(area_end) + 1u - area_start);
+        }
+      }
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (impl->sequence.load(std::memory_order_relaxed) != sequence) {
+      continue;
+    }
+
+    if (ASMJIT_UNLIKELY(!byte_size)) {
+      return make_error(Error::kInvalidArgument);
+    }
+
+    out._rx = static_cast<uint8_t*>(block->_mapping.rx) + byte_offset;
+    out._rw = static_cast<uint8_t*>(block->_mapping.rw) + byte_offset;
+    out._size = byte_size;
+    out._block = static_cast<void*>(block);
+    return Error::kOk;
+  }
+
+  return make_error(Error::kInvalidState);
+}
+
 Error JitAllocator::query(Out<Span> out, void* rx) const noexcept {
   *out = Span{};
 
@@ -1133,6 +2106,13 @@ Error JitAllocator::query(Out<Span> out, void* rx) const noexcept {
   }
 
   JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+
+  Error err = JitAllocatorImpl_queryLockFree(impl, *out, rx);
+  if (err != Error::kInvalidState) {
+    return err;
+  }
+
+  // Blocks were being modified during all attempts, so wait for the modification to finish.
   LockGuard guard(impl->lock);
   JitAllocatorBlock* block = impl->tree.get(static_cast<uint8_t*>(rx));
 
@@ -1144,6 +2124,19 @@ Error JitAllocator::query(Out<Span> out, void* rx) const noexcept {
   JitAllocatorPool* pool = block->pool();
   size_t offset = (size_t)((uint8_t*)rx - block->rx_ptr());
 
+  JitAllocatorSlab* slab = block->slab_at(offset);
+  if (slab) {
+    if (ASMJIT_UNLIKELY(slab->object_index_of(offset) == slab->_capacity)) {
+      return make_error(Error::kInvalidArgument);
+    }
+
+    out->_rx = static_cast<uint8_t*>(block->_mapping.rx) + offset;
+    out->_rw = static_cast<uint8_t*>(block->_mapping.rw) + offset;
+    out->_size = slab->object_size();
+    out->_block = static_cast<void*>(block);
+    return Error::kOk;
+  }
+
   // The first bit representing the allocated area and its size.
   uint32_t area_start = uint32_t(offset >> pool->granularity_log2);
 
@@ -1164,6 +2157,208 @@ Error JitAllocator::query(Out<Span> out, void* rx) const noexcept {
   return Error::kOk;
 }
 
+Error JitAllocator::query_lock_free(Out<Span> out, void* rx) const noexcept {
+  *out = Span{};
+
+  if (ASMJIT_UNLIKELY(_impl == &JitAllocatorImpl_none)) {
+    return make_error(Error::kNotInitialized);
+  }
+
+  return JitAllocatorImpl_queryLockFree(static_cast<JitAllocatorPrivateImpl*>(_impl), *out, rx);
+}
+
+bool JitAllocator::contains(const void* rx) const noexcept {
+  if (ASMJIT_UNLIKELY(_impl == &JitAllocatorImpl_none)) {
+    return false;
+  }
+
+  JitAllocatorReadSection read_section(static_cast<JitAllocatorPrivateImpl*>(_impl));
+  const JitAllocatorSnapshot* snapshot = read_section.snapshot();
+
+  return snapshot && snapshot->find(rx) != nullptr;
+}
+
+// JitAllocator - Purge
+// ====================
+
+Error JitAllocator::purge() noexcept {
+  if (ASMJIT_UNLIKELY(_impl == &JitAllocatorImpl_none)) {
+    return make_error(Error::kNotInitialized);
+  }
+
+  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+  LockGuard guard(impl->lock);
+
+  uint32_t page_size_log2 = Support::ctz(impl->page_size);
+  size_t pool_count = impl->pool_count;
+
+  for (size_t pool_id = 0; pool_id < pool_count; pool_id++) {
+    JitAllocatorPool& pool = impl->pools[pool_id];
+    uint32_t page_area_shift = page_size_log2 - pool.granularity_log2;
+
+    for (JitAllocatorBlock* block = pool.blocks.first(); block; block = block->next()) {
+      uint32_t page_count = block->page_count();
+      if (block->purged_page_count() == page_count) {
+        continue;
+      }
+
+      size_t page_bit_word_count = pool.bit_word_count_from_area_size(page_count);
+      BitVectorRangeIterator<Support::BitWord, 0> it(block->_used_bit_vector, pool.bit_word_count_from_area_size(block->area_size()), 0, block->area_size());
+
+      size_t unused_start;
+      size_t unused_end;
+
+      while (it.next_range(Out(unused_start), Out(unused_end))) {
+        // Only pages that are completely unused can be discarded.
+        size_t page_start = Support::align_up(unused_start, size_t(1) << page_area_shift) >> page_area_shift;
+        size_t page_end = unused_end >> page_area_shift;
+
+        if (page_start >= page_end) {
+          continue;
+        }
+
+        BitVectorRangeIterator<Support::BitWord, 0> page_it(block->_purged_bit_vector, page_bit_word_count, page_start, page_end);
+
+        size_t range_start;
+        size_t range_end;
+
+        while (page_it.next_range(Out(range_start), Out(range_end))) {
+          size_t range_size = range_end - range_start;
+          ASMJIT_PROPAGATE(VirtMem::discard(block->rw_ptr() + (range_start << page_size_log2), range_size << page_size_log2));
+
+          Support::bit_vector_fill(block->_purged_bit_vector, range_start, range_size);
+          block->_purged_page_count += uint32_t(range_size);
+          pool.total_purged_bytes += range_size << page_size_log2;
+        }
+      }
+    }
+  }
+
+  return Error::kOk;
+}
+
+// JitAllocator - Compaction
+// =========================
+
+// Moves all allocations of `block` to other blocks of the same pool, stops when there is no more space available.
+static void JitAllocatorImpl_evacuateBlock(JitAllocatorPrivateImpl* impl, JitAllocatorBlock* block, JitAllocator::RelocateFunc relocate_fn, void* user_data) noexcept {
+  // Never place relocated spans into the evacuated block or to empty blocks as that would not release anything.
+  constexpr uint32_t kSkipFlags = JitAllocatorBlock::kFlagEvacuating | JitAllocatorBlock::kFlagEmpty;
+
+  JitAllocatorPool* pool = block->pool();
+  BitVectorRangeIterator<Support::BitWord, 1> it(block->_used_bit_vector, pool->bit_word_count_from_area_size(block->area_size()), block->initial_area_start(), block->area_size());
+
+  size_t range_start;
+  size_t range_end;
+
+  while (it.next_range(Out(range_start), Out(range_end))) {
+    // A continuous range of used bits can consist of multiple spans - use stop bits to split them.
+    uint32_t area_index = uint32_t(range_start);
+
+    while (area_index < range_end) {
+      uint32_t area_end = uint32_t(Support::bit_vector_index_of(block->_stop_bit_vector, area_index, true)) + 1;
+      uint32_t area_size = area_end - area_index;
+
+      // Slabs are never moved as their objects are allocated and released individually.
+      if (block->slab_at(pool->byte_size_from_area_size(area_index))) {
+        area_index = area_end;
+        continue;
+      }
+
+      uint32_t dst_area_index;
+      JitAllocatorBlock* dst_block = JitAllocatorImpl_findArea(pool, area_size, kSkipFlags, &dst_area_index);
+
+      if (!dst_block) {
+        return;
+      }
+
+      size_t src_offset = pool->byte_size_from_area_size(area_index);
+
+      JitAllocator::Span src;
+      src._rx = block->rx_ptr() + src_offset;
+      src._rw = block->rw_ptr() + src_offset;
+      src._size = pool->byte_size_from_area_size(area_size);
+      src._block = static_cast<void*>(block);
+
+      JitAllocator::Span dst;
+      JitAllocatorImpl_useArea(impl, dst_block, dst_area_index, area_size, dst);
+
+      if (relocate_fn(src, dst, user_data) == Error::kOk) {
+        JitAllocatorImpl_releaseArea(impl, block, area_index, area_end);
+        impl->relocated_size += src.size();
+      }
+      else {
+        JitAllocatorImpl_releaseArea(impl, dst_block, dst_area_index, dst_area_index + area_size);
+      }
+
+      area_index = area_end;
+    }
+  }
+}
+
+Error JitAllocator::compact(RelocateFunc relocate_fn, void* user_data) noexcept {
+  if (ASMJIT_UNLIKELY(_impl == &JitAllocatorImpl_none)) {
+    return make_error(Error::kNotInitialized);
+  }
+
+  if (ASMJIT_UNLIKELY(!relocate_fn)) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(_impl);
+  LockGuard guard(impl->lock);
+  JitAllocatorWriteSection write_section(impl);
+
+  impl->compaction_count++;
+  size_t pool_count = impl->pool_count;
+
+  for (size_t pool_id = 0; pool_id < pool_count; pool_id++) {
+    JitAllocatorPool& pool = impl->pools[pool_id];
+
+    for (;;) {
+      // Find the least used block that was not visited yet and calculate the space available in all used blocks.
+      JitAllocatorBlock* candidate = nullptr;
+      size_t total_area_available = 0;
+
+      for (JitAllocatorBlock* block = pool.blocks.first(); block; block = block->next()) {
+        if (block->is_empty()) {
+          continue;
+        }
+
+        total_area_available += block->area_available();
+        if (!block->has_flag(JitAllocatorBlock::kFlagCompacted) && (!candidate || block->area_used() < candidate->area_used())) {
+          candidate = block;
+        }
+      }
+
+      if (!candidate) {
+        break;
+      }
+
+      // Only evacuate the block if the remaining blocks have enough space to hold all of its spans.
+      candidate->add_flags(JitAllocatorBlock::kFlagCompacted);
+      if (candidate->area_used() - candidate->initial_area_start() > total_area_available - candidate->area_available()) {
+        continue;
+      }
+
+      candidate->add_flags(JitAllocatorBlock::kFlagEvacuating);
+      JitAllocatorImpl_evacuateBlock(impl, candidate, relocate_fn, user_data);
+      candidate->clear_flags(JitAllocatorBlock::kFlagEvacuating);
+
+      if (candidate->is_empty()) {
+        JitAllocatorImpl_removeBlock(impl, candidate);
+        JitAllocatorImpl_deleteBlock(impl, candidate);
+      }
+    }
+
+    for (JitAllocatorBlock* block = pool.blocks.first(); block; block = block->next()) {
+      block->clear_flags(JitAllocatorBlock::kFlagCompacted);
+    }
+  }
+
+  return Error::kOk;
+}
+
 // JitAllocator - Write
 // ====================
 
@@ -1415,6 +2610,7 @@ static void JitAllocatorTest_usage(JitAllocator& allocator) noexcept {
   JitAllocator::Statistics stats = allocator.statistics();
   INFO("    Block Count       : %9llu [Blocks]"        , (unsigned long long)(stats.block_count()));
   INFO("    Reserved (VirtMem): %9llu [Bytes]"         , (unsigned long long)(stats.reserved_size()));
+  INFO("    Resident (VirtMem): %9llu [Bytes]"         , (unsigned long long)(stats.resident_size()));
   INFO("    Used     (VirtMem): %9llu [Bytes] (%.1f%%)", (unsigned long long)(stats.used_size()), stats.used_ratio() * 100.0);
   INFO("    Overhead (HeapMem): %9llu [Bytes] (%.1f%%)", (unsigned long long)(stats.overhead_size()), stats.overhead_ratio() * 100.0);
 }
@@ -1481,7 +2677,13 @@ static void test_jit_allocator_alloc_release() noexcept {
     { "kUseLargePages | kFillUnusedMemory"         , Opt::kUseLargePages | Opt::kFillUnusedMemory, 0, 0 },
     { "kUseLargePages | kAlignBlockSizeToLargePage", Opt::kUseLargePages | Opt::kAlignBlockSizeToLargePage, 0, 0 },
     { "kUseDualMapping"                            , Opt::kUseDualMapping , 0, 0 },
-    { "kUseDualMapping | kFillUnusedMemory"        , Opt::kUseDualMapping | Opt::kFillUnusedMemory, 0, 0 }
+    { "kUseDualMapping | kFillUnusedMemory"        , Opt::kUseDualMapping | Opt::kFillUnusedMemory, 0, 0 },
+    { "kUseSlabs"                                  , Opt::kUseSlabs, 0, 0 },
+    { "kUseSlabs | kFillUnusedMemory"              , Opt::kUseSlabs | Opt::kFillUnusedMemory, 0, 0 },
+    { "kUseSlabs | kUseMultiplePools"              , Opt::kUseSlabs | Opt::kUseMultiplePools, 0, 0 },
+    { "kUseTransparentHugePages"                   , Opt::kUseTransparentHugePages, 0, 0 },
+    { "kUseTransparentHugePages | kPrefaultBlocks" , Opt::kUseTransparentHugePages | Opt::kPrefaultBlocks, 0, 0 },
+    { "kUseDualMapping | kUseTransparentHugePages" , Opt::kUseDualMapping | Opt::kUseTransparentHugePages, 0, 0 }
   };
 
   INFO("BitVectorRangeIterator<uint32_t>");
@@ -1634,10 +2836,374 @@ static void test_jit_allocator_query() noexcept {
   EXPECT_EQ(allocated_span.size(), queried_span.size());
 }
 
+static const uint32_t jit_allocator_anchor_object = 0;
+
+static void test_jit_allocator_anchor() noexcept {
+  constexpr size_t kAnchorRange = size_t(64) * 1024 * 1024;
+  uintptr_t anchor = uintptr_t(&jit_allocator_anchor_object);
+
+  JitAllocator::CreateParams params {};
+  params.anchor = &jit_allocator_anchor_object;
+  params.anchor_range = kAnchorRange;
+
+  JitAllocator allocator(&params);
+
+  // Dual mapping is forced by hardened runtimes, in which case the anchor is ignored.
+  if (allocator.has_option(JitAllocatorOptions::kUseDualMapping)) {
+    return;
+  }
+
+  // Small spans share the first block, the large span requires a separate block.
+  static constexpr size_t allocation_sizes[] = { 64, 1000, 4096, 1024 * 1024 };
+
+  for (size_t allocation_size : allocation_sizes) {
+    JitAllocator::Span span;
+    EXPECT_EQ(allocator.alloc(Out(span), allocation_size), Error::kOk);
+
+    uintptr_t begin = uintptr_t(span.rx());
+    uintptr_t end = begin + span.size();
+
+    EXPECT_LE(begin < anchor ? anchor - begin : begin - anchor, kAnchorRange);
+    EXPECT_LE(end < anchor ? anchor - end : end - anchor, kAnchorRange);
+  }
+}
+
+static void test_jit_allocator_purge() noexcept {
+  constexpr size_t kSpanCount = 16;
+  size_t page_size = VirtMem::info().page_size;
+
+  JitAllocator::CreateParams params {};
+  params.options = JitAllocatorOptions::kFillUnusedMemory;
+
+  JitAllocator allocator(&params);
+
+  // Blocks that use dual mapping are never purged.
+  if (allocator.has_option(JitAllocatorOptions::kUseDualMapping)) {
+    return;
+  }
+
+  JitAllocator::Span spans[kSpanCount];
+  for (JitAllocator::Span& span : spans) {
+    EXPECT_EQ(allocator.alloc(Out(span), page_size), Error::kOk);
+  }
+
+  // Keep the first span so the block stays in use.
+  for (size_t i = 1; i < kSpanCount; i++) {
+    EXPECT_EQ(allocator.release(spans[i].rx()), Error::kOk);
+  }
+
+  JitAllocator::Statistics before = allocator.statistics();
+  EXPECT_EQ(before.resident_size(), before.reserved_size());
+
+  EXPECT_EQ(allocator.purge(), Error::kOk);
+  JitAllocator::Statistics after = allocator.statistics();
+
+  EXPECT_EQ(after.reserved_size(), before.reserved_size());
+  EXPECT_LE(after.resident_size(), after.reserved_size() - (kSpanCount - 2u) * page_size);
+
+  // Allocating from purged pages makes them resident again and fills them with the fill pattern.
+  JitAllocator::Span span;
+  EXPECT_EQ(allocator.alloc(Out(span), page_size), Error::kOk);
+  const uint32_t* span_end = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(span.rx()) + span.size());
+  EXPECT_EQ(span_end[-1], allocator.fill_pattern());
+  EXPECT_GT(allocator.statistics().resident_size(), after.resident_size());
+
+  EXPECT_EQ(allocator.release(span.rx()), Error::kOk);
+  EXPECT_EQ(allocator.release(spans[0].rx()), Error::kOk);
+}
+
+struct JitAllocatorCompactTest {
+  JitAllocator* allocator;
+  JitAllocator::Span* spans;
+  size_t span_count;
+};
+
+static void test_jit_allocator_compact() noexcept {
+  constexpr size_t kSpanCount = 256;
+  constexpr size_t kSpanSize = 1024;
+
+  JitAllocator allocator;
+  JitAllocator::Span spans[kSpanCount];
+
+  for (size_t i = 0; i < kSpanCount; i++) {
+    uint32_t tag = uint32_t(i);
+    EXPECT_EQ(allocator.alloc(Out(spans[i]), kSpanSize), Error::kOk);
+    EXPECT_EQ(allocator.write(spans[i], 0, &tag, sizeof(tag)), Error::kOk);
+  }
+
+  // Release 3 of 4 spans so all blocks become sparse.
+  for (size_t i = 0; i < kSpanCount; i++) {
+    if (i % 4u != 0u) {
+      EXPECT_EQ(allocator.release(spans[i].rx()), Error::kOk);
+      spans[i] = JitAllocator::Span{};
+    }
+  }
+
+  JitAllocator::Statistics before = allocator.statistics();
+  EXPECT_GT(before.fragmented_size(), 0u);
+
+  JitAllocatorCompactTest test_data { &allocator, spans, kSpanCount };
+  JitAllocator::RelocateFunc relocate_fn = [](const JitAllocator::Span& src, JitAllocator::Span& dst, void* user_data) noexcept -> Error {
+    JitAllocatorCompactTest* data = static_cast<JitAllocatorCompactTest*>(user_data);
+
+    for (size_t i = 0; i < data->span_count; i++) {
+      if (data->spans[i].rx() == src.rx()) {
+        // The first span is pinned, which tests that spans can be refused.
+        if (i == 0) {
+          return Error::kInvalidState;
+        }
+
+        ASMJIT_PROPAGATE(data->allocator->write(dst, 0, src.rx(), src.size()));
+        data->spans[i] = dst;
+        return Error::kOk;
+      }
+    }
+
+    return Error::kInvalidState;
+  };
+
+  void* pinned = spans[0].rx();
+  EXPECT_EQ(allocator.compact(relocate_fn, &test_data), Error::kOk);
+
+  JitAllocator::Statistics after = allocator.statistics();
+  EXPECT_LT(after.block_count(), before.block_count());
+  EXPECT_LT(after.used_size(), before.used_size()); // Initial padding of released blocks.
+  EXPECT_EQ(after.allocation_count(), before.allocation_count());
+  EXPECT_EQ(after.compaction_count(), 1u);
+  EXPECT_GT(after.relocated_size(), 0u);
+  EXPECT_EQ(spans[0].rx(), pinned);
+
+  for (size_t i = 0; i < kSpanCount; i += 4) {
+    EXPECT_EQ(*static_cast<const uint32_t*>(spans[i].rx()), uint32_t(i));
+    EXPECT_EQ(allocator.release(spans[i].rx()), Error::kOk);
+  }
+}
+
+static void test_jit_allocator_slabs() noexcept {
+  constexpr size_t kObjectCount = 1000;
+
+  JitAllocator::CreateParams params {};
+  params.options = JitAllocatorOptions::kUseSlabs | JitAllocatorOptions::kFillUnusedMemory | JitAllocatorOptions::kImmediateRelease;
+
+  JitAllocator allocator(&params);
+  JitAllocator::Span spans[kObjectCount];
+
+  for (size_t i = 0; i < kObjectCount; i++) {
+    size_t size = (i % 64u) + 1u;
+    EXPECT_EQ(allocator.alloc(Out(spans[i]), size), Error::kOk);
+    EXPECT_EQ(spans[i].size(), Support::align_up<size_t>(size, 16u));
+    EXPECT_TRUE(Support::is_aligned(uintptr_t(spans[i].rx()), 16u));
+
+    uint32_t tag = uint32_t(i);
+    EXPECT_EQ(allocator.write(spans[i], 0, &tag, sizeof(tag)), Error::kOk);
+  }
+
+  // Objects of 64 bytes don't need more space than regular allocations, smaller objects need less.
+  JitAllocator::Statistics stats = allocator.statistics();
+  EXPECT_EQ(stats.allocation_count(), kObjectCount);
+  EXPECT_LT(stats.used_size(), kObjectCount * 64u);
+
+  for (size_t i = 0; i < kObjectCount; i++) {
+    JitAllocator::Span span;
+    EXPECT_EQ(allocator.query(Out(span), spans[i].rx()), Error::kOk);
+    EXPECT_EQ(span.rx(), spans[i].rx());
+    EXPECT_EQ(span.size(), spans[i].size());
+    EXPECT_EQ(*static_cast<const uint32_t*>(span.rx()), uint32_t(i));
+  }
+
+  // Slab objects cannot grow and cannot be referenced by interior pointers.
+  EXPECT_EQ(allocator.shrink(spans[0], 8u), Error::kOk);
+  EXPECT_EQ(allocator.shrink(spans[0], 17u), Error::kInvalidArgument);
+  EXPECT_EQ(allocator.release(static_cast<uint8_t*>(spans[1].rx()) + 1), Error::kInvalidArgument);
+
+  // Released objects are reused and filled by the fill pattern.
+  EXPECT_EQ(allocator.release(spans[0]), Error::kOk);
+  EXPECT_EQ(allocator.release(spans[0]), Error::kInvalidArgument);
+  EXPECT_EQ(*static_cast<const uint32_t*>(spans[0].rx()), allocator.fill_pattern());
+
+  void* released = spans[0].rx();
+  EXPECT_EQ(allocator.alloc(Out(spans[0]), 16u), Error::kOk);
+  EXPECT_EQ(spans[0].rx(), released);
+
+  for (size_t i = 0; i < kObjectCount; i++) {
+    EXPECT_EQ(i & 1u ? allocator.release(spans[i].rx()) : allocator.release(spans[i]), Error::kOk);
+  }
+
+  // Empty slabs and blocks are released immediately.
+  stats = allocator.statistics();
+  EXPECT_EQ(stats.allocation_count(), 0u);
+  EXPECT_EQ(stats.block_count(), 0u);
+  EXPECT_EQ(stats.overhead_size(), 0u);
+}
+
+static void test_jit_allocator_transparent_huge_pages() noexcept {
+  size_t large_page_size = VirtMem::large_page_size();
+  if (!large_page_size) {
+    return;
+  }
+
+  JitAllocator::CreateParams params {};
+  params.options = JitAllocatorOptions::kUseTransparentHugePages | JitAllocatorOptions::kPrefaultBlocks;
+
+  JitAllocator allocator(&params);
+
+  // Both a small span and a span larger than a large page require blocks of large page multiples.
+  static constexpr size_t allocation_sizes[] = { 64, 3 * 1024 * 1024 };
+
+  for (size_t allocation_size : allocation_sizes) {
+    JitAllocator::Span span;
+    EXPECT_EQ(allocator.alloc(Out(span), allocation_size), Error::kOk);
+    EXPECT_EQ(allocator.write(span, 0, &allocation_size, sizeof(allocation_size)), Error::kOk);
+
+    // Each span is the first one in its block, which is aligned to a large page on Linux (other operating systems
+    // ignore the alignment hint), thus the span only has the initial padding as an offset.
+#if defined(__linux__)
+    EXPECT_EQ(uintptr_t(span.rx()) & (large_page_size - 1u), uintptr_t(allocator.granularity()));
+#endif
+  }
+
+  JitAllocator::Statistics stats = allocator.statistics();
+  EXPECT_EQ(stats.block_count(), 2u);
+  EXPECT_TRUE(Support::is_aligned(stats.reserved_size(), large_page_size));
+
+  // Blocks that can be backed by huge pages are never purged.
+  EXPECT_EQ(allocator.purge(), Error::kOk);
+  EXPECT_EQ(allocator.statistics().resident_size(), stats.resident_size());
+}
+
+static void test_jit_allocator_lock_free_query() noexcept {
+  constexpr size_t kSpanCount = 64;
+  size_t kIterationCount = BrokenAPI::has_arg("--quick") ? 200 : 1000;
+
+  JitAllocator::CreateParams params {};
+  params.options = JitAllocatorOptions::kUseSlabs | JitAllocatorOptions::kImmediateRelease;
+
+  JitAllocator allocator(&params);
+
+  JitAllocator::Span pinned;
+  JitAllocator::Span pinned_object;
+  EXPECT_EQ(allocator.alloc(Out(pinned), 1000u), Error::kOk);
+  EXPECT_EQ(allocator.alloc(Out(pinned_object), 32u), Error::kOk);
+
+  int local_variable = 0;
+  EXPECT_TRUE(allocator.contains(pinned.rx()));
+  EXPECT_TRUE(allocator.contains(static_cast<uint8_t*>(pinned.rx()) + 1500u));
+  EXPECT_FALSE(allocator.contains(&local_variable));
+
+  JitAllocator::Span span;
+  EXPECT_EQ(allocator.query_lock_free(Out(span), pinned.rx()), Error::kOk);
+  EXPECT_EQ(span.rx(), pinned.rx());
+  EXPECT_EQ(span.size(), pinned.size());
+  EXPECT_EQ(allocator.query_lock_free(Out(span), pinned_object.rx()), Error::kOk);
+  EXPECT_EQ(span.size(), pinned_object.size());
+  EXPECT_EQ(allocator.query_lock_free(Out(span), &local_variable), Error::kInvalidArgument);
+
+  // Blocks are created and deleted by another thread while the pinned spans are queried.
+  std::atomic<bool> done {false};
+  std::thread writer([&]() {
+    JitAllocator::Span spans[kSpanCount];
+    for (size_t i = 0; i < kIterationCount; i++) {
+      for (size_t j = 0; j < kSpanCount; j++) {
+        (void)allocator.alloc(Out(spans[j]), j & 1u ? 48u : 64u * 1024u);
+      }
+      for (size_t j = 0; j < kSpanCount; j++) {
+        (void)allocator.release(spans[j]);
+      }
+    }
+    done.store(true);
+  });
+
+  size_t query_count = 0;
+  size_t success_count = 0;
+
+  while (!done.load()) {
+    const JitAllocator::Span& expected = query_count & 1u ? pinned_object : pinned;
+    Error err = allocator.query_lock_free(Out(span), expected.rx());
+
+    if (err == Error::kOk) {
+      EXPECT_EQ(span.rx(), expected.rx());
+      EXPECT_EQ(span.size(), expected.size());
+      success_count++;
+    }
+    else {
+      EXPECT_EQ(err, Error::kInvalidState);
+    }
+
+    EXPECT_TRUE(allocator.contains(expected.rx()));
+    query_count++;
+  }
+
+  writer.join();
+  INFO("  Lock-free queries: %zu (%zu successful)", query_count, success_count);
+
+  EXPECT_EQ(allocator.release(pinned), Error::kOk);
+  EXPECT_EQ(allocator.release(pinned_object), Error::kOk);
+  EXPECT_EQ(allocator.statistics().block_count(), 0u);
+}
+
+// A writer must only wait for lock-free queries that have started before its grace period, a query that started
+// later (and could be held for an arbitrary time) must not block it.
+static void test_jit_allocator_grace_period() noexcept {
+  JitAllocator allocator;
+  JitAllocatorPrivateImpl* impl = static_cast<JitAllocatorPrivateImpl*>(allocator._impl);
+
+  std::atomic<bool> writer_finished {false};
+  std::atomic<bool> reader_started {false};
+  bool writer_finished_while_reading = false;
+
+  std::thread writer;
+  std::thread reader;
+
+  {
+    uint32_t epoch = impl->reader_epoch.load();
+    JitAllocatorReadSection old_read_section(impl);
+
+    writer = std::thread([&]() {
+      LockGuard guard(impl->lock);
+      JitAllocatorImpl_waitForReaders(impl);
+      writer_finished.store(true);
+    });
+
+    while (impl->reader_epoch.load() == epoch) {
+      std::this_thread::yield();
+    }
+
+    reader = std::thread([&]() {
+      JitAllocatorReadSection new_read_section(impl);
+      reader_started.store(true);
+
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+      while (!writer_finished.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+      }
+      writer_finished_while_reading = writer_finished.load();
+    });
+
+    while (!reader_started.load()) {
+      std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(writer_finished.load());
+  }
+
+  writer.join();
+  reader.join();
+
+  EXPECT_TRUE(writer_finished_while_reading)
+    .message("Writer waited for a lock-free query that started after its grace period");
+}
+
 UNIT(jit_allocator) {
   test_jit_allocator_reset_empty();
   test_jit_allocator_alloc_release();
   test_jit_allocator_query();
+  test_jit_allocator_anchor();
+  test_jit_allocator_purge();
+  test_jit_allocator_compact();
+  test_jit_allocator_slabs();
+  test_jit_allocator_transparent_huge_pages();
+  test_jit_allocator_lock_free_query();
+  test_jit_allocator_grace_period();
 }
 #endif // ASMJIT_TEST
 
@@ -89,6 +89,31 @@ enum class JitAllocatorOptions : uint32_t {
   //! allocation would be the same as a minimum large page when large pages are enabled and can be allocated.
   kAlignBlockSizeToLargePage = 0x00000040u,
 
+  //! Enables slabs - allocations of up to 64 bytes are served from fixed-size objects of 16, 32, 48, and 64 bytes.
+  //!
+  //! A slab is a 4kB area within a block that is split into objects of the same size. Unused objects of all slabs
+  //! of the same size class are kept in free lists, thus allocating and releasing an object doesn't have to search
+  //! bit-vectors, which makes it suitable for code that emits a lot of tiny trampolines or thunks. Slabs are never
+  //! moved by \ref JitAllocator::compact() and an empty slab is released the same way as an empty block (one is
+  //! kept per size class unless \ref kImmediateRelease is used).
+  //!
+  //! \remarks Slab objects are aligned to 16 bytes (and not to the allocator granularity). The size of a span that
+  //! refers to a slab object is the size of the object and such span cannot be shrunk.
+  kUseSlabs = 0x00000080u,
+
+  //! Reserves blocks aligned to the size of a large page and grows them in large page multiples, so the operating
+  //! system can back them by transparent huge pages, which reduces iTLB misses of code spread across a block.
+  //!
+  //! \remarks Unlike \ref kUseLargePages this option doesn't require reserved huge pages, see
+  //! \ref VirtMem::MemoryFlags::kMMapTransparentHugePages for more details. It can be combined with dual mapping,
+  //! however, on Linux shared memory is only backed by huge pages when `shmem_enabled` allows it. Blocks that use
+  //! this option are not purged by \ref JitAllocator::purge() as that would split their huge pages.
+  kUseTransparentHugePages = 0x00000100u,
+
+  //! Pre-faults all pages of a block when it's allocated, so the first execution of the code placed in a new block
+  //! doesn't page-fault. See \ref VirtMem::MemoryFlags::kMMapPopulate for more details.
+  kPrefaultBlocks = 0x00000200u,
+
   //! Use a custom fill pattern, must be combined with `kFlagFillUnusedMemory`.
   kCustomFillPattern = 0x10000000u
 };
@@ -110,6 +135,13 @@ ASMJIT_DEFINE_ENUM_FLAGS(JitAllocatorOptions)
 //!
 //! - Internally, the allocator also uses RB tree to keep track of all blocks across all pools. Each inserted block is
 //!   added to the tree so it can be matched fast during `release()` and `shrink()`.
+//!
+//! - Tiny allocations can be served from slabs when `kUseSlabs` is set. Free lists of slabs are kept outside of the
+//!   executable memory as well.
+//!
+//! - Queries don't use the RB tree. Instead, each insertion or removal of a block publishes an immutable sorted array
+//!   of all blocks, and bit-vectors are read optimistically and validated by a sequence number that is incremented
+//!   by each modification, which makes `query()` and `contains()` usable without taking the lock.
 class JitAllocator {
 public:
   ASMJIT_NONCOPYABLE(JitAllocator)
@@ -173,6 +205,23 @@ public:
     //! Only used if \ref JitAllocatorOptions::kCustomFillPattern is set.
     uint32_t fill_pattern = 0;
 
+    //! Address the allocated blocks should be placed near to, for example an address of a function within the
+    //! executable (default none).
+    //!
+    //! If specified, each block is mapped within \ref anchor_range bytes from the anchor if there is a free address
+    //! range, so the code placed in it can reach the anchor's neighborhood by 32-bit relative calls and jumps instead
+    //! of going through the address table (see \ref CodeHolder::relocate_to_base()). Blocks that cannot be placed near
+    //! the anchor are mapped anywhere.
+    //!
+    //! \note The anchor is ignored when \ref JitAllocatorOptions::kUseDualMapping is used.
+    const void* anchor = nullptr;
+
+    //! Maximum distance of all bytes of a block from \ref anchor (default 1GB).
+    //!
+    //! \remarks The default leaves enough room for the anchor's neighborhood (the rest of the executable) to be
+    //! within the ±2GB range of 32-bit relative displacements.
+    size_t anchor_range = 0;
+
     // Reset the content of `CreateParams`.
     ASMJIT_INLINE_NODEBUG void reset() noexcept { *this = CreateParams{}; }
   };
@@ -345,6 +394,13 @@ public:
   //! \remarks This function is thread-safe.
   ASMJIT_API Error release(void* rx) noexcept;
 
+  //! Releases a memory block referenced by `span`, which was returned by `alloc()` or `query()`.
+  //!
+  //! This is the same as `release(span.rx())`, but it doesn't have to look up the block that holds the memory.
+  //!
+  //! \remarks This function is thread-safe.
+  ASMJIT_API Error release(const Span& span) noexcept;
+
   //! Frees extra memory allocated with `rx` by shrinking it to the given `new_size`.
   //!
   //! \remarks This function is thread-safe.
@@ -354,10 +410,68 @@ public:
   //!
   //! If the pointer is matched, the function returns `Error::kOk` and fills `out` with the corresponding span.
   //!
-  //! \remarks This function is thread-safe.
+  //! \remarks This function is thread-safe. It doesn't lock the allocator unless the lock-free query (see \ref
+  //! query_lock_free()) fails because of concurrent modifications.
   [[nodiscard]]
   ASMJIT_API Error query(Out<Span> out, void* rx) const noexcept;
 
+  //! Queries information about an allocated memory block like \ref query(), but never locks the allocator.
+  //!
+  //! Returns \ref Error::kInvalidState if the allocator was being modified during all attempts to read its blocks
+  //! (for example when the function is called by a signal handler that interrupted \ref alloc() or \ref release()
+  //! in the same thread, or during \ref compact()).
+  //!
+  //! \remarks This function is async-signal-safe, thus it can be used by crash handlers and sampling profilers.
+  [[nodiscard]]
+  ASMJIT_API Error query_lock_free(Out<Span> out, void* rx) const noexcept;
+
+  //! Tests whether `rx` points into a block of memory managed by the allocator (either used or unused).
+  //!
+  //! \remarks This function is wait-free and async-signal-safe. It returns false for all addresses in a very rare
+  //! case in which the allocator failed to allocate the list of its blocks used by lock-free queries.
+  [[nodiscard]]
+  ASMJIT_API bool contains(const void* rx) const noexcept;
+
+  //! Returns physical memory of unused pages within all blocks to the operating system.
+  //!
+  //! Blocks are only released when they become completely empty, so a long running application that allocates and
+  //! releases code would keep blocks that are mostly unused, but fully resident. This function scans all blocks for
+  //! page-aligned unused areas and discards them by \ref VirtMem::discard(). The address range stays reserved and
+  //! discarded pages become resident again once they are allocated (and filled with the fill pattern if \ref
+  //! JitAllocatorOptions::kFillUnusedMemory is used).
+  //!
+  //! \note Blocks that use large pages or dual mapping are not purged.
+  //!
+  //! \remarks This function is thread-safe.
+  ASMJIT_API Error purge() noexcept;
+
+  //! \}
+
+  //! \name Compaction
+  //! \{
+
+  //! A function called by \ref compact() to move the content of `src` span to a newly allocated `dst` span.
+  //!
+  //! The function must copy (and relocate if necessary) the content of `src` to `dst` via \ref write() and update
+  //! all references to `src`. When it returns \ref Error::kOk `src` is released, otherwise `dst` is released and
+  //! `src` stays where it is, which is the way of refusing to move spans that cannot be moved.
+  //!
+  //! \note The function is called while the allocator is locked, thus it must not call any other \ref JitAllocator
+  //! member function than \ref write().
+  using RelocateFunc = Error (ASMJIT_CDECL*)(const Span& src, Span& dst, void* user_data) noexcept;
+
+  //! Moves spans out of sparsely used blocks so the blocks can be released.
+  //!
+  //! Blocks are evacuated from the least used one as long as the remaining blocks have enough space to hold all its
+  //! spans - each span is moved to another block by `relocate_fn`, and blocks that became empty are released. Since
+  //! the allocator cannot know which spans are referenced by raw pointers, it's `relocate_fn` that decides whether a
+  //! span can be moved, see \ref JitRuntime::compact(), which uses this function to move relocatable functions.
+  //!
+  //! \note No thread may execute code of spans being moved while the compaction is in progress.
+  //!
+  //! \remarks This function is thread-safe.
+  ASMJIT_API Error compact(RelocateFunc relocate_fn, void* user_data) noexcept;
+
   //! \}
 
   //! \name Write Operations
@@ -552,8 +666,16 @@ public:
     size_t _used_size;
     //! How many bytes are currently reserved by the allocator.
     size_t _reserved_size;
+    //! How many reserved bytes were not returned to the operating system by \ref JitAllocator::purge().
+    size_t _resident_size;
     //! Allocation overhead (in bytes) required to maintain all blocks.
     size_t _overhead_size;
+    //! How many bytes are unused in blocks that hold at least one allocation.
+    size_t _fragmented_size;
+    //! Number of times \ref JitAllocator::compact() was called.
+    size_t _compaction_count;
+    //! How many bytes were moved by \ref JitAllocator::compact() in total.
+    size_t _relocated_size;
 
     //! Resets the statistics to all zeros.
     ASMJIT_INLINE_NODEBUG void reset() noexcept { *this = Statistics{}; }
@@ -578,10 +700,31 @@ public:
     [[nodiscard]]
     ASMJIT_INLINE_NODEBUG size_t reserved_size() const noexcept { return _reserved_size; }
 
+    //! Returns the number of reserved bytes that are backed by physical memory (or would become backed on access).
+    //!
+    //! This is \ref reserved_size() minus the size of pages discarded by \ref JitAllocator::purge().
+    [[nodiscard]]
+    ASMJIT_INLINE_NODEBUG size_t resident_size() const noexcept { return _resident_size; }
+
     //! Returns the number of bytes the allocator needs to manage the allocated memory.
     [[nodiscard]]
     ASMJIT_INLINE_NODEBUG size_t overhead_size() const noexcept { return _overhead_size; }
 
+    //! Returns the number of unused bytes in blocks that hold at least one allocation.
+    //!
+    //! This memory cannot be returned to the operating system unless the blocks are compacted, see \ref
+    //! JitAllocator::compact().
+    [[nodiscard]]
+    ASMJIT_INLINE_NODEBUG size_t fragmented_size() const noexcept { return _fragmented_size; }
+
+    //! Returns how many times \ref JitAllocator::compact() was called.
+    [[nodiscard]]
+    ASMJIT_INLINE_NODEBUG size_t compaction_count() const noexcept { return _compaction_count; }
+
+    //! Returns the number of bytes moved by \ref JitAllocator::compact() in total.
+    [[nodiscard]]
+    ASMJIT_INLINE_NODEBUG size_t relocated_size() const noexcept { return _relocated_size; }
+
     [[nodiscard]]
     ASMJIT_INLINE_NODEBUG double used_ratio() const noexcept {
       return (double(used_size()) / (double(reserved_size()) + 1e-16));
@@ -592,6 +735,11 @@ public:
       return (double(unused_size()) / (double(reserved_size()) + 1e-16));
     }
 
+    [[nodiscard]]
+    ASMJIT_INLINE_NODEBUG double fragmented_ratio() const noexcept {
+      return (double(fragmented_size()) / (double(reserved_size()) + 1e-16));
+    }
+
     [[nodiscard]]
     ASMJIT_INLINE_NODEBUG double overhead_ratio() const noexcept {
       return (double(overhead_size()) / (double(reserved_size()) + 1e-16));
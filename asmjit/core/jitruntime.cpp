@@ -6,11 +6,424 @@
 #include <asmjit/core/api-build_p.h>
 #ifndef ASMJIT_NO_JIT
 
+#include <asmjit/core/codewriter_p.h>
 #include <asmjit/core/cpuinfo.h>
 #include <asmjit/core/jitruntime.h>
+#include <asmjit/core/osutils_p.h>
+#include <asmjit/support/arenalist.h>
+#include <asmjit/support/arenatree.h>
 
 ASMJIT_BEGIN_NAMESPACE
 
+// JitRuntime - Relocatable Functions - Constants
+// ==============================================
+
+// Stubs are only supported on architectures we know how to encode them for.
+#if (ASMJIT_ARCH_X86 != 0) || (ASMJIT_ARCH_ARM == 64)
+static constexpr bool kJitStubsSupported = true;
+#else
+static constexpr bool kJitStubsSupported = false;
+#endif
+
+// Size of a single stub - code followed by a slot holding the address of the function.
+static constexpr uint32_t kJitStubSize = 16u;
+// Offset of the slot within a stub.
+static constexpr uint32_t kJitStubSlotOffset = 8u;
+// Number of stubs in a single chunk.
+static constexpr uint32_t kJitStubChunkCapacity = 256u;
+
+// JitRuntime - Relocatable Functions - Data
+// =========================================
+
+// A value in a relocatable function that depends on the address the function is placed at.
+struct JitRelocatableFixup {
+  //! Offset of the patched region relative to the start of the function.
+  uint32_t offset;
+  //! Relocation type - either `RelocType::kRelToAbs` or `RelocType::kAbsToRel`.
+  RelocType reloc_type;
+  //! Format of the patched value.
+  OffsetFormat format;
+  //! Target offset relative to the start of the function (`kRelToAbs`) or an absolute target address (`kAbsToRel`).
+  uint64_t target;
+};
+
+class JitStubChunk;
+
+// A function added by `JitRuntime::add_relocatable()`, fixups are stored after the structure.
+class JitRelocatableFunc : public ArenaTreeNodeT<JitRelocatableFunc> {
+public:
+  ASMJIT_NONCOPYABLE(JitRelocatableFunc)
+
+  //! Span holding the code of the function.
+  JitAllocator::Span _span;
+  //! Size of the code (span size is aligned to the allocation granularity).
+  size_t _code_size;
+  //! Chunk that holds the stub of the function.
+  JitStubChunk* _chunk;
+  //! Index of the stub in `_chunk`.
+  uint32_t _stub_index;
+  //! Number of fixups.
+  uint32_t _fixup_count;
+  //! Whether the function cannot be moved.
+  bool _pinned;
+
+  ASMJIT_INLINE JitRelocatableFunc(const JitAllocator::Span& span, size_t code_size, uint32_t fixup_count, bool pinned) noexcept
+    : ArenaTreeNodeT(),
+      _span(span),
+      _code_size(code_size),
+      _chunk(nullptr),
+      _stub_index(0),
+      _fixup_count(fixup_count),
+      _pinned(pinned) {}
+
+  static ASMJIT_INLINE_NODEBUG size_t fixups_offset() noexcept {
+    return Support::align_up(sizeof(JitRelocatableFunc), alignof(JitRelocatableFixup));
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint8_t* rx_ptr() const noexcept { return static_cast<uint8_t*>(_span.rx()); }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG JitRelocatableFixup* fixups() noexcept {
+    return reinterpret_cast<JitRelocatableFixup*>(reinterpret_cast<uint8_t*>(this) + fixups_offset());
+  }
+
+  // RBTree default CMP uses '<' and '>' operators.
+  ASMJIT_INLINE_NODEBUG bool operator<(const JitRelocatableFunc& other) const noexcept { return rx_ptr() < other.rx_ptr(); }
+  ASMJIT_INLINE_NODEBUG bool operator>(const JitRelocatableFunc& other) const noexcept { return rx_ptr() > other.rx_ptr(); }
+
+  // Querying functions by the start address of their code.
+  ASMJIT_INLINE_NODEBUG bool operator<(const uint8_t* key) const noexcept { return rx_ptr() < key; }
+  ASMJIT_INLINE_NODEBUG bool operator>(const uint8_t* key) const noexcept { return rx_ptr() > key; }
+};
+
+// A chunk of stubs allocated by `JitAllocator`.
+class JitStubChunk : public ArenaTreeNodeT<JitStubChunk>,
+                     public ArenaListNode<JitStubChunk> {
+public:
+  ASMJIT_NONCOPYABLE(JitStubChunk)
+
+  static inline constexpr uint32_t kBitWordSizeInBits = Support::bit_size_of<Support::BitWord>;
+
+  //! Span holding the stubs.
+  JitAllocator::Span _span;
+  //! Number of used stubs.
+  uint32_t _used_count = 0;
+  //! Used bit-vector (0 = unused, 1 = used).
+  Support::BitWord _used_bit_vector[kJitStubChunkCapacity / kBitWordSizeInBits] {};
+  //! Functions associated with stubs.
+  JitRelocatableFunc* _funcs[kJitStubChunkCapacity] {};
+
+  ASMJIT_INLINE explicit JitStubChunk(const JitAllocator::Span& span) noexcept
+    : ArenaTreeNodeT(),
+      _span(span) {}
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint8_t* rx_ptr() const noexcept { return static_cast<uint8_t*>(_span.rx()); }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG bool is_full() const noexcept { return _used_count == kJitStubChunkCapacity; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint8_t* stub_ptr(uint32_t index) const noexcept { return rx_ptr() + index * kJitStubSize; }
+
+  // RBTree default CMP uses '<' and '>' operators.
+  ASMJIT_INLINE_NODEBUG bool operator<(const JitStubChunk& other) const noexcept { return rx_ptr() < other.rx_ptr(); }
+  ASMJIT_INLINE_NODEBUG bool operator>(const JitStubChunk& other) const noexcept { return rx_ptr() > other.rx_ptr(); }
+
+  // Querying chunks by `key`, which must be in `[ChunkPtr, ChunkPtr + ChunkSize)` range.
+  ASMJIT_INLINE_NODEBUG bool operator<(const uint8_t* key) const noexcept { return rx_ptr() + kJitStubChunkCapacity * kJitStubSize <= key; }
+  ASMJIT_INLINE_NODEBUG bool operator>(const uint8_t* key) const noexcept { return rx_ptr() > key; }
+};
+
+class JitStubTable {
+public:
+  ASMJIT_NONCOPYABLE(JitStubTable)
+
+  //! All chunks in RBTree.
+  ArenaTree<JitStubChunk> chunk_tree;
+  //! All chunks in a double linked list.
+  ArenaList<JitStubChunk> chunks;
+  //! Relocatable functions in RBTree, the key is the address of their code.
+  ArenaTree<JitRelocatableFunc> func_tree;
+
+  ASMJIT_INLINE JitStubTable() noexcept {}
+};
+
+// JitRuntime - Relocatable Functions - Utilities
+// ==============================================
+
+static void JitStubTable_destroy(JitStubTable* table) noexcept {
+  JitStubChunk* chunk = table->chunks.first();
+  while (chunk) {
+    JitStubChunk* next = chunk->next();
+    for (JitRelocatableFunc* func : chunk->_funcs) {
+      ::free(func);
+    }
+    ::free(chunk);
+    chunk = next;
+  }
+
+  table->~JitStubTable();
+  ::free(table);
+}
+
+// Writes `count` stubs to `dst`, which will be executed at `rx`, all slots are zero initialized.
+static void JitStub_init(uint8_t* dst, const uint8_t* rx, uint32_t count) noexcept {
+  for (uint32_t i = 0; i < count; i++, dst += kJitStubSize, rx += kJitStubSize) {
+#if ASMJIT_ARCH_X86 == 64
+    // jmp qword ptr [rip + 2] (the slot follows the instruction and 2 bytes of padding).
+    static const uint8_t stub_code[8] = { 0xFF, 0x25, 0x02, 0x00, 0x00, 0x00, 0xCC, 0xCC };
+    memcpy(dst, stub_code, sizeof(stub_code));
+#elif ASMJIT_ARCH_X86 == 32
+    // jmp dword ptr [slot] (absolute address of the slot).
+    dst[0] = 0xFF;
+    dst[1] = 0x25;
+    Support::storeu_u32_le(dst + 2, uint32_t(uintptr_t(rx + kJitStubSlotOffset)));
+    dst[6] = 0xCC;
+    dst[7] = 0xCC;
+#elif ASMJIT_ARCH_ARM == 64
+    // ldr x16, [pc + 8]; br x16
+    Support::storeu_u32_le(dst + 0, 0x58000050u);
+    Support::storeu_u32_le(dst + 4, 0xD61F0200u);
+#endif
+
+    Support::maybe_unused(rx);
+    memset(dst + kJitStubSlotOffset, 0, kJitStubSize - kJitStubSlotOffset);
+  }
+}
+
+// Calculates the value of `fixup` when the function is placed at `base`.
+static bool JitRelocatableFixup_value(const JitRelocatableFixup& fixup, uint64_t base, int64_t* out) noexcept {
+  uint64_t value = fixup.target;
+
+  if (fixup.reloc_type == RelocType::kRelToAbs) {
+    value += base;
+  }
+  else {
+    value -= base + fixup.offset + fixup.format.region_size();
+
+    // Sign extend as we are not interested in the high 32-bit word in a 32-bit address space.
+    if (sizeof(uintptr_t) <= 4) {
+      value = uint64_t(int64_t(int32_t(value & 0xFFFFFFFFu)));
+    }
+    else if (!Support::is_int_n<32>(int64_t(value))) {
+      return false;
+    }
+  }
+
+  *out = int64_t(value);
+  return true;
+}
+
+// Patches `fixup` in `code`, which was relocated to `old_base` and is being moved to `new_base`.
+static Error JitRelocatableFixup_patch(uint8_t* code, const JitRelocatableFixup& fixup, uint64_t old_base, uint64_t new_base) noexcept {
+  int64_t old_value;
+  int64_t new_value;
+
+  if (!JitRelocatableFixup_value(fixup, old_base, &old_value) ||
+      !JitRelocatableFixup_value(fixup, new_base, &new_value)) {
+    return make_error(Error::kRelocOffsetOutOfRange);
+  }
+
+  // The encoded value was ORed to the instruction, so clear the bits of the old value first.
+  uint8_t* dst = code + fixup.offset + fixup.format.value_offset();
+
+  if (fixup.format.value_size() == 8u) {
+    uint64_t old_mask;
+    uint64_t new_mask;
+
+    if (!CodeWriterUtils::encode_offset64(&old_mask, old_value, fixup.format) ||
+        !CodeWriterUtils::encode_offset64(&new_mask, new_value, fixup.format)) {
+      return make_error(Error::kRelocOffsetOutOfRange);
+    }
+
+    Support::storeu_u64_le(dst, (Support::loadu_u64_le(dst) & ~old_mask) | new_mask);
+    return Error::kOk;
+  }
+
+  uint32_t old_mask;
+  uint32_t new_mask;
+
+  if (!CodeWriterUtils::encode_offset32(&old_mask, old_value, fixup.format) ||
+      !CodeWriterUtils::encode_offset32(&new_mask, new_value, fixup.format)) {
+    return make_error(Error::kRelocOffsetOutOfRange);
+  }
+
+  switch (fixup.format.value_size()) {
+    case 1: Support::store_u8(dst, uint8_t((Support::load_u8(dst) & ~old_mask) | new_mask)); break;
+    case 2: Support::storeu_u16_le(dst, uint16_t((Support::loadu_u16_le(dst) & ~old_mask) | new_mask)); break;
+    case 4: Support::storeu_u32_le(dst, (Support::loadu_u32_le(dst) & ~old_mask) | new_mask); break;
+
+    default:
+      return make_error(Error::kInvalidRelocEntry);
+  }
+
+  return Error::kOk;
+}
+
+// Creates a `JitRelocatableFunc` from relocations of `code`, which was already relocated to `span`.
+static JitRelocatableFunc* JitRelocatableFunc_create(const CodeHolder* code, const JitAllocator::Span& span) noexcept {
+  uint64_t base = code->base_address();
+  uint32_t fixup_count = 0;
+  bool pinned = false;
+
+  // Two passes - the first counts fixups and the second fills them.
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    JitRelocatableFunc* func = nullptr;
+
+    if (pass == 1) {
+      void* p = ::malloc(JitRelocatableFunc::fixups_offset() + sizeof(JitRelocatableFixup) * fixup_count);
+      if (ASMJIT_UNLIKELY(!p)) {
+        return nullptr;
+      }
+      func = new(Support::PlacementNew{p}) JitRelocatableFunc(span, code->code_size(), fixup_count, pinned);
+      fixup_count = 0;
+    }
+
+    for (const RelocEntry* re : code->_relocations) {
+      const Section* source_section = code->section_by_id(re->source_section_id());
+      uint64_t offset = source_section->offset() + re->source_offset();
+      uint64_t target = re->payload();
+
+      switch (re->reloc_type()) {
+        case RelocType::kNone:
+        case RelocType::kAbsToAbs:
+          continue;
+
+        case RelocType::kRelToAbs:
+          target += code->section_by_id(re->target_section_id())->offset();
+          break;
+
+        case RelocType::kAbsToRel:
+          break;
+
+        case RelocType::kX64AddressEntry:
+          // Entries that were resolved through the address table are position independent.
+          if (!Support::is_int_n<32>(int64_t(target - (base + offset + re->format().region_size())))) {
+            continue;
+          }
+          break;
+
+        default:
+          pinned = true;
+          continue;
+      }
+
+      if (func) {
+        JitRelocatableFixup& fixup = func->fixups()[fixup_count];
+        fixup.offset = uint32_t(offset);
+        fixup.reloc_type = re->reloc_type() == RelocType::kRelToAbs ? RelocType::kRelToAbs : RelocType::kAbsToRel;
+        fixup.format = re->format();
+        fixup.target = target;
+      }
+      fixup_count++;
+    }
+
+    if (func) {
+      return func;
+    }
+  }
+
+  return nullptr;
+}
+
+// Called by `JitAllocator::compact()` to move a relocatable function.
+static Error ASMJIT_CDECL JitRuntime_relocate_func(const JitAllocator::Span& src, JitAllocator::Span& dst, void* user_data) noexcept {
+  JitRuntime* rt = static_cast<JitRuntime*>(user_data);
+  JitStubTable* table = rt->_stub_table;
+
+  // Spans that don't hold relocatable functions (including stubs) cannot be moved.
+  JitRelocatableFunc* func = table ? table->func_tree.get(static_cast<uint8_t*>(src.rx())) : nullptr;
+  if (!func || func->_pinned) {
+    return Error::kInvalidState;
+  }
+
+  uint64_t old_base = uint64_t(uintptr_t(src.rx()));
+  uint64_t new_base = uint64_t(uintptr_t(dst.rx()));
+
+  ASMJIT_PROPAGATE(rt->_allocator.write(dst, [&](JitAllocator::Span& span) noexcept -> Error {
+    uint8_t* rw = static_cast<uint8_t*>(span.rw());
+    memcpy(rw, src.rx(), func->_code_size);
+
+    JitRelocatableFixup* fixups = func->fixups();
+    for (uint32_t i = 0; i < func->_fixup_count; i++) {
+      ASMJIT_PROPAGATE(JitRelocatableFixup_patch(rw, fixups[i], old_base, new_base));
+    }
+    return Error::kOk;
+  }));
+
+  // Redirect the stub to the new location.
+  JitStubChunk* chunk = func->_chunk;
+  uintptr_t slot_value = uintptr_t(dst.rx());
+  ASMJIT_PROPAGATE(rt->_allocator.write(chunk->_span, func->_stub_index * kJitStubSize + kJitStubSlotOffset, &slot_value, sizeof(slot_value)));
+
+  // Removed nodes keep their links, which must be cleared before the node can be inserted again.
+  table->func_tree.remove(func);
+  func->_tree_nodes[0] = 0;
+  func->_tree_nodes[1] = 0;
+
+  func->_span = dst;
+  table->func_tree.insert(func);
+
+  return Error::kOk;
+}
+
+// Finds an unused stub (creates the stub table and a new chunk if necessary), must be called with `_stub_lock` held.
+static Error JitRuntime_alloc_stub(JitRuntime* rt, JitStubChunk** chunk_out, uint32_t* index_out) noexcept {
+  JitStubTable* table = rt->_stub_table;
+
+  if (!table) {
+    void* p = ::malloc(sizeof(JitStubTable));
+    if (ASMJIT_UNLIKELY(!p)) {
+      return make_error(Error::kOutOfMemory);
+    }
+
+    table = new(Support::PlacementNew{p}) JitStubTable();
+    rt->_stub_table = table;
+  }
+
+  JitStubChunk* chunk = table->chunks.first();
+  while (chunk && chunk->is_full()) {
+    chunk = chunk->next();
+  }
+
+  if (!chunk) {
+    JitAllocator& allocator = rt->allocator();
+
+    JitAllocator::Span span;
+    ASMJIT_PROPAGATE(allocator.alloc(Out(span), kJitStubChunkCapacity * kJitStubSize));
+
+    void* p = ::malloc(sizeof(JitStubChunk));
+    if (ASMJIT_UNLIKELY(!p)) {
+      allocator.release(span.rx());
+      return make_error(Error::kOutOfMemory);
+    }
+
+    Error err = allocator.write(span, [&](JitAllocator::Span& span) noexcept -> Error {
+      JitStub_init(static_cast<uint8_t*>(span.rw()), static_cast<const uint8_t*>(span.rx()), kJitStubChunkCapacity);
+      return Error::kOk;
+    });
+
+    if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+      ::free(p);
+      allocator.release(span.rx());
+      return err;
+    }
+
+    chunk = new(Support::PlacementNew{p}) JitStubChunk(span);
+    table->chunk_tree.insert(chunk);
+    table->chunks.append(chunk);
+  }
+
+  *chunk_out = chunk;
+  *index_out = uint32_t(Support::bit_vector_index_of(chunk->_used_bit_vector, 0, false));
+  return Error::kOk;
+}
+
+// JitRuntime - Construction & Destruction
+// =======================================
+
 JitRuntime::JitRuntime(const JitAllocator::CreateParams* params) noexcept
   : _allocator(params) {
   _environment = Environment::host();
@@ -21,11 +434,32 @@ JitRuntime::JitRuntime(const JitAllocator::CreateParams* params) noexcept
   _cpu_hints = host_cpu.hints();
 }
 
-JitRuntime::~JitRuntime() noexcept {}
+JitRuntime::~JitRuntime() noexcept {
+  if (_stub_table) {
+    JitStubTable_destroy(_stub_table);
+  }
+}
+
+// JitRuntime - Reset
+// ==================
 
-Error JitRuntime::_add(void** dst, CodeHolder* code) noexcept {
-  *dst = nullptr;
+void JitRuntime::reset(ResetPolicy reset_policy) noexcept {
+  {
+    LockGuard guard(_stub_lock);
+    if (_stub_table) {
+      JitStubTable_destroy(_stub_table);
+      _stub_table = nullptr;
+    }
+  }
 
+  _allocator.reset(reset_policy);
+}
+
+// JitRuntime - Add & Release
+// ==========================
+
+// Relocates the code stored in `code` into a newly allocated span.
+static Error JitRuntime_add_code(JitAllocator& allocator, CodeHolder* code, JitAllocator::Span& span) noexcept {
   ASMJIT_PROPAGATE(code->flatten());
   ASMJIT_PROPAGATE(code->resolve_cross_section_fixups());
 
@@ -34,14 +468,13 @@ Error JitRuntime::_add(void** dst, CodeHolder* code) noexcept {
     return make_error(Error::kNoCodeGenerated);
   }
 
-  JitAllocator::Span span;
-  ASMJIT_PROPAGATE(_allocator.alloc(Out(span), estimated_code_size));
+  ASMJIT_PROPAGATE(allocator.alloc(Out(span), estimated_code_size));
 
   // Relocate the code.
   CodeHolder::RelocationSummary relocation_summary;
   Error err = code->relocate_to_base(uintptr_t(span.rx()), &relocation_summary);
   if (ASMJIT_UNLIKELY(err != Error::kOk)) {
-    _allocator.release(span.rx());
+    allocator.release(span.rx());
     return err;
   }
 
@@ -52,7 +485,7 @@ Error JitRuntime::_add(void** dst, CodeHolder* code) noexcept {
   // If not true it means that `relocate_to_base()` filled wrong information in `relocation_summary`.
   ASMJIT_ASSERT(code_size == code->code_size());
 
-  _allocator.write(span, [&](JitAllocator::Span& span) noexcept -> Error {
+  allocator.write(span, [&](JitAllocator::Span& span) noexcept -> Error {
     uint8_t* rw = static_cast<uint8_t*>(span.rw());
 
     for (Section* section : code->_sections) {
@@ -73,14 +506,108 @@ Error JitRuntime::_add(void** dst, CodeHolder* code) noexcept {
     return Error::kOk;
   });
 
+  return Error::kOk;
+}
+
+Error JitRuntime::_add(void** dst, CodeHolder* code) noexcept {
+  *dst = nullptr;
+
+  JitAllocator::Span span;
+  ASMJIT_PROPAGATE(JitRuntime_add_code(_allocator, code, span));
+
   *dst = span.rx();
   return Error::kOk;
 }
 
+Error JitRuntime::_add_relocatable(void** dst, CodeHolder* code) noexcept {
+  *dst = nullptr;
+
+  if (!kJitStubsSupported) {
+    return make_error(Error::kFeatureNotEnabled);
+  }
+
+  JitAllocator::Span span;
+  ASMJIT_PROPAGATE(JitRuntime_add_code(_allocator, code, span));
+
+  JitRelocatableFunc* func = JitRelocatableFunc_create(code, span);
+  if (ASMJIT_UNLIKELY(!func)) {
+    _allocator.release(span.rx());
+    return make_error(Error::kOutOfMemory);
+  }
+
+  LockGuard guard(_stub_lock);
+
+  JitStubChunk* chunk;
+  uint32_t stub_index;
+  Error err = JitRuntime_alloc_stub(this, &chunk, &stub_index);
+
+  uintptr_t slot_value = uintptr_t(span.rx());
+  if (err == Error::kOk) {
+    err = _allocator.write(chunk->_span, stub_index * kJitStubSize + kJitStubSlotOffset, &slot_value, sizeof(slot_value));
+  }
+
+  if (ASMJIT_UNLIKELY(err != Error::kOk)) {
+    ::free(func);
+    _allocator.release(span.rx());
+    return err;
+  }
+
+  Support::bit_vector_set_bit(chunk->_used_bit_vector, stub_index, true);
+  chunk->_used_count++;
+  chunk->_funcs[stub_index] = func;
+
+  func->_chunk = chunk;
+  func->_stub_index = stub_index;
+  _stub_table->func_tree.insert(func);
+
+  *dst = chunk->stub_ptr(stub_index);
+  return Error::kOk;
+}
+
 Error JitRuntime::_release(void* p) noexcept {
+  {
+    LockGuard guard(_stub_lock);
+    JitStubTable* table = _stub_table;
+
+    JitStubChunk* chunk = table ? table->chunk_tree.get(static_cast<uint8_t*>(p)) : nullptr;
+    if (chunk) {
+      size_t offset = size_t(static_cast<uint8_t*>(p) - chunk->rx_ptr());
+      uint32_t stub_index = uint32_t(offset / kJitStubSize);
+
+      if (ASMJIT_UNLIKELY(offset % kJitStubSize != 0u || !Support::bit_vector_get_bit(chunk->_used_bit_vector, stub_index))) {
+        return make_error(Error::kInvalidArgument);
+      }
+
+      JitRelocatableFunc* func = chunk->_funcs[stub_index];
+      table->func_tree.remove(func);
+      Error err = _allocator.release(func->_span.rx());
+      ::free(func);
+
+      Support::bit_vector_set_bit(chunk->_used_bit_vector, stub_index, false);
+      chunk->_funcs[stub_index] = nullptr;
+
+      if (--chunk->_used_count == 0u) {
+        table->chunk_tree.remove(chunk);
+        table->chunks.unlink(chunk);
+        _allocator.release(chunk->_span.rx());
+        ::free(chunk);
+      }
+
+      return err;
+    }
+  }
+
   return _allocator.release(p);
 }
 
+// JitRuntime - Compaction
+// =======================
+
+Error JitRuntime::compact() noexcept {
+  LockGuard guard(_stub_lock);
+  return _allocator.compact(JitRuntime_relocate_func, this);
+}
+
 ASMJIT_END_NAMESPACE
 
 #endif
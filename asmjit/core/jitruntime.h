@@ -11,11 +11,13 @@
 
 #include <asmjit/core/codeholder.h>
 #include <asmjit/core/jitallocator.h>
+#include <asmjit/core/osutils.h>
 #include <asmjit/core/target.h>
 
 ASMJIT_BEGIN_NAMESPACE
 
 class CodeHolder;
+class JitStubTable;
 
 //! \addtogroup asmjit_virtual_memory
 //! \{
@@ -30,6 +32,10 @@ public:
 
   //! Virtual memory allocator.
   JitAllocator _allocator;
+  //! Lock that guards `_stub_table`.
+  Lock _stub_lock;
+  //! Stubs and relocation data of functions added by \ref add_relocatable() (allocated on demand).
+  JitStubTable* _stub_table = nullptr;
 
   //! \name Construction & Destruction
   //! \{
@@ -54,9 +60,9 @@ public:
   //! Depending on `reset_policy` the currently held memory can be either freed entirely when ResetPolicy::kHard is used,
   //! or the allocator can keep some of it for next allocations when ResetPolicy::kSoft is used, which is the default
   //! behavior.
-  ASMJIT_INLINE_NODEBUG void reset(ResetPolicy reset_policy = ResetPolicy::kSoft) noexcept {
-    _allocator.reset(reset_policy);
-  }
+  //!
+  //! \note Stubs of relocatable functions are released as well, see \ref add_relocatable().
+  ASMJIT_API void reset(ResetPolicy reset_policy = ResetPolicy::kSoft) noexcept;
 
   //! \}
 
@@ -84,7 +90,22 @@ public:
     return _add(Support::ptr_cast_impl<void**, Func*>(dst), code);
   }
 
-  //! Releases `p` which was obtained by calling `add()`.
+  //! Allocates memory needed for a code stored in the `CodeHolder` like \ref add(), but returns an entry stub that
+  //! stays valid when the function is moved by \ref compact().
+  //!
+  //! The stub is a small thunk that jumps to the function through a slot that holds its address (`jmp [slot]` on
+  //! X86 and `ldr x16, slot` followed by `br x16` on AArch64). The runtime keeps the location of all values in the
+  //! code that depend on its address (absolute addresses of the code itself and relative displacements to external
+  //! targets), so the code can be relocated when it's moved. Functions that use relocations that cannot be redone
+  //! (expressions) are never moved, but they are still called through a stub.
+  //!
+  //! The returned stub must be released by \ref release().
+  template<typename Func>
+  ASMJIT_INLINE_NODEBUG Error add_relocatable(Func* dst, CodeHolder* code) noexcept {
+    return _add_relocatable(Support::ptr_cast_impl<void**, Func*>(dst), code);
+  }
+
+  //! Releases `p` which was obtained by calling `add()` or \ref add_relocatable().
   template<typename Func>
   ASMJIT_INLINE_NODEBUG Error release(Func p) noexcept {
     return _release(Support::ptr_cast_impl<void*, Func>(p));
@@ -93,9 +114,23 @@ public:
   //! Type-unsafe version of `add()`.
   ASMJIT_API virtual Error _add(void** dst, CodeHolder* code) noexcept;
 
+  //! Type-unsafe version of `add_relocatable()`.
+  ASMJIT_API Error _add_relocatable(void** dst, CodeHolder* code) noexcept;
+
   //! Type-unsafe version of `release()`.
   ASMJIT_API virtual Error _release(void* p) noexcept;
 
+  //! Moves relocatable functions (see \ref add_relocatable()) out of sparsely used blocks, updates their stubs, and
+  //! releases blocks that became empty.
+  //!
+  //! Functions added by \ref add() are never moved as the runtime doesn't know who references them. Use \ref
+  //! JitAllocator::Statistics::fragmented_size() to decide whether compaction is worth it and \ref
+  //! JitAllocator::Statistics::relocated_size() to see how much code it moved.
+  //!
+  //! \note No thread may execute relocatable functions while the compaction is in progress as their code can be moved
+  //! and the previous location released.
+  ASMJIT_API Error compact() noexcept;
+
   //! \}
 };
 
@@ -0,0 +1,259 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core/api-build_p.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/logger.h>
+#include <asmjit/core/peepholepass.h>
+#include <asmjit/support/support.h>
+
+#if !defined(ASMJIT_NO_X86)
+  #include <asmjit/x86/x86peephole_p.h>
+#endif
+
+#if !defined(ASMJIT_NO_AARCH64)
+  #include <asmjit/arm/a64peephole_p.h>
+#endif
+
+ASMJIT_BEGIN_NAMESPACE
+
+// PeepholePass - Generic Rules
+// ============================
+
+// Removes register to register copies (instructions having InstRWFlags::kMovOp) that don't change the destination:
+//
+//   - copy to self (`mov a, a`)
+//   - copy back (`mov b, a` followed by `mov a, b`)
+//   - duplicate copy (`mov b, a` followed by `mov b, a`)
+//
+// Copies that zero extend the destination are never removed as they change bytes of the destination that were not
+// part of the copy (for example `mov eax, eax` in 64-bit mode or `vmovaps xmm0, xmm0` on AVX-512 hardware).
+static PeepholeResult ASMJIT_CDECL peephole_redundant_copy(PeepholePass& pass, InstNode* node) {
+  if (node->op_count() != 2u || node->has_extra_reg()) {
+    return PeepholeResult::kNone;
+  }
+
+  InstRWInfo rw_info;
+  if (pass.query_rw_info(node, &rw_info) != Error::kOk || !rw_info.is_mov_op()) {
+    return PeepholeResult::kNone;
+  }
+
+  const OpRWInfo& dst_rw = rw_info.operand(0);
+  if (dst_rw.extend_byte_mask() != 0u) {
+    return PeepholeResult::kNone;
+  }
+
+  const Operand& dst = node->op(0);
+  const Operand& src = node->op(1);
+
+  if (dst == src) {
+    return PeepholeResult::kRemove;
+  }
+
+  InstNode* prev = PeepholePass::prev_inst(node);
+  if (!prev || prev->op_count() != 2u || prev->has_extra_reg()) {
+    return PeepholeResult::kNone;
+  }
+
+  InstRWInfo prev_rw_info;
+  if (pass.query_rw_info(prev, &prev_rw_info) != Error::kOk || !prev_rw_info.is_mov_op()) {
+    return PeepholeResult::kNone;
+  }
+
+  if (prev->inst_id() == node->inst_id() && prev->op(0) == dst && prev->op(1) == src) {
+    return PeepholeResult::kRemove;
+  }
+
+  if (prev->op(0) == src && prev->op(1) == dst) {
+    // The bytes copied back must be a subset of bytes copied by the previous instruction.
+    if ((dst_rw.write_byte_mask() & ~prev_rw_info.operand(0).write_byte_mask()) == 0u) {
+      return PeepholeResult::kRemove;
+    }
+  }
+
+  return PeepholeResult::kNone;
+}
+
+static const PeepholeRule peephole_generic_rules[] = {
+  { BaseInst::kIdNone, peephole_redundant_copy }
+};
+
+// PeepholePass - Construction & Destruction
+// =========================================
+
+static Span<const PeepholeRule> peephole_arch_rules(Arch arch) noexcept {
+#if !defined(ASMJIT_NO_X86)
+  if (Environment::is_family_x86(arch)) {
+    return x86::PeepholeInternal::default_rules();
+  }
+#endif
+
+#if !defined(ASMJIT_NO_AARCH64)
+  if (Environment::is_family_aarch64(arch)) {
+    return a64::PeepholeInternal::default_rules();
+  }
+#endif
+
+  Support::maybe_unused(arch);
+  return Span<const PeepholeRule>();
+}
+
+PeepholePass::PeepholePass(BaseBuilder& cb) noexcept
+  : Pass(cb, "PeepholePass"),
+    _arch(cb.arch()),
+    _arch_rules(peephole_arch_rules(cb.arch())) {}
+
+PeepholePass::~PeepholePass() noexcept {}
+
+// PeepholePass - Rules
+// ====================
+
+Error PeepholePass::add_rule(InstId inst_id, PeepholeFunc func) noexcept {
+  if (ASMJIT_UNLIKELY(!func)) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  return _rules.append(cb()._builder_arena, PeepholeRule{inst_id, func});
+}
+
+// PeepholePass - Helpers
+// ======================
+
+bool PeepholePass::are_flags_dead_after(const InstNode* node, CpuRWFlags flags) const noexcept {
+  const BaseNode* cur = node->next();
+  flags &= _used_flags;
+
+  while (flags != CpuRWFlags::kNone) {
+    if (!cur || cur->type() != NodeType::kInst) {
+      return false;
+    }
+
+    InstRWInfo rw_info;
+    if (query_rw_info(cur->as<InstNode>(), &rw_info) != Error::kOk || Support::test(rw_info.read_flags(), flags)) {
+      return false;
+    }
+
+    flags &= ~rw_info.write_flags();
+    cur = cur->next();
+  }
+
+  return true;
+}
+
+// PeepholePass - Run
+// ==================
+
+static PeepholeResult peephole_match(PeepholePass& pass, Span<const PeepholeRule> rules, InstNode* node) noexcept {
+  InstId real_id = node->real_id();
+
+  for (const PeepholeRule& rule : rules) {
+    if (rule.inst_id == BaseInst::kIdNone || rule.inst_id == real_id) {
+      PeepholeResult result = rule.func(pass, node);
+      if (result != PeepholeResult::kNone) {
+        return result;
+      }
+    }
+  }
+
+  return PeepholeResult::kNone;
+}
+
+Error PeepholePass::run(Arena& arena, Logger* logger) {
+  Support::maybe_unused(arena);
+
+  _func_stats.clear();
+  _removed_count = 0;
+  _rewritten_count = 0;
+  _used_flags = CpuRWFlags::kNone;
+
+  for (BaseNode* node = cb().first_node(); node; node = node->next()) {
+    if (node->is_inst()) {
+      InstRWInfo rw_info;
+      if (query_rw_info(node->as<InstNode>(), &rw_info) != Error::kOk) {
+        // Be conservative if an instruction cannot be analyzed.
+        _used_flags = ~CpuRWFlags::kNone;
+        break;
+      }
+      _used_flags |= rw_info.read_flags();
+    }
+  }
+
+  Span<const PeepholeRule> generic_rules(peephole_generic_rules, ASMJIT_ARRAY_SIZE(peephole_generic_rules));
+  Span<const PeepholeRule> user_rules(_rules.data(), _rules.size());
+  PeepholeFuncStats* stats = nullptr;
+
+  BaseNode* node = cb().first_node();
+  while (node) {
+    BaseNode* next = node->next();
+
+    if (node->type() == NodeType::kFunc) {
+      ASMJIT_PROPAGATE(_func_stats.append(cb()._builder_arena, PeepholeFuncStats{node->as<LabelNode>(), 0u, 0u}));
+      stats = &_func_stats[_func_stats.size() - 1u];
+    }
+    else if (node->type() == NodeType::kInst) {
+      InstNode* inst = node->as<InstNode>();
+      PeepholeResult result = PeepholeResult::kNone;
+      bool rewritten = false;
+
+      for (uint32_t i = 0; i < kMaxRewriteCount; i++) {
+        result = peephole_match(*this, generic_rules, inst);
+        if (result == PeepholeResult::kNone) {
+          result = peephole_match(*this, _arch_rules, inst);
+        }
+        if (result == PeepholeResult::kNone) {
+          result = peephole_match(*this, user_rules, inst);
+        }
+
+        if (result != PeepholeResult::kRewritten) {
+          break;
+        }
+        rewritten = true;
+      }
+
+      if (result == PeepholeResult::kRemove || rewritten) {
+        if (!stats) {
+          ASMJIT_PROPAGATE(_func_stats.append(cb()._builder_arena, PeepholeFuncStats{nullptr, 0u, 0u}));
+          stats = &_func_stats[_func_stats.size() - 1u];
+        }
+
+        if (result == PeepholeResult::kRemove) {
+          cb().remove_node(inst);
+          stats->removed_count++;
+          _removed_count++;
+        }
+        else {
+          stats->rewritten_count++;
+          _rewritten_count++;
+        }
+      }
+    }
+
+    node = next;
+  }
+
+#ifndef ASMJIT_NO_LOGGING
+  if (logger) {
+    for (const PeepholeFuncStats& s : _func_stats) {
+      if (s.removed_count || s.rewritten_count) {
+        if (s.func) {
+          logger->logf("[PeepholePass] Function L%u: %u removed, %u rewritten\n", s.func->label_id(), s.removed_count, s.rewritten_count);
+        }
+        else {
+          logger->logf("[PeepholePass] Code: %u removed, %u rewritten\n", s.removed_count, s.rewritten_count);
+        }
+      }
+    }
+  }
+#else
+  Support::maybe_unused(logger);
+#endif // !ASMJIT_NO_LOGGING
+
+  return Error::kOk;
+}
+
+ASMJIT_END_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
@@ -0,0 +1,207 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#ifndef ASMJIT_CORE_PEEPHOLEPASS_H_INCLUDED
+#define ASMJIT_CORE_PEEPHOLEPASS_H_INCLUDED
+
+#include <asmjit/core/api-config.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/builder.h>
+#include <asmjit/core/inst.h>
+#include <asmjit/support/arenavector.h>
+#include <asmjit/support/span.h>
+
+ASMJIT_BEGIN_NAMESPACE
+
+//! \addtogroup asmjit_builder
+//! \{
+
+class PeepholePass;
+
+//! Result of a \ref PeepholeFunc.
+enum class PeepholeResult : uint8_t {
+  //! The rule didn't match, the instruction was not changed.
+  kNone = 0,
+  //! The instruction was rewritten in place - rules are matched again against the rewritten instruction.
+  kRewritten = 1,
+  //! The instruction is redundant and should be removed (the pass removes it).
+  kRemove = 2
+};
+
+//! Peephole rule function.
+//!
+//! The function receives the instruction that matched \ref PeepholeRule::inst_id and can inspect its neighbors, but
+//! it's only allowed to modify the matched instruction (either rewrite it in place or return \ref
+//! PeepholeResult::kRemove to have it removed).
+using PeepholeFunc = PeepholeResult (ASMJIT_CDECL*)(PeepholePass& pass, InstNode* node);
+
+//! Peephole rule - a pair of instruction id and a function that implements the rule.
+struct PeepholeRule {
+  //! Instruction id the rule matches (real id without architecture specific parts), or \ref BaseInst::kIdNone to
+  //! match all instructions.
+  InstId inst_id;
+  //! Rule function.
+  PeepholeFunc func;
+};
+
+//! Statistics of a single function (or of code outside of functions) collected by \ref PeepholePass.
+struct PeepholeFuncStats {
+  //! Function node (\ref NodeType::kFunc) or null if the code is not part of a function.
+  const LabelNode* func;
+  //! Number of removed instructions.
+  uint32_t removed_count;
+  //! Number of rewritten instructions.
+  uint32_t rewritten_count;
+};
+
+//! Peephole optimization pass.
+//!
+//! Matches table-driven rules against instructions and removes or rewrites instructions that are redundant. Built-in
+//! rules are added for the target architecture when the pass is created, and more rules can be added by \ref
+//! add_rule(). All built-in rules use \ref InstAPI::query_rw_info() to verify that the transformation doesn't change
+//! observable state (registers, zero extension, and CPU flags that are read later).
+//!
+//! The pass is designed to run after register allocation, so it should be added after the Compiler has been attached
+//! to \ref CodeHolder:
+//!
+//! ```
+//! cc.add_pass<PeepholePass>();
+//! ```
+//!
+//! Built-in rules:
+//!
+//!   - Removes copies to self that don't zero extend the destination (`mov rax, rax`, `movaps xmm0, xmm0`).
+//!   - Removes copies that copy a value back or duplicate the previous copy (`mov b, a` + `mov a, b`).
+//!   - X86|X64: Removes `and`, `or`, `xor`, `add`, `sub`, and shifts with identity immediates if the flags they
+//!     write are not read later.
+//!   - X86|X64: Forwards a stored register to a load of the same memory (typically a spill followed by a reload).
+//!   - X86|X64: Rewrites `cmp reg, 0` to `test reg, reg` and removes `test reg, reg` if the flags were already set
+//!     by a previous instruction the same way.
+//!   - AArch64: Removes `add` and `sub` of zero to the same register.
+class ASMJIT_VIRTAPI PeepholePass : public Pass {
+public:
+  ASMJIT_NONCOPYABLE(PeepholePass)
+  using Base = Pass;
+
+  //! \name Constants
+  //! \{
+
+  //! Maximum number of times rules are matched against the same instruction (after it has been rewritten).
+  static inline constexpr uint32_t kMaxRewriteCount = 4u;
+
+  //! \}
+
+  //! \name Members
+  //! \{
+
+  //! Target architecture.
+  Arch _arch;
+  //! Built-in rules specific to the target architecture.
+  Span<const PeepholeRule> _arch_rules;
+  //! Rules added by \ref add_rule().
+  ArenaVector<PeepholeRule> _rules;
+  //! CPU flags read by at least one instruction (flags that are never read are dead everywhere).
+  CpuRWFlags _used_flags = CpuRWFlags::kNone;
+  //! Statistics of each function processed by the last run.
+  ArenaVector<PeepholeFuncStats> _func_stats;
+  //! Number of removed instructions by the last run.
+  size_t _removed_count = 0;
+  //! Number of rewritten instructions by the last run.
+  size_t _rewritten_count = 0;
+
+  //! \}
+
+  //! \name Construction & Destruction
+  //! \{
+
+  //! Creates a new peephole pass having built-in rules of the target architecture.
+  ASMJIT_API explicit PeepholePass(BaseBuilder& cb) noexcept;
+  ASMJIT_API ~PeepholePass() noexcept override;
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns the target architecture.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG Arch arch() const noexcept { return _arch; }
+
+  //! Returns rules added by \ref add_rule() (built-in rules are not included).
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG Span<const PeepholeRule> rules() const noexcept { return Span<const PeepholeRule>(_rules.data(), _rules.size()); }
+
+  //! Returns per function statistics collected by the last run.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG Span<const PeepholeFuncStats> func_stats() const noexcept { return Span<const PeepholeFuncStats>(_func_stats.data(), _func_stats.size()); }
+
+  //! Returns the number of instructions removed by the last run.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG size_t removed_count() const noexcept { return _removed_count; }
+
+  //! Returns the number of instructions rewritten by the last run.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG size_t rewritten_count() const noexcept { return _rewritten_count; }
+
+  //! \}
+
+  //! \name Rules
+  //! \{
+
+  //! Adds a rule that matches instructions of the given `inst_id` (or all instructions if `inst_id` is \ref
+  //! BaseInst::kIdNone). Rules are matched in the order they were added, built-in rules are always first.
+  ASMJIT_API Error add_rule(InstId inst_id, PeepholeFunc func) noexcept;
+
+  //! \}
+
+  //! \name Helpers for Rules
+  //! \{
+
+  //! Returns the instruction that directly precedes `node` or null if the previous node is not an instruction.
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG InstNode* prev_inst(const BaseNode* node) noexcept {
+    BaseNode* prev = node->prev();
+    return prev && prev->type() == NodeType::kInst ? prev->as<InstNode>() : nullptr;
+  }
+
+  //! Returns the instruction that directly follows `node` or null if the next node is not an instruction.
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG InstNode* next_inst(const BaseNode* node) noexcept {
+    BaseNode* next = node->next();
+    return next && next->type() == NodeType::kInst ? next->as<InstNode>() : nullptr;
+  }
+
+  //! Queries read/write information of the given instruction `node`.
+  [[nodiscard]]
+  ASMJIT_INLINE Error query_rw_info(const InstNode* node, InstRWInfo* out) const noexcept {
+    return InstAPI::query_rw_info(_arch, node->baseInst(), node->operands_data(), node->op_count(), out);
+  }
+
+  //! Tests whether none of the given CPU `flags` is read after `node` before being overwritten.
+  //!
+  //! Flags that are not read by any instruction of the code are always dead (CPU flags are not preserved across
+  //! function calls). Otherwise the analysis is local to the instructions that follow `node` - if a node that is not
+  //! an instruction is found (label, jump, function return, ...) or an instruction cannot be analyzed, flags are
+  //! considered live.
+  [[nodiscard]]
+  ASMJIT_API bool are_flags_dead_after(const InstNode* node, CpuRWFlags flags) const noexcept;
+
+  //! \}
+
+  //! \name Pass Interface
+  //! \{
+
+  ASMJIT_API Error run(Arena& arena, Logger* logger) override;
+
+  //! \}
+};
+
+//! \}
+
+ASMJIT_END_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
+#endif // ASMJIT_CORE_PEEPHOLEPASS_H_INCLUDED
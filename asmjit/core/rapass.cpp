@@ -87,7 +87,8 @@ static ASMJIT_INLINE void RAPass_prepare_logging(BaseRAPass& pass, Logger* logge
   else {
     pass._format_options.reset();
     pass._diagnostic_options = diag & ~(DiagnosticOptions::kRADebugCFG |
-                                       DiagnosticOptions::kRADebugUnreachable);
+                                       DiagnosticOptions::kRADebugUnreachable |
+                                       DiagnosticOptions::kRADebugDeadCode);
   }
 }
 
@@ -231,6 +232,7 @@ Error BaseRAPass::run_on_function(Arena& arena, FuncNode* func, [[maybe_unused]]
   _injection_end = nullptr;
 
   // Reset `Arena` as nothing should persist between `run_on_function()` calls.
+  _cb._record_pass_arena_usage(arena, BuilderMemoryCategory::kRAFunction);
   arena.reset();
 
   // We alter the compiler cursor, because it doesn't make sense to reference it after the compilation - some nodes
@@ -248,6 +250,10 @@ Error BaseRAPass::on_perform_all_steps() noexcept {
   ASMJIT_PROPAGATE(build_cfg_views());
   ASMJIT_PROPAGATE(remove_unreachable_code());
   ASMJIT_PROPAGATE(build_cfg_dominators());
+  if (cc().has_compiler_option(CompilerOptions::kRemoveDeadCode)) {
+    ASMJIT_PROPAGATE(remove_dead_code());
+  }
+
   ASMJIT_PROPAGATE(build_reg_ids());
   ASMJIT_PROPAGATE(build_liveness());
   ASMJIT_PROPAGATE(assign_arg_index_to_work_regs());
@@ -766,6 +772,390 @@ bool BaseRAPass::is_next_to(BaseNode* node, BaseNode* target) noexcept {
   }
 }
 
+// BaseRAPass - Dead Code Elimination
+// ==================================
+
+// Returns a work register of a stack area (created by `BaseCompiler::_new_stack()`) referenced by `op`, or null.
+static ASMJIT_INLINE RAWorkReg* RAPass_stack_area_of(BaseRAPass* pass, const Operand_& op) noexcept {
+  if (!op.is_mem() || !op.as<BaseMem>().is_reg_home()) {
+    return nullptr;
+  }
+
+  Span<VirtReg*> virt_regs = pass->cc().virt_regs();
+  uint32_t virt_index = Operand::virt_id_to_index(op.as<BaseMem>().base_id());
+
+  if (virt_index >= virt_regs.size() || !virt_regs[virt_index]->is_stack_area()) {
+    return nullptr;
+  }
+
+  return virt_regs[virt_index]->work_reg();
+}
+
+static bool RAPass_is_dead_inst(
+  BaseRAPass* pass,
+  const InstNode* inst,
+  const InstRWInfo& rw_info,
+  CpuRWFlags live_flags,
+  Span<const BitWord> live,
+  Span<const BitWord> escaped_stack_areas
+) noexcept {
+  // Instructions having side effects that are not described by RW information are never removed. Integer division
+  // is kept as well as it can trap, which could be intentional.
+  InstSchedClass sched_class;
+  if (InstAPI::query_sched_class(pass->cc().arch(), inst->baseInst(), inst->operands_data(), inst->op_count(), &sched_class) != Error::kOk ||
+      sched_class == InstSchedClass::kBarrier ||
+      sched_class == InstSchedClass::kDiv) {
+    return false;
+  }
+
+  if (Support::test(rw_info.write_flags(), live_flags)) {
+    return false;
+  }
+
+  if (inst->has_extra_reg() && inst->extra_reg().is_phys_reg()) {
+    return false;
+  }
+
+  // An instruction that doesn't write anything observable is not considered dead (for example a prefetch).
+  bool has_outputs = rw_info.write_flags() != CpuRWFlags::kNone;
+
+  Span<const Operand> operands = inst->operands();
+  for (size_t i = 0; i < operands.size(); i++) {
+    const Operand& op = operands[i];
+
+    if (op.is_reg()) {
+      // Physical registers can be used by the code outside of RA's control.
+      if (op.as<Reg>().is_phys_reg()) {
+        return false;
+      }
+    }
+    else if (op.is_mem()) {
+      // The only memory that can be accessed by a dead instruction is a stack area that is never read - any other
+      // memory access (even a load) can be observable, for example it can fault or it can read memory mapped I/O.
+      RAWorkReg* stack_area = RAPass_stack_area_of(pass, op);
+      if (!stack_area || BitOps::bit_at(escaped_stack_areas, stack_area->work_id())) {
+        return false;
+      }
+
+      if (rw_info.operand(i).is_write()) {
+        has_outputs = true;
+      }
+    }
+  }
+
+  const RAInst* ra_inst = inst->pass_data<RAInst>();
+  uint32_t tied_count = ra_inst->tied_count();
+
+  for (uint32_t i = 0; i < tied_count; i++) {
+    const RATiedReg* tied_reg = ra_inst->tied_at(i);
+
+    if (tied_reg->has_any_consecutive_flag()) {
+      return false;
+    }
+
+    if (tied_reg->is_write()) {
+      if (BitOps::bit_at(live, tied_reg->work_reg()->work_id())) {
+        return false;
+      }
+      has_outputs = true;
+    }
+  }
+
+  return has_outputs;
+}
+
+Error BaseRAPass::remove_dead_code() noexcept {
+  uint32_t work_reg_count = _total_work_reg_count;
+
+  // Nothing can be removed if the function doesn't use virtual registers.
+  if (!work_reg_count) {
+    return Error::kOk;
+  }
+
+#ifndef ASMJIT_NO_LOGGING
+  Logger* logger = logger_if(DiagnosticOptions::kRADebugDeadCode);
+  String& sb = _tmp_string;
+#endif
+
+  Arch arch = cc().arch();
+  Span<RABlock*> pov = _pov.as_span();
+
+  // Work ids are assigned by `build_reg_ids()`, which runs after this step, so use temporary ones. Registers that are
+  // used across multiple basic blocks come first as only these need to be tracked by global liveness analysis.
+  uint32_t multi_work_reg_count = 0u;
+  {
+    uint32_t single_id = work_reg_count;
+    for (uint32_t rg = 0; rg < Globals::kNumVirtGroups; rg++) {
+      for (RAWorkReg* work_reg : _work_regs_of_group[rg]) {
+        work_reg->_work_id = RAWorkId(work_reg->is_within_single_basic_block() ? --single_id : multi_work_reg_count++);
+      }
+    }
+  }
+
+  // Bits are organized as [GEN/LIVE-IN, KILL, LIVE-OUT] of each block (multi-block registers only) followed by the
+  // current LIVE set, stack areas that are read (or their address escapes), and stack areas that are referenced by
+  // instructions that were kept.
+  size_t word_count = BitOps::size_in_words<BitWord>(work_reg_count);
+  size_t multi_word_count = BitOps::size_in_words<BitWord>(multi_work_reg_count);
+  size_t block_word_count = multi_word_count * 3u;
+  size_t total_word_count = block_word_count * block_count() + word_count * 3u;
+
+  BitWord* bits = arena().alloc_oneshot_zeroed<BitWord>(Arena::aligned_size(total_word_count * sizeof(BitWord)));
+  if (ASMJIT_UNLIKELY(!bits)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  BitWord* extra_bits = bits + block_word_count * block_count();
+  Span<BitWord> live(extra_bits, word_count);
+  Span<BitWord> escaped_stack_areas(extra_bits + word_count, word_count);
+  Span<BitWord> referenced_stack_areas(extra_bits + word_count * 2u, word_count);
+
+  // Find stack areas that are not only stored to.
+  for (RABlock* block : pov.iterate()) {
+    BaseNode* node = block->first();
+    BaseNode* after_last = block->last()->next();
+
+    while (node != after_last) {
+      if (node->is_inst()) {
+        InstNode* inst = node->as<InstNode>();
+        Span<const Operand> operands = inst->operands();
+
+        InstRWInfo rw_info;
+        bool has_rw_info = false;
+
+        for (size_t i = 0; i < operands.size(); i++) {
+          RAWorkReg* stack_area = RAPass_stack_area_of(this, operands[i]);
+          if (!stack_area) {
+            continue;
+          }
+
+          if (!has_rw_info && node->type() == NodeType::kInst) {
+            has_rw_info = InstAPI::query_rw_info(arch, inst->baseInst(), operands.data(), operands.size(), &rw_info) == Error::kOk;
+          }
+
+          // A store is the only access that doesn't make the content of a stack area observable.
+          bool is_store = has_rw_info && rw_info.operand(i).is_write() && !rw_info.operand(i).is_read();
+          if (!is_store) {
+            BitOps::set_bit(escaped_stack_areas, stack_area->work_id(), true);
+          }
+        }
+      }
+      node = node->next();
+    }
+  }
+
+  // Removing an instruction that reads a register used by multiple blocks changes global liveness, which can make
+  // instructions in other blocks dead - in that case liveness is recalculated and dead instructions removed again.
+  constexpr uint32_t kMaxIterations = 4u;
+
+  uint32_t num_removed_insts = 0u;
+  uint32_t num_removed_slots = 0u;
+
+  for (uint32_t iteration = 0; iteration < kMaxIterations; iteration++) {
+    memset(bits, 0, block_word_count * block_count() * sizeof(BitWord));
+    memset(referenced_stack_areas.data(), 0, word_count * sizeof(BitWord));
+
+    // Calculate GEN and KILL of each block.
+    for (RABlock* block : pov.iterate()) {
+      BitWord* block_bits = bits + size_t(block->block_id()) * block_word_count;
+      Span<BitWord> gen(block_bits, multi_word_count);
+      Span<BitWord> kill(block_bits + multi_word_count, multi_word_count);
+
+      BaseNode* node = block->last();
+      BaseNode* stop = block->first();
+
+      for (;;) {
+        if (node->is_inst()) {
+          RAInst* ra_inst = node->pass_data<RAInst>();
+          ASMJIT_ASSERT(ra_inst != nullptr);
+
+          uint32_t tied_count = ra_inst->tied_count();
+          for (uint32_t i = 0; i < tied_count; i++) {
+            RATiedReg* tied_reg = ra_inst->tied_at(i);
+            uint32_t work_id = uint32_t(tied_reg->work_reg()->work_id());
+
+            if (work_id < multi_work_reg_count && tied_reg->is_write_only()) {
+              BitOps::clear_bit(gen, work_id);
+              BitOps::set_bit(kill, work_id, true);
+            }
+          }
+
+          for (uint32_t i = 0; i < tied_count; i++) {
+            RATiedReg* tied_reg = ra_inst->tied_at(i);
+            uint32_t work_id = uint32_t(tied_reg->work_reg()->work_id());
+
+            if (work_id < multi_work_reg_count && !tied_reg->is_write_only()) {
+              BitOps::set_bit(gen, work_id, true);
+            }
+          }
+        }
+
+        if (node == stop) {
+          break;
+        }
+
+        node = node->prev();
+        ASMJIT_ASSERT(node != nullptr);
+      }
+    }
+
+    // Calculate LIVE-IN and LIVE-OUT - LIVE-IN starts as GEN and then accumulates `LIVE-OUT & ~KILL`.
+    bool changed;
+    do {
+      changed = false;
+
+      for (RABlock* block : pov.iterate()) {
+        BitWord* block_bits = bits + size_t(block->block_id()) * block_word_count;
+        BitWord* live_in = block_bits;
+        BitWord* kill = block_bits + multi_word_count;
+        BitWord* live_out = block_bits + multi_word_count * 2u;
+
+        for (RABlock* successor : block->successors()) {
+          const BitWord* successor_live_in = bits + size_t(successor->block_id()) * block_word_count;
+
+          for (size_t i = 0; i < multi_word_count; i++) {
+            BitWord new_live_out = live_out[i] | successor_live_in[i];
+            if (new_live_out != live_out[i]) {
+              live_out[i] = new_live_out;
+              live_in[i] |= new_live_out & ~kill[i];
+              changed = true;
+            }
+          }
+        }
+      }
+    } while (changed);
+
+    // Remove dead instructions - each block is processed backwards so the removal of one instruction can make
+    // instructions that precede it dead as well. CPU flags are considered live at the end of each block.
+    bool multi_block_use_removed = false;
+
+    for (RABlock* block : pov.iterate()) {
+      // Registers used by a single basic block are never live at its end.
+      const BitWord* live_out = bits + size_t(block->block_id()) * block_word_count + multi_word_count * 2u;
+      memset(live.data(), 0, word_count * sizeof(BitWord));
+      memcpy(live.data(), live_out, multi_word_count * sizeof(BitWord));
+
+      CpuRWFlags live_flags = ~CpuRWFlags::kNone;
+      BaseNode* node = block->last();
+
+      for (;;) {
+        BaseNode* prev = node->prev();
+        bool is_first = node == block->first();
+
+        if (node->is_inst()) {
+          InstNode* inst = node->as<InstNode>();
+          RAInst* ra_inst = inst->pass_data<RAInst>();
+          uint32_t tied_count = ra_inst->tied_count();
+
+          InstRWInfo rw_info;
+          bool has_rw_info = node->type() == NodeType::kInst &&
+                             InstAPI::query_rw_info(arch, inst->baseInst(), inst->operands_data(), inst->op_count(), &rw_info) == Error::kOk;
+
+          // A block must never become empty, so keep the instruction if it's the only node of the block.
+          bool is_dead = has_rw_info && !(is_first && node == block->last()) &&
+                         RAPass_is_dead_inst(this, inst, rw_info, live_flags, live, escaped_stack_areas);
+
+          if (is_dead) {
+#ifndef ASMJIT_NO_LOGGING
+            if (logger) {
+              sb.clear();
+              Formatter::format_node(sb, _format_options, &_cb, node);
+              logger->logf("  removing dead instruction from block {%u}: %s\n", uint32_t(block->block_id()), sb.data());
+            }
+#endif
+
+            for (uint32_t i = 0; i < tied_count; i++) {
+              RATiedReg* tied_reg = ra_inst->tied_at(i);
+              if (uint32_t(tied_reg->work_reg()->work_id()) < multi_work_reg_count && !tied_reg->is_write_only()) {
+                multi_block_use_removed = true;
+              }
+            }
+
+            if (is_first) {
+              block->set_first(node->next());
+            }
+
+            if (node == block->last()) {
+              block->set_last(prev);
+            }
+
+            cc().remove_node(node);
+            num_removed_insts++;
+          }
+          else {
+            for (uint32_t i = 0; i < tied_count; i++) {
+              RATiedReg* tied_reg = ra_inst->tied_at(i);
+              if (tied_reg->is_write_only()) {
+                BitOps::clear_bit(live, tied_reg->work_reg()->work_id());
+              }
+            }
+
+            for (uint32_t i = 0; i < tied_count; i++) {
+              RATiedReg* tied_reg = ra_inst->tied_at(i);
+              if (!tied_reg->is_write_only()) {
+                BitOps::set_bit(live, tied_reg->work_reg()->work_id(), true);
+              }
+            }
+
+            for (const Operand& op : inst->operands()) {
+              RAWorkReg* stack_area = RAPass_stack_area_of(this, op);
+              if (stack_area) {
+                BitOps::set_bit(referenced_stack_areas, stack_area->work_id(), true);
+              }
+            }
+
+            if (has_rw_info) {
+              live_flags = (live_flags & ~rw_info.write_flags()) | rw_info.read_flags();
+            }
+            else {
+              live_flags = ~CpuRWFlags::kNone;
+            }
+          }
+        }
+
+        if (is_first) {
+          break;
+        }
+
+        node = prev;
+        ASMJIT_ASSERT(node != nullptr);
+      }
+    }
+
+    if (!multi_block_use_removed) {
+      break;
+    }
+  }
+
+  // Stack areas that are no longer referenced don't need a stack slot.
+  if (num_removed_insts) {
+    for (uint32_t rg = 0; rg < Globals::kNumVirtGroups; rg++) {
+      for (RAWorkReg* work_reg : _work_regs_of_group[rg]) {
+        if (!work_reg->has_stack_slot() || !work_reg->virt_reg()->is_stack_area() ||
+            BitOps::bit_at(referenced_stack_areas, work_reg->work_id())) {
+          continue;
+        }
+
+#ifndef ASMJIT_NO_LOGGING
+        if (logger) {
+          sb.clear();
+          Formatter::format_virt_reg_name(sb, work_reg->virt_reg());
+          logger->logf("  removing stack slot of unreferenced stack area %s\n", sb.data());
+        }
+#endif
+
+        _stack_allocator.remove_slot(work_reg->stack_slot());
+        work_reg->_stack_slot = nullptr;
+        work_reg->clear_flags(RAWorkRegFlags::kStackUsed);
+        num_removed_slots++;
+      }
+    }
+  }
+
+  ASMJIT_RA_LOG_FORMAT("[remove_dead_code - removed %u instructions and %u stack slots]\n", num_removed_insts, num_removed_slots);
+  return Error::kOk;
+}
+
 // BaseRAPass - Registers - VirtReg / WorkReg Mapping
 // ==================================================
 
@@ -443,6 +443,22 @@ public:
   [[nodiscard]]
   Error remove_unreachable_code() noexcept;
 
+  //! Removes instructions that have no observable effect and stores to stack areas (created by \ref
+  //! BaseCompiler::_new_stack()) that are never read.
+  //!
+  //! An instruction is dead when all registers and stack areas it writes are not live after it and when it doesn't
+  //! write CPU flags that are read later. Instructions that use physical registers, access any other memory (loads
+  //! included), perform integer division (which can trap), or have side effects not described by \ref
+  //! InstAPI::query_rw_info() (reported as \ref InstSchedClass::kBarrier) are always kept. Stack areas that are no
+  //! longer referenced after the removal don't get a stack slot.
+  //!
+  //! \note Only called when \ref CompilerOptions::kRemoveDeadCode is enabled.
+  //!
+  //! \note Must be called after \ref remove_unreachable_code() and before \ref build_reg_ids(), as it uses work ids
+  //! of work registers as temporary indexes.
+  [[nodiscard]]
+  Error remove_dead_code() noexcept;
+
   //! Returns `node` or some node after that is ideal for beginning a new block. This function is mostly used after
   //! a conditional or unconditional jump to select the successor node. In some cases the next node could be a label,
   //! which means it could have assigned some block already.
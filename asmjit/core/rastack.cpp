@@ -38,6 +38,20 @@ RAStackSlot* RAStackAllocator::new_slot(uint32_t base_reg_id, uint32_t size, uin
   return slot;
 }
 
+void RAStackAllocator::remove_slot(RAStackSlot* slot) noexcept {
+  size_t index = _slots.index_of(slot);
+  if (index == SIZE_MAX) {
+    return;
+  }
+
+  _slots.remove_at(index);
+  _alignment = 1;
+
+  for (RAStackSlot* s : _slots) {
+    _alignment = Support::max<uint32_t>(_alignment, s->alignment());
+  }
+}
+
 // RAStackAllocator - Utilities
 // ============================
 
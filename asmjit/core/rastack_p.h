@@ -176,6 +176,9 @@ public:
   [[nodiscard]]
   RAStackSlot* new_slot(uint32_t base_reg_id, uint32_t size, uint32_t alignment, uint32_t flags = 0) noexcept;
 
+  //! Removes `slot` that is no longer referenced and recalculates the minimum stack alignment.
+  void remove_slot(RAStackSlot* slot) noexcept;
+
   [[nodiscard]]
   Error calculate_stack_frame() noexcept;
 
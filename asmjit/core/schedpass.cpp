@@ -0,0 +1,584 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core/api-build_p.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/logger.h>
+#include <asmjit/core/schedpass.h>
+#include <asmjit/support/support.h>
+
+#if defined(ASMJIT_TEST)
+  #if !defined(ASMJIT_NO_X86)
+    #include <asmjit/x86/x86builder.h>
+  #endif
+
+  #if !defined(ASMJIT_NO_AARCH64)
+    #include <asmjit/arm/a64builder.h>
+  #endif
+#endif // ASMJIT_TEST
+
+ASMJIT_BEGIN_NAMESPACE
+
+// SchedModel - Built-in Models
+// ============================
+
+// The values are approximations of latencies and throughputs published in vendor optimization guides. Each class
+// represents the most common instructions of that class, so for example `kVecFP` uses the latency of FMA.
+#define U(unit) SchedUnit::k##unit
+
+//                                                Barrier        Mov            ALU            Mul            Div             VecALU         VecMul         VecFP          VecDiv          VecShuffle
+static const SchedModel sched_model_table[] = {
+  { "Skylake"      , 4, 5, { 4, 1, 1, 3, 2, 1, 2, 1 }, {{1, U(ALU), 1}, {1, U(ALU), 1}, {1, U(ALU), 1}, {3, U(Mul), 1}, {26, U(Div), 6}, {1, U(Vec), 1}, {5, U(VecMul), 1}, {4, U(VecMul), 1}, {11, U(VecMul), 4}, {1, U(VecShuffle), 1}} },
+  { "Zen4"         , 6, 4, { 4, 1, 1, 4, 2, 2, 3, 2 }, {{1, U(ALU), 1}, {1, U(ALU), 1}, {1, U(ALU), 1}, {3, U(Mul), 1}, {12, U(Div), 6}, {1, U(Vec), 1}, {3, U(VecMul), 1}, {4, U(VecMul), 1}, {11, U(VecMul), 3}, {1, U(VecShuffle), 1}} },
+  { "Cortex-A76"   , 4, 4, { 3, 1, 1, 2, 2, 2, 2, 1 }, {{1, U(ALU), 1}, {1, U(ALU), 1}, {1, U(ALU), 1}, {2, U(Mul), 1}, {10, U(Div), 10}, {2, U(Vec), 1}, {4, U(VecMul), 1}, {4, U(VecMul), 1}, {10, U(VecMul), 7}, {2, U(VecShuffle), 1}} },
+  { "Neoverse-V1"  , 8, 4, { 4, 2, 1, 4, 4, 2, 3, 2 }, {{1, U(ALU), 1}, {1, U(ALU), 1}, {1, U(ALU), 1}, {2, U(Mul), 1}, {12, U(Div), 12}, {2, U(Vec), 1}, {4, U(VecMul), 1}, {4, U(VecMul), 1}, {10, U(VecMul), 5}, {2, U(VecShuffle), 1}} }
+};
+
+#undef U
+
+static_assert(ASMJIT_ARRAY_SIZE(sched_model_table) == uint32_t(SchedModelId::kMaxValue) + 1u,
+              "sched_model_table[] must provide a model for each SchedModelId");
+
+const SchedModel& SchedModel::by_id(SchedModelId id) noexcept {
+  ASMJIT_ASSERT(id <= SchedModelId::kMaxValue);
+  return sched_model_table[size_t(id)];
+}
+
+const SchedModel* SchedModel::default_for_arch(Arch arch) noexcept {
+  if (Environment::is_family_x86(arch)) {
+    return &by_id(SchedModelId::kX86_Skylake);
+  }
+
+  if (Environment::is_family_aarch64(arch)) {
+    return &by_id(SchedModelId::kA64_CortexA76);
+  }
+
+  return nullptr;
+}
+
+// SchedPass - Internals
+// =====================
+
+//! Register (or other resource) read or written by an instruction.
+struct SchedReg {
+  uint32_t key;
+  OpRWFlags flags;
+};
+
+//! Dependency edge between two instructions of a scheduling region.
+struct SchedEdge {
+  SchedEdge* next;
+  uint32_t index;
+  uint32_t latency;
+};
+
+//! Instruction of a scheduling region.
+struct SchedNode {
+  InstNode* inst;
+  SchedReg* regs;
+  SchedEdge* successors;
+  uint32_t reg_count;
+  uint32_t latency;
+  uint32_t occupancy;
+  uint32_t height;
+  uint32_t pred_count;
+  uint32_t ready_cycle;
+  CpuRWFlags read_flags;
+  CpuRWFlags write_flags;
+  SchedUnit unit;
+  bool mem_read;
+  bool mem_write;
+  bool scheduled;
+};
+
+// Physical registers use keys that never collide with virtual register IDs.
+static ASMJIT_INLINE uint32_t sched_reg_key(RegGroup group, uint32_t id) noexcept {
+  return Operand::is_virt_id(id) ? id : 0x80000000u | (uint32_t(group) << 8) | id;
+}
+
+static ASMJIT_INLINE void sched_add_reg(SchedNode& node, RegGroup group, uint32_t id, OpRWFlags flags) noexcept {
+  // Zero register (AArch64) and invalid registers don't carry any dependency.
+  if (id == Reg::kIdBad) {
+    return;
+  }
+
+  node.regs[node.reg_count++] = SchedReg{sched_reg_key(group, id), flags & OpRWFlags::kRW};
+}
+
+static Error sched_init_node(const SchedPass& pass, Arena& arena, SchedNode& node, InstNode* inst, InstSchedClass sched_class, const InstRWInfo& rw_info) noexcept {
+  size_t op_count = inst->op_count();
+  const Operand* operands = inst->operands_data();
+
+  // Each operand can use up to 2 registers (memory base and index), plus one extra register.
+  node.regs = arena.alloc_oneshot<SchedReg>(Arena::aligned_size((op_count * 2u + 1u) * sizeof(SchedReg)));
+  if (ASMJIT_UNLIKELY(!node.regs)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  node.inst = inst;
+  node.successors = nullptr;
+  node.reg_count = 0;
+  node.height = 0;
+  node.pred_count = 0;
+  node.ready_cycle = 0;
+  node.read_flags = rw_info.read_flags();
+  node.write_flags = rw_info.write_flags();
+  node.mem_read = false;
+  node.mem_write = false;
+  node.scheduled = false;
+
+  for (size_t i = 0; i < op_count; i++) {
+    const Operand& op = operands[i];
+    const OpRWInfo& op_rw = rw_info.operand(i);
+
+    if (op.is_reg()) {
+      const Reg& reg = op.as<Reg>();
+      sched_add_reg(node, reg.reg_group(), reg.id(), op_rw.op_flags());
+    }
+    else if (op.is_mem()) {
+      const BaseMem& mem = op.as<BaseMem>();
+
+      if (mem.has_base_reg()) {
+        OpRWFlags flags = OpRWFlags::kRead;
+        if (op_rw.is_mem_base_write()) {
+          flags |= OpRWFlags::kWrite;
+        }
+        sched_add_reg(node, RegUtils::group_of(mem.base_type()), mem.base_id(), flags);
+      }
+
+      if (mem.has_index_reg()) {
+        OpRWFlags flags = OpRWFlags::kRead;
+        if (op_rw.is_mem_index_write()) {
+          flags |= OpRWFlags::kWrite;
+        }
+        sched_add_reg(node, RegUtils::group_of(mem.index_type()), mem.index_id(), flags);
+      }
+
+      node.mem_read |= op_rw.is_read();
+      node.mem_write |= op_rw.is_write();
+    }
+  }
+
+  const RegOnly& extra_reg = inst->extra_reg();
+  if (extra_reg.is_reg()) {
+    OpRWFlags flags = rw_info.extra_reg().op_flags() & OpRWFlags::kRW;
+    sched_add_reg(node, extra_reg.group(), extra_reg.id(), flags != OpRWFlags::kNone ? flags : OpRWFlags::kRead);
+  }
+
+  SchedInstInfo info {};
+  pass.query_inst_info(*inst, sched_class, rw_info, Out(info));
+
+  node.latency = info.latency;
+  node.unit = info.unit;
+  node.occupancy = Support::max<uint32_t>(info.occupancy, 1u);
+
+  return Error::kOk;
+}
+
+// Returns true if `b` depends on `a`, where `a` precedes `b` in the original order. The latency of the dependency
+// is stored to `latency_out` - it's the latency of `a` in case of a true dependency and zero otherwise (only order).
+static bool sched_depends(const SchedModel& model, const SchedNode& a, const SchedNode& b, uint32_t* latency_out) noexcept {
+  bool depends = false;
+  uint32_t latency = 0;
+
+  for (uint32_t i = 0; i < b.reg_count; i++) {
+    const SchedReg& b_reg = b.regs[i];
+    for (uint32_t j = 0; j < a.reg_count; j++) {
+      const SchedReg& a_reg = a.regs[j];
+      if (a_reg.key != b_reg.key) {
+        continue;
+      }
+
+      if (Support::test(a_reg.flags, OpRWFlags::kWrite)) {
+        // RAW (true dependency) or WAW (output dependency).
+        depends = true;
+        if (Support::test(b_reg.flags, OpRWFlags::kRead)) {
+          latency = Support::max(latency, a.latency);
+        }
+      }
+      else if (Support::test(b_reg.flags, OpRWFlags::kWrite)) {
+        // WAR (anti dependency).
+        depends = true;
+      }
+    }
+  }
+
+  if (Support::test(a.write_flags, b.read_flags)) {
+    depends = true;
+    latency = Support::max(latency, a.latency);
+  }
+
+  if (Support::test(a.write_flags, b.write_flags) || Support::test(a.read_flags, b.write_flags)) {
+    depends = true;
+  }
+
+  // Memory is handled conservatively as there is no alias analysis - loads are never reordered with stores.
+  if (a.mem_write && (b.mem_read || b.mem_write)) {
+    depends = true;
+    if (b.mem_read) {
+      latency = Support::max(latency, model.load_latency());
+    }
+  }
+  else if (a.mem_read && b.mem_write) {
+    depends = true;
+  }
+
+  *latency_out = latency;
+  return depends;
+}
+
+static Error sched_region(const SchedModel& model, Arena& arena, SchedNode* nodes, uint32_t count, BaseBuilder& cb, size_t* moved_count) noexcept {
+  // Build the dependency graph.
+  for (uint32_t b = 1; b < count; b++) {
+    for (uint32_t a = 0; a < b; a++) {
+      uint32_t latency;
+      if (!sched_depends(model, nodes[a], nodes[b], &latency)) {
+        continue;
+      }
+
+      SchedEdge* edge = arena.alloc_oneshot<SchedEdge>(Arena::aligned_size_of<SchedEdge>());
+      if (ASMJIT_UNLIKELY(!edge)) {
+        return make_error(Error::kOutOfMemory);
+      }
+
+      edge->next = nodes[a].successors;
+      edge->index = b;
+      edge->latency = latency;
+
+      nodes[a].successors = edge;
+      nodes[b].pred_count++;
+    }
+  }
+
+  // Calculate the height of each node (the length of the critical path from the node to the end of the region).
+  for (uint32_t i = count; i != 0u;) {
+    SchedNode& node = nodes[--i];
+    uint32_t height = node.latency;
+
+    for (SchedEdge* edge = node.successors; edge; edge = edge->next) {
+      height = Support::max(height, edge->latency + nodes[edge->index].height);
+    }
+
+    node.height = height;
+  }
+
+  // List scheduling - each cycle picks ready instructions having the highest height until the issue width is
+  // exhausted or there is no instruction that could be issued (dependencies or execution units are busy).
+  uint32_t* order = arena.alloc_oneshot<uint32_t>(Arena::aligned_size(count * sizeof(uint32_t)));
+  if (ASMJIT_UNLIKELY(!order)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  uint32_t unit_free_at[SchedModel::kUnitCount][SchedModel::kMaxUnitsPerKind] {};
+  uint32_t issue_width = Support::max<uint32_t>(model.issue_width(), 1u);
+
+  uint32_t cycle = 0;
+  uint32_t issued = 0;
+  uint32_t scheduled = 0;
+
+  while (scheduled < count) {
+    uint32_t best_index = 0xFFFFFFFFu;
+    uint32_t best_unit_slot = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+      const SchedNode& node = nodes[i];
+      if (node.scheduled || node.pred_count != 0u || node.ready_cycle > cycle) {
+        continue;
+      }
+
+      uint32_t unit_id = uint32_t(node.unit);
+      uint32_t unit_count = Support::min<uint32_t>(Support::max<uint32_t>(model.unit_count(node.unit), 1u), SchedModel::kMaxUnitsPerKind);
+      uint32_t slot = 0;
+
+      while (slot < unit_count && unit_free_at[unit_id][slot] > cycle) {
+        slot++;
+      }
+
+      if (slot == unit_count) {
+        continue;
+      }
+
+      // Nodes are iterated in the original order, so the first node wins if heights are equal.
+      if (best_index == 0xFFFFFFFFu || node.height > nodes[best_index].height) {
+        best_index = i;
+        best_unit_slot = slot;
+      }
+    }
+
+    if (best_index != 0xFFFFFFFFu) {
+      SchedNode& node = nodes[best_index];
+
+      node.scheduled = true;
+      unit_free_at[uint32_t(node.unit)][best_unit_slot] = cycle + node.occupancy;
+      order[scheduled++] = best_index;
+
+      for (SchedEdge* edge = node.successors; edge; edge = edge->next) {
+        SchedNode& succ = nodes[edge->index];
+        succ.pred_count--;
+        succ.ready_cycle = Support::max(succ.ready_cycle, cycle + edge->latency);
+      }
+
+      if (++issued < issue_width) {
+        continue;
+      }
+    }
+
+    cycle++;
+    issued = 0;
+  }
+
+  // Relink the nodes if the order has changed.
+  uint32_t moved = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    moved += uint32_t(order[i] != i);
+  }
+
+  if (moved) {
+    BaseNode* prev = nodes[0].inst->prev();
+    BaseNode* next = nodes[count - 1u].inst->next();
+
+    for (uint32_t i = 0; i < count; i++) {
+      BaseNode* node = nodes[order[i]].inst;
+      node->_prev = prev;
+
+      if (prev) {
+        prev->_next = node;
+      }
+      else {
+        cb._node_list._first = node;
+      }
+
+      prev = node;
+    }
+
+    prev->_next = next;
+    if (next) {
+      next->_prev = prev;
+    }
+    else {
+      cb._node_list._last = prev;
+    }
+
+    *moved_count += moved;
+  }
+
+  return Error::kOk;
+}
+
+// SchedPass - Construction & Destruction
+// ======================================
+
+SchedPass::SchedPass(BaseBuilder& cb, const SchedModel* model) noexcept
+  : Pass(cb, "SchedPass"),
+    _model(model ? model : SchedModel::default_for_arch(cb.arch())) {}
+
+SchedPass::~SchedPass() noexcept {}
+
+// SchedPass - Interface
+// =====================
+
+void SchedPass::query_inst_info(const InstNode& node, InstSchedClass sched_class, const InstRWInfo& rw_info, Out<SchedInstInfo> out) const noexcept {
+  Support::maybe_unused(node);
+
+  const SchedClassInfo& class_info = _model->class_info(sched_class);
+  bool mem_read = false;
+  bool mem_write = false;
+
+  for (uint32_t i = 0; i < rw_info.op_count(); i++) {
+    const OpRWInfo& op_rw = rw_info.operand(i);
+    if (op_rw.op_flags() == OpRWFlags::kNone) {
+      continue;
+    }
+
+    if (node.op(i).is_mem()) {
+      mem_read |= op_rw.is_read();
+      mem_write |= op_rw.is_write();
+    }
+  }
+
+  out->latency = class_info.latency();
+  out->unit = class_info.unit();
+  out->occupancy = class_info.occupancy();
+
+  if (sched_class == InstSchedClass::kMov) {
+    if (mem_read) {
+      out->latency = _model->load_latency();
+      out->unit = SchedUnit::kLoad;
+    }
+    else if (mem_write) {
+      out->unit = SchedUnit::kStore;
+    }
+  }
+  else if (mem_read) {
+    // Load-op instruction - the load latency is added to the latency of the operation.
+    out->latency += _model->load_latency();
+  }
+}
+
+Error SchedPass::run(Arena& arena, Logger* logger) {
+  Support::maybe_unused(logger);
+
+  _moved_count = 0;
+  if (!_model) {
+    return Error::kOk;
+  }
+
+  Arch arch = cb().arch();
+  uint32_t max_region_size = Support::max<uint32_t>(_max_region_size, 2u);
+
+  SchedNode* nodes = arena.alloc_oneshot<SchedNode>(Arena::aligned_size(max_region_size * sizeof(SchedNode)));
+  if (ASMJIT_UNLIKELY(!nodes)) {
+    return make_error(Error::kOutOfMemory);
+  }
+
+  // Per-region data is allocated by a separate arena that is reset after each region is scheduled.
+  Arena region_arena(16u * 1024u);
+  uint32_t count = 0;
+
+  BaseNode* node_ = cb().first_node();
+  while (node_ || count) {
+    bool end_region = true;
+
+    if (node_ && node_->type() == NodeType::kInst) {
+      InstNode* inst = node_->as<InstNode>();
+      InstRWInfo rw_info;
+      InstSchedClass sched_class;
+
+      if (InstAPI::query_rw_info(arch, inst->baseInst(), inst->operands_data(), inst->op_count(), &rw_info) == Error::kOk &&
+          InstAPI::query_sched_class(arch, inst->baseInst(), inst->operands_data(), inst->op_count(), &sched_class) == Error::kOk &&
+          sched_class != InstSchedClass::kBarrier) {
+        ASMJIT_PROPAGATE(sched_init_node(*this, region_arena, nodes[count], inst, sched_class, rw_info));
+        end_region = ++count == max_region_size;
+      }
+    }
+
+    // Advance before the region is scheduled as scheduling reorders the nodes within the region.
+    BaseNode* next = node_ ? node_->next() : nullptr;
+
+    if (end_region) {
+      if (count > 1u) {
+        ASMJIT_PROPAGATE(sched_region(*_model, region_arena, nodes, count, cb(), &_moved_count));
+      }
+      region_arena.reset();
+      count = 0;
+    }
+
+    node_ = next;
+  }
+
+#ifndef ASMJIT_NO_LOGGING
+  if (logger && _moved_count) {
+    logger->logf("[SchedPass] Model '%s' moved %zu instructions\n", _model->name(), _moved_count);
+  }
+#endif // !ASMJIT_NO_LOGGING
+
+  return Error::kOk;
+}
+
+// SchedPass - Tests
+// =================
+
+#if defined(ASMJIT_TEST)
+// Kernel used by all tests - a short chain of vector ALU instructions followed by a long latency division, which
+// feeds a floating point addition. A latency-aware scheduler must hoist the division before the ALU chain as its
+// height (VecDiv + VecFP latency) is greater than the height of the ALU chain (2x VecALU latency).
+static void test_sched_check_model(const SchedModel& model) noexcept {
+  uint32_t alu_height = model.class_info(InstSchedClass::kVecALU).latency() * 2u;
+  uint32_t div_height = model.class_info(InstSchedClass::kVecDiv).latency() + model.class_info(InstSchedClass::kVecFP).latency();
+
+  EXPECT_GT(div_height, alu_height)
+    .message("Model '%s' - the test kernel requires VecDiv + VecFP latency to exceed 2x VecALU latency", model.name());
+}
+
+static void test_sched_check_order(BaseBuilder& cb, const SchedModel& model, const InstId* expected, size_t count) noexcept {
+  EXPECT_EQ(cb.add_pass<SchedPass>(&model), Error::kOk);
+  EXPECT_EQ(cb.run_passes(), Error::kOk);
+
+  size_t i = 0;
+  for (BaseNode* node = cb.first_node(); node; node = node->next()) {
+    if (!node->is_inst()) {
+      continue;
+    }
+
+    EXPECT_LT(i, count);
+    EXPECT_EQ(node->as<InstNode>()->inst_id(), expected[i])
+      .message("Model '%s' - unexpected instruction at index %zu", model.name(), i);
+    i++;
+  }
+  EXPECT_EQ(i, count);
+
+  const SchedPass* pass = static_cast<const SchedPass*>(cb.pass_by_name("SchedPass"));
+  EXPECT_NOT_NULL(pass);
+  EXPECT_EQ(pass->moved_count(), 3u)
+    .message("Model '%s' - unexpected number of moved instructions", model.name());
+}
+
+#if !defined(ASMJIT_NO_X86)
+static void test_sched_x86(SchedModelId model_id) noexcept {
+  const SchedModel& model = SchedModel::by_id(model_id);
+  INFO("Verifying SchedPass order of a X86 kernel with '%s' model", model.name());
+
+  test_sched_check_model(model);
+
+  Environment env;
+  env.init(Arch::kX64);
+
+  CodeHolder code;
+  code.init(env);
+  x86::Builder cb(&code);
+
+  using namespace x86;
+  cb.vpaddd(xmm0, xmm0, xmm1);
+  cb.vpaddd(xmm0, xmm0, xmm2);
+  cb.vdivps(xmm3, xmm4, xmm5);
+  cb.vaddps(xmm3, xmm3, xmm6);
+
+  static const InstId expected[] = { Inst::kIdVdivps, Inst::kIdVpaddd, Inst::kIdVpaddd, Inst::kIdVaddps };
+  test_sched_check_order(cb, model, expected, ASMJIT_ARRAY_SIZE(expected));
+}
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+static void test_sched_a64(SchedModelId model_id) noexcept {
+  const SchedModel& model = SchedModel::by_id(model_id);
+  INFO("Verifying SchedPass order of an AArch64 kernel with '%s' model", model.name());
+
+  test_sched_check_model(model);
+
+  Environment env;
+  env.init(Arch::kAArch64);
+
+  CodeHolder code;
+  code.init(env);
+  a64::Builder cb(&code);
+
+  using namespace a64;
+  cb.add(v0.s4(), v0.s4(), v1.s4());
+  cb.add(v0.s4(), v0.s4(), v2.s4());
+  cb.fdiv(v3.s4(), v4.s4(), v5.s4());
+  cb.fadd(v3.s4(), v3.s4(), v6.s4());
+
+  static const InstId expected[] = { Inst::kIdFdiv_v, Inst::kIdAdd_v, Inst::kIdAdd_v, Inst::kIdFadd_v };
+  test_sched_check_order(cb, model, expected, ASMJIT_ARRAY_SIZE(expected));
+}
+#endif // !ASMJIT_NO_AARCH64
+
+UNIT(sched_pass) {
+#if !defined(ASMJIT_NO_X86)
+  test_sched_x86(SchedModelId::kX86_Skylake);
+  test_sched_x86(SchedModelId::kX86_Zen4);
+#endif // !ASMJIT_NO_X86
+
+#if !defined(ASMJIT_NO_AARCH64)
+  test_sched_a64(SchedModelId::kA64_CortexA76);
+  test_sched_a64(SchedModelId::kA64_NeoverseV1);
+#endif // !ASMJIT_NO_AARCH64
+}
+#endif // ASMJIT_TEST
+
+ASMJIT_END_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
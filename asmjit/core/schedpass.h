@@ -0,0 +1,267 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#ifndef ASMJIT_CORE_SCHEDPASS_H_INCLUDED
+#define ASMJIT_CORE_SCHEDPASS_H_INCLUDED
+
+#include <asmjit/core/api-config.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/builder.h>
+#include <asmjit/core/inst.h>
+#include <asmjit/support/arena.h>
+#include <asmjit/support/support.h>
+
+ASMJIT_BEGIN_NAMESPACE
+
+//! \addtogroup asmjit_builder
+//! \{
+
+//! Execution unit (a group of execution ports) used by \ref SchedModel.
+enum class SchedUnit : uint8_t {
+  //! General purpose arithmetic and logic.
+  kALU = 0,
+  //! General purpose multiplication.
+  kMul = 1,
+  //! General purpose division.
+  kDiv = 2,
+  //! Vector arithmetic and logic.
+  kVec = 3,
+  //! Vector multiplication, FMA, and division.
+  kVecMul = 4,
+  //! Vector shuffles and permutations.
+  kVecShuffle = 5,
+  //! Load unit.
+  kLoad = 6,
+  //! Store unit.
+  kStore = 7,
+
+  //! Maximum value of `SchedUnit`.
+  kMaxValue = kStore
+};
+
+//! Identifier of a built-in scheduling model, see \ref SchedModel::by_id().
+enum class SchedModelId : uint8_t {
+  //! Intel Skylake (and derived Coffee Lake / Comet Lake cores).
+  kX86_Skylake = 0,
+  //! AMD Zen 4.
+  kX86_Zen4 = 1,
+  //! ARM Cortex-A76 (also a reasonable approximation of Cortex-A77 and Neoverse N1).
+  kA64_CortexA76 = 2,
+  //! ARM Neoverse V1.
+  kA64_NeoverseV1 = 3,
+
+  //! Maximum value of `SchedModelId`.
+  kMaxValue = kA64_NeoverseV1
+};
+
+//! Latency and throughput of an instruction class, see \ref InstSchedClass.
+struct SchedClassInfo {
+  //! \name Members
+  //! \{
+
+  //! Latency in cycles (the number of cycles until the result can be consumed).
+  uint8_t _latency;
+  //! Execution unit used by the instruction.
+  SchedUnit _unit;
+  //! The number of cycles the execution unit is occupied (1 means fully pipelined).
+  uint8_t _occupancy;
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t latency() const noexcept { return _latency; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG SchedUnit unit() const noexcept { return _unit; }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t occupancy() const noexcept { return _occupancy; }
+
+  //! \}
+};
+
+//! Scheduling model used by \ref SchedPass.
+//!
+//! Scheduling model describes a CPU core by using a coarse latency and throughput table indexed by \ref
+//! InstSchedClass, by the number of instructions the core can issue per cycle, and by the number of execution
+//! units of each \ref SchedUnit kind. AsmJit provides built-in models, which can be obtained by \ref by_id(),
+//! however, a custom model can be provided as well as `SchedModel` is a simple data structure.
+struct SchedModel {
+  //! \name Constants
+  //! \{
+
+  static inline constexpr uint32_t kUnitCount = uint32_t(SchedUnit::kMaxValue) + 1u;
+  static inline constexpr uint32_t kClassCount = uint32_t(InstSchedClass::kMaxValue) + 1u;
+
+  //! Maximum number of execution units of the same kind.
+  static inline constexpr uint32_t kMaxUnitsPerKind = 8u;
+
+  //! \}
+
+  //! \name Members
+  //! \{
+
+  //! Name of the model.
+  const char* _name;
+  //! Maximum number of instructions issued per cycle.
+  uint8_t _issue_width;
+  //! Latency of a load from L1 cache, which is added to the latency of instructions that read memory.
+  uint8_t _load_latency;
+  //! Number of execution units of each kind (indexed by \ref SchedUnit).
+  uint8_t _unit_count[kUnitCount];
+  //! Latency and throughput of each instruction class (indexed by \ref InstSchedClass).
+  SchedClassInfo _class_info[kClassCount];
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns the name of the model.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const char* name() const noexcept { return _name; }
+
+  //! Returns the maximum number of instructions issued per cycle.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t issue_width() const noexcept { return _issue_width; }
+
+  //! Returns the latency of a load from L1 cache.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t load_latency() const noexcept { return _load_latency; }
+
+  //! Returns the number of execution units of the given `unit` kind.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t unit_count(SchedUnit unit) const noexcept { return _unit_count[size_t(unit)]; }
+
+  //! Returns latency and throughput of the given instruction class.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const SchedClassInfo& class_info(InstSchedClass sched_class) const noexcept { return _class_info[size_t(sched_class)]; }
+
+  //! \}
+
+  //! \name Built-in Models
+  //! \{
+
+  //! Returns a built-in scheduling model of the given `id`.
+  [[nodiscard]]
+  static ASMJIT_API const SchedModel& by_id(SchedModelId id) noexcept;
+
+  //! Returns a default scheduling model for the given `arch` or nullptr if there is no model for it.
+  [[nodiscard]]
+  static ASMJIT_API const SchedModel* default_for_arch(Arch arch) noexcept;
+
+  //! \}
+};
+
+//! Scheduling information of a single instruction as used by \ref SchedPass.
+struct SchedInstInfo {
+  //! Latency in cycles.
+  uint32_t latency;
+  //! Execution unit used by the instruction.
+  SchedUnit unit;
+  //! The number of cycles the execution unit is occupied.
+  uint32_t occupancy;
+};
+
+//! Instruction scheduling pass.
+//!
+//! Reorders instructions within basic blocks (list scheduling) to expose more instruction level parallelism. A
+//! scheduling region is a sequence of consecutive \ref InstNode nodes - any other node (labels, alignment, data,
+//! functions, invocations, returns, ...) and any instruction that has \ref InstSchedClass::kBarrier class ends the
+//! region. Dependencies are computed from \ref InstRWInfo (registers, CPU flags, and memory accesses, where memory
+//! is handled conservatively - loads can be reordered with other loads, but never across stores) and instructions
+//! are prioritized by the length of the critical path to the end of the region as given by \ref SchedModel.
+//!
+//! The pass can run either before register allocation (on virtual registers) or after it (on physical registers):
+//!
+//! ```
+//! // Post-RA scheduling - passes run in order, so the pass would run after register allocation.
+//! cc.add_pass<SchedPass>(&SchedModel::by_id(SchedModelId::kX86_Zen4));
+//!
+//! // Pre-RA scheduling - insert the pass before the first pass (the register allocator is added by the compiler
+//! // when it's attached to CodeHolder).
+//! cc.insert_pass<SchedPass>(0, nullptr);
+//! ```
+//!
+//! \note Scheduling before register allocation can increase register pressure.
+class ASMJIT_VIRTAPI SchedPass : public Pass {
+public:
+  ASMJIT_NONCOPYABLE(SchedPass)
+  using Base = Pass;
+
+  //! \name Constants
+  //! \{
+
+  //! Default maximum number of instructions in a scheduling region - longer sequences are split.
+  static inline constexpr uint32_t kDefaultMaxRegionSize = 128u;
+
+  //! \}
+
+  //! \name Members
+  //! \{
+
+  //! Scheduling model.
+  const SchedModel* _model;
+  //! Maximum number of instructions in a single scheduling region.
+  uint32_t _max_region_size = kDefaultMaxRegionSize;
+  //! Number of instructions that were moved by the last run.
+  size_t _moved_count = 0;
+
+  //! \}
+
+  //! \name Construction & Destruction
+  //! \{
+
+  //! Creates a new scheduling pass that would use the given scheduling `model`. If `model` is null a default model
+  //! for the target architecture is used, see \ref SchedModel::default_for_arch().
+  ASMJIT_API SchedPass(BaseBuilder& cb, const SchedModel* model = nullptr) noexcept;
+  ASMJIT_API ~SchedPass() noexcept override;
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns the scheduling model used by this pass.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const SchedModel* model() const noexcept { return _model; }
+
+  //! Returns the maximum number of instructions in a single scheduling region.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t max_region_size() const noexcept { return _max_region_size; }
+
+  //! Sets the maximum number of instructions in a single scheduling region (at least 2).
+  ASMJIT_INLINE_NODEBUG void set_max_region_size(uint32_t size) noexcept { _max_region_size = Support::max<uint32_t>(size, 2u); }
+
+  //! Returns the number of instructions that were moved by the last run of the pass.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG size_t moved_count() const noexcept { return _moved_count; }
+
+  //! \}
+
+  //! \name Pass Interface
+  //! \{
+
+  ASMJIT_API Error run(Arena& arena, Logger* logger) override;
+
+  //! Returns scheduling information of the given instruction `node`.
+  //!
+  //! The default implementation uses \ref SchedModel, however, it can be overridden to provide more precise
+  //! information, for example per instruction latencies.
+  ASMJIT_API virtual void query_inst_info(const InstNode& node, InstSchedClass sched_class, const InstRWInfo& rw_info, Out<SchedInstInfo> out) const noexcept;
+
+  //! \}
+};
+
+//! \}
+
+ASMJIT_END_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
+#endif // ASMJIT_CORE_SCHEDPASS_H_INCLUDED
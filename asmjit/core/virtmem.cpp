@@ -36,6 +36,14 @@
       #define MAP_HUGE_SHIFT 26
     #endif // MAP_HUGE_SHIFT
 
+    #ifndef MADV_POPULATE_READ
+      #define MADV_POPULATE_READ 22
+    #endif // MADV_POPULATE_READ
+
+    #ifndef MADV_POPULATE_WRITE
+      #define MADV_POPULATE_WRITE 23
+    #endif // MADV_POPULATE_WRITE
+
     #if !defined(MFD_CLOEXEC)
       #define MFD_CLOEXEC 0x0001u
     #endif // MFD_CLOEXEC
@@ -152,6 +160,65 @@ static const constexpr MemoryFlags dual_mapping_filter[2] = {
   MemoryFlags::kAccessExecute | MemoryFlags::kMMapMaxAccessExecute
 };
 
+// Number of addresses probed by `alloc_near()` in each direction from the anchor.
+static constexpr uint32_t kAllocNearProbeCount = 256u;
+
+// Tests whether all bytes of `[p, p + size)` are within `max_distance` bytes from `anchor`.
+static ASMJIT_INLINE bool is_within_distance(uintptr_t p, size_t size, uintptr_t anchor, size_t max_distance) noexcept {
+  uintptr_t end = p + size;
+  if (end < p) {
+    return false;
+  }
+
+  size_t d0 = p < anchor ? size_t(anchor - p) : size_t(p - anchor);
+  size_t d1 = end < anchor ? size_t(anchor - end) : size_t(end - anchor);
+  return Support::max(d0, d1) <= max_distance;
+}
+
+// Probes addresses around `anchor` starting at the closest ones. The `try_map` function maps `size` bytes at the
+// given address and returns the mapped address, which can be different if the address is only used as a hint, or
+// `nullptr` on failure. Mappings that are too far are released by `unmap`.
+template<typename TryMapFn, typename UnmapFn>
+static Error alloc_near_by_probing(void** p, size_t size, const void* anchor, size_t max_distance, const TryMapFn& try_map, const UnmapFn& unmap) noexcept {
+  *p = nullptr;
+
+  if (size == 0 || size > max_distance) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  size_t granularity = info().page_granularity;
+  size_t aligned_size = Support::align_up(size, granularity);
+  size_t step = Support::max(aligned_size, Support::align_up(max_distance / kAllocNearProbeCount, granularity));
+
+  uintptr_t anchor_addr = uintptr_t(anchor);
+  uintptr_t base = Support::align_down(anchor_addr, granularity);
+
+  for (uint32_t i = 0; i <= kAllocNearProbeCount; i++) {
+    size_t offset = size_t(i) * step;
+    uintptr_t candidates[2] = { base + offset, base - offset - aligned_size };
+
+    for (uintptr_t candidate : candidates) {
+      if (candidate < granularity || !is_within_distance(candidate, size, anchor_addr, max_distance)) {
+        continue;
+      }
+
+      void* ptr = try_map(reinterpret_cast<void*>(candidate));
+      if (!ptr) {
+        continue;
+      }
+
+      if (is_within_distance(uintptr_t(ptr), size, anchor_addr, max_distance)) {
+        *p = ptr;
+        return Error::kOk;
+      }
+
+      unmap(ptr);
+    }
+  }
+
+  return make_error(Error::kOutOfMemory);
+}
+
 // Virtual Memory [Windows]
 // ========================
 
@@ -224,7 +291,7 @@ static HardenedRuntimeFlags get_hardened_runtime_flags() noexcept {
   return flags;
 }
 
-Error alloc(void** p, size_t size, MemoryFlags memory_flags) noexcept {
+static Error virtual_alloc(void** p, size_t size, MemoryFlags memory_flags, void* address = nullptr) noexcept {
   *p = nullptr;
 
   if (size == 0) {
@@ -249,7 +316,7 @@ Error alloc(void** p, size_t size, MemoryFlags memory_flags) noexcept {
     allocation_type |= MEM_LARGE_PAGES;
   }
 
-  void* result = ::VirtualAlloc(nullptr, size, allocation_type, protect_flags);
+  void* result = ::VirtualAlloc(address, size, allocation_type, protect_flags);
   if (!result) {
     return make_error(Error::kOutOfMemory);
   }
@@ -258,6 +325,22 @@ Error alloc(void** p, size_t size, MemoryFlags memory_flags) noexcept {
   return Error::kOk;
 }
 
+Error alloc(void** p, size_t size, MemoryFlags memory_flags) noexcept {
+  return virtual_alloc(p, size, memory_flags);
+}
+
+Error alloc_near(void** p, size_t size, MemoryFlags memory_flags, const void* anchor, size_t max_distance) noexcept {
+  // VirtualAlloc() fails if the requested address range is not free.
+  auto try_map = [&](void* address) noexcept -> void* {
+    void* ptr;
+    return virtual_alloc(&ptr, size, memory_flags, address) == Error::kOk ? ptr : nullptr;
+  };
+
+  auto unmap = [&](void* ptr) noexcept { ::VirtualFree(ptr, 0, MEM_RELEASE); };
+
+  return alloc_near_by_probing(p, size, anchor, max_distance, try_map, unmap);
+}
+
 Error release(void* p, size_t size) noexcept {
   Support::maybe_unused(size);
 
@@ -282,6 +365,15 @@ Error protect(void* p, size_t size, MemoryFlags memory_flags) noexcept {
   return make_error(Error::kInvalidArgument);
 }
 
+Error discard(void* p, size_t size) noexcept {
+  // MEM_RESET keeps the pages committed, but their content doesn't have to be preserved (the protection is ignored).
+  if (ASMJIT_UNLIKELY(!::VirtualAlloc(p, size, MEM_RESET, PAGE_NOACCESS))) {
+    return make_error(Error::kInvalidArgument);
+  }
+
+  return Error::kOk;
+}
+
 Error alloc_dual_mapping(Out<DualMapping> dm, size_t size, MemoryFlags memory_flags) noexcept {
   dm->rx = nullptr;
   dm->rw = nullptr;
@@ -854,7 +946,45 @@ static HardenedRuntimeFlags get_hardened_runtime_flags() noexcept {
   return flags;
 }
 
-static Error map_memory(void** p, size_t size, MemoryFlags memory_flags, int fd = -1, off_t offset = 0) noexcept {
+// Maps `size` bytes aligned to `alignment` - reserves a larger inaccessible range first, maps the memory over its
+// aligned part, and then unmaps the rest of the reserved range. Returns `MAP_FAILED` and sets `errno` on failure.
+static void* mmap_aligned(void* hint, size_t size, size_t alignment, int protection, int mm_flags, int fd, off_t offset) noexcept {
+  size_t reserve_size = size + alignment - info().page_size;
+  if (ASMJIT_UNLIKELY(reserve_size < size)) {
+    errno = ENOMEM;
+    return MAP_FAILED;
+  }
+
+  void* reserved = mmap(hint, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (reserved == MAP_FAILED) {
+    return MAP_FAILED;
+  }
+
+  uintptr_t reserved_start = uintptr_t(reserved);
+  uintptr_t reserved_end = reserved_start + reserve_size;
+  uintptr_t aligned_start = Support::align_up(reserved_start, alignment);
+  uintptr_t aligned_end = aligned_start + size;
+
+  void* ptr = mmap(reinterpret_cast<void*>(aligned_start), size, protection, mm_flags | MAP_FIXED, fd, offset);
+  if (ptr == MAP_FAILED) {
+    int e = errno;
+    munmap(reserved, reserve_size);
+    errno = e;
+    return MAP_FAILED;
+  }
+
+  if (aligned_start != reserved_start) {
+    munmap(reserved, aligned_start - reserved_start);
+  }
+
+  if (aligned_end != reserved_end) {
+    munmap(reinterpret_cast<void*>(aligned_end), reserved_end - aligned_end);
+  }
+
+  return ptr;
+}
+
+static Error map_memory(void** p, size_t size, MemoryFlags memory_flags, int fd = -1, off_t offset = 0, void* hint = nullptr) noexcept {
   *p = nullptr;
 
   if (size == 0) {
@@ -889,17 +1019,44 @@ static Error map_memory(void** p, size_t size, MemoryFlags memory_flags, int fd
 #endif // __linux__
   }
 
-  void* ptr = mmap(nullptr, size, protection, mm_flags, fd, offset);
+  size_t alignment = 0;
+
+#if defined(__linux__)
+  bool populate = Support::test(memory_flags, VirtMem::MemoryFlags::kMMapPopulate);
+  if (!use_large_pages && Support::test(memory_flags, VirtMem::MemoryFlags::kMMapTransparentHugePages)) {
+    size_t lp_size = large_page_size();
+    if (lp_size > info().page_size) {
+      alignment = lp_size;
+    }
+  }
+
+  // Populating must happen after `MADV_HUGEPAGE` when huge pages are requested, otherwise the kernel would
+  // populate the mapping by regular pages, so `MAP_POPULATE` can only be used with regular mappings.
+  if (populate && !alignment) {
+    mm_flags |= MAP_POPULATE;
+    populate = false;
+  }
+#endif // __linux__
+
+  void* ptr = alignment ? mmap_aligned(hint, size, alignment, protection, mm_flags, fd, offset)
+                        : mmap(hint, size, protection, mm_flags, fd, offset);
   if (ptr == MAP_FAILED) {
     return make_error(asmjit_error_from_errno(errno));
   }
 
 #if defined(MADV_HUGEPAGE)
-  if (use_large_pages) {
+  if (use_large_pages || alignment) {
     madvise(ptr, size, MADV_HUGEPAGE);
   }
 #endif
 
+#if defined(__linux__)
+  // Pre-faulting is only a hint, a failure (for example `EINVAL` on kernels older than 5.14) is not reported.
+  if (populate) {
+    madvise(ptr, size, Support::test(memory_flags, MemoryFlags::kAccessWrite) ? MADV_POPULATE_WRITE : MADV_POPULATE_READ);
+  }
+#endif // __linux__
+
   *p = ptr;
   return Error::kOk;
 }
@@ -916,6 +1073,18 @@ Error alloc(void** p, size_t size, MemoryFlags memory_flags) noexcept {
   return map_memory(p, size, memory_flags);
 }
 
+Error alloc_near(void** p, size_t size, MemoryFlags memory_flags, const void* anchor, size_t max_distance) noexcept {
+  // The address passed to mmap() is only a hint, the kernel maps the memory elsewhere if the range is not free.
+  auto try_map = [&](void* hint) noexcept -> void* {
+    void* ptr;
+    return map_memory(&ptr, size, memory_flags, -1, 0, hint) == Error::kOk ? ptr : nullptr;
+  };
+
+  auto unmap = [&](void* ptr) noexcept { unmap_memory(ptr, size); };
+
+  return alloc_near_by_probing(p, size, anchor, max_distance, try_map, unmap);
+}
+
 Error release(void* p, size_t size) noexcept {
   return unmap_memory(p, size);
 }
@@ -928,6 +1097,21 @@ Error protect(void* p, size_t size, MemoryFlags memory_flags) noexcept {
   return make_error(asmjit_error_from_errno(errno));
 }
 
+Error discard(void* p, size_t size) noexcept {
+  // Linux drops the pages immediately with MADV_DONTNEED, whereas MADV_FREE only reclaims them under memory pressure,
+  // which means that the resident set size would not shrink. Other systems treat MADV_DONTNEED as a hint only.
+#if defined(__linux__) || !defined(MADV_FREE)
+  int advice = MADV_DONTNEED;
+#else
+  int advice = MADV_FREE;
+#endif
+
+  if (madvise(p, size, advice) == 0) {
+    return Error::kOk;
+  }
+  return make_error(asmjit_error_from_errno(errno));
+}
+
 // Virtual Memory [Posix] - Dual Mapping
 // =====================================
 
@@ -151,6 +151,21 @@ enum class MemoryFlags : uint32_t {
   //! additional mechanism to allocate regular page(s) when large page(s) allocation fails.
   kMMapLargePages = 0x00000200u,
 
+  //! Align the mapping to the size of a large page (see \ref VirtMem::large_page_size()) and advise the kernel to
+  //! back it by transparent huge pages (`MADV_HUGEPAGE`).
+  //!
+  //! \remarks Unlike \ref kMMapLargePages this flag is only a hint - the allocation doesn't fail if huge pages are
+  //! not available and the kernel would use regular pages in that case. The size of the mapping should be a multiple
+  //! of the large page size, otherwise its tail would always be backed by regular pages. This flag is ignored on
+  //! operating systems other than Linux and when used together with \ref kMMapLargePages.
+  kMMapTransparentHugePages = 0x00000400u,
+
+  //! Pre-fault all pages of the mapping during the allocation, so the first access to them doesn't page-fault.
+  //!
+  //! \remarks Pages are populated writable if the mapping has \ref kAccessWrite, otherwise readable. This flag is
+  //! only a hint that is ignored on operating systems other than Linux.
+  kMMapPopulate = 0x00000800u,
+
   //! Not an access flag, only used by `alloc_dual_mapping()` to override the default allocation strategy to always use
   //! a 'tmp' directory instead of "/dev/shm" (on POSIX platforms). Please note that this flag will be ignored if the
   //! operating system allows to allocate an executable memory by a different API than `open()` or `shm_open()`. For
@@ -169,6 +184,17 @@ ASMJIT_DEFINE_ENUM_FLAGS(MemoryFlags)
 [[nodiscard]]
 ASMJIT_API Error alloc(void** p, size_t size, MemoryFlags flags) noexcept;
 
+//! Allocates virtual memory like \ref VirtMem::alloc(), but places it so all bytes of the allocated region are within
+//! `max_distance` bytes from `anchor`.
+//!
+//! Free addresses are probed from the closest to `anchor` to the farthest. This can be used to allocate executable
+//! memory that can reach `anchor` (for example a function within the executable) by a 32-bit relative displacement.
+//!
+//! \remarks Returns \ref Error::kOutOfMemory if there is no free address range near `anchor`. The memory must be
+//! released by \ref VirtMem::release().
+[[nodiscard]]
+ASMJIT_API Error alloc_near(void** p, size_t size, MemoryFlags flags, const void* anchor, size_t max_distance) noexcept;
+
 //! Releases virtual memory previously allocated by \ref VirtMem::alloc().
 //!
 //! \note The size must be the same as used by \ref VirtMem::alloc(). If the size is not the same value the call
@@ -180,6 +206,16 @@ ASMJIT_API Error release(void* p, size_t size) noexcept;
 [[nodiscard]]
 ASMJIT_API Error protect(void* p, size_t size, MemoryFlags flags) noexcept;
 
+//! Returns physical pages backing `[p, p + size)` to the operating system while keeping the address range mapped.
+//!
+//! A cross-platform wrapper around `madvise()` (POSIX) and `VirtualAlloc(MEM_RESET)` (Windows). Both `p` and `size`
+//! must be aligned to the page size. The content of the discarded pages is undefined after the call (Linux provides
+//! zeroed pages on the next access), but the pages remain accessible with their original protection.
+//!
+//! \note Only private mappings are supported - discarding pages of a dual mapping doesn't release its backing memory.
+[[nodiscard]]
+ASMJIT_API Error discard(void* p, size_t size) noexcept;
+
 //! Dual memory mapping used to map an anonymous memory into two memory regions where one region is read-only, but
 //! executable, and the second region is read+write, but not executable. See \ref VirtMem::alloc_dual_mapping() for
 //! more details.
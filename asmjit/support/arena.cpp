@@ -7,6 +7,12 @@
 #include <asmjit/support/arena.h>
 #include <asmjit/support/support.h>
 
+#include <atomic>
+
+#if defined(ASMJIT_TEST)
+  #include <thread>
+#endif
+
 ASMJIT_BEGIN_NAMESPACE
 
 // Arena - Globals
@@ -26,14 +32,6 @@ static ASMJIT_INLINE Arena::ManagedBlock* Arena_get_zero_block() noexcept {
   return const_cast<Arena::ManagedBlock*>(&_arena_zero_block);
 }
 
-static ASMJIT_INLINE void* Arena_malloc(size_t size) noexcept {
-  return ::malloc(size);
-}
-
-static ASMJIT_INLINE void Arena_free(void* ptr) noexcept {
-  ::free(ptr);
-}
-
 static ASMJIT_INLINE void Arena_assign_block(Arena& arena, Arena::ManagedBlock* block) noexcept {
   arena._ptr = Support::align_up(block->data(), Arena::kAlignment);
   arena._end = block->end();
@@ -41,6 +39,246 @@ static ASMJIT_INLINE void Arena_assign_block(Arena& arena, Arena::ManagedBlock*
   ASMJIT_ASSERT(arena._ptr <= arena._end);
 }
 
+// Arena - Block Pool
+// ==================
+
+namespace ArenaBlockPool {
+
+// A block that is pooled - the link is stored in the block itself as its content is not used while it's pooled.
+struct PooledBlock {
+  PooledBlock* next;
+};
+
+// A per-thread cache of pooled blocks, which is accessed without synchronization.
+struct Magazine {
+  PooledBlock* blocks[kSizeClassCount];
+  uint32_t counts[kSizeClassCount];
+  bool destroyed;
+
+  ~Magazine() noexcept;
+};
+
+static std::atomic<size_t> pool_max_size;
+static std::atomic<size_t> pool_size;
+static std::atomic<PooledBlock*> pool_lists[kSizeClassCount];
+
+// Zero initialized (no constructor), the destructor returns cached blocks when the thread exits.
+static thread_local Magazine pool_magazine;
+
+static ASMJIT_INLINE size_t size_class_size(uint32_t size_class) noexcept {
+  return (size_t(1) << (kMinSizeShift + size_class)) - Globals::kAllocOverhead;
+}
+
+// Returns the smallest size class that can hold `size` bytes or `kSizeClassCount` if `size` is too large.
+static ASMJIT_INLINE uint32_t size_class_of(size_t size) noexcept {
+  if (size > size_class_size(kSizeClassCount - 1u)) {
+    return kSizeClassCount;
+  }
+
+  size_t n = (size + Globals::kAllocOverhead - 1u) >> kMinSizeShift;
+  return n ? uint32_t(Support::bit_size_of<size_t> - Support::clz(n)) : 0u;
+}
+
+static ASMJIT_INLINE bool is_enabled() noexcept {
+  return pool_max_size.load(std::memory_order_relaxed) != 0u;
+}
+
+// Pushes a linked list of blocks to a shared list - only push and exchange operations are used to access shared
+// lists, which makes them lock-free without suffering from ABA problem.
+static void push_shared(uint32_t size_class, PooledBlock* first, PooledBlock* last) noexcept {
+  std::atomic<PooledBlock*>& list = pool_lists[size_class];
+  PooledBlock* head = list.load(std::memory_order_relaxed);
+
+  do {
+    last->next = head;
+  } while (!list.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+static void free_list(PooledBlock* block, size_t block_size) noexcept {
+  while (block) {
+    PooledBlock* next = block->next;
+    pool_size.fetch_sub(block_size, std::memory_order_relaxed);
+    ::free(block);
+    block = next;
+  }
+}
+
+Magazine::~Magazine() noexcept {
+  bool enabled = is_enabled();
+
+  for (uint32_t size_class = 0; size_class < kSizeClassCount; size_class++) {
+    PooledBlock* first = blocks[size_class];
+    if (!first) {
+      continue;
+    }
+
+    if (enabled) {
+      PooledBlock* last = first;
+      while (last->next) {
+        last = last->next;
+      }
+      push_shared(size_class, first, last);
+    }
+    else {
+      free_list(first, size_class_size(size_class));
+    }
+
+    blocks[size_class] = nullptr;
+    counts[size_class] = 0u;
+  }
+
+  destroyed = true;
+}
+
+// Acquires a block of the given `size_class`, returns null if there is no pooled block available.
+static void* acquire(uint32_t size_class) noexcept {
+  Magazine& magazine = pool_magazine;
+  PooledBlock* block = nullptr;
+
+  if (ASMJIT_LIKELY(!magazine.destroyed) && magazine.blocks[size_class]) {
+    block = magazine.blocks[size_class];
+    magazine.blocks[size_class] = block->next;
+    magazine.counts[size_class]--;
+  }
+  else {
+    // Take the whole shared list, keep the first block, refill the magazine, and return the rest back.
+    block = pool_lists[size_class].exchange(nullptr, std::memory_order_acquire);
+    if (!block) {
+      return nullptr;
+    }
+
+    PooledBlock* rest = block->next;
+    if (ASMJIT_LIKELY(!magazine.destroyed)) {
+      while (rest && magazine.counts[size_class] < kMagazineCapacity) {
+        PooledBlock* next = rest->next;
+        rest->next = magazine.blocks[size_class];
+        magazine.blocks[size_class] = rest;
+        magazine.counts[size_class]++;
+        rest = next;
+      }
+    }
+
+    if (rest) {
+      PooledBlock* last = rest;
+      while (last->next) {
+        last = last->next;
+      }
+      push_shared(size_class, rest, last);
+    }
+  }
+
+  pool_size.fetch_sub(size_class_size(size_class), std::memory_order_relaxed);
+  return block;
+}
+
+// Releases a block of `size` bytes to the pool, returns false if the block cannot be pooled.
+static bool release(void* p, size_t size) noexcept {
+  if (!is_enabled()) {
+    return false;
+  }
+
+  uint32_t size_class = size_class_of(size);
+  if (size_class >= kSizeClassCount || size_class_size(size_class) != size) {
+    return false;
+  }
+
+  size_t max_size = pool_max_size.load(std::memory_order_relaxed);
+  if (pool_size.fetch_add(size, std::memory_order_relaxed) + size > max_size) {
+    pool_size.fetch_sub(size, std::memory_order_relaxed);
+    return false;
+  }
+
+  PooledBlock* block = static_cast<PooledBlock*>(p);
+  Magazine& magazine = pool_magazine;
+
+  if (ASMJIT_UNLIKELY(magazine.destroyed)) {
+    push_shared(size_class, block, block);
+    return true;
+  }
+
+  // Move all cached blocks to the shared list when the magazine is full, so other threads can use them.
+  if (magazine.counts[size_class] >= kMagazineCapacity) {
+    PooledBlock* first = magazine.blocks[size_class];
+    PooledBlock* last = first;
+    while (last->next) {
+      last = last->next;
+    }
+
+    push_shared(size_class, first, last);
+    magazine.blocks[size_class] = nullptr;
+    magazine.counts[size_class] = 0u;
+  }
+
+  block->next = magazine.blocks[size_class];
+  magazine.blocks[size_class] = block;
+  magazine.counts[size_class]++;
+  return true;
+}
+
+size_t max_pooled_size() noexcept {
+  return pool_max_size.load(std::memory_order_relaxed);
+}
+
+void set_max_pooled_size(size_t size) noexcept {
+  pool_max_size.store(size, std::memory_order_relaxed);
+  if (size == 0u) {
+    trim();
+  }
+}
+
+size_t pooled_size() noexcept {
+  return pool_size.load(std::memory_order_relaxed);
+}
+
+void trim() noexcept {
+  Magazine& magazine = pool_magazine;
+
+  for (uint32_t size_class = 0; size_class < kSizeClassCount; size_class++) {
+    size_t block_size = size_class_size(size_class);
+
+    if (!magazine.destroyed) {
+      free_list(magazine.blocks[size_class], block_size);
+      magazine.blocks[size_class] = nullptr;
+      magazine.counts[size_class] = 0u;
+    }
+
+    free_list(pool_lists[size_class].exchange(nullptr, std::memory_order_acquire), block_size);
+  }
+}
+
+} // {ArenaBlockPool}
+
+// Allocates a block of at least `size` bytes, `allocated_size` receives the real size of the block, which is greater
+// than `size` if the block was rounded up to a size class of `ArenaBlockPool`.
+static void* Arena_alloc_block(Arena& arena, size_t size, Out<size_t> allocated_size) noexcept {
+  allocated_size = size;
+
+  if (ArenaBlockPool::is_enabled()) {
+    uint32_t size_class = ArenaBlockPool::size_class_of(size);
+
+    if (size_class < ArenaBlockPool::kSizeClassCount) {
+      void* p = ArenaBlockPool::acquire(size_class);
+      size = ArenaBlockPool::size_class_size(size_class);
+      allocated_size = size;
+
+      if (p) {
+        arena._block_pool_hits++;
+        return p;
+      }
+
+      arena._block_pool_misses++;
+    }
+  }
+
+  return ::malloc(size);
+}
+
+static ASMJIT_INLINE void Arena_free_block(void* p, size_t size) noexcept {
+  if (!ArenaBlockPool::release(p, size)) {
+    ::free(p);
+  }
+}
+
 // This is only used in debug mode to verify that the Arena is used properly.
 [[maybe_unused]]
 static bool Arena_has_dynamic_block(Arena& arena, Arena::DynamicBlock* block) noexcept {
@@ -105,7 +343,7 @@ void Arena::reset(ResetPolicy reset_policy) noexcept {
     if (current) {
       do {
         ManagedBlock* next = current->next;
-        Arena_free(current);
+        Arena_free_block(current, current->size + sizeof(ManagedBlock));
         current = next;
       } while (current);
     }
@@ -118,7 +356,7 @@ void Arena::reset(ResetPolicy reset_policy) noexcept {
     DynamicBlock* current = _dynamic_blocks;
     while (current) {
       DynamicBlock* next = current->next;
-      Arena_free(current);
+      Arena_free_block(current, current->size);
       current = next;
     }
 
@@ -194,7 +432,7 @@ void* Arena::_alloc_oneshot(size_t size) noexcept {
     cur_block->next = next;
 
     next = next->next;
-    Arena_free(block_to_free);
+    Arena_free_block(block_to_free, block_to_free->size + sizeof(ManagedBlock));
   }
 
   // Calculates the initial size of a next block - in most cases this would be enough for the allocation. In
@@ -222,8 +460,8 @@ void* Arena::_alloc_oneshot(size_t size) noexcept {
     block_size -= Globals::kAllocOverhead;
   }
 
-  // Allocate new block.
-  ManagedBlock* new_block = static_cast<ManagedBlock*>(Arena_malloc(block_size));
+  // Allocate new block - its size can be greater than requested if it was acquired from `ArenaBlockPool`.
+  ManagedBlock* new_block = static_cast<ManagedBlock*>(Arena_alloc_block(*this, block_size, Out(block_size)));
   if (ASMJIT_UNLIKELY(!new_block)) {
     return nullptr;
   }
@@ -351,7 +589,8 @@ void* Arena::_alloc_reusable(size_t size, Out<size_t> allocated_size) noexcept {
       return nullptr;
     }
 
-    void* p = Arena_malloc(size + dynamic_block_overhead);
+    size_t dynamic_block_size;
+    void* p = Arena_alloc_block(*this, size + dynamic_block_overhead, Out(dynamic_block_size));
     if (ASMJIT_UNLIKELY(!p)) {
       allocated_size = 0;
       return nullptr;
@@ -370,6 +609,7 @@ void* Arena::_alloc_reusable(size_t size, Out<size_t> allocated_size) noexcept {
 
     dynamic_block->prev = nullptr;
     dynamic_block->next = next;
+    dynamic_block->size = dynamic_block_size;
     _dynamic_blocks = dynamic_block;
 
     // Align the pointer to the guaranteed alignment and store `DynamicBlock`
@@ -412,7 +652,7 @@ void Arena::_release_dynamic(void* p, size_t size) noexcept {
     next->prev = prev;
   }
 
-  Arena_free(dynamic_block);
+  Arena_free_block(dynamic_block, dynamic_block->size);
 }
 
 // Arena - Statistics
@@ -441,6 +681,8 @@ ArenaStatistics Arena::statistics() const noexcept {
   stats._used_size = used_size;
   stats._reserved_size = reserved_size;
   stats._overhead_size = _unused_byte_count;
+  stats._block_pool_hits = _block_pool_hits;
+  stats._block_pool_misses = _block_pool_misses;
   return stats;
 }
 
@@ -490,6 +732,106 @@ UNIT(arena_oneshot) {
   }
 }
 
+UNIT(arena_block_pool) {
+  constexpr size_t kThreadCount = 4u;
+  constexpr size_t kRoundCount = 100u;
+
+  size_t saved_max_pooled_size = ArenaBlockPool::max_pooled_size();
+
+  ArenaBlockPool::set_max_pooled_size(0u);
+  EXPECT_EQ(ArenaBlockPool::pooled_size(), 0u);
+
+  INFO("Verifying that Arena doesn't use ArenaBlockPool when it's disabled");
+  {
+    Arena arena(1024u * 16u);
+    for (size_t i = 0; i < 1000u; i++) {
+      EXPECT_NOT_NULL(arena.alloc_oneshot(256u));
+    }
+    arena.reset(ResetPolicy::kHard);
+
+    ArenaStatistics stats = arena.statistics();
+    EXPECT_EQ(stats.block_pool_hits(), 0u);
+    EXPECT_EQ(stats.block_pool_misses(), 0u);
+    EXPECT_EQ(ArenaBlockPool::pooled_size(), 0u);
+  }
+
+  ArenaBlockPool::set_max_pooled_size(size_t(16u) * 1024u * 1024u);
+
+  INFO("Verifying that Arena reuses blocks of ArenaBlockPool after a hard reset");
+  {
+    Arena arena(1024u * 16u);
+
+    for (size_t r = 0; r < 3u; r++) {
+      for (size_t i = 0; i < 1000u; i++) {
+        EXPECT_NOT_NULL(arena.alloc_oneshot(256u));
+      }
+
+      void* dynamic = arena.alloc_reusable(10000u);
+      EXPECT_NOT_NULL(dynamic);
+      arena.free_reusable(dynamic, 10000u);
+
+      arena.reset(ResetPolicy::kHard);
+      EXPECT_GT(ArenaBlockPool::pooled_size(), 0u);
+    }
+
+    ArenaStatistics stats = arena.statistics();
+    EXPECT_GT(stats.block_pool_misses(), 0u);
+    EXPECT_GT(stats.block_pool_hits(), 0u);
+    EXPECT_GE(stats.block_pool_hits(), stats.block_pool_misses() * 2u);
+  }
+
+  INFO("Verifying that ArenaBlockPool respects the maximum pooled size");
+  {
+    ArenaBlockPool::trim();
+    ArenaBlockPool::set_max_pooled_size(size_t(64u) * 1024u);
+
+    Arena arena(1024u * 16u);
+    for (size_t i = 0; i < 4096u; i++) {
+      EXPECT_NOT_NULL(arena.alloc_oneshot(256u));
+    }
+    arena.reset(ResetPolicy::kHard);
+    EXPECT_LE(ArenaBlockPool::pooled_size(), size_t(64u) * 1024u);
+  }
+
+  INFO("Using ArenaBlockPool by %zu threads concurrently", kThreadCount);
+  {
+    ArenaBlockPool::set_max_pooled_size(size_t(16u) * 1024u * 1024u);
+
+    std::atomic<size_t> failures {};
+    std::thread threads[kThreadCount];
+
+    for (size_t t = 0; t < kThreadCount; t++) {
+      threads[t] = std::thread([&failures, t]() {
+        Arena arena(1024u * 16u);
+
+        for (size_t r = 0; r < kRoundCount; r++) {
+          for (size_t i = 0; i < 500u + t * 100u; i++) {
+            uint64_t* p = arena.alloc_oneshot<uint64_t>(64u);
+            if (!p) {
+              failures.fetch_add(1u);
+              return;
+            }
+            p[0] = uint64_t(r);
+          }
+          arena.reset(ResetPolicy::kHard);
+        }
+      });
+    }
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0u);
+
+    // Threads have exited, so their magazines were returned to shared lists, which trim() frees.
+    ArenaBlockPool::trim();
+    EXPECT_EQ(ArenaBlockPool::pooled_size(), 0u);
+  }
+
+  ArenaBlockPool::set_max_pooled_size(saved_max_pooled_size);
+}
+
 UNIT(arena_reusable_slots_check) {
   constexpr size_t kMinReusableSlotSize = Arena::kMinReusableSlotSize;
   constexpr size_t kMaxReusableSlotSize = Arena::kMaxReusableSlotSize;
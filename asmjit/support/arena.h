@@ -30,6 +30,10 @@ struct ArenaStatistics {
   size_t _overhead_size;
   //! Number of bytes pooled by \ref Arena reusable pools and eventually \ref ArenaPool if aggregated.
   size_t _pooled_size;
+  //! Number of blocks that were acquired from \ref ArenaBlockPool.
+  size_t _block_pool_hits;
+  //! Number of blocks that had to be allocated by `malloc()`, because \ref ArenaBlockPool had no block to offer.
+  size_t _block_pool_misses;
 
   //! \}
 
@@ -57,6 +61,13 @@ struct ArenaStatistics {
   //! Returns the number of bytes pooled by \ref Arena reusable pools and eventually \ref ArenaPool if aggregated.
   ASMJIT_INLINE_NODEBUG size_t pooled_size() const noexcept { return _pooled_size; }
 
+  //! Returns the number of blocks that \ref Arena (or multiple Arenas if aggregated) acquired from \ref ArenaBlockPool.
+  ASMJIT_INLINE_NODEBUG size_t block_pool_hits() const noexcept { return _block_pool_hits; }
+
+  //! Returns the number of blocks that \ref Arena (or multiple Arenas if aggregated) had to allocate by `malloc()`,
+  //! because \ref ArenaBlockPool was enabled, but had no block of the requested size class.
+  ASMJIT_INLINE_NODEBUG size_t block_pool_misses() const noexcept { return _block_pool_misses; }
+
   //! \}
 
   //! \name Aggregation
@@ -68,6 +79,8 @@ struct ArenaStatistics {
     _reserved_size += other._reserved_size;
     _overhead_size += other._overhead_size;
     _pooled_size += other._pooled_size;
+    _block_pool_hits += other._block_pool_hits;
+    _block_pool_misses += other._block_pool_misses;
   }
 
   ASMJIT_INLINE ArenaStatistics& operator+=(const ArenaStatistics& other) noexcept {
@@ -78,9 +91,51 @@ struct ArenaStatistics {
   //! \}
 };
 
+//! Process-wide pool of memory blocks used by \ref Arena.
+//!
+//! When enabled by setting a non-zero maximum pooled size, all arenas allocate their blocks from the pool and return
+//! them to the pool instead of freeing them when they are hard reset or destroyed. This avoids `malloc()` and `free()`
+//! churn when many short-lived \ref CodeHolder instances are created and destroyed by multiple threads.
+//!
+//! Blocks are pooled by power of 2 size classes, which means that blocks that don't fit any size class exactly are
+//! rounded up when the pool is enabled. Each thread caches up to \ref kMagazineCapacity blocks of each size class in
+//! its own magazine, which is accessed without any synchronization, other blocks are kept in lock-free lists shared
+//! by all threads. Blocks cached by a thread are returned to shared lists when the thread exits.
+//!
+//! The pool is disabled by default.
+namespace ArenaBlockPool {
+
+//! Log2 of the smallest pooled block size (including allocator overhead).
+static inline constexpr uint32_t kMinSizeShift = 12u;
+//! Log2 of the largest pooled block size (including allocator overhead).
+static inline constexpr uint32_t kMaxSizeShift = 24u;
+//! Number of size classes.
+static inline constexpr uint32_t kSizeClassCount = kMaxSizeShift - kMinSizeShift + 1u;
+//! Maximum number of blocks of a single size class cached by a thread.
+static inline constexpr uint32_t kMagazineCapacity = 4u;
+
+//! Returns the maximum number of bytes that can be pooled, zero if the pool is disabled.
+[[nodiscard]]
+ASMJIT_API size_t max_pooled_size() noexcept;
+
+//! Sets the maximum number of bytes that can be pooled to `size`.
+//!
+//! Blocks released when the pool is full are freed. Setting the maximum size to zero disables the pool and frees
+//! all blocks that are not cached by other threads (see \ref trim()).
+ASMJIT_API void set_max_pooled_size(size_t size) noexcept;
+
+//! Returns the number of bytes pooled, including blocks cached by threads.
+[[nodiscard]]
+ASMJIT_API size_t pooled_size() noexcept;
+
+//! Frees all blocks kept in shared lists and all blocks cached by the calling thread.
+ASMJIT_API void trim() noexcept;
+
+} // {ArenaBlockPool}
+
 //! Arena allocator is an incremental memory allocator that allocates memory by simply incrementing a pointer. It
 //! allocates blocks of memory by using C's `malloc()`, but divides these blocks into smaller segments requested by
-//! calling `Arena::alloc()` and friends.
+//! calling `Arena::alloc()` and friends. Blocks are acquired from \ref ArenaBlockPool instead when it's enabled.
 class Arena {
 public:
   ASMJIT_NONCOPYABLE(Arena)
@@ -129,6 +184,8 @@ public:
   struct DynamicBlock {
     DynamicBlock* prev;
     DynamicBlock* next;
+    //! Size of the whole allocation including the block header.
+    size_t size;
   };
 
   //! Returns the slot index to be used for the given `size`. Returns `true` if a valid slot has been written to `slot`.
@@ -184,6 +241,11 @@ public:
   //! Large blocks for allocations that either couldn't use slots or one-shot allocation.
   DynamicBlock* _dynamic_blocks {};
 
+  //! Number of blocks acquired from \ref ArenaBlockPool.
+  size_t _block_pool_hits {};
+  //! Number of blocks that \ref ArenaBlockPool couldn't provide.
+  size_t _block_pool_misses {};
+
   //! \}
 
   //! \name Construction & Destruction
@@ -464,6 +526,9 @@ public:
   //! \note This function fills all members, but `_pooled_size` member (see \ref ArenaStatistics::pooled_size()
   //! function) would be assigned to zero as \ref Arena has no clue about the use of the requested memory.
   //!
+  //! Block pool hits and misses are accumulated during the whole lifetime of the \ref Arena, they are not cleared
+  //! by \ref reset().
+  //!
   //! \attention This function could be relatively expensive depending on the number of blocks that is managed by
   //! the allocator. The primary case of this function is to use it during the development to get an idea about
   //! the use of \ref Arena (or use of multiple Arenas if the statistics is aggregated).
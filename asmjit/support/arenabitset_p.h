@@ -39,7 +39,7 @@ ASMJIT_INLINE bool bit_at(const Span<T>& span, const Index& index) noexcept {
 }
 
 template<typename T, typename Index>
-ASMJIT_INLINE void set_bit(const Span<T>& span, const Index& index, bool value) noexcept {
+ASMJIT_INLINE void set_bit(Span<T> span, const Index& index, bool value) noexcept {
   size_t i = Support::as_basic_uint(index);
   size_t word_index = i / Support::bit_size_of<T>;
   size_t bit_index = i % Support::bit_size_of<T>;
@@ -52,7 +52,7 @@ ASMJIT_INLINE void set_bit(const Span<T>& span, const Index& index, bool value)
 }
 
 template<typename T, typename Index>
-ASMJIT_INLINE void clear_bit(const Span<T>& span, const Index& index) noexcept {
+ASMJIT_INLINE void clear_bit(Span<T> span, const Index& index) noexcept {
   size_t i = Support::as_basic_uint(index);
 
   size_t word_index = i / Support::bit_size_of<T>;
@@ -65,7 +65,7 @@ ASMJIT_INLINE void clear_bit(const Span<T>& span, const Index& index) noexcept {
 }
 
 template<typename T, typename Index>
-ASMJIT_INLINE void or_bit(const Span<T>& span, const Index& index, bool value) noexcept {
+ASMJIT_INLINE void or_bit(Span<T> span, const Index& index, bool value) noexcept {
   size_t i = Support::as_basic_uint(index);
 
   size_t word_index = i / Support::bit_size_of<T>;
@@ -78,7 +78,7 @@ ASMJIT_INLINE void or_bit(const Span<T>& span, const Index& index, bool value) n
 }
 
 template<typename T, typename Index>
-ASMJIT_INLINE void xor_bit(const Span<T>& span, const Index& index, bool value) noexcept {
+ASMJIT_INLINE void xor_bit(Span<T> span, const Index& index, bool value) noexcept {
   size_t i = Support::as_basic_uint(index);
   size_t word_index = i / Support::bit_size_of<T>;
   size_t bit_index = i % Support::bit_size_of<T>;
@@ -8,6 +8,11 @@
 
 #include <asmjit/support/arena.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define ASMJIT_ARENA_HASH_USE_SSE2
+  #include <emmintrin.h>
+#endif
+
 ASMJIT_BEGIN_NAMESPACE
 
 //! \addtogroup asmjit_support
@@ -15,7 +20,8 @@ ASMJIT_BEGIN_NAMESPACE
 
 //! Node used by \ref ArenaHash template.
 //!
-//! You must provide function `bool eq(const Key& key)` in order to make `ArenaHash::get()` working.
+//! The node only stores a precalculated hash code, the key itself must be stored by a class that inherits from it.
+//! Lookups use a key matcher that must provide `uint32_t hash_code() const` and `bool matches(const NodeT* node)`.
 class ArenaHashNode {
 public:
   ASMJIT_NONCOPYABLE(ArenaHashNode)
@@ -24,36 +30,115 @@ public:
     : _hash_code(hash_code),
       _custom_data(custom_data) {}
 
-  //! Next node in the chain, null if it terminates the chain.
-  ArenaHashNode* _hash_next {};
   //! Precalculated hash-code of key.
   uint32_t _hash_code {};
   //! Padding, can be reused by any Node that inherits `ArenaHashNode`.
   uint32_t _custom_data {};
 };
 
+//! \cond INTERNAL
+
+//! Control byte values used by \ref ArenaHash.
+//!
+//! Each slot of the hash table has a single control byte. A control byte of an occupied slot stores 7 low bits of
+//! the mixed hash code (so it's always less than 0x80), empty and deleted slots have the most significant bit set.
+enum class ArenaHashCtrl : uint8_t {
+  //! Slot that has never been occupied - terminates probing.
+  kEmpty = 0x80u,
+  //! Slot that was occupied, but its node was removed (a tombstone) - doesn't terminate probing.
+  kDeleted = 0xFEu
+};
+
+//! A group of control bytes that is matched at once.
+//!
+//! SSE2 implementation matches 16 control bytes by a single comparison, the portable implementation matches 8 control
+//! bytes packed in a 64-bit integer (SWAR). Each match returns a bit-mask where bit `i` represents the i-th slot of
+//! the group.
+struct ArenaHashGroup {
+#if defined(ASMJIT_ARENA_HASH_USE_SSE2)
+  static inline constexpr uint32_t kSize = 16u;
+
+  __m128i _ctrl;
+
+  ASMJIT_INLINE_NODEBUG explicit ArenaHashGroup(const uint8_t* ctrl) noexcept
+    : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match(uint32_t h2) const noexcept {
+    return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(char(h2)))));
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match_empty() const noexcept {
+    return match(uint32_t(ArenaHashCtrl::kEmpty));
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match_empty_or_deleted() const noexcept {
+    return uint32_t(_mm_movemask_epi8(_ctrl));
+  }
+#else
+  static inline constexpr uint32_t kSize = 8u;
+  static inline constexpr uint64_t kLsb = 0x0101010101010101u;
+  static inline constexpr uint64_t kMsb = 0x8080808080808080u;
+
+  uint64_t _ctrl;
+
+  ASMJIT_INLINE_NODEBUG explicit ArenaHashGroup(const uint8_t* ctrl) noexcept
+    : _ctrl(Support::loadu_u64_le(ctrl)) {}
+
+  //! Packs the most significant bits of each byte of `msb` into the low 8 bits of the result.
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG uint32_t _pack(uint64_t msb) noexcept {
+    return uint32_t(((msb >> 7) * 0x0102040810204080u) >> 56);
+  }
+
+  //! \note This can report a false positive for a byte that follows a matching byte, however, such byte always
+  //! belongs to an occupied slot, so the false positive is always rejected by the key matcher.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match(uint32_t h2) const noexcept {
+    uint64_t x = _ctrl ^ (kLsb * h2);
+    return _pack((x - kLsb) & ~x & kMsb);
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match_empty() const noexcept {
+    // Only `kEmpty` has the most significant bit set and bit 1 clear.
+    return _pack(_ctrl & ~(_ctrl << 6) & kMsb);
+  }
+
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t match_empty_or_deleted() const noexcept {
+    return _pack(_ctrl & kMsb);
+  }
+#endif
+};
+
+//! \endcond
+
 //! Base class used by \ref ArenaHash template
+//!
+//! The hash table uses open addressing - nodes are stored in a flat array of slots, which is split into groups of
+//! \ref ArenaHashGroup::kSize slots. Each slot has a control byte, which holds 7 bits of the hash code of its node
+//! so a lookup only has to compare keys of nodes, which match all of these bits. Groups are probed quadratically
+//! and the probing terminates when a group that has at least one empty slot is reached.
 class ArenaHashBase {
 public:
   ASMJIT_NONCOPYABLE(ArenaHashBase)
 
-  //! Buckets data.
-  ArenaHashNode** _data;
+  //! Control bytes (one per slot).
+  uint8_t* _ctrl;
+  //! Slots (nodes), the storage of control bytes follows.
+  ArenaHashNode** _slots;
   //! Count of records inserted into the hash table.
   size_t _size;
-  //! Count of hash buckets.
-  uint32_t _buckets_count;
-  //! When buckets array should grow (only checked after insertion).
-  uint32_t _buckets_grow;
-  //! Reciprocal value of `_buckets_count`.
-  uint32_t _rcp_value;
-  //! How many bits to shift right when hash is multiplied with `_rcp_value`.
-  uint8_t _rcp_shift;
-  //! Prime value index in internal prime array.
-  uint8_t _prime_index;
-
-  //! Embedded data, used by empty hash tables.
-  ArenaHashNode* _embedded[1];
+  //! Count of groups minus one (the count of groups is always a power of 2).
+  uint32_t _group_mask;
+  //! How many nodes can be inserted into empty slots before the table has to grow.
+  uint32_t _growth_left;
+
+  //! Embedded control bytes (all empty), used by empty hash tables.
+  uint8_t _embedded[ArenaHashGroup::kSize];
 
   //! \name Construction & Destruction
   //! \{
@@ -63,35 +148,30 @@ public:
   }
 
   inline ArenaHashBase(ArenaHashBase&& other) noexcept {
-    _data = other._data;
+    _ctrl = other._ctrl;
+    _slots = other._slots;
     _size = other._size;
-    _buckets_count = other._buckets_count;
-    _buckets_grow = other._buckets_grow;
-    _rcp_value = other._rcp_value;
-    _rcp_shift = other._rcp_shift;
-    _prime_index = other._prime_index;
-    _embedded[0] = other._embedded[0];
-
-    if (_data == other._embedded) {
-      _data = _embedded;
+    _group_mask = other._group_mask;
+    _growth_left = other._growth_left;
+    memset(_embedded, int(ArenaHashCtrl::kEmpty), sizeof(_embedded));
+
+    if (_ctrl == other._embedded) {
+      _ctrl = _embedded;
     }
   }
 
   inline void reset() noexcept {
-    _data = _embedded;
+    _ctrl = _embedded;
+    _slots = nullptr;
     _size = 0;
-    _buckets_count = 1;
-    _buckets_grow = 1;
-    _rcp_value = 1;
-    _rcp_shift = 0;
-    _prime_index = 0;
-    _embedded[0] = nullptr;
+    _group_mask = 0;
+    _growth_left = 0;
+    memset(_embedded, int(ArenaHashCtrl::kEmpty), sizeof(_embedded));
   }
 
   inline void release(Arena& arena) noexcept {
-    ArenaHashNode** old_data = _data;
-    if (old_data != _embedded) {
-      arena.free_reusable(old_data, _buckets_count * sizeof(ArenaHashNode*));
+    if (_slots) {
+      arena.free_reusable(_slots, _storage_size(capacity()));
     }
     reset();
   }
@@ -107,37 +187,78 @@ public:
   [[nodiscard]]
   ASMJIT_INLINE_NODEBUG size_t size() const noexcept { return _size; }
 
+  //! Returns the number of slots of the hash table (zero if no storage has been allocated yet).
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG size_t capacity() const noexcept {
+    return _slots ? (size_t(_group_mask) + 1u) * ArenaHashGroup::kSize : size_t(0);
+  }
+
   //! \}
 
   //! \name Utilities
   //! \{
 
   inline void _swap(ArenaHashBase& other) noexcept {
-    std::swap(_data, other._data);
+    std::swap(_ctrl, other._ctrl);
+    std::swap(_slots, other._slots);
     std::swap(_size, other._size);
-    std::swap(_buckets_count, other._buckets_count);
-    std::swap(_buckets_grow, other._buckets_grow);
-    std::swap(_rcp_value, other._rcp_value);
-    std::swap(_rcp_shift, other._rcp_shift);
-    std::swap(_prime_index, other._prime_index);
-    std::swap(_embedded[0], other._embedded[0]);
-
-    if (_data == other._embedded) {
-      _data = _embedded;
+    std::swap(_group_mask, other._group_mask);
+    std::swap(_growth_left, other._growth_left);
+
+    if (_ctrl == other._embedded) {
+      _ctrl = _embedded;
     }
 
-    if (other._data == _embedded) {
-      other._data = other._embedded;
+    if (other._ctrl == _embedded) {
+      other._ctrl = other._embedded;
     }
   }
 
   //! \cond INTERNAL
-  inline uint32_t _calc_mod(uint32_t hash) const noexcept {
-    uint32_t x = uint32_t((uint64_t(hash) * _rcp_value) >> _rcp_shift);
-    return hash - x * _buckets_count;
+
+  //! Mixes the bits of `hash_code` so both the group index and the control byte get well distributed values.
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG uint32_t _mix_hash(uint32_t hash_code) noexcept {
+    uint32_t h = hash_code * 0x9E3779B1u;
+    return h ^ (h >> 16);
   }
 
-  ASMJIT_API void _rehash(Arena& arena, uint32_t prime_index) noexcept;
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG uint32_t _h1(uint32_t h) noexcept { return h >> 7; }
+
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG uint32_t _h2(uint32_t h) noexcept { return h & 0x7Fu; }
+
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG size_t _storage_size(size_t capacity) noexcept {
+    return capacity * (sizeof(ArenaHashNode*) + 1u);
+  }
+
+  //! Returns the number of nodes that can be stored in a table of the given `capacity` (maximum load is 7/8).
+  [[nodiscard]]
+  static ASMJIT_INLINE_NODEBUG uint32_t _growth_capacity(size_t capacity) noexcept {
+    return uint32_t(capacity - capacity / 8u);
+  }
+
+  //! Returns the index of the first empty or deleted slot that the node having mixed hash `h` would be inserted to.
+  [[nodiscard]]
+  inline size_t _find_insert_slot(uint32_t h) const noexcept {
+    uint32_t group_index = _h1(h) & _group_mask;
+    uint32_t step = 0;
+
+    for (;;) {
+      size_t base = size_t(group_index) * ArenaHashGroup::kSize;
+      uint32_t mask = ArenaHashGroup(_ctrl + base).match_empty_or_deleted();
+
+      if (mask) {
+        return base + Support::ctz(mask);
+      }
+
+      group_index = (group_index + ++step) & _group_mask;
+    }
+  }
+
+  ASMJIT_API Error _rehash(Arena& arena, uint32_t group_count) noexcept;
   ASMJIT_API ArenaHashNode* _insert(Arena& arena, ArenaHashNode* node) noexcept;
   ASMJIT_API ArenaHashNode* _remove(Arena& arena, ArenaHashNode* node) noexcept;
   //! \endcond
@@ -150,6 +271,9 @@ public:
 //! This hash table allows duplicates to be inserted (the API is so low level that it's up to you if you allow it or
 //! not, as you should first `get()` the node and then modify it or insert a new node by using `insert()`, depending
 //! on the intention).
+//!
+//! The table only stores pointers to nodes, it never allocates nor frees nodes themselves. Its storage is allocated
+//! from \ref Arena by using reusable allocations, thus it's returned to the arena when the table grows.
 template<typename NodeT>
 class ArenaHash : public ArenaHashBase {
 public:
@@ -176,16 +300,34 @@ public:
   template<typename KeyT>
   [[nodiscard]]
   inline NodeT* get(const KeyT& key) const noexcept {
-    uint32_t hash_mod = _calc_mod(key.hash_code());
-    NodeT* node = static_cast<NodeT*>(_data[hash_mod]);
-
-    while (node && !key.matches(node)) {
-      node = static_cast<NodeT*>(node->_hash_next);
+    uint32_t h = _mix_hash(key.hash_code());
+    uint32_t h2 = _h2(h);
+    uint32_t group_index = _h1(h) & _group_mask;
+    uint32_t step = 0;
+
+    for (;;) {
+      size_t base = size_t(group_index) * ArenaHashGroup::kSize;
+      ArenaHashGroup group(_ctrl + base);
+
+      for (uint32_t mask = group.match(h2); mask; mask &= mask - 1u) {
+        NodeT* node = static_cast<NodeT*>(_slots[base + Support::ctz(mask)]);
+        if (key.matches(node)) {
+          return node;
+        }
+      }
+
+      if (group.match_empty()) {
+        return nullptr;
+      }
+
+      group_index = (group_index + ++step) & _group_mask;
     }
-    return node;
   }
 
+  //! Inserts `node` into the hash table, returns null if the table failed to grow (out of memory).
   ASMJIT_INLINE_NODEBUG NodeT* insert(Arena& arena, NodeT* node) noexcept { return static_cast<NodeT*>(_insert(arena, node)); }
+
+  //! Removes `node` from the hash table, returns null if the node was not found.
   ASMJIT_INLINE_NODEBUG NodeT* remove(Arena& arena, NodeT* node) noexcept { return static_cast<NodeT*>(_remove(arena, node)); }
 
   //! \}
@@ -1260,6 +1260,34 @@ static SUPPORT_INLINE_NODEBUG uint32_t hash_string(const char* data, size_t size
   return hash_code;
 }
 
+// Gets a hash of the given `data` of `size` bytes by processing 8 bytes at a time. This is much faster than
+// `hash_string()` when hashing long strings, however, the resulting hash is not compatible with `hash_char()`.
+[[nodiscard]]
+static SUPPORT_INLINE uint32_t hash_bytes(const void* data, size_t size) noexcept {
+  constexpr uint64_t kMul = 0x9E3779B97F4A7C15u;
+
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  uint64_t h = uint64_t(size) * kMul;
+
+  while (size >= 8u) {
+    h = (h ^ loadu_u64(p)) * kMul;
+    h ^= h >> 29;
+    p += 8;
+    size -= 8u;
+  }
+
+  if (size) {
+    uint64_t tail = 0;
+    for (size_t i = 0; i < size; i++) {
+      tail |= uint64_t(p[i]) << (i * 8u);
+    }
+    h = (h ^ tail) * kMul;
+    h ^= h >> 29;
+  }
+
+  return uint32_t(h ^ (h >> 32));
+}
+
 [[nodiscard]]
 static SUPPORT_INLINE_NODEBUG const char* find_packed_string(const char* p, uint32_t id) noexcept {
   uint32_t i = 0;
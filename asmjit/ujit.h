@@ -10,6 +10,7 @@
 #include <asmjit/ujit/ujitbase.h>
 #include <asmjit/ujit/unicompiler.h>
 #include <asmjit/ujit/unicondition.h>
+#include <asmjit/ujit/uniloop.h>
 #include <asmjit/ujit/uniop.h>
 #include <asmjit/ujit/vecconsttable.h>
 #include <asmjit/asmjit-scope-end.h>
@@ -71,6 +71,14 @@ enum class FloatToIntOutsideRangeBehavior : uint8_t {
   kSaturatedValue
 };
 
+//! The behavior of f32 to bf16 conversion when the input or the result is denormal.
+enum class FloatToBF16DenormalBehavior : uint8_t {
+  //! Denormal inputs and results are flushed to zero of the same sign (X86|X86_64 - AVX512_BF16 and AVX_NE_CONVERT).
+  kFlushToZero,
+  //! Denormal inputs and results are preserved and rounded like other values (AArch64).
+  kPreserve
+};
+
 //! The behavior of a floating point min/max instructions when comparing against NaN.
 enum class FMinFMaxOpBehavior : uint8_t {
   //! Min and max selects a finite value if one of the compared values is NaN.
@@ -107,9 +115,9 @@ enum class DataWidth : uint8_t {
 enum class VecWidth : uint8_t {
   //! 128-bit vector register (baseline, SSE/AVX, NEON, etc...).
   k128 = 0,
-  //! 256-bit vector register (AVX2+).
+  //! 256-bit vector register (AVX2+ or SVE having 256-bit vector length).
   k256 = 1,
-  //! 512-bit vector register (AVX512_DQ & AVX512_BW & AVX512_VL).
+  //! 512-bit vector register (AVX512_DQ & AVX512_BW & AVX512_VL or SVE having 512-bit vector length).
   k512 = 2,
   //! 1024-bit vector register (no backend at the moment).
   k1024 = 3
@@ -130,6 +138,23 @@ enum class Bcst : uint8_t {
   kNA_Unique = 0xFF
 };
 
+//! Latency class of the longest dependency chain of a loop body, used by \ref UniCompiler::unroll_factor().
+enum class LatencyClass : uint8_t {
+  //! Integer additions, logical operations, shifts, and shuffles within 128-bit lanes.
+  kIntSimple = 0,
+  //! Integer multiplication of 16-bit elements.
+  kIntMul16 = 1,
+  //! Integer multiplication of 32-bit elements (see \ref CpuHints::kVecFastIntMul32).
+  kIntMul32 = 2,
+  //! Integer multiplication of 64-bit elements (see \ref CpuHints::kVecFastIntMul64).
+  kIntMul64 = 3,
+  //! Floating point addition, multiplication, and multiply-add.
+  kFloatArith = 4,
+
+  //! Maximum value of `LatencyClass`.
+  kMaxValue = kFloatArith
+};
+
 namespace VecWidthUtils {
 
 static ASMJIT_INLINE OperandSignature signature_of(VecWidth vw) noexcept {
@@ -151,8 +176,14 @@ static ASMJIT_INLINE TypeId type_id_of(VecWidth vw) noexcept {
 #endif
 
 #if defined(ASMJIT_UJIT_AARCH64)
-  Support::maybe_unused(vw);
-  return TypeId::kInt32x4;
+  // 256-bit and 512-bit vectors are only used by SVE, where they map to scalable vector registers (Z).
+  static const TypeId table[] = {
+    TypeId::kInt32x4,
+    TypeId::kInt32x8,
+    TypeId::kInt32x16
+  };
+
+  return table[size_t(vw)];
 #endif
 }
 
@@ -32,7 +32,8 @@ public:
   enum class StackId : uint32_t {
     kIndex,
     kCustom,
-    kMaxValue = kCustom
+    kSveLanes,
+    kMaxValue = kSveLanes
   };
 
 #if defined(ASMJIT_UJIT_X86)
@@ -121,6 +122,8 @@ public:
     kSHA512,
     kSM3,
     kSM4,
+    kSVE,
+    kSVE2,
 
     kIntrin = 63
   };
@@ -154,6 +157,12 @@ public:
   uint64_t _gp_ext_mask {};
   //! NEON extensions (AArch64).
   uint64_t _asimd_ext_mask {};
+  //! SVE predicate registers allocated by \ref sve_alloc_pred() (AArch64).
+  uint32_t _sve_pred_mask {};
+  //! SVE vector length of the target CPU in bytes, zero if unknown (AArch64).
+  uint32_t _sve_vector_length {};
+  //! Whether the all-true SVE predicate returned by \ref sve_ptrue() was initialized in the current function.
+  bool _sve_ptrue_initialized {};
 #endif // ASMJIT_UJIT_AARCH64
 
   //! The behavior of scalar operations (mostly floating point).
@@ -164,6 +173,8 @@ public:
   FMAddOpBehavior _fmadd_op_behavior {};
   //! The behavior of a float-to-int conversion when the float is out of integer range, infinite, or NaN.
   FloatToIntOutsideRangeBehavior _float_to_int_outside_range_behavior {};
+  //! The behavior of f32 to bf16 conversion when the input or the result is denormal.
+  FloatToBF16DenormalBehavior _float_to_bf16_denormal_behavior {};
 
   //! Target CPU features.
   CpuFeatures _features {};
@@ -403,6 +414,27 @@ public:
   ASMJIT_INLINE_NODEBUG bool has_sm3() const noexcept { return has_asimd_ext(ASIMDExt::kSM3); }
   //! Tests whether SM4 extension is available.
   ASMJIT_INLINE_NODEBUG bool has_sm4() const noexcept { return has_asimd_ext(ASIMDExt::kSM4); }
+  //! Tests whether SVE extension is available.
+  ASMJIT_INLINE_NODEBUG bool has_sve() const noexcept { return has_asimd_ext(ASIMDExt::kSVE); }
+  //! Tests whether SVE2 extension is available.
+  ASMJIT_INLINE_NODEBUG bool has_sve2() const noexcept { return has_asimd_ext(ASIMDExt::kSVE2); }
+
+  //! Returns the SVE vector length of the target CPU in bytes, or zero if it's not known.
+  //!
+  //! The vector length is detected when the features passed to the constructor are the features of the host CPU,
+  //! otherwise it must be provided by \ref set_sve_vector_length().
+  ASMJIT_INLINE_NODEBUG uint32_t sve_vector_length() const noexcept { return _sve_vector_length; }
+
+  //! Sets the SVE vector length of the target CPU in bytes, must be called before \ref init_vec_width().
+  ASMJIT_INLINE_NODEBUG void set_sve_vector_length(uint32_t vl) noexcept { _sve_vector_length = vl; }
+
+  //! Tests whether vectors of \ref vec_width() are SVE scalable vector registers (Z), see \ref init_vec_width().
+  //!
+  //! \note The SVE backend is vector-length specific, not vector-length agnostic - the generated code assumes that
+  //! the vector length equals \ref vec_width(), which must match \ref sve_vector_length(), otherwise \ref
+  //! init_vec_width() reports an error and uses 128-bit vectors. Only 256-bit and 512-bit vector lengths are mapped
+  //! to SVE, a CPU having 128-bit SVE uses NEON, which has the same width.
+  ASMJIT_INLINE_NODEBUG bool use_sve() const noexcept { return _vec_reg_type == RegType::kVecNLen; }
 
   //! Tests whether the target SIMD ISA provides instructions with non-destructive destination (always on AArch64).
   ASMJIT_INLINE_NODEBUG bool has_non_destructive_src() const noexcept { return true; }
@@ -418,6 +450,8 @@ public:
   //! Returns the behavior of float-to-integer conversion when the floating point is outside of the integer representable
   //! range, infinite, or NaN.
   ASMJIT_INLINE_NODEBUG FloatToIntOutsideRangeBehavior float_to_int_outside_range_behavior() const noexcept { return _float_to_int_outside_range_behavior; }
+  //! Returns the behavior of f32 to bf16 conversion when the input or the result is denormal.
+  ASMJIT_INLINE_NODEBUG FloatToBF16DenormalBehavior float_to_bf16_denormal_behavior() const noexcept { return _float_to_bf16_denormal_behavior; }
 
   //! Tests whether a scalar operation is zeroing the rest of the destination register (AArch64).
   ASMJIT_INLINE_NODEBUG bool is_scalar_op_zeroing() const noexcept { return _scalar_op_behavior == ScalarOpBehavior::kZeroing; }
@@ -453,6 +487,16 @@ public:
 
   ASMJIT_API bool has_masked_access_of(uint32_t data_size) const noexcept;
 
+  //! Returns the number of independent vectors a loop body should process per iteration to hide the latency of its
+  //! dependency chains, which can be used to size \ref new_vec_array() and \ref UniLoop.
+  //!
+  //! The factor is the latency of `latency_class` multiplied by the number of such operations the target issues per
+  //! cycle at the current \ref vec_width(), adjusted by \ref cpu_hints(). It's limited by the number of vector
+  //! registers, which the body needs `regs_per_vec` of per each vector (excluding `reserved_regs` that hold constants
+  //! and other values shared by all vectors), and by \ref OpArray::kMaxSize. The returned value is always at least 1.
+  [[nodiscard]]
+  ASMJIT_API uint32_t unroll_factor(uint32_t regs_per_vec = 1, uint32_t reserved_regs = 0, LatencyClass latency_class = LatencyClass::kFloatArith) const noexcept;
+
   //! \}
 
   //! \name CPU SIMD Width and SIMD Width Utilities
@@ -660,6 +704,24 @@ public:
   //! In general this mostly does a cleanup of \ref UniCompiler.
   ASMJIT_API void unhook_func() noexcept;
 
+#if defined(ASMJIT_UJIT_AARCH64)
+  //! Returns an all-true SVE predicate register, which is initialized at the beginning of the function on first use.
+  //!
+  //! \note SVE predicate registers are not allocated by the register allocator. The all-true predicate uses P7 and
+  //! P6 is used as a temporary by comparisons, thus neither can be used by user code that uses \ref use_sve() mode.
+  ASMJIT_API a64::PReg sve_ptrue();
+
+  //! Restores the all-true SVE predicate returned by \ref sve_ptrue() at the current position, which is required
+  //! after a call as predicate registers are not preserved across calls. Does nothing if not in \ref use_sve() mode.
+  ASMJIT_API void sve_restore_ptrue();
+
+  //! Allocates a SVE predicate register (P0 to P5) that can be used until it's released by \ref sve_release_pred().
+  ASMJIT_API a64::PReg sve_alloc_pred();
+
+  //! Releases a SVE predicate register allocated by \ref sve_alloc_pred().
+  ASMJIT_API void sve_release_pred(const a64::PReg& p) noexcept;
+#endif // ASMJIT_UJIT_AARCH64
+
   //! Creates a new \ref FuncNode.
   //!
   //! This is just a convenience wrapper that calls \ref BaseCompiler::new_func_node().
@@ -743,14 +805,18 @@ public:
   //! \{
 
   //! Creates a new \ref InvokeNode.
-  ASMJIT_INLINE Error new_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
-    return cc->new_invoke_node(out, inst_id, o0, signature);
-  }
+  //!
+  //! \note In \ref use_sve() mode the invoked function clobbers all SVE vector and predicate registers, thus all
+  //! vector registers are considered clobbered by the register allocator and it's an error to create an invoke node
+  //! while a predicate allocated by \ref sve_alloc_pred() is in use (for example within a masked tail of \ref UniLoop).
+  //! When the node is added to the instruction stream manually, \ref sve_restore_ptrue() must be called after it.
+  ASMJIT_API Error new_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature);
 
   //! Creates a new \ref InvokeNode and adds it to the instruction stream.
-  ASMJIT_INLINE Error add_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
-    return cc->add_invoke_node(out, inst_id, o0, signature);
-  }
+  //!
+  //! \note In \ref use_sve() mode the all-true predicate returned by \ref sve_ptrue() is restored after the call,
+  //! see \ref new_invoke_node() for more details.
+  ASMJIT_API Error add_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature);
 
   //! \}
 
@@ -1207,6 +1273,39 @@ public:
   ASMJIT_API void emit_mv(UniOpMV op, const Mem& dst_, const Vec& src_, Alignment alignment, uint32_t idx = 0);
   ASMJIT_API void emit_mv(UniOpMV op, const Mem& dst_, const OpArray& src_, Alignment alignment, uint32_t idx = 0);
 
+  //! Emits a gather - loads each element of `dst_` from `[base + (index_[i] << shift) + disp]`.
+  //!
+  //! Hardware gathers are only used when the CPU provides \ref CpuHints::kVecFastGather, otherwise the operation is
+  //! emitted as a sequence of scalar loads inserted into the destination. SVE vectors always use SVE gathers.
+  ASMJIT_API void emit_gather(UniOpGather op, const Vec& dst_, const Gp& base, const Vec& index_, uint32_t shift, int32_t disp = 0);
+
+  //! Emits a scatter - stores each element of `src_` to `[base + (index_[i] << shift) + disp]`.
+  //!
+  //! Hardware scatters are only used when the CPU provides \ref CpuHints::kVecFastScatter, otherwise the operation
+  //! is emitted as a sequence of scalar extracts and stores. SVE vectors always use SVE scatters.
+  ASMJIT_API void emit_scatter(UniOpScatter op, const Gp& base, const Vec& index_, uint32_t shift, const Vec& src_, int32_t disp = 0);
+
+  //! Emits a horizontal reduction of all elements of `src_` into `dst_`, which is either a general-purpose register
+  //! or a vector register (the result is stored to its lowest element).
+  ASMJIT_API void emit_reduce(UniOpReduce op, const Operand_& dst_, const Vec& src_);
+  //! \overload
+  ASMJIT_API void emit_reduce(UniOpReduce op, const Operand_& dst_, const OpArray& src_);
+
+  //! Emits a byte table lookup - `dst_[i] = index_[i] < n ? table[index_[i]] : 0`, where the table has `n` bytes held
+  //! by 128-bit registers passed in `table_` (16 bytes per register, at most 8 registers).
+  //!
+  //! Unlike \ref v_swizzlev_u8() indexes are not limited to 16 bytes and each 128-bit lane of a wider destination
+  //! looks up the whole table, which includes SVE vectors.
+  //!
+  //! \note AArch64 requires table registers of TBL/TBX to be consecutive, so the same registers should always be
+  //! passed in the same order, otherwise the register allocator may fail to satisfy all lookups.
+  ASMJIT_API void emit_lut_u8(const Vec& dst_, const OpArray& table_, const Operand_& index_);
+  //! \overload
+  //!
+  //! The table has `table_size` bytes (16, 32, 64, or 128) in memory, for example a constant in a user provided
+  //! constant pool.
+  ASMJIT_API void emit_lut_u8(const Vec& dst_, const Mem& table_, uint32_t table_size, const Operand_& index_);
+
   ASMJIT_API void emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src1_, const Operand_& src2_);
   ASMJIT_API void emit_3v(UniOpVVV op, const OpArray& dst_, const Operand_& src1_, const OpArray& src2_);
   ASMJIT_API void emit_3v(UniOpVVV op, const OpArray& dst_, const OpArray& src1_, const Operand_& src2_);
@@ -1262,6 +1361,10 @@ public:
     ASMJIT_INLINE void name(const Mem& dst, const Vec& src, uint32_t idx) { emit_mv(op, dst, src, Alignment(default_alignment), idx); } \
     ASMJIT_INLINE void name(const Mem& dst, const VecArray& src, uint32_t idx) { emit_mv(op, dst, src, Alignment(default_alignment), idx); }
 
+  #define DEFINE_OP_REDUCE(name, op) \
+    template<typename Dst, typename Src> \
+    ASMJIT_INLINE void name(const Dst& dst, const Src& src) { emit_reduce(op, dst, src); }
+
   #define DEFINE_OP_3V(name, op) \
     template<typename Dst, typename Src1, typename Src2> \
     ASMJIT_INLINE void name(const Dst& dst, const Src1& src1, const Src2& src2) { emit_3v(op, dst, src1, src2); }
@@ -1404,6 +1507,20 @@ public:
   DEFINE_OP_2V(v_cvt_round_f32_to_i32, UniOpVV::kCvtRoundF32ToI32)
   DEFINE_OP_2V(v_cvt_round_f64_to_i32_lo, UniOpVV::kCvtRoundF64ToI32Lo)
   DEFINE_OP_2V(v_cvt_round_f64_to_i32_hi, UniOpVV::kCvtRoundF64ToI32Hi)
+  DEFINE_OP_2V(v_cvt_f16_lo_to_f32, UniOpVV::kCvtF16LoToF32)
+  DEFINE_OP_2V(v_cvt_f16_hi_to_f32, UniOpVV::kCvtF16HiToF32)
+  DEFINE_OP_2V(v_cvt_f32_to_f16_lo, UniOpVV::kCvtF32ToF16Lo)
+  DEFINE_OP_2V(v_cvt_bf16_lo_to_f32, UniOpVV::kCvtBF16LoToF32)
+  DEFINE_OP_2V(v_cvt_bf16_hi_to_f32, UniOpVV::kCvtBF16HiToF32)
+  DEFINE_OP_2V(v_cvt_f32_to_bf16_lo, UniOpVV::kCvtF32ToBF16Lo)
+  DEFINE_OP_2V(v_popcnt_u8, UniOpVV::kPopcntU8)
+  DEFINE_OP_2V(v_popcnt_u16, UniOpVV::kPopcntU16)
+  DEFINE_OP_2V(v_popcnt_u32, UniOpVV::kPopcntU32)
+  DEFINE_OP_2V(v_popcnt_u64, UniOpVV::kPopcntU64)
+  DEFINE_OP_2V(v_lzcnt_u32, UniOpVV::kLzcntU32)
+  DEFINE_OP_2V(v_lzcnt_u64, UniOpVV::kLzcntU64)
+  DEFINE_OP_2V(v_tzcnt_u32, UniOpVV::kTzcntU32)
+  DEFINE_OP_2V(v_tzcnt_u64, UniOpVV::kTzcntU64)
 
   DEFINE_OP_2VI(v_slli_i16, UniOpVVI::kSllU16)
   DEFINE_OP_2VI(v_slli_u16, UniOpVVI::kSllU16)
@@ -1610,6 +1727,10 @@ public:
   DEFINE_OP_VM_A(v_loadavec_i32_to_i64, UniOpVM::kLoadCvtN_I32ToI64, 0)
   DEFINE_OP_VM_A(v_loaduvec_u32_to_u64, UniOpVM::kLoadCvtN_U32ToU64, 1)
   DEFINE_OP_VM_A(v_loadavec_u32_to_u64, UniOpVM::kLoadCvtN_U32ToU64, 0)
+  DEFINE_OP_VM_A(v_loaduvec_f16_to_f32, UniOpVM::kLoadCvtN_F16ToF32, 1)
+  DEFINE_OP_VM_A(v_loadavec_f16_to_f32, UniOpVM::kLoadCvtN_F16ToF32, 0)
+  DEFINE_OP_VM_A(v_loaduvec_bf16_to_f32, UniOpVM::kLoadCvtN_BF16ToF32, 1)
+  DEFINE_OP_VM_A(v_loadavec_bf16_to_f32, UniOpVM::kLoadCvtN_BF16ToF32, 0)
 
   DEFINE_OP_VM_I(v_insert_u8, UniOpVM::kLoadInsertU8, 1)
   DEFINE_OP_VM_I(v_insert_u16, UniOpVM::kLoadInsertU16, 1)
@@ -1683,6 +1804,53 @@ public:
   DEFINE_OP_MV_I(v_store_extract_u32, UniOpMV::kStoreExtractU32, 1)
   DEFINE_OP_MV_I(v_store_extract_u64, UniOpMV::kStoreExtractU64, 1)
 
+  DEFINE_OP_MV_U(v_storeuvec_f32_to_f16, UniOpMV::kStoreCvtN_F32ToF16, 1)
+  DEFINE_OP_MV_A(v_storeavec_f32_to_f16, UniOpMV::kStoreCvtN_F32ToF16, 0)
+  DEFINE_OP_MV_U(v_storeuvec_f32_to_bf16, UniOpMV::kStoreCvtN_F32ToBF16, 1)
+  DEFINE_OP_MV_A(v_storeavec_f32_to_bf16, UniOpMV::kStoreCvtN_F32ToBF16, 0)
+
+  ASMJIT_INLINE void v_gather_u32(const Vec& dst, const Gp& base, const Vec& index, uint32_t shift, int32_t disp = 0) { emit_gather(UniOpGather::kGatherU32, dst, base, index, shift, disp); }
+  ASMJIT_INLINE void v_gather_u64(const Vec& dst, const Gp& base, const Vec& index, uint32_t shift, int32_t disp = 0) { emit_gather(UniOpGather::kGatherU64, dst, base, index, shift, disp); }
+  ASMJIT_INLINE void v_gather_f32(const Vec& dst, const Gp& base, const Vec& index, uint32_t shift, int32_t disp = 0) { emit_gather(UniOpGather::kGatherF32, dst, base, index, shift, disp); }
+  ASMJIT_INLINE void v_gather_f64(const Vec& dst, const Gp& base, const Vec& index, uint32_t shift, int32_t disp = 0) { emit_gather(UniOpGather::kGatherF64, dst, base, index, shift, disp); }
+
+  ASMJIT_INLINE void v_scatter_u32(const Gp& base, const Vec& index, uint32_t shift, const Vec& src, int32_t disp = 0) { emit_scatter(UniOpScatter::kScatterU32, base, index, shift, src, disp); }
+  ASMJIT_INLINE void v_scatter_u64(const Gp& base, const Vec& index, uint32_t shift, const Vec& src, int32_t disp = 0) { emit_scatter(UniOpScatter::kScatterU64, base, index, shift, src, disp); }
+  ASMJIT_INLINE void v_scatter_f32(const Gp& base, const Vec& index, uint32_t shift, const Vec& src, int32_t disp = 0) { emit_scatter(UniOpScatter::kScatterF32, base, index, shift, src, disp); }
+  ASMJIT_INLINE void v_scatter_f64(const Gp& base, const Vec& index, uint32_t shift, const Vec& src, int32_t disp = 0) { emit_scatter(UniOpScatter::kScatterF64, base, index, shift, src, disp); }
+
+  ASMJIT_INLINE void v_lut_u8(const Vec& dst, const VecArray& table, const Operand_& index) { emit_lut_u8(dst, table, index); }
+  ASMJIT_INLINE void v_lut_u8(const Vec& dst, const Mem& table, uint32_t table_size, const Operand_& index) { emit_lut_u8(dst, table, table_size, index); }
+
+  DEFINE_OP_REDUCE(v_reduce_add_u32, UniOpReduce::kAddU32)
+  DEFINE_OP_REDUCE(v_reduce_add_u64, UniOpReduce::kAddU64)
+  DEFINE_OP_REDUCE(v_reduce_add_f32, UniOpReduce::kAddF32)
+  DEFINE_OP_REDUCE(v_reduce_add_f64, UniOpReduce::kAddF64)
+  DEFINE_OP_REDUCE(v_reduce_min_i8, UniOpReduce::kMinI8)
+  DEFINE_OP_REDUCE(v_reduce_min_u8, UniOpReduce::kMinU8)
+  DEFINE_OP_REDUCE(v_reduce_min_i16, UniOpReduce::kMinI16)
+  DEFINE_OP_REDUCE(v_reduce_min_u16, UniOpReduce::kMinU16)
+  DEFINE_OP_REDUCE(v_reduce_min_i32, UniOpReduce::kMinI32)
+  DEFINE_OP_REDUCE(v_reduce_min_u32, UniOpReduce::kMinU32)
+  DEFINE_OP_REDUCE(v_reduce_min_i64, UniOpReduce::kMinI64)
+  DEFINE_OP_REDUCE(v_reduce_min_u64, UniOpReduce::kMinU64)
+  DEFINE_OP_REDUCE(v_reduce_min_f32, UniOpReduce::kMinF32)
+  DEFINE_OP_REDUCE(v_reduce_min_f64, UniOpReduce::kMinF64)
+  DEFINE_OP_REDUCE(v_reduce_max_i8, UniOpReduce::kMaxI8)
+  DEFINE_OP_REDUCE(v_reduce_max_u8, UniOpReduce::kMaxU8)
+  DEFINE_OP_REDUCE(v_reduce_max_i16, UniOpReduce::kMaxI16)
+  DEFINE_OP_REDUCE(v_reduce_max_u16, UniOpReduce::kMaxU16)
+  DEFINE_OP_REDUCE(v_reduce_max_i32, UniOpReduce::kMaxI32)
+  DEFINE_OP_REDUCE(v_reduce_max_u32, UniOpReduce::kMaxU32)
+  DEFINE_OP_REDUCE(v_reduce_max_i64, UniOpReduce::kMaxI64)
+  DEFINE_OP_REDUCE(v_reduce_max_u64, UniOpReduce::kMaxU64)
+  DEFINE_OP_REDUCE(v_reduce_max_f32, UniOpReduce::kMaxF32)
+  DEFINE_OP_REDUCE(v_reduce_max_f64, UniOpReduce::kMaxF64)
+  DEFINE_OP_REDUCE(v_reduce_and_u32, UniOpReduce::kAndU32)
+  DEFINE_OP_REDUCE(v_reduce_and_u64, UniOpReduce::kAndU64)
+  DEFINE_OP_REDUCE(v_reduce_or_u32, UniOpReduce::kOrU32)
+  DEFINE_OP_REDUCE(v_reduce_or_u64, UniOpReduce::kOrU64)
+
   DEFINE_OP_3V(v_and_i32, UniOpVVV::kAndU32)
   DEFINE_OP_3V(v_and_u32, UniOpVVV::kAndU32)
   DEFINE_OP_3V(v_and_i64, UniOpVVV::kAndU64)
@@ -1887,6 +2055,14 @@ public:
   DEFINE_OP_3V(v_packs_i32_i16, UniOpVVV::kPacksI32_I16)
   DEFINE_OP_3V(v_packs_i32_u16, UniOpVVV::kPacksI32_U16)
   DEFINE_OP_3V(v_swizzlev_u8, UniOpVVV::kSwizzlev_U8)
+  DEFINE_OP_3V(v_add_f16, UniOpVVV::kAddF16)
+  DEFINE_OP_3V(v_sub_f16, UniOpVVV::kSubF16)
+  DEFINE_OP_3V(v_mul_f16, UniOpVVV::kMulF16)
+  DEFINE_OP_3V(v_div_f16, UniOpVVV::kDivF16)
+  DEFINE_OP_3V(v_compress_u32, UniOpVVV::kCompressU32)
+  DEFINE_OP_3V(v_compress_u64, UniOpVVV::kCompressU64)
+  DEFINE_OP_3V(v_expand_u32, UniOpVVV::kExpandU32)
+  DEFINE_OP_3V(v_expand_u64, UniOpVVV::kExpandU64)
 
 #if defined(ASMJIT_UJIT_AARCH64)
   DEFINE_OP_3V(v_mulw_lo_i8, UniOpVVV::kMulwLoI8)
@@ -1959,11 +2135,16 @@ public:
   DEFINE_OP_4V(s_nmsub_f64, UniOpVVVV::kNMSubF64S)
   DEFINE_OP_4V(v_nmsub_f32, UniOpVVVV::kNMSubF32)
   DEFINE_OP_4V(v_nmsub_f64, UniOpVVVV::kNMSubF64)
+  DEFINE_OP_4V(v_dot_i8_i32, UniOpVVVV::kDotI8_I32)
+  DEFINE_OP_4V(v_dot_u8_i32, UniOpVVVV::kDotU8_I32)
+  DEFINE_OP_4V(v_dot_u8i8_i32, UniOpVVVV::kDotU8I8_I32)
+  DEFINE_OP_4V(v_dot_i16_i32, UniOpVVVV::kDotI16_I32)
 
   #undef DEFINE_OP_4V
   #undef DEFINE_OP_3VI_WRAP
   #undef DEFINE_OP_3VI
   #undef DEFINE_OP_3V
+  #undef DEFINE_OP_REDUCE
   #undef DEFINE_OP_MV_A
   #undef DEFINE_OP_MV_U
   #undef DEFINE_OP_MV_I
@@ -12,6 +12,10 @@
 #include <asmjit/ujit/unicompiler_utils_p.h>
 #include <asmjit/ujit/unicondition.h>
 
+#if ASMJIT_ARCH_ARM == 64 && defined(__linux__)
+  #include <sys/prctl.h>
+#endif
+
 ASMJIT_BEGIN_SUB_NAMESPACE(ujit)
 
 using GPExt = UniCompiler::GPExt;
@@ -33,6 +37,7 @@ UniCompiler::UniCompiler(BackendCompiler* cc, const CpuFeatures& features, CpuHi
   _fmin_fmax_op_behavior = FMinFMaxOpBehavior::kFiniteValue;
   _fmadd_op_behavior = FMAddOpBehavior::kFMAStoreToAccumulator;
   _float_to_int_outside_range_behavior = FloatToIntOutsideRangeBehavior::kSaturatedValue;
+  _float_to_bf16_denormal_behavior = FloatToBF16DenormalBehavior::kPreserve;
 
   _init_extensions(features);
 }
@@ -42,6 +47,16 @@ UniCompiler::~UniCompiler() noexcept {}
 // ujit::UniCompiler - CPU Architecture, Features and Optimization Options
 // =======================================================================
 
+// Returns the SVE vector length of the host CPU in bytes, or zero if it's not known.
+static uint32_t sve_host_vector_length() noexcept {
+#if ASMJIT_ARCH_ARM == 64 && defined(__linux__)
+  int vl = prctl(51 /* PR_SVE_GET_VL */);
+  if (vl > 0)
+    return uint32_t(vl) & 0xFFFFu; // PR_SVE_VL_LEN_MASK.
+#endif
+  return 0u;
+}
+
 void UniCompiler::_init_extensions(const CpuFeatures& features) noexcept {
   uint64_t gp_ext_mask = 0;
   uint64_t asimd_ext_mask = 0;
@@ -74,26 +89,61 @@ void UniCompiler::_init_extensions(const CpuFeatures& features) noexcept {
   if (features.arm().has_sha512()  ) asimd_ext_mask |= uint64_t(1) << uint32_t(ASIMDExt::kSHA512);
   if (features.arm().has_sm3()     ) asimd_ext_mask |= uint64_t(1) << uint32_t(ASIMDExt::kSM3);
   if (features.arm().has_sm4()     ) asimd_ext_mask |= uint64_t(1) << uint32_t(ASIMDExt::kSM4);
+  if (features.arm().has_sve()     ) asimd_ext_mask |= uint64_t(1) << uint32_t(ASIMDExt::kSVE);
+  if (features.arm().has_sve2()    ) asimd_ext_mask |= uint64_t(1) << uint32_t(ASIMDExt::kSVE2);
 
   _gp_ext_mask = gp_ext_mask;
   _asimd_ext_mask = asimd_ext_mask;
+
+  // The vector length is only known when generating code for the host CPU, otherwise it must be set explicitly.
+  _sve_vector_length = 0u;
+  if (has_sve() && features == CpuInfo::host().features()) {
+    _sve_vector_length = sve_host_vector_length();
+  }
 }
 
 VecWidth UniCompiler::max_vec_width_from_cpu_features() noexcept {
+  // SVE is only used when the vector length is 256 or 512 bits. The generated code depends on the vector length
+  // (spill slots, MUL VL offsets, and element counts of loops), so it must be known at JIT time.
+  if (has_sve()) {
+    switch (_sve_vector_length) {
+      case 32u: return VecWidth::k256;
+      case 64u: return VecWidth::k512;
+      default:
+        break;
+    }
+  }
+
   return VecWidth::k128;
 }
 
 void UniCompiler::init_vec_width(VecWidth vw) noexcept {
-  ASMJIT_ASSERT(vw == VecWidth::k128);
-  Support::maybe_unused(vw);
+  // 256-bit and 512-bit vectors use SVE scalable vector registers (Z) and the generated code is specific to the
+  // vector length, which must match the vector length of the CPU that executes it. A width that doesn't match is
+  // reported as an error and NEON is used instead, so the compiler stays in a consistent state.
+  if (vw != VecWidth::k128) {
+    if (!has_sve()) {
+      cc->report_error(make_error(Error::kFeatureNotEnabled));
+      vw = VecWidth::k128;
+    }
+    else if (vw > VecWidth::k512 || _sve_vector_length != (16u << uint32_t(vw))) {
+      cc->report_error(make_error(Error::kInvalidArgument));
+      vw = VecWidth::k128;
+    }
+  }
 
-  _vec_width = VecWidth::k128;
-  _vec_reg_type = RegType::kVec128;
-  _vec_type_id = TypeId::kInt32x4;
-  _vec_multiplier = 1u;
+  _vec_width = vw;
+  _vec_reg_type = vw == VecWidth::k128 ? RegType::kVec128 : RegType::kVecNLen;
+  _vec_type_id = VecWidthUtils::type_id_of(vw);
+  _vec_multiplier = uint8_t(1u << uint32_t(vw));
 }
 
 bool UniCompiler::has_masked_access_of(uint32_t data_size) const noexcept {
+  // SVE loads and stores are predicated, so masked accesses are native regardless of the element size.
+  if (use_sve() && data_size <= 8u && Support::is_power_of_2(data_size)) {
+    return true;
+  }
+
   switch (data_size) {
     case 1: return has_cpu_hint(CpuHints::kVecMaskedOps8);
     case 2: return has_cpu_hint(CpuHints::kVecMaskedOps16);
@@ -105,6 +155,20 @@ bool UniCompiler::has_masked_access_of(uint32_t data_size) const noexcept {
   }
 }
 
+uint32_t UniCompiler::unroll_factor(uint32_t regs_per_vec, uint32_t reserved_regs, LatencyClass latency_class) const noexcept {
+  // Latencies of common Cortex and Neoverse cores having 2 vector pipelines. 64-bit multiplication is emulated by
+  // a sequence of 32-bit multiplications and additions.
+  static constexpr LatencyInfo latency_table[size_t(LatencyClass::kMaxValue) + 1] = {
+    { 2, 2 }, // kIntSimple.
+    { 4, 1 }, // kIntMul16.
+    { 4, 1 }, // kIntMul32.
+    { 8, 1 }, // kIntMul64.
+    { 4, 2 }  // kFloatArith.
+  };
+
+  return unroll_factor_from_latency(latency_table[size_t(latency_class)], vec_reg_count(), regs_per_vec, reserved_regs);
+}
+
 // ujit::UniCompiler - Embed
 // =========================
 
@@ -131,6 +195,87 @@ void UniCompiler::hook_func() noexcept {
 
 void UniCompiler::unhook_func() noexcept {
   _func_init_hook = nullptr;
+  _sve_pred_mask = 0u;
+  _sve_ptrue_initialized = false;
+}
+
+// ujit::UniCompiler - SVE Predicates
+// ==================================
+
+// P7 holds an all-true predicate and P6 is a temporary used by comparisons. P0 to P5 are allocated on demand by
+// sve_alloc_pred(). Predicate registers are not allocated by the register allocator, thus they are fixed.
+static constexpr uint32_t kSvePTrueId = 7u;
+static constexpr uint32_t kSvePTmpId = 6u;
+static constexpr uint32_t kSvePAllocatableMask = 0x3Fu;
+
+a64::PReg UniCompiler::sve_ptrue() {
+  if (!_sve_ptrue_initialized) {
+    ScopedInjector injector(cc, &_func_init_hook);
+    cc->ptrue(a64::PReg(kSvePTrueId).b());
+    _sve_ptrue_initialized = true;
+  }
+  return a64::PReg(kSvePTrueId);
+}
+
+void UniCompiler::sve_restore_ptrue() {
+  if (use_sve()) {
+    cc->ptrue(a64::PReg(kSvePTrueId).b());
+  }
+}
+
+a64::PReg UniCompiler::sve_alloc_pred() {
+  uint32_t available = kSvePAllocatableMask & ~_sve_pred_mask;
+  if (!available) {
+    // All predicates are in use - UniLoop masked tails nested too deep.
+    cc->report_error(make_error(Error::kInvalidState));
+    return a64::PReg(0u);
+  }
+
+  uint32_t id = Support::ctz(available);
+  _sve_pred_mask |= 1u << id;
+  return a64::PReg(id);
+}
+
+void UniCompiler::sve_release_pred(const a64::PReg& p) noexcept {
+  _sve_pred_mask &= ~(1u << p.id());
+}
+
+// ujit::UniCompiler - Function Invocation
+// =======================================
+
+// AAPCS64 only preserves the low 64 bits of V8-V15 and no predicate registers across calls. Predicates allocated by
+// `sve_alloc_pred()` cannot be restored after a call, thus creating an invoke node while any of them is in use is an
+// error. Scalable vector registers (Z) are handled by the register allocator once all vector registers are clobbered.
+static ASMJIT_INLINE Error UniCompiler_check_sve_invoke(UniCompiler& uc) noexcept {
+  if (ASMJIT_UNLIKELY(uc.use_sve() && uc._sve_pred_mask != 0u)) {
+    return uc.cc->report_error(make_error(Error::kInvalidState));
+  }
+  return Error::kOk;
+}
+
+static ASMJIT_INLINE void UniCompiler_init_sve_invoke(UniCompiler& uc, InvokeNode* invoke_node) noexcept {
+  if (uc.use_sve()) {
+    invoke_node->detail()._call_conv.set_preserved_regs(RegGroup::kVec, 0u);
+  }
+}
+
+Error UniCompiler::new_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
+  out = nullptr;
+  ASMJIT_PROPAGATE(UniCompiler_check_sve_invoke(*this));
+  ASMJIT_PROPAGATE(cc->new_invoke_node(out, inst_id, o0, signature));
+
+  UniCompiler_init_sve_invoke(*this, *out);
+  return Error::kOk;
+}
+
+Error UniCompiler::add_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
+  out = nullptr;
+  ASMJIT_PROPAGATE(UniCompiler_check_sve_invoke(*this));
+  ASMJIT_PROPAGATE(cc->add_invoke_node(out, inst_id, o0, signature));
+
+  UniCompiler_init_sve_invoke(*this, *out);
+  sve_restore_ptrue();
+  return Error::kOk;
 }
 
 // ujit::UniCompiler - Constants
@@ -151,39 +296,40 @@ Operand UniCompiler::simd_const(const void* c, Bcst bcst_width, VecWidth const_w
 }
 
 Operand UniCompiler::simd_const(const void* c, Bcst bcst_width, const Vec& similar_to) {
-  Support::maybe_unused(similar_to);
-  return simd_vec_const(c, bcst_width, VecWidth::k128);
+  return simd_vec_const(c, bcst_width, similar_to);
 }
 
 Operand UniCompiler::simd_const(const void* c, Bcst bcst_width, const VecArray& similar_to) {
   ASMJIT_ASSERT(!similar_to.is_empty());
-  Support::maybe_unused(bcst_width, similar_to);
-
-  return simd_vec_const(c, bcst_width, VecWidth::k128);
+  return simd_vec_const(c, bcst_width, similar_to[0]);
 }
 
 Vec UniCompiler::simd_vec_const(const void* c, Bcst bcst_width, VecWidth const_width) {
   Support::maybe_unused(bcst_width);
   Support::maybe_unused(const_width);
 
+  // Constants are scalable vector registers (Z) in SVE mode.
+  OperandSignature signature{use_sve() ? RegTraits<RegType::kVecNLen>::kSignature : RegTraits<RegType::kVec128>::kSignature};
+
   size_t n = _vec_consts.size();
   for (size_t i = 0; i < n; i++) {
     if (_vec_consts[i].ptr == c) {
-      return Vec(OperandSignature{RegTraits<RegType::kVec128>::kSignature}, _vec_consts[i].virt_reg_id);
+      return Vec(signature, _vec_consts[i].virt_reg_id);
     }
   }
 
-  return Vec(OperandSignature{RegTraits<RegType::kVec128>::kSignature}, _new_vec_const(c, true).id());
+  return Vec(signature, _new_vec_const(c, true).id());
 }
 
 Vec UniCompiler::simd_vec_const(const void* c, Bcst bcst_width, const Vec& similar_to) {
-  Support::maybe_unused(similar_to);
-  return simd_vec_const(c, bcst_width, VecWidth::k128);
+  // ASIMD code that emulates SVE operations by 128-bit lanes uses the V view of a constant, which is the same.
+  Vec vec = simd_vec_const(c, bcst_width, VecWidth::k128);
+  return similar_to.is_reg(RegType::kVecNLen) ? vec : vec.v128();
 }
 
 Vec UniCompiler::simd_vec_const(const void* c, Bcst bcst_width, const VecArray& similar_to) {
-  Support::maybe_unused(similar_to);
-  return simd_vec_const(c, bcst_width, VecWidth::k128);
+  ASMJIT_ASSERT(!similar_to.is_empty());
+  return simd_vec_const(c, bcst_width, similar_to[0]);
 }
 
 Mem UniCompiler::simd_mem_const(const void* c, Bcst bcst_width, VecWidth const_width) {
@@ -251,7 +397,14 @@ Vec UniCompiler::_new_vec_const(const void* c, bool is_unique_const) {
     Mem m = _get_mem_const(c);
 
     ScopedInjector inject(cc, &_func_init_hook);
-    v_loadavec(vec, m);
+    if (use_sve()) {
+      // Constants in the table are 128-bit wide, so the constant is broadcasted to all 128-bit lanes.
+      v_loada128(vec.v128(), m);
+      cc->dup(vec.z(), vec.z().at(0));
+    }
+    else {
+      v_loadavec(vec, m);
+    }
   }
 
   return vec;
@@ -286,15 +439,18 @@ Vec UniCompiler::simd_const_16b(const void* data16) {
 // =========================
 
 Mem UniCompiler::tmp_stack(StackId id, uint32_t size) {
+  // The area used to emulate SVE operations by 128-bit lanes holds up to 4 vectors of 512 bits.
+  uint32_t capacity = id == StackId::kSveLanes ? 256u : 32u;
+
   ASMJIT_ASSERT(Support::is_power_of_2(size));
-  ASMJIT_ASSERT(size <= 32);
+  ASMJIT_ASSERT(size <= capacity);
 
   // Only used by asserts.
   Support::maybe_unused(size);
 
   Mem& stack = _tmp_stack[size_t(id)];
   if (!stack.base_id()) {
-    stack = cc->new_stack(32, 16, "tmp_stack");
+    stack = cc->new_stack(capacity, 16, "tmp_stack");
   }
   return stack;
 }
@@ -1325,7 +1481,21 @@ static constexpr UniOpVInfo opcode_info_2v[size_t(UniOpVV::kMaxValue) + 1] = {
   DEFINE_OP(Inst::kIdFcvtzs_v       , kIntrin, 0, 0, 0, kNone, kF64V, k32, kHi, k64, kHi, 0x00u), // kCvtTruncF64ToI32Hi.
   DEFINE_OP(Inst::kIdFcvtns_v       , kASIMD , 0, 0, 0, kNone, kF32V, k32, kNA, k32, kNA, 0x00u), // kCvtRoundF32ToI32.
   DEFINE_OP(Inst::kIdFcvtns_v       , kIntrin, 0, 0, 0, kNone, kF64V, k32, kLo, k64, kLo, 0x00u), // kCvtRoundF64ToI32Lo.
-  DEFINE_OP(Inst::kIdFcvtns_v       , kIntrin, 0, 0, 0, kNone, kF64V, k32, kHi, k64, kHi, 0x00u)  // kCvtRoundF64ToI32Hi.
+  DEFINE_OP(Inst::kIdFcvtns_v       , kIntrin, 0, 0, 0, kNone, kF64V, k32, kHi, k64, kHi, 0x00u), // kCvtRoundF64ToI32Hi.
+  DEFINE_OP(Inst::kIdFcvtl_v        , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k16, kLo, 0x00u), // kCvtF16LoToF32.
+  DEFINE_OP(Inst::kIdFcvtl2_v       , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k16, kHi, 0x00u), // kCvtF16HiToF32.
+  DEFINE_OP(Inst::kIdFcvtn_v        , kIntrin, 0, 0, 0, kNone, kNone, k16, kLo, k32, kNA, 0x00u), // kCvtF32ToF16Lo.
+  DEFINE_OP(Inst::kIdShll_v         , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k16, kLo, 0x10u), // kCvtBF16LoToF32.
+  DEFINE_OP(Inst::kIdShll2_v        , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k16, kHi, 0x10u), // kCvtBF16HiToF32.
+  DEFINE_OP(Inst::kIdBfcvtn_v       , kIntrin, 0, 0, 0, kNone, kNone, k16, kLo, k32, kNA, 0x00u), // kCvtF32ToBF16Lo.
+  DEFINE_OP(Inst::kIdCnt_v          , kASIMD , 0, 0, 0, kNone, kNone, k8 , kNA, k8 , kNA, 0x00u), // kPopcntU8.
+  DEFINE_OP(Inst::kIdCnt_v          , kIntrin, 0, 0, 0, kNone, kNone, k16, kNA, k16, kNA, 0x00u), // kPopcntU16.
+  DEFINE_OP(Inst::kIdCnt_v          , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k32, kNA, 0x00u), // kPopcntU32.
+  DEFINE_OP(Inst::kIdCnt_v          , kIntrin, 0, 0, 0, kNone, kNone, k64, kNA, k64, kNA, 0x00u), // kPopcntU64.
+  DEFINE_OP(Inst::kIdClz_v          , kASIMD , 0, 0, 0, kNone, kNone, k32, kNA, k32, kNA, 0x00u), // kLzcntU32.
+  DEFINE_OP(Inst::kIdClz_v          , kIntrin, 0, 0, 0, kNone, kNone, k64, kNA, k64, kNA, 0x00u), // kLzcntU64.
+  DEFINE_OP(Inst::kIdRbit_v         , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k32, kNA, 0x00u), // kTzcntU32.
+  DEFINE_OP(Inst::kIdRbit_v         , kIntrin, 0, 0, 0, kNone, kNone, k64, kNA, k64, kNA, 0x00u)  // kTzcntU64.
 };
 
 static constexpr UniOpVInfo opcode_info_2vs[size_t(UniOpVR::kMaxValue) + 1] = {
@@ -1580,6 +1750,14 @@ static constexpr UniOpVInfo opcode_info_3v[size_t(UniOpVVV::kMaxValue) + 1] = {
   DEFINE_OP(Inst::kIdSqxtn_v        , kIntrin, 0, 0, 0, kNone, kNone, k16, kNA, k32, kNA, 0x00u), // kPacksI32_I16.
   DEFINE_OP(Inst::kIdSqxtun_v       , kIntrin, 0, 0, 0, kNone, kNone, k16, kNA, k32, kNA, 0x00u), // kPacksI32_U16.
   DEFINE_OP(Inst::kIdTbl_v          , kASIMD , 0, 0, 0, kNone, kNone, k8 , kNA, k8 , kNA, 0x00u), // kSwizzlev_U8.
+  DEFINE_OP(Inst::kIdFadd_v         , kFP16  , 1, 0, 0, kNone, kNone, k16, kNA, k16, kNA, 0x00u), // kAddF16.
+  DEFINE_OP(Inst::kIdFsub_v         , kFP16  , 0, 0, 0, kNone, kNone, k16, kNA, k16, kNA, 0x00u), // kSubF16.
+  DEFINE_OP(Inst::kIdFmul_v         , kFP16  , 1, 0, 0, kNone, kNone, k16, kNA, k16, kNA, 0x00u), // kMulF16.
+  DEFINE_OP(Inst::kIdFdiv_v         , kFP16  , 0, 0, 0, kNone, kNone, k16, kNA, k16, kNA, 0x00u), // kDivF16.
+  DEFINE_OP(Inst::kIdTbl_v          , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k32, kNA, 0x00u), // kCompressU32.
+  DEFINE_OP(Inst::kIdTbl_v          , kIntrin, 0, 0, 0, kNone, kNone, k64, kNA, k64, kNA, 0x00u), // kCompressU64.
+  DEFINE_OP(Inst::kIdTbl_v          , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k32, kNA, 0x00u), // kExpandU32.
+  DEFINE_OP(Inst::kIdTbl_v          , kIntrin, 0, 0, 0, kNone, kNone, k64, kNA, k64, kNA, 0x00u), // kExpandU64.
   DEFINE_OP(Inst::kIdSmull_v        , kASIMD , 0, 0, 0, kNone, kNone, k16, kNA, k8 , kLo, 0x00u), // kMulwLoI8.
   DEFINE_OP(Inst::kIdUmull_v        , kASIMD , 0, 0, 0, kNone, kNone, k16, kNA, k8 , kLo, 0x00u), // kMulwLoU8.
   DEFINE_OP(Inst::kIdSmull2_v       , kASIMD , 0, 0, 0, kNone, kNone, k16, kNA, k8 , kHi, 0x00u), // kMulwHiI8.
@@ -1641,7 +1819,11 @@ static constexpr UniOpVInfo opcode_info_4v[size_t(UniOpVVV::kMaxValue) + 1] = {
   DEFINE_OP(Inst::kIdFnmadd_v       , kASIMD , 0, 0, 0, kNone, kF32S, k32, kNA, k32, kNA, 0x00u), // kNMSubF32S.
   DEFINE_OP(Inst::kIdFnmadd_v       , kASIMD , 0, 0, 0, kNone, kF64S, k64, kNA, k64, kNA, 0x00u), // kNMSubF64S.
   DEFINE_OP(Inst::kIdFmls_v         , kASIMD , 0, 0, 0, kNone, kF32V, k32, kNA, k32, kNA, 0x01u), // kNMSubF32.
-  DEFINE_OP(Inst::kIdFmls_v         , kASIMD , 0, 0, 0, kNone, kF64V, k64, kNA, k64, kNA, 0x01u)  // kNMSubF64.
+  DEFINE_OP(Inst::kIdFmls_v         , kASIMD , 0, 0, 0, kNone, kF64V, k64, kNA, k64, kNA, 0x01u), // kNMSubF64.
+  DEFINE_OP(Inst::kIdSdot_v         , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k8 , kNA, 0x00u), // kDotI8_I32.
+  DEFINE_OP(Inst::kIdUdot_v         , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k8 , kNA, 0x00u), // kDotU8_I32.
+  DEFINE_OP(Inst::kIdUsdot_v        , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k8 , kNA, 0x00u), // kDotU8I8_I32.
+  DEFINE_OP(0                       , kIntrin, 0, 0, 0, kNone, kNone, k32, kNA, k16, kNA, 0x00u)  // kDotI16_I32.
 };
 
 #undef DEFINE_OP
@@ -1726,6 +1908,8 @@ static constexpr UniOpVMInfo opcode_info_2vm[size_t(UniOpVM::kMaxValue) + 1] = {
   DEFINE_OP(UniOpVV::kCvtU16LoToU32,  0, kNA), // kLoadCvtN_U16ToU32.
   DEFINE_OP(UniOpVV::kCvtI32LoToI64,  0, kNA), // kLoadCvtN_I32ToI64.
   DEFINE_OP(UniOpVV::kCvtU32LoToU64,  0, kNA), // kLoadCvtN_U32ToU64.
+  DEFINE_OP(UniOpVV::kCvtF16LoToF32,  0, kNA), // kLoadCvtN_F16ToF32.
+  DEFINE_OP(UniOpVV::kCvtBF16LoToF32, 0, kNA), // kLoadCvtN_BF16ToF32.
   DEFINE_OP(0                       ,  1, k8 ), // kLoadInsertU8.
   DEFINE_OP(0                       ,  2, k16), // kLoadInsertU16.
   DEFINE_OP(0                       ,  4, k32), // kLoadInsertU32.
@@ -1759,7 +1943,12 @@ static constexpr UniOpVMInfo opcode_info_2mv[size_t(UniOpMV::kMaxValue) + 1] = {
   DEFINE_OP(NarrowingOp::kNone      ,  0, k32), // kStoreN_U32.
   DEFINE_OP(NarrowingOp::kNone      ,  0, k64), // kStoreN_U64.
   DEFINE_OP(NarrowingOp::kNone      ,  0, k32), // kStoreN_F32.
-  DEFINE_OP(NarrowingOp::kNone      ,  0, k64)  // kStoreN_F64.
+  DEFINE_OP(NarrowingOp::kNone      ,  0, k64), // kStoreN_F64.
+  DEFINE_OP(NarrowingOp::kNone      ,  2, k16), // kStoreExtractU16.
+  DEFINE_OP(NarrowingOp::kNone      ,  4, k32), // kStoreExtractU32.
+  DEFINE_OP(NarrowingOp::kNone      ,  8, k64), // kStoreExtractU64.
+  DEFINE_OP(NarrowingOp::kNone      ,  0, k16), // kStoreCvtN_F32ToF16.
+  DEFINE_OP(NarrowingOp::kNone      ,  0, k16)  // kStoreCvtN_F32ToBF16.
   /*
   DEFINE_OP(NarrowingOp::kU16ToU8   ,  8, kNA), // kStoreCvtz64_U16ToU8.
   DEFINE_OP(NarrowingOp::kU32ToU16  ,  8, kNA), // kStoreCvtz64_U32ToU16.
@@ -1925,179 +2114,1367 @@ static ASMJIT_NOINLINE void vec_neg(UniCompiler& uc, const Vec& dst, const Vec&
     cc->mvn_(dst.q(), src.q());
 }
 
-// ujit::UniCompiler - Vector Instructions - Swizzle 32 Impl
-// =========================================================
+// ujit::UniCompiler - Vector Instructions - SVE
+// =============================================
 
-// [DCBA] <- Mov    (DCBA, dcba)
-// [AAAA] <- Dup0   (DCBA, dcba)
-// [BBBB] <- Dup1   (DCBA, dcba)
-// [CCCC] <- Dup2   (DCBA, dcba)
-// [DDDD] <- Dup3   (DCBA, dcba)
-// [CDAB] <- Rev64  (DCBA, dcba)
-// [aDCB] <- Ext4   (DCBA, dcba) [dcb|aDCB|A  ]
-// [baDC] <- Ext8   (DCBA, dcba) [ dc|baDC|BA ]
-// [cbaD] <- Ext12  (DCBA, dcba) [  d|cbaD|CBA]
-// [bBaA] <- Zip1_4S(DCBA, dcba)
-// [baBA] <- Zip1_2D(DCBA, dcba)
-// [dDcC] <- Zip2_4S(DCBA, dcba)
-// [dcDC] <- Zip2_2D(DCBA, dcba)
-// [caCA] <- Uzp1_4S(DCBA, dcba)
-// [baBA] <- Uzp1_2D(DCBA, dcba)
-// [dbDB] <- Uzp2_4S(DCBA, dcba)
-// [dcDC] <- Uzp2_2D(DCBA, dcba)
-// [cCaA] <- Trn1_4S(DCBA, dcba)
-// [dDbB] <- Trn2_4S(DCBA, dcba)
-struct Swizzle32Data {
-  enum class OpTarget : uint8_t {
-    kDst = 0,
-    k1   = 1,
-    k2   = 2,
-    kA   = 3,
+// Vectors wider than 128 bits are SVE Z registers. Instructions that have an unpredicated SVE form (logical ops,
+// add, sub, and some floating point ops) keep the ASIMD instruction id as the assembler encodes them as SVE when
+// the operands are Z registers, the remaining instructions are predicated by the all-true predicate returned by
+// `UniCompiler::sve_ptrue()`. Operations that have no SVE instruction are emulated by their ASIMD lowering applied
+// to each 128-bit lane, see `sve_emulate_by_lanes()`.
 
-    k_   = kDst
-  };
+static ASMJIT_INLINE bool is_sve_vec(const Operand_& op) noexcept {
+  return op.is_reg(RegType::kVecNLen);
+}
 
-  struct Op {
-    //! Swizzle operation does nothing - 'mov' (this can be only the first operation).
-    static constexpr uint8_t kMov = 1;
-    //! Swizzle operation performs an insert - moves a value from one lane to another.
-    static constexpr uint8_t kIns = 2;
-    //! Swizzle operation duplicates a lane across all others - 'dup'.
-    static constexpr uint8_t kDup = 3;
-    //! Swizzle operation rotates a vector - 'ext'.
-    static constexpr uint8_t kExt = 4;
-    //! Swizzle operation swaps lo/hi elements of 64-bit lanes - 'rev64'.
-    static constexpr uint8_t kRev64 = 5;
-    //! Swizzle operation can be implemented as a single zip[1|2], uzp[1|2], or trn[1|2] instruction with 32-bit or 64-bit elements.
-    static constexpr uint8_t kZipUnzip = 7;
+// Returns `op` with Z registers replaced by their 128-bit V views, used by scalar operations.
+static ASMJIT_INLINE Operand sve_v128_op(const Operand_& op) noexcept {
+  return is_sve_vec(op) ? Operand(op.as<Vec>().v128()) : Operand(op);
+}
 
-    static constexpr uint8_t kIns0To1  = uint8_t(kIns     ) | (0 << 4) | (1 << 6);
-    static constexpr uint8_t kIns0To2  = uint8_t(kIns     ) | (0 << 4) | (2 << 6);
-    static constexpr uint8_t kIns0To3  = uint8_t(kIns     ) | (0 << 4) | (3 << 6);
-    static constexpr uint8_t kIns1To0  = uint8_t(kIns     ) | (1 << 4) | (0 << 6);
-    static constexpr uint8_t kIns1To2  = uint8_t(kIns     ) | (1 << 4) | (2 << 6);
-    static constexpr uint8_t kIns1To3  = uint8_t(kIns     ) | (1 << 4) | (3 << 6);
-    static constexpr uint8_t kIns2To0  = uint8_t(kIns     ) | (2 << 4) | (0 << 6);
-    static constexpr uint8_t kIns2To1  = uint8_t(kIns     ) | (2 << 4) | (1 << 6);
-    static constexpr uint8_t kIns2To3  = uint8_t(kIns     ) | (2 << 4) | (3 << 6);
-    static constexpr uint8_t kIns3To0  = uint8_t(kIns     ) | (3 << 4) | (0 << 6);
-    static constexpr uint8_t kIns3To1  = uint8_t(kIns     ) | (3 << 4) | (1 << 6);
-    static constexpr uint8_t kIns3To2  = uint8_t(kIns     ) | (3 << 4) | (2 << 6);
-    static constexpr uint8_t kDup0     = uint8_t(kDup     ) | (0 << 4);
-    static constexpr uint8_t kDup1     = uint8_t(kDup     ) | (1 << 4);
-    static constexpr uint8_t kDup2     = uint8_t(kDup     ) | (2 << 4);
-    static constexpr uint8_t kDup3     = uint8_t(kDup     ) | (3 << 4);
-    static constexpr uint8_t kExt4     = uint8_t(kExt     ) | (1 << 4);
-    static constexpr uint8_t kExt8     = uint8_t(kExt     ) | (2 << 4);
-    static constexpr uint8_t kExt12    = uint8_t(kExt     ) | (3 << 4);
-    static constexpr uint8_t kZip1_4S  = uint8_t(kZipUnzip) | (0 << 4) | (0 << 7);
-    static constexpr uint8_t kZip1_2D  = uint8_t(kZipUnzip) | (0 << 4) | (1 << 7);
-    static constexpr uint8_t kZip2_4S  = uint8_t(kZipUnzip) | (1 << 4) | (0 << 7);
-    static constexpr uint8_t kZip2_2D  = uint8_t(kZipUnzip) | (1 << 4) | (1 << 7);
-    static constexpr uint8_t kUzp1_4S  = uint8_t(kZipUnzip) | (2 << 4) | (0 << 7);
-    static constexpr uint8_t kUzp1_2D  = uint8_t(kZipUnzip) | (2 << 4) | (1 << 7);
-    static constexpr uint8_t kUzp2_4S  = uint8_t(kZipUnzip) | (3 << 4) | (0 << 7);
-    static constexpr uint8_t kUzp2_2D  = uint8_t(kZipUnzip) | (3 << 4) | (1 << 7);
-    static constexpr uint8_t kTrn1_4S  = uint8_t(kZipUnzip) | (4 << 4);
-    static constexpr uint8_t kTrn2_4S  = uint8_t(kZipUnzip) | (5 << 4);
+static ASMJIT_INLINE Vec sve_typed(const Vec& vec, ElementSize sz) noexcept {
+  Vec out = vec.z();
+  vec_set_type(out, sz);
+  return out;
+}
 
-    // Alias to nothing to make the table easier to read.
-    static constexpr uint8_t k_ = 0;
+static ASMJIT_INLINE a64::PReg sve_tmp_pred(ElementSize sz) noexcept {
+  return a64::PReg::make_p_with_element_type(a64::VecElementType(uint32_t(sz) + 1), kSvePTmpId);
+}
 
-    uint8_t data;
+static ASMJIT_NOINLINE void sve_mov(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  if (dst.id() != src.id()) {
+    uc.cc->orr(dst.z().d(), src.z().d(), src.z().d());
+  }
+}
 
-    ASMJIT_INLINE_NODEBUG bool is_valid() const noexcept { return data != 0; }
-    ASMJIT_INLINE_NODEBUG uint32_t type() const noexcept { return data & 0xF; }
+// Converts `m` to an addressing mode accepted by SVE contiguous loads and stores of `1 << msz` bytes per element.
+// Offsets that are multiples of the vector length are encoded as `MUL VL` when the memory size of the access is
+// the vector length, other offsets and index shifts are precalculated.
+static ASMJIT_NOINLINE Mem sve_mem(UniCompiler& uc, const Mem& m, uint32_t msz, bool full_vector) {
+  ASMJIT_ASSERT(m.has_base_reg());
+  ASMJIT_ASSERT(!m.is_pre_index() && !m.is_post_index());
 
-    ASMJIT_INLINE_NODEBUG uint32_t dup_idx() const noexcept { return (data >> 4) & 0x3; }
-    ASMJIT_INLINE_NODEBUG uint32_t ext_imm() const noexcept { return (data >> 2) & (0x3 << 2); }
+  BackendCompiler* cc = uc.cc;
+  Gp base = m.base_reg().as<Gp>();
+  int64_t offset = m.offset();
 
-    ASMJIT_INLINE_NODEBUG uint32_t zip_op() const noexcept { return (data >> 4) & 0x7; }
-    ASMJIT_INLINE_NODEBUG bool zip_s4() const noexcept { return (data & (1 << 7)) == 0; }
+  if (!m.has_index()) {
+    if (offset == 0)
+      return m;
 
-    ASMJIT_INLINE_NODEBUG uint32_t ins_src() const noexcept { return (data >> 4) & 0x3; }
-    ASMJIT_INLINE_NODEBUG uint32_t ins_dst() const noexcept { return (data >> 6) & 0x3; }
-  };
+    int64_t vl = int64_t(16u << uint32_t(uc.vec_width()));
+    if (full_vector && (offset % vl) == 0 && Support::is_between<int64_t>(offset / vl, -8, 7))
+      return a64::ptr(base, int32_t(offset / vl));
 
-  //! \name Members
-  //! \{
+    Gp addr = uc.new_gpz("@sve_addr");
+    uc.add(addr, base, Imm(offset));
+    return a64::ptr(addr);
+  }
 
-  Op ops[3];
-  uint8_t flags;
+  Gp index = m.index_reg().as<Gp>();
+  if (offset == 0 && index.is_gp64() && m.shift() == msz && (m.shift_op() == a64::ShiftOp::kLSL || msz == 0u))
+    return a64::ptr(base, index, a64::lsl(msz));
 
-  //! \}
+  Gp addr = uc.new_gpz("@sve_addr");
+  cc->add(addr, base, index, a64::Shift(m.shift_op(), m.shift()));
+  if (offset != 0)
+    uc.add(addr, addr, Imm(offset));
+  return a64::ptr(addr);
+}
 
-  //! \name Accessors
-  //! \{
+static constexpr InstId sve_ld1_inst_id[4] = { Inst::kIdLd1b_z, Inst::kIdLd1h_z, Inst::kIdLd1w_z, Inst::kIdLd1d_z };
+static constexpr InstId sve_st1_inst_id[4] = { Inst::kIdSt1b_z, Inst::kIdSt1h_z, Inst::kIdSt1w_z, Inst::kIdSt1d_z };
 
-  ASMJIT_INLINE_NODEBUG bool is_defined() const noexcept { return ops[0].data != 0; }
-  ASMJIT_INLINE_NODEBUG Op op(uint32_t index) const noexcept { return ops[index]; }
-  ASMJIT_INLINE_NODEBUG OpTarget op_target(uint32_t index) const noexcept { return OpTarget((flags >> (index * 2)) & 0x3); }
+// Loads elements of `1 << msz` bytes zero extended to elements of `sz` - all elements active by `pg` are loaded.
+static ASMJIT_NOINLINE void sve_load(UniCompiler& uc, const Vec& dst, const Mem& m, ElementSize sz, uint32_t msz, const a64::PReg& pg) {
+  Mem mem = sve_mem(uc, m, msz, msz == uint32_t(sz));
+  uc.cc->emit(sve_ld1_inst_id[msz], sve_typed(dst, sz), pg.z(), mem);
+}
 
-  //! \}
-};
+// Stores elements of `sz` truncated to `1 << msz` bytes - all elements active by `pg` are stored.
+static ASMJIT_NOINLINE void sve_store(UniCompiler& uc, const Mem& m, const Vec& src, ElementSize sz, uint32_t msz, const a64::PReg& pg) {
+  Mem mem = sve_mem(uc, m, msz, msz == uint32_t(sz));
+  uc.cc->emit(sve_st1_inst_id[msz], sve_typed(src, sz), a64::PReg(pg.id()), mem);
+}
 
-// This table provides all combinations for all possible 32-bit swizzles (there is 256 combinations in total).
-// It prioritizes lane moves, and then operations that can have either one or two inputs. Each operation has
-// a target, which specifies whether it replaces the destination or one or both sources that are then passed
-// to a next operation. The last operation must always be `OpTarget::kDst` so the result ends up in the right
-// register.
-//
-// In general the decomposition of operations needed for all swizzles is as follows:
-//
-//   - 1 Op Swizzles: 17
-//   - 2 Op Swizzles: 156
-//   - 3 Op Swizzles: 83
-//
-// Which means that luckily most used swizzles would fall into 1 or 2 operations.
+static ASMJIT_NOINLINE Vec sve_as_vec(UniCompiler& uc, const Operand_& op, const Vec& ref) {
+  if (op.is_vec())
+    return op.as<Vec>().clone_as(ref);
+
+  Vec tmp = uc.new_similar_reg(ref, "@tmp");
+  sve_load(uc, tmp, op.as<Mem>(), ElementSize::k8, 0u, uc.sve_ptrue());
+  return tmp.clone_as(ref);
+}
+
+// Returns a predicate that has the first `mem_size` bytes active, or the all-true predicate if `mem_size` is zero or
+// the vector length.
+static ASMJIT_NOINLINE a64::PReg sve_mem_size_pred(UniCompiler& uc, uint32_t mem_size, ElementSize sz) {
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+  if (mem_size == 0u || mem_size == vec_size)
+    return uc.sve_ptrue();
+
+  // Element counts 1 to 8 are encoded directly as VL1 to VL8 patterns, powers of 2 from 16 to 256 as VL16 to VL256.
+  uint32_t element_count = mem_size >> uint32_t(sz);
+  uint32_t pattern = element_count;
+
+  if (element_count > 8u) {
+    ASMJIT_ASSERT(Support::is_power_of_2(element_count) && element_count <= 256u);
+    pattern = Support::ctz(element_count) + 5u;
+  }
+
+  ASMJIT_ASSERT(element_count >= 1u && mem_size < vec_size);
+  uc.cc->ptrue(sve_tmp_pred(sz), Imm(pattern));
+  return a64::PReg(kSvePTmpId);
+}
+
+// Returns the address of a stack area of 4 vectors, which is used to access Z registers by 128-bit lanes.
+static ASMJIT_NOINLINE Gp sve_lanes_area(UniCompiler& uc) {
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+
+  Gp base = uc.new_gpz("@sve_lanes");
+  uc.cc->load_address_of(base, uc.tmp_stack(UniCompiler::StackId::kSveLanes, vec_size * 4u));
+  return base;
+}
+
+// Permutes bytes of `src` by TBL having `indexes` in the constant pool, indexes out of range select zero.
+static ASMJIT_NOINLINE void sve_emit_tbl_const(UniCompiler& uc, const Vec& dst, const Vec& src, const uint8_t* indexes) {
+  BackendCompiler* cc = uc.cc;
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+
+  Mem m = cc->new_const(ConstPoolScope::kLocal, indexes, vec_size);
+  Gp addr = uc.new_gpz("@tbl_addr");
+  Vec index = uc.new_similar_reg(dst.z(), "@tbl_index");
+
+  cc->adr(addr, Label(m.base_id()));
+  if (m.offset_lo32() != 0)
+    uc.add(addr, addr, Imm(m.offset_lo32()));
+
+  cc->ld1b(index.b(), uc.sve_ptrue().z(), a64::ptr(addr));
+  cc->tbl(dst.z().b(), src.z().b(), index.b());
+}
+
+// Replaces element `idx` of `dst` by the same element of `value`.
+static ASMJIT_NOINLINE void sve_select_element(UniCompiler& uc, const Vec& dst, const Vec& value, ElementSize sz, uint32_t idx) {
+  BackendCompiler* cc = uc.cc;
+
+  Vec lanes = uc.new_similar_reg(dst.z(), "@lanes");
+  Vec lane_idx = uc.new_similar_reg(dst.z(), "@lane_idx");
+
+  cc->index(sve_typed(lanes, sz), Imm(0), Imm(1));
+  cc->dup(sve_typed(lane_idx, sz), Imm(idx));
+  cc->cmpeq(sve_tmp_pred(sz), uc.sve_ptrue().z(), sve_typed(lanes, sz), sve_typed(lane_idx, sz));
+  cc->sel(sve_typed(dst, sz), a64::PReg(kSvePTmpId), sve_typed(value, sz), sve_typed(dst, sz));
+}
+
+// SVE Lane Emulation
+// ------------------
 //
-// NOTE: Moves (InsXToY) operations only happen on the destination as they are destructive, which is perfectly
-// okay as moving them into earlier steps didn't really improve anything.
-#define OP(swiz, op0, target0, op1, target1, op2, target2) { \
-  {                                                            \
-    {Swizzle32Data::Op::k##op0},                               \
-    {Swizzle32Data::Op::k##op1},                               \
-    {Swizzle32Data::Op::k##op2}                                \
-  },                                                           \
-  (                                                            \
-    (uint16_t(Swizzle32Data::OpTarget::k##target0) << 0) |     \
-    (uint16_t(Swizzle32Data::OpTarget::k##target1) << 2) |     \
-    (uint16_t(Swizzle32Data::OpTarget::k##target2) << 4)       \
-  )                                                            \
+// Operations that have no SVE instruction are emulated by their ASIMD lowering. Sources are stored to a stack area,
+// each 128-bit lane is loaded to a V register and processed by the ASIMD lowering, and the results are stored back
+// and loaded to the destination Z register. This works for all operations that operate on 128-bit lanes, widening
+// and narrowing operations only need a different mapping of lanes.
+
+// Kind of an emulated operation, which also defines the number of its vector sources.
+enum class SveLaneOpKind : uint32_t {
+  k2V,
+  k2VI,
+  k3V,
+  k3VI,
+  k4V
+};
+
+// Describes offsets of 128-bit lanes of sources and results in the stack area.
+struct SveLaneMap {
+  // Offset of the first source lane and the distance between source lanes.
+  uint32_t src_offset;
+  uint32_t src_stride;
+  // Offset of the first result and the distance between results - results of narrowing operations are 8 bytes.
+  uint32_t dst_offset;
+  uint32_t dst_stride;
+  // Narrowed results are in the high 64 bits of the ASIMD destination.
+  bool dst_hi;
+  // The destination is also a source (accumulating operations).
+  bool accumulate;
+};
+
+// Widening operations convert consecutive chunks of the low or the high half of the source - high ASIMD forms read
+// the high 64 bits of the register, so the lane is loaded 8 bytes before the chunk. Narrowing operations produce
+// 64 bits per lane stored to the low or the high half of the destination, which is otherwise zero.
+static SveLaneMap sve_lane_map(UniCompiler& uc, const UniOpVInfo& op_info, bool accumulate) noexcept {
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+  SveLaneMap map { 0u, 16u, 0u, 16u, false, accumulate };
+
+  if (op_info.dst_part == VecPart::kNA && op_info.src_part == VecPart::kNA)
+    return map;
+
+  bool hi = op_info.dst_part == VecPart::kHi || op_info.src_part == VecPart::kHi;
+  if (op_info.dst_element > op_info.src_element) {
+    map.src_stride = 16u >> (uint32_t(op_info.dst_element) - uint32_t(op_info.src_element));
+    map.src_offset = hi ? vec_size / 2u - 8u : 0u;
+  }
+  else {
+    map.dst_stride = 8u;
+    map.dst_offset = hi ? vec_size / 2u : 0u;
+    map.dst_hi = hi;
+  }
+
+  return map;
 }
 
-static constexpr Swizzle32Data swizzle_32_data[256] = {
-  OP(0000, Dup0   , _, _      , _, _      , _), OP(0001, Rev64  , _, Ins1To2, _, Ins1To3, _), OP(0002, Ext8   , _, Ins2To1, _, Ins2To3, _), OP(0003, Dup0   , 2, Ext12  , _, _      , _),
-  OP(0010, Zip1_2D, _, Ins0To3, _, _      , _), OP(0011, Rev64  , A, Zip1_4S, _, _      , _), OP(0012, Ext8   , _, Ins3To1, _, Ins2To3, _), OP(0013, Rev64  , 2, Ext12  , _, Ins2To3, _),
-  OP(0020, Uzp1_4S, _, Ins0To3, _, _      , _), OP(0021, Ext4   , _, Ins3To2, _, _      , _), OP(0022, Ext4   , A, Trn2_4S, _, _      , _), OP(0023, Ext4   , _, Ins2To0, _, Ins3To2, _),
-  OP(0030, Ext8   , _, Ins2To0, _, Ins2To3, _), OP(0031, Dup0   , 2, Uzp2_4S, _, _      , _), OP(0032, Ext8   , _, Ins2To3, _, _      , _), OP(0033, Ext4   , A, Zip2_4S, _, _      , _),
-  OP(0100, Zip1_4S, _, Ins0To3, _, _      , _), OP(0101, Rev64  , A, Zip1_2D, _, _      , _), OP(0102, Ext12  , _, Ins3To0, _, Ins1To3, _), OP(0103, Ext12  , _, Ins1To3, _, _      , _),
-  OP(0110, Rev64  , 2, Zip1_4S, _, _      , _), OP(0111, Dup1   , 1, Ext4   , _, _      , _), OP(0112, Rev64  , 2, Ext8   , _, Ins2To1, _), OP(0113, Ext12  , _, Ins1To3, _, Ins2To1, _),
-  OP(0120, Ext4   , _, Ins0To2, _, Ins3To0, _), OP(0121, Ext4   , _, Ins0To2, _, _      , _), OP(0122, Ext4   , _, Ins0To2, _, Ins1To0, _), OP(0123, Rev64  , A, Ext8   , _, _      , _),
-  OP(0130, Ext12  , 2, Zip1_4S, _, _      , _), OP(0131, Ext4   , _, Ins2To1, _, Ins0To2, _), OP(0132, Rev64  , 2, Ext8   , _, _      , _), OP(0133, Ext12  , _, Ins1To3, _, Ins0To1, _),
-  OP(0200, Trn1_4S, _, Ins0To3, _, _      , _), OP(0201, Rev64  , _, Ins3To2, _, Ins1To3, _), OP(0202, Ext4   , A, Uzp2_4S, _, _      , _), OP(0203, Uzp1_4S, 2, Ext12  , _, _      , _),
-  OP(0210, Mov    , _, Ins0To3, _, _      , _), OP(0211, Mov    , _, Ins0To3, _, Ins1To0, _), OP(0212, Mov    , _, Ins0To3, _, Ins2To0, _), OP(0213, Rev64  , A, Ext8   , 1, Zip1_4S, _),
-  OP(0220, Ext8   , 2, Uzp1_4S, _, _      , _), OP(0221, Ext4   , _, Ins1To2, _, _      , _), OP(0222, Dup2   , 1, Ext4   , _, _      , _), OP(0223, Ext4   , _, Ins2To0, _, Ins1To2, _),
-  OP(0230, Rev64  , 1, Ext4   , _, _      , _), OP(0231, Ext4   , 2, Uzp2_4S, _, _      , _), OP(0232, Ext8   , _, Ins2To3, _, Ins0To2, _), OP(0233, Rev64  , 1, Ext4   , _, Ins1To0, _),
-  OP(0300, Rev64  , _, Ins1To0, _, Ins1To3, _), OP(0301, Rev64  , _, Ins1To3, _, _      , _), OP(0302, Dup0   , 2, Zip2_4S, _, _      , _), OP(0303, Ext4   , A, Zip2_2D, _, _      , _),
-  OP(0310, Ext12  , 2, Zip1_2D, _, _      , _), OP(0311, Ext4   , _, Ins0To1, _, _      , _), OP(0312, Dup0   , 2, Zip1_4S, 2, Zip2_4S, _), OP(0313, Uzp2_4S, 1, Ext4   , _, _      , _),
-  OP(0320, Ext4   , _, Ins3To0, _, _      , _), OP(0321, Ext4   , _, _      , _, _      , _), OP(0322, Ext4   , _, Ins1To0, _, _      , _), OP(0323, Ext4   , _, Ins2To0, _, _      , _),
-  OP(0330, Ext4   , _, Ins2To1, _, Ins3To0, _), OP(0331, Ext4   , _, Ins2To1, _, _      , _), OP(0332, Ext4   , 2, Zip2_4S, _, _      , _), OP(0333, Dup3   , 1, Ext4   , _, _      , _),
-  OP(1000, Zip1_4S, _, Ins0To2, _, _      , _), OP(1001, Rev64  , 1, Zip1_4S, _, _      , _), OP(1002, Ext8   , _, Ins2To1, _, _      , _), OP(1003, Ext4   , 1, Ext8   , _, _      , _),
-  OP(1010, Zip1_2D, _, _      , _, _      , _), OP(1011, Zip1_2D, _, Ins1To0, _, _      , _), OP(1012, Ext8   , _, Ins3To1, _, _      , _), OP(1013, Ext8   , _, Ins1To0, _, Ins3To1, _),
-  OP(1020, Zip1_4S, 2, Uzp1_4S, _, _      , _), OP(1021, Ext4   , 1, Zip1_2D, _, _      , _), OP(1022, Ext8   , _, Ins0To1, _, _      , _), OP(1023, Rev64  , 1, Ext8   , _, _      , _),
-  OP(1030, Ext8   , _, Ins2To0, _, _      , _), OP(1031, Ext8   , _, Ins3To0, _, _      , _), OP(1032, Ext8   , _, _      , _, _      , _), OP(1033, Ext8   , _, Ins1To0, _, _      , _),
-  OP(1100, Zip1_4S, _, _      , _, _      , _), OP(1101, Zip1_4S, _, Ins2To0, _, _      , _), OP(1102, Ext8   , _, Ins2To1, _, Ins3To2, _), OP(1103, Ext12  , _, Ins2To3, _, _      , _),
-  OP(1110, Zip1_4S, _, Ins2To1, _, _      , _), OP(1111, Dup1   , _, _      , _, _      , _), OP(1112, Ext8   , _, Ins3To1, _, Ins3To2, _), OP(1113, Dup1   , 2, Ext12  , _, _      , _),
-  OP(1120, Dup1   , 2, Uzp1_4S, _, _      , _), OP(1121, Ext4   , _, Ins0To2, _, Ins0To3, _), OP(1122, Ext8   , _, Ins0To1, _, Ins3To2, _), OP(1123, Ext12  , _, Ins3To1, _, Ins2To3, _),
-  OP(1130, Ext8   , _, Ins2To0, _, Ins3To2, _), OP(1131, Uzp2_4S, _, Ins0To3, _, _      , _), OP(1132, Ext8   , _, Ins3To2, _, _      , _), OP(1133, Ext8   , A, Trn2_4S, _, _      , _),
-  OP(1200, Zip1_4S, 2, Trn1_4S, _, _      , _), OP(1201, Ext4   , 1, Zip1_4S, _, _      , _), OP(1202, Dup2   , 1, Zip1_4S, _, _      , _), OP(1203, Dup1   , 2, Uzp1_4S, 2, Ext12  , _),
-  OP(1210, Mov    , _, Ins1To3, _, _      , _), OP(1211, Mov    , _, Ins1To0, _, Ins1To3, _), OP(1212, Mov    , _, Ins1To3, _, Ins2To0, _), OP(1213, Mov    , _, Ins3To0, _, Ins1To3, _),
-  OP(1220, Mov    , _, Ins1To3, _, Ins2To1, _), OP(1221, Ext4   , _, Ins0To3, _, Ins1To2, _), OP(1222, Ext8   , _, Ins0To1, _, Ins0To2, _), OP(1223, Rev64  , 1, Ext8   , _, Ins1To2, _),
-  OP(1230, Rev64  , A, Ext4   , _, _      , _), OP(1231, Ext8   , _, Ins0To2, _, Ins3To0, _), OP(1232, Ext8   , _, Ins0To2, _, _      , _), OP(1233, Ext8   , _, Ins0To2, _, Ins1To0, _),
-  OP(1300, Rev64  , _, Ins0To3, _, Ins1To0, _), OP(1301, Rev64  , _, Ins0To3, _, _      , _), OP(1302, Ext8   , 1, Zip1_4S, _, _      , _), OP(1303, Dup3   , 1, Zip1_4S, _, _      , _),
-  OP(1310, Mov    , _, Ins3To2, _, Ins1To3, _), OP(1311, Trn2_4S, _, Ins0To3, _, _      , _), OP(1312, Dup1   , 2, Zip2_4S, _, _      , _), OP(1313, Ext8   , A, Uzp2_4S, _, _      , _),
-  OP(1320, Ext12  , 2, Uzp1_4S, _, _      , _), OP(1321, Ext4   , _, Ins0To3, _, _      , _), OP(1322, Ext4   , _, Ins0To3, _, Ins1To0, _), OP(1323, Ext4   , _, Ins0To3, _, Ins2To0, _),
+static void sve_emit_lane_op(UniCompiler& uc, SveLaneOpKind kind, uint32_t op, uint32_t imm, const Vec& dst, const Vec* src) {
+  switch (kind) {
+    case SveLaneOpKind::k2V : uc.emit_2v(UniOpVV(op), dst, src[0]); break;
+    case SveLaneOpKind::k2VI: uc.emit_2vi(UniOpVVI(op), dst, src[0], imm); break;
+    case SveLaneOpKind::k3V : uc.emit_3v(UniOpVVV(op), dst, src[0], src[1]); break;
+    case SveLaneOpKind::k3VI: uc.emit_3vi(UniOpVVVI(op), dst, src[0], src[1], imm); break;
+    case SveLaneOpKind::k4V : uc.emit_4v(UniOpVVVV(op), dst, src[0], src[1], src[2]); break;
+  }
+}
+
+static ASMJIT_NOINLINE void sve_emulate_by_lanes(UniCompiler& uc, SveLaneOpKind kind, uint32_t op, uint32_t imm, const SveLaneMap& map, const Vec& dst, const Operand_* srcs) {
+  BackendCompiler* cc = uc.cc;
+
+  uint32_t src_count = kind <= SveLaneOpKind::k2VI ? 1u : kind <= SveLaneOpKind::k3VI ? 2u : 3u;
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+  uint32_t dst_area = src_count * vec_size;
+
+  Gp base = sve_lanes_area(uc);
+  Vec lane_src[3];
+  Vec lane_dst = uc.new_vec128("@lane_dst");
+
+  // LDR and STR of Z registers use offsets in multiples of the vector length.
+  for (uint32_t i = 0; i < src_count; i++) {
+    cc->str(sve_as_vec(uc, srcs[i], dst).z(), a64::ptr(base, int32_t(i)));
+    lane_src[i] = uc.new_vec128("@lane_src");
+  }
+
+  if (map.dst_stride != 16u) {
+    Vec zero = uc.new_similar_reg(dst, "@zero");
+    cc->dup(zero.b(), Imm(0));
+    cc->str(zero, a64::ptr(base, int32_t(src_count)));
+  }
+  else if (map.accumulate) {
+    cc->str(dst.z(), a64::ptr(base, int32_t(src_count)));
+  }
+
+  for (uint32_t lane = 0; lane < vec_size / 16u; lane++) {
+    for (uint32_t i = 0; i < src_count; i++) {
+      cc->ldr(lane_src[i].q(), a64::ptr(base, int32_t(i * vec_size + map.src_offset + lane * map.src_stride)));
+    }
+
+    if (map.accumulate) {
+      cc->ldr(lane_dst.q(), a64::ptr(base, int32_t(dst_area + lane * 16u)));
+    }
+
+    sve_emit_lane_op(uc, kind, op, imm, lane_dst, lane_src);
+
+    int32_t dst_offset = int32_t(dst_area + map.dst_offset + lane * map.dst_stride);
+    if (map.dst_stride == 16u) {
+      cc->str(lane_dst.q(), a64::ptr(base, dst_offset));
+    }
+    else {
+      if (map.dst_hi)
+        cc->ext(lane_dst.b16(), lane_dst.b16(), lane_dst.b16(), Imm(8));
+      cc->str(lane_dst.d(), a64::ptr(base, dst_offset));
+    }
+  }
+
+  cc->ldr(dst.z(), a64::ptr(base, int32_t(src_count)));
+}
+
+// Emits a predicated destructive instruction `dst = src1 <op> src2`.
+static ASMJIT_NOINLINE void sve_emit_destructive(UniCompiler& uc, InstId inst_id, ElementSize sz, const Vec& dst_, const Vec& src1_, const Vec& src2_, bool commutative) {
+  BackendCompiler* cc = uc.cc;
+
+  Vec dst = sve_typed(dst_, sz);
+  Vec src1 = sve_typed(src1_, sz);
+  Vec src2 = sve_typed(src2_, sz);
+
+  if (dst.id() == src2.id() && dst.id() != src1.id()) {
+    if (commutative) {
+      std::swap(src1, src2);
+    }
+    else {
+      Vec tmp = sve_typed(uc.new_similar_reg(dst_, "@tmp"), sz);
+      sve_mov(uc, tmp, src1);
+      cc->emit(inst_id, tmp, uc.sve_ptrue().m(), tmp, src2);
+      sve_mov(uc, dst, tmp);
+      return;
+    }
+  }
+
+  sve_mov(uc, dst, src1);
+  cc->emit(inst_id, dst, uc.sve_ptrue().m(), dst, src2);
+}
+
+// Emits a comparison to the temporary predicate and expands it to a vector mask.
+static ASMJIT_NOINLINE void sve_emit_cmp(UniCompiler& uc, InstId inst_id, ElementSize sz, const Vec& dst, const Vec& src1, const Vec& src2) {
+  BackendCompiler* cc = uc.cc;
+
+  cc->emit(inst_id, sve_tmp_pred(sz), uc.sve_ptrue().z(), sve_typed(src1, sz), sve_typed(src2, sz));
+  cc->cpy(sve_typed(dst, sz), a64::PReg(kSvePTmpId).z(), Imm(-1));
+}
+
+// Returns the predicated SVE instruction that performs the same element-wise operation as the given ASIMD
+// instruction, or `Inst::kIdNone` if there is no such instruction.
+static InstId sve_predicated_inst_id(InstId inst_id) noexcept {
+  switch (inst_id) {
+    case Inst::kIdAbs_v   : return Inst::kIdAbs_z;
+    case Inst::kIdMvn_v   : return Inst::kIdNot_z;
+    case Inst::kIdFabs_v  : return Inst::kIdFabs_z;
+    case Inst::kIdFneg_v  : return Inst::kIdFneg_z;
+    case Inst::kIdFrintz_v: return Inst::kIdFrintz_z;
+    case Inst::kIdFrintm_v: return Inst::kIdFrintm_z;
+    case Inst::kIdFrintp_v: return Inst::kIdFrintp_z;
+    case Inst::kIdFrintn_v: return Inst::kIdFrintn_z;
+    case Inst::kIdFsqrt_v : return Inst::kIdFsqrt_z;
+    case Inst::kIdScvtf_v : return Inst::kIdScvtf_z;
+    case Inst::kIdFcvtzs_v: return Inst::kIdFcvtzs_z;
+    case Inst::kIdMul_v   : return Inst::kIdMul_z;
+    case Inst::kIdSmin_v  : return Inst::kIdSmin_z;
+    case Inst::kIdUmin_v  : return Inst::kIdUmin_z;
+    case Inst::kIdSmax_v  : return Inst::kIdSmax_z;
+    case Inst::kIdUmax_v  : return Inst::kIdUmax_z;
+    case Inst::kIdFdiv_v  : return Inst::kIdFdiv_z;
+    case Inst::kIdFminnm_v: return Inst::kIdFminnm_z;
+    case Inst::kIdFmaxnm_v: return Inst::kIdFmaxnm_z;
+    case Inst::kIdCmeq_v  : return Inst::kIdCmpeq_z;
+    case Inst::kIdCmgt_v  : return Inst::kIdCmpgt_z;
+    case Inst::kIdCmhi_v  : return Inst::kIdCmphi_z;
+    case Inst::kIdCmge_v  : return Inst::kIdCmpge_z;
+    case Inst::kIdCmhs_v  : return Inst::kIdCmphs_z;
+    case Inst::kIdFcmeq_v : return Inst::kIdFcmeq_z;
+    case Inst::kIdFcmgt_v : return Inst::kIdFcmgt_z;
+    case Inst::kIdFcmge_v : return Inst::kIdFcmge_z;
+    case Inst::kIdCnt_v   : return Inst::kIdCnt_z;
+    case Inst::kIdClz_v   : return Inst::kIdClz_z;
+
+    default:
+      return Inst::kIdNone;
+  }
+}
+
+static ASMJIT_INLINE bool sve_is_scalar_float_mode(FloatMode fm) noexcept {
+  return fm == FloatMode::kF32S || fm == FloatMode::kF64S;
+}
+
+static ASMJIT_NOINLINE void sve_emit_2v(UniCompiler& uc, UniOpVV op, const Vec& dst_, const Operand_& src_) {
+  BackendCompiler* cc = uc.cc;
+  UniOpVInfo op_info = opcode_info_2v[size_t(op)];
+
+  if (sve_is_scalar_float_mode(op_info.float_mode) || op == UniOpVV::kMovU64) {
+    uc.emit_2v(op, dst_.v128(), sve_v128_op(src_));
+    return;
+  }
+
+  Vec dst = dst_.z();
+
+  switch (op) {
+    case UniOpVV::kMov: {
+      if (src_.is_vec())
+        sve_mov(uc, dst, src_.as<Vec>());
+      else
+        sve_load(uc, dst, src_.as<Mem>(), ElementSize::k8, 0u, uc.sve_ptrue());
+      return;
+    }
+
+    case UniOpVV::kBroadcastU8Z:
+    case UniOpVV::kBroadcastU16Z:
+    case UniOpVV::kBroadcastU8:
+    case UniOpVV::kBroadcastU16:
+    case UniOpVV::kBroadcastU32:
+    case UniOpVV::kBroadcastF32:
+    case UniOpVV::kBroadcastU64:
+    case UniOpVV::kBroadcastF64: {
+      ElementSize element_size = ElementSize(op_info.dst_element);
+      Operand src(src_);
+
+      if (src.is_mem()) {
+        Vec tmp = uc.new_vec128("@tmp");
+        vec_load_mem(uc, tmp, src.as<Mem>(), 1u << uint32_t(op_info.src_element));
+        src = tmp;
+      }
+
+      if (src.is_gp()) {
+        Gp src_gp = src.as<Gp>();
+        cc->dup(sve_typed(dst, element_size), element_size <= ElementSize::k32 ? src_gp.r32() : src_gp.r64());
+      }
+      else {
+        cc->dup(sve_typed(dst, element_size), sve_typed(src.as<Vec>(), element_size).at(0));
+      }
+      return;
+    }
+
+    case UniOpVV::kBroadcastV128_U32:
+    case UniOpVV::kBroadcastV128_U64:
+    case UniOpVV::kBroadcastV128_F32:
+    case UniOpVV::kBroadcastV128_F64: {
+      Vec src = src_.is_vec() ? src_.as<Vec>() : Vec();
+      if (src_.is_mem()) {
+        src = uc.new_vec128("@tmp");
+        vec_load_mem(uc, src, src_.as<Mem>(), 16);
+      }
+
+      cc->dup(dst, src.z().at(0));
+      return;
+    }
+
+    case UniOpVV::kBroadcastV256_U32:
+    case UniOpVV::kBroadcastV256_U64:
+    case UniOpVV::kBroadcastV256_F32:
+    case UniOpVV::kBroadcastV256_F64: {
+      // Only a move when the vector is 256 bits long, wider vectors repeat the low 256 bits by TBL.
+      Vec src = src_.is_vec() ? src_.as<Vec>().z() : Vec();
+      if (src_.is_mem()) {
+        src = uc.new_similar_reg(dst, "@tmp");
+        sve_load(uc, src, src_.as<Mem>(), ElementSize::k8, 0u, sve_mem_size_pred(uc, 32u, ElementSize::k8));
+      }
+
+      if (uc.vec_width() == VecWidth::k256) {
+        sve_mov(uc, dst, src);
+        return;
+      }
+
+      uint8_t indexes[64];
+      for (uint32_t i = 0; i < 64u; i++) {
+        indexes[i] = uint8_t(i & 31u);
+      }
+
+      sve_emit_tbl_const(uc, dst, src, indexes);
+      return;
+    }
+
+    case UniOpVV::kPopcntU16:
+    case UniOpVV::kPopcntU32:
+    case UniOpVV::kPopcntU64:
+    case UniOpVV::kLzcntU64: {
+      Vec src = sve_as_vec(uc, src_, dst);
+      ElementSize element_size = ElementSize(op_info.dst_element);
+
+      cc->emit(sve_predicated_inst_id(op_info.inst_id), sve_typed(dst, element_size), uc.sve_ptrue().m(), sve_typed(src, element_size));
+      return;
+    }
+
+    case UniOpVV::kTzcntU32:
+    case UniOpVV::kTzcntU64: {
+      // There is no RBIT in SVE, so count bits of `(x - 1) & ~x`, which is a mask of trailing zeros.
+      Vec src = sve_as_vec(uc, src_, dst);
+      Vec tmp = uc.new_similar_reg(dst, "@tmp");
+      ElementSize element_size = ElementSize(op_info.dst_element);
+
+      cc->cpy(sve_typed(tmp, element_size), uc.sve_ptrue().z(), Imm(-1));
+      sve_emit_destructive(uc, Inst::kIdAdd_z, element_size, tmp, tmp, src, true);
+      sve_emit_destructive(uc, Inst::kIdBic_z, element_size, tmp, tmp, src, false);
+      cc->cnt(sve_typed(dst, element_size), uc.sve_ptrue().m(), sve_typed(tmp, element_size));
+      return;
+    }
+
+    case UniOpVV::kCvtRoundF32ToI32: {
+      Vec src = sve_as_vec(uc, src_, dst).s();
+      cc->frintn(dst.s(), uc.sve_ptrue().m(), src);
+      cc->fcvtzs(dst.s(), uc.sve_ptrue().m(), dst.s());
+      return;
+    }
+
+    default: {
+      InstId inst_id = sve_predicated_inst_id(op_info.inst_id);
+
+      if (inst_id == Inst::kIdNone || op_info.asimd_ext == ASIMDExt::kIntrin || op_info.dst_part != VecPart::kNA || op_info.src_part != VecPart::kNA) {
+        sve_emulate_by_lanes(uc, SveLaneOpKind::k2V, uint32_t(op), 0u, sve_lane_map(uc, op_info, false), dst, &src_);
+        return;
+      }
+
+      Vec src = sve_as_vec(uc, src_, dst);
+      ElementSize element_size = ElementSize(op_info.dst_element);
+
+      cc->emit(inst_id, sve_typed(dst, element_size), uc.sve_ptrue().m(), sve_typed(src, element_size));
+      return;
+    }
+  }
+}
+
+static ASMJIT_NOINLINE void sve_emit_2vi(UniCompiler& uc, UniOpVVI op, const Vec& dst_, const Operand_& src_, uint32_t imm) {
+  BackendCompiler* cc = uc.cc;
+  UniOpVInfo op_info = opcode_info_2vi[size_t(op)];
+
+  Vec dst = dst_.z();
+  ElementSize element_size = ElementSize(op_info.dst_element);
+  uint32_t bit_count = 8u << uint32_t(element_size);
+
+  switch (op) {
+    case UniOpVVI::kSllU16:
+    case UniOpVVI::kSllU32:
+    case UniOpVVI::kSllU64:
+    case UniOpVVI::kSrlU16:
+    case UniOpVVI::kSrlU32:
+    case UniOpVVI::kSrlU64:
+    case UniOpVVI::kSraI16:
+    case UniOpVVI::kSraI32:
+    case UniOpVVI::kSraI64: {
+      Vec src = sve_as_vec(uc, src_, dst);
+
+      if (imm == 0u) {
+        sve_mov(uc, dst, src);
+        return;
+      }
+
+      InstId inst_id = op <= UniOpVVI::kSllU64 ? Inst::kIdLsl_z :
+                       op <= UniOpVVI::kSrlU64 ? Inst::kIdLsr_z : Inst::kIdAsr_z;
+
+      // LSL immediate is limited to `bit_count - 1` and LSR/ASR immediates to `bit_count`.
+      if (imm >= bit_count) {
+        if (inst_id == Inst::kIdLsl_z) {
+          cc->dup(dst.b(), Imm(0));
+          return;
+        }
+        imm = bit_count;
+      }
+
+      cc->emit(inst_id, sve_typed(dst, element_size), sve_typed(src, element_size), Imm(imm));
+      return;
+    }
+
+    case UniOpVVI::kSwizzleU64x4:
+    case UniOpVVI::kSwizzleF64x4: {
+      // Each 256-bit lane is permuted the same way, element `j` of the lane selects `(imm >> (j * 8)) & 3`.
+      uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+      Vec src = sve_as_vec(uc, src_, dst);
+
+      uint8_t indexes[64];
+      for (uint32_t i = 0; i < vec_size; i++) {
+        uint32_t element = (imm >> (((i >> 3) & 0x3u) * 8u)) & 0x3u;
+        indexes[i] = uint8_t((i & ~31u) + element * 8u + (i & 7u));
+      }
+
+      sve_emit_tbl_const(uc, dst, src, indexes);
+      return;
+    }
+
+    case UniOpVVI::kExtractV128_I32:
+    case UniOpVVI::kExtractV128_I64:
+    case UniOpVVI::kExtractV128_F32:
+    case UniOpVVI::kExtractV128_F64:
+    case UniOpVVI::kExtractV256_I32:
+    case UniOpVVI::kExtractV256_I64:
+    case UniOpVVI::kExtractV256_F32:
+    case UniOpVVI::kExtractV256_F64: {
+      uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+      uint32_t lane_size = op >= UniOpVVI::kExtractV256_I32 ? 32u : 16u;
+      ASMJIT_ASSERT((imm + 1u) * lane_size <= vec_size);
+
+      if (imm == 0u && src_.is_vec() && lane_size == 16u) {
+        cc->mov(dst_.v128().b16(), src_.as<Vec>().v128().b16());
+        return;
+      }
+
+      Mem m;
+      if (src_.is_mem()) {
+        m = src_.as<Mem>();
+        m.add_offset(int32_t(imm * lane_size));
+      }
+      else {
+        Gp base = sve_lanes_area(uc);
+        cc->str(src_.as<Vec>().z(), a64::ptr(base));
+        m = a64::ptr(base, int32_t(imm * lane_size));
+      }
+
+      if (lane_size == 16u)
+        uc.v_loadu128(dst_.v128(), m);
+      else
+        sve_load(uc, dst, m, ElementSize::k8, 0u, sve_mem_size_pred(uc, lane_size, ElementSize::k8));
+      return;
+    }
+
+    default: {
+      bool accumulate = op >= UniOpVVI::kSrlAccU16 && op <= UniOpVVI::kSrlRndAccU64;
+      sve_emulate_by_lanes(uc, SveLaneOpKind::k2VI, uint32_t(op), imm, sve_lane_map(uc, op_info, accumulate), dst, &src_);
+      return;
+    }
+  }
+}
+
+// Compress and expand use an exclusive prefix sum of selected elements, which is the position of each selected element
+// in the compressed vector. Compress scatters the selected elements to these positions in a zeroed stack area and
+// expand permutes the source by them (unselected elements use an out of range index, which selects zero).
+static ASMJIT_NOINLINE void sve_emit_compress_expand(UniCompiler& uc, bool is_expand, ElementSize sz, const Vec& dst, const Vec& src, const Vec& mask) {
+  BackendCompiler* cc = uc.cc;
+
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+  uint32_t element_count = vec_size >> uint32_t(sz);
+
+  Vec zero = uc.new_similar_reg(dst, "@zero");
+  Vec ones = uc.new_similar_reg(dst, "@ones");
+  Vec sum = uc.new_similar_reg(dst, "@sum");
+  Vec idx = uc.new_similar_reg(dst, "@idx");
+  Vec tmp = uc.new_similar_reg(dst, "@tmp");
+
+  cc->dup(zero.b(), Imm(0));
+  cc->cmpne(sve_tmp_pred(sz), uc.sve_ptrue().z(), sve_typed(mask, sz), sve_typed(zero, sz));
+  cc->cpy(sve_typed(ones, sz), a64::PReg(kSvePTmpId).z(), Imm(1));
+  sve_mov(uc, sum, ones);
+
+  // Inclusive prefix sum - negative indexes shift in zeros as they are out of range.
+  for (uint32_t n = 1; n < element_count; n <<= 1) {
+    cc->index(sve_typed(idx, sz), Imm(-int32_t(n)), Imm(1));
+    cc->tbl(sve_typed(tmp, sz), sve_typed(sum, sz), sve_typed(idx, sz));
+    cc->add(sve_typed(sum, sz), sve_typed(sum, sz), sve_typed(tmp, sz));
+  }
+  cc->sub(sve_typed(sum, sz), sve_typed(sum, sz), sve_typed(ones, sz));
+
+  if (is_expand) {
+    cc->dup(tmp.b(), Imm(-1));
+    cc->cpy(sve_typed(tmp, sz), a64::PReg(kSvePTmpId).m(), Imm(0));
+    cc->orr(sum.d(), sum.d(), tmp.d());
+    cc->tbl(sve_typed(dst, sz), sve_typed(src, sz), sve_typed(sum, sz));
+  }
+  else {
+    Gp base = sve_lanes_area(uc);
+    cc->str(zero, a64::ptr(base));
+
+    if (sz == ElementSize::k32)
+      cc->st1w(src.z().s(), a64::PReg(kSvePTmpId), a64::ptr(base, sum.s(), a64::sxtw(2)));
+    else
+      cc->st1d(src.z().d(), a64::PReg(kSvePTmpId), a64::ptr(base, sum.d(), a64::lsl(3)));
+
+    cc->ldr(dst.z(), a64::ptr(base));
+  }
+}
+
+static ASMJIT_NOINLINE void sve_emit_3v(UniCompiler& uc, UniOpVVV op, const Vec& dst_, const Operand_& src1_, const Operand_& src2_) {
+  BackendCompiler* cc = uc.cc;
+  UniOpVInfo op_info = opcode_info_3v[size_t(op)];
+
+  if (sve_is_scalar_float_mode(op_info.float_mode)) {
+    uc.emit_3v(op, dst_.v128(), sve_v128_op(src1_), sve_v128_op(src2_));
+    return;
+  }
+
+  Vec dst = dst_.z();
+  Vec src1 = src1_.as<Vec>().z();
+
+  if (is_same_vec(src1, src2_)) {
+    switch (op_info.same_vec_op) {
+      case SameVecOp::kZero: {
+        cc->dup(dst.b(), Imm(0));
+        return;
+      }
+
+      case SameVecOp::kOnes: {
+        cc->dup(dst.b(), Imm(-1));
+        return;
+      }
+
+      case SameVecOp::kSrc: {
+        sve_mov(uc, dst, src1);
+        return;
+      }
+
+      default:
+        break;
+    }
+  }
+
+  Vec src2 = sve_as_vec(uc, src2_, dst);
+  ElementSize element_size = ElementSize(op_info.dst_element);
+
+  // Operands in the original order as expected by the ASIMD lowering used by lane emulation.
+  Operand_ lane_srcs[2] = { src1, src2 };
+
+  if (op_info.reverse)
+    std::swap(src1, src2);
+
+  switch (op) {
+    case UniOpVVV::kAndU32:
+    case UniOpVVV::kAndU64:
+    case UniOpVVV::kOrU32:
+    case UniOpVVV::kOrU64:
+    case UniOpVVV::kXorU32:
+    case UniOpVVV::kXorU64:
+    case UniOpVVV::kAndnU32:
+    case UniOpVVV::kAndnU64:
+    case UniOpVVV::kBicU32:
+    case UniOpVVV::kBicU64:
+    case UniOpVVV::kAndF32:
+    case UniOpVVV::kAndF64:
+    case UniOpVVV::kOrF32:
+    case UniOpVVV::kOrF64:
+    case UniOpVVV::kXorF32:
+    case UniOpVVV::kXorF64:
+    case UniOpVVV::kAndnF32:
+    case UniOpVVV::kAndnF64:
+    case UniOpVVV::kBicF32:
+    case UniOpVVV::kBicF64: {
+      // Unpredicated bitwise operations only accept D elements.
+      cc->emit(op_info.inst_id, dst.d(), src1.d(), src2.d());
+      return;
+    }
+
+    case UniOpVVV::kAddU8:
+    case UniOpVVV::kAddU16:
+    case UniOpVVV::kAddU32:
+    case UniOpVVV::kAddU64:
+    case UniOpVVV::kSubU8:
+    case UniOpVVV::kSubU16:
+    case UniOpVVV::kSubU32:
+    case UniOpVVV::kSubU64:
+    case UniOpVVV::kAddF32:
+    case UniOpVVV::kAddF64:
+    case UniOpVVV::kSubF32:
+    case UniOpVVV::kSubF64:
+    case UniOpVVV::kMulF32:
+    case UniOpVVV::kMulF64: {
+      cc->emit(op_info.inst_id, sve_typed(dst, element_size), sve_typed(src1, element_size), sve_typed(src2, element_size));
+      return;
+    }
+
+    case UniOpVVV::kMulU64:
+      sve_emit_destructive(uc, Inst::kIdMul_z, ElementSize::k64, dst, src1, src2, true);
+      return;
+
+    case UniOpVVV::kMulhI16:
+    case UniOpVVV::kMulhU16:
+      sve_emit_destructive(uc, op == UniOpVVV::kMulhI16 ? Inst::kIdSmulh_z : Inst::kIdUmulh_z, ElementSize::k16, dst, src1, src2, true);
+      return;
+
+    case UniOpVVV::kMinI64:
+    case UniOpVVV::kMinU64:
+      sve_emit_destructive(uc, op == UniOpVVV::kMinI64 ? Inst::kIdSmin_z : Inst::kIdUmin_z, ElementSize::k64, dst, src1, src2, true);
+      return;
+
+    case UniOpVVV::kMaxI64:
+    case UniOpVVV::kMaxU64:
+      sve_emit_destructive(uc, op == UniOpVVV::kMaxI64 ? Inst::kIdSmax_z : Inst::kIdUmax_z, ElementSize::k64, dst, src1, src2, true);
+      return;
+
+    case UniOpVVV::kCmpNeF32:
+    case UniOpVVV::kCmpNeF64:
+      sve_emit_cmp(uc, Inst::kIdFcmne_z, element_size, dst, src1, src2);
+      return;
+
+    case UniOpVVV::kCompressU32:
+    case UniOpVVV::kCompressU64:
+    case UniOpVVV::kExpandU32:
+    case UniOpVVV::kExpandU64:
+      sve_emit_compress_expand(uc, op >= UniOpVVV::kExpandU32, element_size, dst, src1, src2);
+      return;
+
+    default: {
+      InstId inst_id = sve_predicated_inst_id(op_info.inst_id);
+
+      if (inst_id == Inst::kIdNone || op_info.asimd_ext == ASIMDExt::kIntrin || op_info.dst_part != VecPart::kNA || op_info.src_part != VecPart::kNA) {
+        bool accumulate = op >= UniOpVVV::kMAddwLoI8 && op <= UniOpVVV::kMAddwHiU32;
+        sve_emulate_by_lanes(uc, SveLaneOpKind::k3V, uint32_t(op), 0u, sve_lane_map(uc, op_info, accumulate), dst, lane_srcs);
+        return;
+      }
+
+      if (op_info.comparison)
+        sve_emit_cmp(uc, inst_id, element_size, dst, src1, src2);
+      else
+        sve_emit_destructive(uc, inst_id, element_size, dst, src1, src2, op_info.commutative);
+      return;
+    }
+  }
+}
+
+static ASMJIT_NOINLINE void sve_emit_4v(UniCompiler& uc, UniOpVVVV op, const Vec& dst_, const Operand_& src1_, const Operand_& src2_, const Operand_& src3_) {
+  BackendCompiler* cc = uc.cc;
+  UniOpVInfo op_info = opcode_info_4v[size_t(op)];
+
+  if (sve_is_scalar_float_mode(op_info.float_mode)) {
+    uc.emit_4v(op, dst_.v128(), sve_v128_op(src1_), sve_v128_op(src2_), sve_v128_op(src3_));
+    return;
+  }
+
+  Vec dst = dst_.z();
+  Vec src1 = src1_.as<Vec>().z();
+  Vec src2 = sve_as_vec(uc, src2_, dst);
+  Vec src3 = sve_as_vec(uc, src3_, dst);
+
+  if (op >= UniOpVVVV::kDotI8_I32 && op <= UniOpVVVV::kDotI16_I32) {
+    // SVE dot products are not provided by the assembler.
+    Operand_ lane_srcs[3] = { src1, src2, src3 };
+    sve_emulate_by_lanes(uc, SveLaneOpKind::k4V, uint32_t(op), 0u, sve_lane_map(uc, op_info, false), dst, lane_srcs);
+    return;
+  }
+
+  if (op == UniOpVVVV::kBlendV_U8) {
+    // dst = src1 ^ ((src1 ^ src2) & src3).
+    Vec tmp = uc.new_similar_reg(dst, "@tmp");
+    cc->eor(tmp.d(), src1.d(), src2.d());
+    cc->and_(tmp.d(), tmp.d(), src3.d());
+    cc->eor(dst.d(), src1.d(), tmp.d());
+    return;
+  }
+
+  // The accumulator is the destination of SVE multiply-add instructions, the negated forms implement MSub and NMSub.
+  InstId inst_id = Inst::kIdMla_z;
+  if (op_info.inst_id == Inst::kIdFmla_v)
+    inst_id = op_info.imm ? Inst::kIdFnmls_z : Inst::kIdFmla_z;
+  else if (op_info.inst_id == Inst::kIdFmls_v)
+    inst_id = op_info.imm ? Inst::kIdFnmla_z : Inst::kIdFmls_z;
+
+  ElementSize element_size = ElementSize(op_info.dst_element);
+  Vec acc = dst;
+
+  if (dst.id() == src1.id() || dst.id() == src2.id())
+    acc = uc.new_similar_reg(dst, "@tmp");
+
+  sve_mov(uc, acc, src3);
+  cc->emit(inst_id, sve_typed(acc, element_size), uc.sve_ptrue().m(), sve_typed(src1, element_size), sve_typed(src2, element_size));
+  sve_mov(uc, dst, acc);
+}
+
+static ASMJIT_NOINLINE void sve_emit_3vi(UniCompiler& uc, UniOpVVVI op, const Vec& dst_, const Operand_& src1_, const Operand_& src2_, uint32_t imm) {
+  BackendCompiler* cc = uc.cc;
+  Vec dst = dst_.z();
+
+  if (op >= UniOpVVVI::kInsertV128_U32) {
+    // The first source is stored to the stack, the inserted lane is copied over it, and the result is loaded back.
+    uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+    uint32_t lane_size = op >= UniOpVVVI::kInsertV256_U32 ? 32u : 16u;
+    ASMJIT_ASSERT((imm + 1u) * lane_size <= vec_size);
+
+    Gp base = sve_lanes_area(uc);
+    Mem lane_src = a64::ptr(base, int32_t(vec_size));
+
+    cc->str(src1_.as<Vec>().z(), a64::ptr(base));
+    if (src2_.is_mem()) {
+      lane_src = src2_.as<Mem>();
+    }
+    else if (lane_size == 16u) {
+      cc->str(src2_.as<Vec>().q(), a64::ptr(base, int32_t(imm * lane_size)));
+      cc->ldr(dst, a64::ptr(base));
+      return;
+    }
+    else {
+      cc->str(src2_.as<Vec>().z(), a64::ptr(base, 1));
+    }
+
+    Vec part = uc.new_vec128("@part");
+    for (uint32_t i = 0; i < lane_size; i += 16u) {
+      Mem m(lane_src);
+      m.add_offset(int32_t(i));
+
+      uc.v_loadu128(part, m);
+      cc->str(part.q(), a64::ptr(base, int32_t(imm * lane_size + i)));
+    }
+
+    cc->ldr(dst, a64::ptr(base));
+    return;
+  }
+
+  // Alignr and interleaved shuffles operate on 128-bit lanes.
+  Operand_ lane_srcs[2] = { src1_, src2_ };
+  sve_emulate_by_lanes(uc, SveLaneOpKind::k3VI, uint32_t(op), imm, SveLaneMap{0u, 16u, 0u, 16u, false, false}, dst, lane_srcs);
+}
+
+static ASMJIT_NOINLINE void sve_emit_vm(UniCompiler& uc, UniOpVM op, const Vec& dst_, const Mem& src, uint32_t idx) {
+  UniOpVMInfo op_info = opcode_info_2vm[size_t(op)];
+  Vec dst = dst_.z();
+
+  BackendCompiler* cc = uc.cc;
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+
+  ElementSize element_size = ElementSize::k8;
+  uint32_t msz = 0u;
+
+  // Sign extension and BF16 conversion shift loaded elements left and sign extension shifts them back.
+  bool is_signed = false;
+  bool is_bf16 = false;
+
+  switch (op) {
+    case UniOpVM::kLoadN_U32:
+    case UniOpVM::kLoadN_U64:
+    case UniOpVM::kLoadN_F32:
+    case UniOpVM::kLoadN_F64:
+    case UniOpVM::kLoad256_U32:
+    case UniOpVM::kLoad256_U64:
+    case UniOpVM::kLoad256_F32:
+    case UniOpVM::kLoad256_F64:
+    case UniOpVM::kLoad512_U32:
+    case UniOpVM::kLoad512_U64:
+    case UniOpVM::kLoad512_F32:
+    case UniOpVM::kLoad512_F64: {
+      element_size = ElementSize(op_info.element);
+      sve_load(uc, dst, src, element_size, uint32_t(element_size), sve_mem_size_pred(uc, op_info.mem_size, element_size));
+      return;
+    }
+
+    // Zero extending loads - the memory size must be the size of the destination divided by the extension ratio.
+    case UniOpVM::kLoadCvt128_U8ToU16:
+    case UniOpVM::kLoadCvt256_U8ToU16:
+    case UniOpVM::kLoadCvtN_U8ToU16:
+      element_size = ElementSize::k16;
+      msz = 0u;
+      break;
+
+    case UniOpVM::kLoadCvt128_U8ToU32:
+    case UniOpVM::kLoadCvtN_U8ToU32:
+      element_size = ElementSize::k32;
+      msz = 0u;
+      break;
+
+    case UniOpVM::kLoadCvtN_U8ToU64:
+      element_size = ElementSize::k64;
+      msz = 0u;
+      break;
+
+    case UniOpVM::kLoadCvt128_U16ToU32:
+    case UniOpVM::kLoadCvt256_U16ToU32:
+    case UniOpVM::kLoadCvtN_U16ToU32:
+      element_size = ElementSize::k32;
+      msz = 1u;
+      break;
+
+    case UniOpVM::kLoadCvt128_U32ToU64:
+    case UniOpVM::kLoadCvt256_U32ToU64:
+    case UniOpVM::kLoadCvtN_U32ToU64:
+      element_size = ElementSize::k64;
+      msz = 2u;
+      break;
+
+    // Sign extending loads - SVE LD1SB/LD1SH/LD1SW are not provided by the assembler.
+    case UniOpVM::kLoadCvt128_I8ToI16:
+    case UniOpVM::kLoadCvt256_I8ToI16:
+    case UniOpVM::kLoadCvtN_I8ToI16:
+      element_size = ElementSize::k16;
+      msz = 0u;
+      is_signed = true;
+      break;
+
+    case UniOpVM::kLoadCvt128_I8ToI32:
+    case UniOpVM::kLoadCvtN_I8ToI32:
+      element_size = ElementSize::k32;
+      msz = 0u;
+      is_signed = true;
+      break;
+
+    case UniOpVM::kLoadCvt128_I16ToI32:
+    case UniOpVM::kLoadCvt256_I16ToI32:
+    case UniOpVM::kLoadCvtN_I16ToI32:
+      element_size = ElementSize::k32;
+      msz = 1u;
+      is_signed = true;
+      break;
+
+    case UniOpVM::kLoadCvt128_I32ToI64:
+    case UniOpVM::kLoadCvt256_I32ToI64:
+    case UniOpVM::kLoadCvtN_I32ToI64:
+      element_size = ElementSize::k64;
+      msz = 2u;
+      is_signed = true;
+      break;
+
+    case UniOpVM::kLoadCvtN_BF16ToF32:
+      element_size = ElementSize::k32;
+      msz = 1u;
+      is_bf16 = true;
+      break;
+
+    case UniOpVM::kLoadCvtN_F16ToF32: {
+      // There is no F16 to F32 conversion in the assembler, the loaded half of the vector is converted by lanes.
+      Vec tmp = uc.new_similar_reg(dst, "@tmp");
+      sve_load(uc, tmp, src, ElementSize::k8, 0u, sve_mem_size_pred(uc, vec_size / 2u, ElementSize::k8));
+      uc.emit_2v(UniOpVV::kCvtF16LoToF32, dst, tmp);
+      return;
+    }
+
+    case UniOpVM::kLoadInsertU8:
+    case UniOpVM::kLoadInsertU16:
+    case UniOpVM::kLoadInsertU32:
+    case UniOpVM::kLoadInsertU64:
+    case UniOpVM::kLoadInsertF32:
+    case UniOpVM::kLoadInsertF32x2:
+    case UniOpVM::kLoadInsertF64: {
+      // Inserting a lane by an ASIMD instruction would clear the bits of the Z register above 128 bits.
+      Vec tmp = uc.new_vec128("@tmp");
+      Vec value = uc.new_similar_reg(dst, "@value");
+
+      vec_load_mem(uc, tmp, src, op_info.mem_size);
+      cc->dup(sve_typed(value, op_info.element), sve_typed(tmp, op_info.element).at(0));
+      sve_select_element(uc, dst, value, op_info.element, idx);
+      return;
+    }
+
+    default: {
+      // Loads of 128 bits or less are ASIMD loads, which clear the remaining bits of the Z register.
+      ASMJIT_ASSERT(op <= UniOpVM::kLoad128_F64 || (op >= UniOpVM::kLoadCvt16_U8ToU64 && op <= UniOpVM::kLoadCvt64_U32ToU64));
+      uc.emit_vm(op, dst.v128(), src, Alignment(1), idx);
+      return;
+    }
+  }
+
+  // Converting loads of a fixed memory size only fill the low part of the destination, the rest is zeroed.
+  uint32_t dst_size = op_info.mem_size ? (uint32_t(op_info.mem_size) >> msz) << uint32_t(element_size) : vec_size;
+  ASMJIT_ASSERT(dst_size <= vec_size);
+
+  Vec typed_dst = sve_typed(dst, element_size);
+  sve_load(uc, dst, src, element_size, msz, sve_mem_size_pred(uc, dst_size, element_size));
+
+  if (is_signed || is_bf16) {
+    uint32_t shift = (8u << uint32_t(element_size)) - (8u << msz);
+    cc->lsl(typed_dst, typed_dst, Imm(shift));
+    if (is_signed)
+      cc->asr(typed_dst, typed_dst, Imm(shift));
+  }
+}
+
+static ASMJIT_NOINLINE void sve_emit_mv(UniCompiler& uc, UniOpMV op, const Mem& dst, const Vec& src_, uint32_t idx) {
+  Vec src = src_.z();
+
+  switch (op) {
+    case UniOpMV::kStoreN_U32:
+    case UniOpMV::kStoreN_U64:
+    case UniOpMV::kStoreN_F32:
+    case UniOpMV::kStoreN_F64:
+    case UniOpMV::kStore256_U32:
+    case UniOpMV::kStore256_U64:
+    case UniOpMV::kStore256_F32:
+    case UniOpMV::kStore256_F64:
+    case UniOpMV::kStore512_U32:
+    case UniOpMV::kStore512_U64:
+    case UniOpMV::kStore512_F32:
+    case UniOpMV::kStore512_F64: {
+      UniOpVMInfo op_info = opcode_info_2mv[size_t(op)];
+      ElementSize element_size = ElementSize(op_info.element);
+
+      sve_store(uc, dst, src, element_size, uint32_t(element_size), sve_mem_size_pred(uc, op_info.mem_size, element_size));
+      return;
+    }
+
+    case UniOpMV::kStoreCvtN_F32ToF16:
+    case UniOpMV::kStoreCvtN_F32ToBF16: {
+      // Narrowed elements are in the low half of the temporary, which is stored.
+      uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+      Vec tmp = uc.new_similar_reg(src, "@tmp");
+
+      uc.emit_2v(op == UniOpMV::kStoreCvtN_F32ToF16 ? UniOpVV::kCvtF32ToF16Lo : UniOpVV::kCvtF32ToBF16Lo, tmp, src);
+      sve_store(uc, dst, tmp, ElementSize::k8, 0u, sve_mem_size_pred(uc, vec_size / 2u, ElementSize::k8));
+      return;
+    }
+
+    case UniOpMV::kStoreExtractU16:
+    case UniOpMV::kStoreExtractU32:
+    case UniOpMV::kStoreExtractU64: {
+      // Elements above the low 128 bits are moved to the first element first.
+      ElementSize sz = ElementSize(uint32_t(op) - uint32_t(UniOpMV::kStoreExtractU16) + 1u);
+      if ((idx << uint32_t(sz)) >= 16u) {
+        Vec tmp = uc.new_similar_reg(src, "@tmp");
+        uc.cc->dup(sve_typed(tmp, sz), sve_typed(src, sz).at(idx));
+        uc.emit_mv(op, dst, tmp.v128(), Alignment(1), 0u);
+        return;
+      }
+
+      uc.emit_mv(op, dst, src.v128(), Alignment(1), idx);
+      return;
+    }
+
+    default: {
+      // Stores of 128 bits or less only use the low 128 bits of the Z register.
+      uc.emit_mv(op, dst, src.v128(), Alignment(1), idx);
+      return;
+    }
+  }
+}
+
+// Returns the vector addressing of SVE gathers and scatters of `element_size` elements - 32-bit indexes are sign
+// extended and only shifts by the element size are encodable, other shifts are applied to a copy of the index.
+static ASMJIT_NOINLINE Mem sve_gather_mem(UniCompiler& uc, const Gp& base_, const Vec& index_, uint32_t element_size, uint32_t shift, int32_t disp) {
+  BackendCompiler* cc = uc.cc;
+
+  Gp base = base_.r64();
+  if (disp) {
+    base = uc.new_gp64("@gather_base");
+    uc.add(base, base_.r64(), Imm(disp));
+  }
+
+  ElementSize sz = element_size == 4u ? ElementSize::k32 : ElementSize::k64;
+  Vec index = index_.z();
+
+  if (shift != 0u && shift != uint32_t(sz)) {
+    Vec tmp = uc.new_similar_reg(index, "@gather_index");
+    cc->lsl(sve_typed(tmp, sz), sve_typed(index, sz), Imm(shift));
+    index = tmp;
+    shift = 0u;
+  }
+
+  if (sz == ElementSize::k32)
+    return a64::ptr(base, index.s(), a64::sxtw(shift));
+  else if (shift)
+    return a64::ptr(base, index.d(), a64::lsl(shift));
+  else
+    return a64::ptr(base, index.d());
+}
+
+// Looks up bytes of `index` in a table of `table_size` bytes, indexes out of the table select zero. Tables longer
+// than the vector are split to parts, each looked up by indexes biased by the offset of the part.
+static ASMJIT_NOINLINE void sve_emit_lut_u8(UniCompiler& uc, const Vec& dst_, const Mem& table, uint32_t table_size, const Operand_& index_) {
+  BackendCompiler* cc = uc.cc;
+
+  uint32_t vec_size = 16u << uint32_t(uc.vec_width());
+  uint32_t part_count = (table_size + vec_size - 1u) / vec_size;
+
+  Vec dst = dst_.z();
+  Vec index = sve_as_vec(uc, index_, dst);
+  Vec out = part_count > 1u && index.id() == dst.id() ? uc.new_similar_reg(dst, "@lut_out") : dst;
+
+  Vec part = uc.new_similar_reg(dst, "@lut_table");
+  Vec part_index = uc.new_similar_reg(dst, "@lut_index");
+  Vec part_out = uc.new_similar_reg(dst, "@lut_part");
+
+  for (uint32_t i = 0; i < part_count; i++) {
+    Mem m(table);
+    m.add_offset(int32_t(i * vec_size));
+
+    uint32_t part_size = Support::min<uint32_t>(table_size - i * vec_size, vec_size);
+    sve_load(uc, part, m, ElementSize::k8, 0u, sve_mem_size_pred(uc, part_size, ElementSize::k8));
+
+    if (i == 0u) {
+      cc->tbl(out.b(), part.b(), index.b());
+    }
+    else {
+      cc->dup(part_index.b(), Imm(int32_t(i * vec_size)));
+      cc->sub(part_index.b(), index.b(), part_index.b());
+      cc->tbl(part_out.b(), part.b(), part_index.b());
+      cc->orr(out.d(), out.d(), part_out.d());
+    }
+  }
+
+  sve_mov(uc, dst, out);
+}
+
+// SVE across vector reductions - all of them reduce to a scalar of the element size except UADDV, which always
+// produces a 64-bit sum.
+static constexpr InstId sve_reduce_inst_id[size_t(UniOpReduce::kMaxValue) + 1] = {
+  Inst::kIdUaddv_z,   // UniOpReduce::kAddU32
+  Inst::kIdUaddv_z,   // UniOpReduce::kAddU64
+  Inst::kIdFaddv_z,   // UniOpReduce::kAddF32
+  Inst::kIdFaddv_z,   // UniOpReduce::kAddF64
+  Inst::kIdSminv_z,   // UniOpReduce::kMinI8
+  Inst::kIdUminv_z,   // UniOpReduce::kMinU8
+  Inst::kIdSminv_z,   // UniOpReduce::kMinI16
+  Inst::kIdUminv_z,   // UniOpReduce::kMinU16
+  Inst::kIdSminv_z,   // UniOpReduce::kMinI32
+  Inst::kIdUminv_z,   // UniOpReduce::kMinU32
+  Inst::kIdSminv_z,   // UniOpReduce::kMinI64
+  Inst::kIdUminv_z,   // UniOpReduce::kMinU64
+  Inst::kIdFminnmv_z, // UniOpReduce::kMinF32
+  Inst::kIdFminnmv_z, // UniOpReduce::kMinF64
+  Inst::kIdSmaxv_z,   // UniOpReduce::kMaxI8
+  Inst::kIdUmaxv_z,   // UniOpReduce::kMaxU8
+  Inst::kIdSmaxv_z,   // UniOpReduce::kMaxI16
+  Inst::kIdUmaxv_z,   // UniOpReduce::kMaxU16
+  Inst::kIdSmaxv_z,   // UniOpReduce::kMaxI32
+  Inst::kIdUmaxv_z,   // UniOpReduce::kMaxU32
+  Inst::kIdSmaxv_z,   // UniOpReduce::kMaxI64
+  Inst::kIdUmaxv_z,   // UniOpReduce::kMaxU64
+  Inst::kIdFmaxnmv_z, // UniOpReduce::kMaxF32
+  Inst::kIdFmaxnmv_z, // UniOpReduce::kMaxF64
+  Inst::kIdAndv_z,    // UniOpReduce::kAndU32
+  Inst::kIdAndv_z,    // UniOpReduce::kAndU64
+  Inst::kIdOrv_z,     // UniOpReduce::kOrU32
+  Inst::kIdOrv_z      // UniOpReduce::kOrU64
+};
+
+static ASMJIT_NOINLINE void sve_emit_reduce(UniCompiler& uc, UniOpReduce op, const Vec& acc, const Vec& src) {
+  BackendCompiler* cc = uc.cc;
+
+  UniOpReduceInfo info = uni_op_reduce_info_table[size_t(op)];
+  InstId inst_id = sve_reduce_inst_id[size_t(op)];
+  ElementSize sz = ElementSize(Support::ctz(info.element_size));
+
+  a64::PReg pg(uc.sve_ptrue().id());
+  Vec zsrc = sve_typed(src, sz);
+
+  if (inst_id == Inst::kIdUaddv_z) {
+    cc->uaddv(acc.d(), pg, zsrc);
+    if (sz == ElementSize::k32)
+      cc->fmov(acc.s(), acc.s());
+    return;
+  }
+
+  switch (sz) {
+    case ElementSize::k8 : cc->emit(inst_id, acc.b(), pg, zsrc); break;
+    case ElementSize::k16: cc->emit(inst_id, acc.h(), pg, zsrc); break;
+    case ElementSize::k32: cc->emit(inst_id, acc.s(), pg, zsrc); break;
+    default              : cc->emit(inst_id, acc.d(), pg, zsrc); break;
+  }
+}
+
+// ujit::UniCompiler - Vector Instructions - Swizzle 32 Impl
+// =========================================================
+
+// [DCBA] <- Mov    (DCBA, dcba)
+// [AAAA] <- Dup0   (DCBA, dcba)
+// [BBBB] <- Dup1   (DCBA, dcba)
+// [CCCC] <- Dup2   (DCBA, dcba)
+// [DDDD] <- Dup3   (DCBA, dcba)
+// [CDAB] <- Rev64  (DCBA, dcba)
+// [aDCB] <- Ext4   (DCBA, dcba) [dcb|aDCB|A  ]
+// [baDC] <- Ext8   (DCBA, dcba) [ dc|baDC|BA ]
+// [cbaD] <- Ext12  (DCBA, dcba) [  d|cbaD|CBA]
+// [bBaA] <- Zip1_4S(DCBA, dcba)
+// [baBA] <- Zip1_2D(DCBA, dcba)
+// [dDcC] <- Zip2_4S(DCBA, dcba)
+// [dcDC] <- Zip2_2D(DCBA, dcba)
+// [caCA] <- Uzp1_4S(DCBA, dcba)
+// [baBA] <- Uzp1_2D(DCBA, dcba)
+// [dbDB] <- Uzp2_4S(DCBA, dcba)
+// [dcDC] <- Uzp2_2D(DCBA, dcba)
+// [cCaA] <- Trn1_4S(DCBA, dcba)
+// [dDbB] <- Trn2_4S(DCBA, dcba)
+struct Swizzle32Data {
+  enum class OpTarget : uint8_t {
+    kDst = 0,
+    k1   = 1,
+    k2   = 2,
+    kA   = 3,
+
+    k_   = kDst
+  };
+
+  struct Op {
+    //! Swizzle operation does nothing - 'mov' (this can be only the first operation).
+    static constexpr uint8_t kMov = 1;
+    //! Swizzle operation performs an insert - moves a value from one lane to another.
+    static constexpr uint8_t kIns = 2;
+    //! Swizzle operation duplicates a lane across all others - 'dup'.
+    static constexpr uint8_t kDup = 3;
+    //! Swizzle operation rotates a vector - 'ext'.
+    static constexpr uint8_t kExt = 4;
+    //! Swizzle operation swaps lo/hi elements of 64-bit lanes - 'rev64'.
+    static constexpr uint8_t kRev64 = 5;
+    //! Swizzle operation can be implemented as a single zip[1|2], uzp[1|2], or trn[1|2] instruction with 32-bit or 64-bit elements.
+    static constexpr uint8_t kZipUnzip = 7;
+
+    static constexpr uint8_t kIns0To1  = uint8_t(kIns     ) | (0 << 4) | (1 << 6);
+    static constexpr uint8_t kIns0To2  = uint8_t(kIns     ) | (0 << 4) | (2 << 6);
+    static constexpr uint8_t kIns0To3  = uint8_t(kIns     ) | (0 << 4) | (3 << 6);
+    static constexpr uint8_t kIns1To0  = uint8_t(kIns     ) | (1 << 4) | (0 << 6);
+    static constexpr uint8_t kIns1To2  = uint8_t(kIns     ) | (1 << 4) | (2 << 6);
+    static constexpr uint8_t kIns1To3  = uint8_t(kIns     ) | (1 << 4) | (3 << 6);
+    static constexpr uint8_t kIns2To0  = uint8_t(kIns     ) | (2 << 4) | (0 << 6);
+    static constexpr uint8_t kIns2To1  = uint8_t(kIns     ) | (2 << 4) | (1 << 6);
+    static constexpr uint8_t kIns2To3  = uint8_t(kIns     ) | (2 << 4) | (3 << 6);
+    static constexpr uint8_t kIns3To0  = uint8_t(kIns     ) | (3 << 4) | (0 << 6);
+    static constexpr uint8_t kIns3To1  = uint8_t(kIns     ) | (3 << 4) | (1 << 6);
+    static constexpr uint8_t kIns3To2  = uint8_t(kIns     ) | (3 << 4) | (2 << 6);
+    static constexpr uint8_t kDup0     = uint8_t(kDup     ) | (0 << 4);
+    static constexpr uint8_t kDup1     = uint8_t(kDup     ) | (1 << 4);
+    static constexpr uint8_t kDup2     = uint8_t(kDup     ) | (2 << 4);
+    static constexpr uint8_t kDup3     = uint8_t(kDup     ) | (3 << 4);
+    static constexpr uint8_t kExt4     = uint8_t(kExt     ) | (1 << 4);
+    static constexpr uint8_t kExt8     = uint8_t(kExt     ) | (2 << 4);
+    static constexpr uint8_t kExt12    = uint8_t(kExt     ) | (3 << 4);
+    static constexpr uint8_t kZip1_4S  = uint8_t(kZipUnzip) | (0 << 4) | (0 << 7);
+    static constexpr uint8_t kZip1_2D  = uint8_t(kZipUnzip) | (0 << 4) | (1 << 7);
+    static constexpr uint8_t kZip2_4S  = uint8_t(kZipUnzip) | (1 << 4) | (0 << 7);
+    static constexpr uint8_t kZip2_2D  = uint8_t(kZipUnzip) | (1 << 4) | (1 << 7);
+    static constexpr uint8_t kUzp1_4S  = uint8_t(kZipUnzip) | (2 << 4) | (0 << 7);
+    static constexpr uint8_t kUzp1_2D  = uint8_t(kZipUnzip) | (2 << 4) | (1 << 7);
+    static constexpr uint8_t kUzp2_4S  = uint8_t(kZipUnzip) | (3 << 4) | (0 << 7);
+    static constexpr uint8_t kUzp2_2D  = uint8_t(kZipUnzip) | (3 << 4) | (1 << 7);
+    static constexpr uint8_t kTrn1_4S  = uint8_t(kZipUnzip) | (4 << 4);
+    static constexpr uint8_t kTrn2_4S  = uint8_t(kZipUnzip) | (5 << 4);
+
+    // Alias to nothing to make the table easier to read.
+    static constexpr uint8_t k_ = 0;
+
+    uint8_t data;
+
+    ASMJIT_INLINE_NODEBUG bool is_valid() const noexcept { return data != 0; }
+    ASMJIT_INLINE_NODEBUG uint32_t type() const noexcept { return data & 0xF; }
+
+    ASMJIT_INLINE_NODEBUG uint32_t dup_idx() const noexcept { return (data >> 4) & 0x3; }
+    ASMJIT_INLINE_NODEBUG uint32_t ext_imm() const noexcept { return (data >> 2) & (0x3 << 2); }
+
+    ASMJIT_INLINE_NODEBUG uint32_t zip_op() const noexcept { return (data >> 4) & 0x7; }
+    ASMJIT_INLINE_NODEBUG bool zip_s4() const noexcept { return (data & (1 << 7)) == 0; }
+
+    ASMJIT_INLINE_NODEBUG uint32_t ins_src() const noexcept { return (data >> 4) & 0x3; }
+    ASMJIT_INLINE_NODEBUG uint32_t ins_dst() const noexcept { return (data >> 6) & 0x3; }
+  };
+
+  //! \name Members
+  //! \{
+
+  Op ops[3];
+  uint8_t flags;
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  ASMJIT_INLINE_NODEBUG bool is_defined() const noexcept { return ops[0].data != 0; }
+  ASMJIT_INLINE_NODEBUG Op op(uint32_t index) const noexcept { return ops[index]; }
+  ASMJIT_INLINE_NODEBUG OpTarget op_target(uint32_t index) const noexcept { return OpTarget((flags >> (index * 2)) & 0x3); }
+
+  //! \}
+};
+
+// This table provides all combinations for all possible 32-bit swizzles (there is 256 combinations in total).
+// It prioritizes lane moves, and then operations that can have either one or two inputs. Each operation has
+// a target, which specifies whether it replaces the destination or one or both sources that are then passed
+// to a next operation. The last operation must always be `OpTarget::kDst` so the result ends up in the right
+// register.
+//
+// In general the decomposition of operations needed for all swizzles is as follows:
+//
+//   - 1 Op Swizzles: 17
+//   - 2 Op Swizzles: 156
+//   - 3 Op Swizzles: 83
+//
+// Which means that luckily most used swizzles would fall into 1 or 2 operations.
+//
+// NOTE: Moves (InsXToY) operations only happen on the destination as they are destructive, which is perfectly
+// okay as moving them into earlier steps didn't really improve anything.
+#define OP(swiz, op0, target0, op1, target1, op2, target2) { \
+  {                                                            \
+    {Swizzle32Data::Op::k##op0},                               \
+    {Swizzle32Data::Op::k##op1},                               \
+    {Swizzle32Data::Op::k##op2}                                \
+  },                                                           \
+  (                                                            \
+    (uint16_t(Swizzle32Data::OpTarget::k##target0) << 0) |     \
+    (uint16_t(Swizzle32Data::OpTarget::k##target1) << 2) |     \
+    (uint16_t(Swizzle32Data::OpTarget::k##target2) << 4)       \
+  )                                                            \
+}
+
+static constexpr Swizzle32Data swizzle_32_data[256] = {
+  OP(0000, Dup0   , _, _      , _, _      , _), OP(0001, Rev64  , _, Ins1To2, _, Ins1To3, _), OP(0002, Ext8   , _, Ins2To1, _, Ins2To3, _), OP(0003, Dup0   , 2, Ext12  , _, _      , _),
+  OP(0010, Zip1_2D, _, Ins0To3, _, _      , _), OP(0011, Rev64  , A, Zip1_4S, _, _      , _), OP(0012, Ext8   , _, Ins3To1, _, Ins2To3, _), OP(0013, Rev64  , 2, Ext12  , _, Ins2To3, _),
+  OP(0020, Uzp1_4S, _, Ins0To3, _, _      , _), OP(0021, Ext4   , _, Ins3To2, _, _      , _), OP(0022, Ext4   , A, Trn2_4S, _, _      , _), OP(0023, Ext4   , _, Ins2To0, _, Ins3To2, _),
+  OP(0030, Ext8   , _, Ins2To0, _, Ins2To3, _), OP(0031, Dup0   , 2, Uzp2_4S, _, _      , _), OP(0032, Ext8   , _, Ins2To3, _, _      , _), OP(0033, Ext4   , A, Zip2_4S, _, _      , _),
+  OP(0100, Zip1_4S, _, Ins0To3, _, _      , _), OP(0101, Rev64  , A, Zip1_2D, _, _      , _), OP(0102, Ext12  , _, Ins3To0, _, Ins1To3, _), OP(0103, Ext12  , _, Ins1To3, _, _      , _),
+  OP(0110, Rev64  , 2, Zip1_4S, _, _      , _), OP(0111, Dup1   , 1, Ext4   , _, _      , _), OP(0112, Rev64  , 2, Ext8   , _, Ins2To1, _), OP(0113, Ext12  , _, Ins1To3, _, Ins2To1, _),
+  OP(0120, Ext4   , _, Ins0To2, _, Ins3To0, _), OP(0121, Ext4   , _, Ins0To2, _, _      , _), OP(0122, Ext4   , _, Ins0To2, _, Ins1To0, _), OP(0123, Rev64  , A, Ext8   , _, _      , _),
+  OP(0130, Ext12  , 2, Zip1_4S, _, _      , _), OP(0131, Ext4   , _, Ins2To1, _, Ins0To2, _), OP(0132, Rev64  , 2, Ext8   , _, _      , _), OP(0133, Ext12  , _, Ins1To3, _, Ins0To1, _),
+  OP(0200, Trn1_4S, _, Ins0To3, _, _      , _), OP(0201, Rev64  , _, Ins3To2, _, Ins1To3, _), OP(0202, Ext4   , A, Uzp2_4S, _, _      , _), OP(0203, Uzp1_4S, 2, Ext12  , _, _      , _),
+  OP(0210, Mov    , _, Ins0To3, _, _      , _), OP(0211, Mov    , _, Ins0To3, _, Ins1To0, _), OP(0212, Mov    , _, Ins0To3, _, Ins2To0, _), OP(0213, Rev64  , A, Ext8   , 1, Zip1_4S, _),
+  OP(0220, Ext8   , 2, Uzp1_4S, _, _      , _), OP(0221, Ext4   , _, Ins1To2, _, _      , _), OP(0222, Dup2   , 1, Ext4   , _, _      , _), OP(0223, Ext4   , _, Ins2To0, _, Ins1To2, _),
+  OP(0230, Rev64  , 1, Ext4   , _, _      , _), OP(0231, Ext4   , 2, Uzp2_4S, _, _      , _), OP(0232, Ext8   , _, Ins2To3, _, Ins0To2, _), OP(0233, Rev64  , 1, Ext4   , _, Ins1To0, _),
+  OP(0300, Rev64  , _, Ins1To0, _, Ins1To3, _), OP(0301, Rev64  , _, Ins1To3, _, _      , _), OP(0302, Dup0   , 2, Zip2_4S, _, _      , _), OP(0303, Ext4   , A, Zip2_2D, _, _      , _),
+  OP(0310, Ext12  , 2, Zip1_2D, _, _      , _), OP(0311, Ext4   , _, Ins0To1, _, _      , _), OP(0312, Dup0   , 2, Zip1_4S, 2, Zip2_4S, _), OP(0313, Uzp2_4S, 1, Ext4   , _, _      , _),
+  OP(0320, Ext4   , _, Ins3To0, _, _      , _), OP(0321, Ext4   , _, _      , _, _      , _), OP(0322, Ext4   , _, Ins1To0, _, _      , _), OP(0323, Ext4   , _, Ins2To0, _, _      , _),
+  OP(0330, Ext4   , _, Ins2To1, _, Ins3To0, _), OP(0331, Ext4   , _, Ins2To1, _, _      , _), OP(0332, Ext4   , 2, Zip2_4S, _, _      , _), OP(0333, Dup3   , 1, Ext4   , _, _      , _),
+  OP(1000, Zip1_4S, _, Ins0To2, _, _      , _), OP(1001, Rev64  , 1, Zip1_4S, _, _      , _), OP(1002, Ext8   , _, Ins2To1, _, _      , _), OP(1003, Ext4   , 1, Ext8   , _, _      , _),
+  OP(1010, Zip1_2D, _, _      , _, _      , _), OP(1011, Zip1_2D, _, Ins1To0, _, _      , _), OP(1012, Ext8   , _, Ins3To1, _, _      , _), OP(1013, Ext8   , _, Ins1To0, _, Ins3To1, _),
+  OP(1020, Zip1_4S, 2, Uzp1_4S, _, _      , _), OP(1021, Ext4   , 1, Zip1_2D, _, _      , _), OP(1022, Ext8   , _, Ins0To1, _, _      , _), OP(1023, Rev64  , 1, Ext8   , _, _      , _),
+  OP(1030, Ext8   , _, Ins2To0, _, _      , _), OP(1031, Ext8   , _, Ins3To0, _, _      , _), OP(1032, Ext8   , _, _      , _, _      , _), OP(1033, Ext8   , _, Ins1To0, _, _      , _),
+  OP(1100, Zip1_4S, _, _      , _, _      , _), OP(1101, Zip1_4S, _, Ins2To0, _, _      , _), OP(1102, Ext8   , _, Ins2To1, _, Ins3To2, _), OP(1103, Ext12  , _, Ins2To3, _, _      , _),
+  OP(1110, Zip1_4S, _, Ins2To1, _, _      , _), OP(1111, Dup1   , _, _      , _, _      , _), OP(1112, Ext8   , _, Ins3To1, _, Ins3To2, _), OP(1113, Dup1   , 2, Ext12  , _, _      , _),
+  OP(1120, Dup1   , 2, Uzp1_4S, _, _      , _), OP(1121, Ext4   , _, Ins0To2, _, Ins0To3, _), OP(1122, Ext8   , _, Ins0To1, _, Ins3To2, _), OP(1123, Ext12  , _, Ins3To1, _, Ins2To3, _),
+  OP(1130, Ext8   , _, Ins2To0, _, Ins3To2, _), OP(1131, Uzp2_4S, _, Ins0To3, _, _      , _), OP(1132, Ext8   , _, Ins3To2, _, _      , _), OP(1133, Ext8   , A, Trn2_4S, _, _      , _),
+  OP(1200, Zip1_4S, 2, Trn1_4S, _, _      , _), OP(1201, Ext4   , 1, Zip1_4S, _, _      , _), OP(1202, Dup2   , 1, Zip1_4S, _, _      , _), OP(1203, Dup1   , 2, Uzp1_4S, 2, Ext12  , _),
+  OP(1210, Mov    , _, Ins1To3, _, _      , _), OP(1211, Mov    , _, Ins1To0, _, Ins1To3, _), OP(1212, Mov    , _, Ins1To3, _, Ins2To0, _), OP(1213, Mov    , _, Ins3To0, _, Ins1To3, _),
+  OP(1220, Mov    , _, Ins1To3, _, Ins2To1, _), OP(1221, Ext4   , _, Ins0To3, _, Ins1To2, _), OP(1222, Ext8   , _, Ins0To1, _, Ins0To2, _), OP(1223, Rev64  , 1, Ext8   , _, Ins1To2, _),
+  OP(1230, Rev64  , A, Ext4   , _, _      , _), OP(1231, Ext8   , _, Ins0To2, _, Ins3To0, _), OP(1232, Ext8   , _, Ins0To2, _, _      , _), OP(1233, Ext8   , _, Ins0To2, _, Ins1To0, _),
+  OP(1300, Rev64  , _, Ins0To3, _, Ins1To0, _), OP(1301, Rev64  , _, Ins0To3, _, _      , _), OP(1302, Ext8   , 1, Zip1_4S, _, _      , _), OP(1303, Dup3   , 1, Zip1_4S, _, _      , _),
+  OP(1310, Mov    , _, Ins3To2, _, Ins1To3, _), OP(1311, Trn2_4S, _, Ins0To3, _, _      , _), OP(1312, Dup1   , 2, Zip2_4S, _, _      , _), OP(1313, Ext8   , A, Uzp2_4S, _, _      , _),
+  OP(1320, Ext12  , 2, Uzp1_4S, _, _      , _), OP(1321, Ext4   , _, Ins0To3, _, _      , _), OP(1322, Ext4   , _, Ins0To3, _, Ins1To0, _), OP(1323, Ext4   , _, Ins0To3, _, Ins2To0, _),
   OP(1330, Ext8   , _, Ins2To0, _, Ins1To2, _), OP(1331, Ext8   , 2, Uzp2_4S, _, _      , _), OP(1332, Ext8   , _, Ins1To2, _, _      , _), OP(1333, Ext8   , _, Ins1To0, _, Ins1To2, _),
   OP(2000, Uzp1_4S, _, Ins0To1, _, _      , _), OP(2001, Rev64  , _, Ins1To2, _, _      , _), OP(2002, Ext8   , 1, Uzp1_4S, _, _      , _), OP(2003, Ext12  , _, Ins1To2, _, _      , _),
   OP(2010, Zip1_4S, 1, Uzp1_4S, _, _      , _), OP(2011, Dup1   , 1, Uzp1_4S, _, _      , _), OP(2012, Ext8   , _, Ins3To1, _, Ins0To3, _), OP(2013, Ext12  , 1, Uzp1_4S, _, _      , _),
@@ -2784,6 +4161,11 @@ static ASMJIT_INLINE void emit_4v_t(UniCompiler& uc, UniOpVVVV op, const OpArray
 void UniCompiler::emit_2v(UniOpVV op, const Operand_& dst_, const Operand_& src_) {
   ASMJIT_ASSERT(dst_.is_vec());
 
+  if (is_sve_vec(dst_)) {
+    sve_emit_2v(*this, op, dst_.as<Vec>(), src_);
+    return;
+  }
+
   Vec dst(dst_.as<Vec>());
 
   UniOpVInfo op_info = opcode_info_2v[size_t(op)];
@@ -2880,7 +4262,9 @@ void UniCompiler::emit_2v(UniOpVV op, const Operand_& dst_, const Operand_& src_
     case UniOpVV::kNotU32:
     case UniOpVV::kNotU64:
     case UniOpVV::kNotF32:
-    case UniOpVV::kNotF64: {
+    case UniOpVV::kNotF64:
+    case UniOpVV::kPopcntU8:
+    case UniOpVV::kLzcntU32: {
       Vec src = as_vec(*this, src_, dst);
 
       vec_set_type(dst, op_info.dst_element);
@@ -3075,75 +4459,198 @@ void UniCompiler::emit_2v(UniOpVV op, const Operand_& dst_, const Operand_& src_
         src = src.v64();
       }
 
-      vec_set_type(dst, op_info.dst_element);
+      vec_set_type(dst, op_info.dst_element);
+      vec_set_type(src, op_info.src_element);
+
+      cc->emit(inst_id, dst, src);
+      return;
+    }
+
+    case UniOpVV::kCvtI32HiToF64:
+      if (src_.is_mem()) {
+        Vec src = as_vec(*this, src_.as<Mem>().clone_adjusted(8), dst, 8).v64();
+
+        vec_set_type(dst, op_info.dst_element);
+        vec_set_type(src, op_info.src_element);
+
+        cc->emit(opcode_info_2v[size_t(op) - 1u].inst_id, dst, src, 0);
+        cc->scvtf(dst.d2(), dst.d2());
+        return;
+      }
+      [[fallthrough]];
+
+    case UniOpVV::kCvtI32LoToF64: {
+      Vec src = as_vec(*this, src_, dst, 8);
+
+      if (op_info.src_part == VecPart::kLo) {
+        src = src.v64();
+      }
+
+      vec_set_type(dst, op_info.dst_element);
+      vec_set_type(src, op_info.src_element);
+
+      cc->emit(inst_id, dst, src, 0);
+      cc->scvtf(dst.d2(), dst.d2());
+      return;
+    }
+
+    case UniOpVV::kCvtF64ToF32Lo:
+    case UniOpVV::kCvtF64ToF32Hi: {
+      dst = dst.q();
+      Vec src = as_vec(*this, src_, dst);
+
+      if (op_info.dst_part == VecPart::kLo) {
+        dst = dst.d();
+      }
+
+      vec_set_type(dst, op_info.dst_element);
+      vec_set_type(src, op_info.src_element);
+
+      cc->emit(inst_id, dst, src);
+      return;
+    }
+
+    case UniOpVV::kCvtTruncF64ToI32Lo:
+    case UniOpVV::kCvtRoundF64ToI32Lo:
+    case UniOpVV::kCvtTruncF64ToI32Hi:
+    case UniOpVV::kCvtRoundF64ToI32Hi: {
+      dst = dst.q();
+
+      Vec src = as_vec(*this, src_, dst);
+      Vec tmp = new_similar_reg(dst, "@tmp");
+
+      cc->emit(inst_id, tmp.d2(), src.d2());
+
+      if (op_info.dst_part == VecPart::kLo) {
+        cc->sqxtn(dst.s2(), tmp.d2());
+      }
+      else {
+        cc->sqxtn2(dst.s4(), tmp.d2());
+      }
+
+      return;
+    }
+
+    case UniOpVV::kCvtF16LoToF32:
+    case UniOpVV::kCvtF16HiToF32:
+    case UniOpVV::kCvtBF16LoToF32:
+    case UniOpVV::kCvtBF16HiToF32: {
+      // BF16 is the high half of F32, so the widening is just a shift by 16 (SHLL), F16 uses FCVTL.
+      vec_set_type(dst, op_info.dst_element);
+
+      Vec src;
+
+      if (op_info.src_part == VecPart::kLo) {
+        src = as_vec(*this, src_, dst, 8);
+        src = src.v64();
+      }
+      else if (src_.is_vec()) {
+        src = src_.as<Vec>();
+      }
+      else {
+        Mem m(src_.as<Mem>());
+        m.add_offset(8);
+        src = vec_from_mem(*this,  m, dst, 8);
+        src = src.v64();
+
+        // Since we have loaded from memory, we want to use the low-part variant of the instruction.
+        inst_id = opcode_info_2v[size_t(op) - 1u].inst_id;
+      }
+
       vec_set_type(src, op_info.src_element);
 
-      cc->emit(inst_id, dst, src);
+      if (op_info.imm)
+        cc->emit(inst_id, dst, src, Imm(op_info.imm));
+      else
+        cc->emit(inst_id, dst, src);
       return;
     }
 
-    case UniOpVV::kCvtI32HiToF64:
-      if (src_.is_mem()) {
-        Vec src = as_vec(*this, src_.as<Mem>().clone_adjusted(8), dst, 8).v64();
-
-        vec_set_type(dst, op_info.dst_element);
-        vec_set_type(src, op_info.src_element);
+    case UniOpVV::kCvtF32ToF16Lo: {
+      dst = dst.q();
+      Vec src = as_vec(*this, src_, dst);
 
-        cc->emit(opcode_info_2v[size_t(op) - 1u].inst_id, dst, src, 0);
-        cc->scvtf(dst.d2(), dst.d2());
-        return;
-      }
-      [[fallthrough]];
+      cc->fcvtn(dst.h4(), src.s4());
+      return;
+    }
 
-    case UniOpVV::kCvtI32LoToF64: {
-      Vec src = as_vec(*this, src_, dst, 8);
+    case UniOpVV::kCvtF32ToBF16Lo: {
+      dst = dst.q();
+      Vec src = as_vec(*this, src_, dst);
 
-      if (op_info.src_part == VecPart::kLo) {
-        src = src.v64();
+      if (has_bf16()) {
+        cc->bfcvtn(dst.h4(), src.s4());
+        return;
       }
 
-      vec_set_type(dst, op_info.dst_element);
-      vec_set_type(src, op_info.src_element);
-
-      cc->emit(inst_id, dst, src, 0);
-      cc->scvtf(dst.d2(), dst.d2());
+      // Intrinsic - round to nearest even by adding `0x7FFF + ((x >> 16) & 1)` to the F32 bits, NaNs are quieted
+      // instead, and the high 16 bits are narrowed. Denormals are preserved, as they are by BFCVTN.
+      Vec tmp = new_similar_reg(dst, "@tmp");
+      Vec nan = new_similar_reg(dst, "@nan");
+      Vec msk = new_similar_reg(dst, "@msk");
+      Vec bias = simd_vec_const(&ct().p_00007FFF00007FFF, Bcst::k32, dst);
+      Vec quiet_bit = simd_vec_const(&ct().p_0040000000400000, Bcst::k32, dst);
+
+      cc->shl(tmp.s4(), src.s4(), 15);
+      cc->ushr(tmp.s4(), tmp.s4(), 31);
+      cc->add(tmp.s4(), tmp.s4(), src.s4());
+      cc->add(tmp.s4(), tmp.s4(), bias.s4());
+      cc->orr(nan.b16(), src.b16(), quiet_bit.b16());
+      cc->fcmeq(msk.s4(), src.s4(), src.s4());
+      cc->bsl(msk.b16(), tmp.b16(), nan.b16());
+      cc->shrn(dst.h4(), msk.s4(), 16);
       return;
     }
 
-    case UniOpVV::kCvtF64ToF32Lo:
-    case UniOpVV::kCvtF64ToF32Hi: {
+    case UniOpVV::kPopcntU16:
+    case UniOpVV::kPopcntU32:
+    case UniOpVV::kPopcntU64: {
+      // Intrinsic - CNT only counts bits of bytes, wider counts are calculated by pairwise widening additions.
       dst = dst.q();
       Vec src = as_vec(*this, src_, dst);
 
-      if (op_info.dst_part == VecPart::kLo) {
-        dst = dst.d();
-      }
+      cc->cnt(dst.b16(), src.b16());
+      cc->uaddlp(dst.h8(), dst.b16());
 
-      vec_set_type(dst, op_info.dst_element);
-      vec_set_type(src, op_info.src_element);
+      if (op >= UniOpVV::kPopcntU32)
+        cc->uaddlp(dst.s4(), dst.h8());
 
-      cc->emit(inst_id, dst, src);
+      if (op >= UniOpVV::kPopcntU64)
+        cc->uaddlp(dst.d2(), dst.s4());
       return;
     }
 
-    case UniOpVV::kCvtTruncF64ToI32Lo:
-    case UniOpVV::kCvtRoundF64ToI32Lo:
-    case UniOpVV::kCvtTruncF64ToI32Hi:
-    case UniOpVV::kCvtRoundF64ToI32Hi: {
+    case UniOpVV::kLzcntU64:
+    case UniOpVV::kTzcntU32:
+    case UniOpVV::kTzcntU64: {
+      // Intrinsic - trailing zeros are counted as leading zeros of elements having reversed bits, and 64-bit counts
+      // are combined from counts of both 32-bit halves as CLZ doesn't support 64-bit elements.
       dst = dst.q();
-
       Vec src = as_vec(*this, src_, dst);
-      Vec tmp = new_similar_reg(dst, "@tmp");
-
-      cc->emit(inst_id, tmp.d2(), src.d2());
 
-      if (op_info.dst_part == VecPart::kLo) {
-        cc->sqxtn(dst.s2(), tmp.d2());
+      if (op == UniOpVV::kTzcntU32) {
+        cc->rbit(dst.b16(), src.b16());
+        cc->rev32(dst.b16(), dst.b16());
+        src = dst;
       }
-      else {
-        cc->sqxtn2(dst.s4(), tmp.d2());
+      else if (op == UniOpVV::kTzcntU64) {
+        cc->rbit(dst.b16(), src.b16());
+        cc->rev64(dst.b16(), dst.b16());
+        src = dst;
       }
 
+      cc->clz(dst.s4(), src.s4());
+
+      if (op != UniOpVV::kTzcntU32) {
+        Vec hi = new_similar_reg(dst, "@hi");
+        Vec msk = new_similar_reg(dst, "@msk");
+        Vec c32 = simd_vec_const(&ct().p_0000002000000020, Bcst::k32, dst);
+
+        cc->ushr(hi.d2(), dst.d2(), 32);
+        cc->cmeq(msk.s4(), hi.s4(), c32.s4());
+        cc->and_(dst.b16(), dst.b16(), msk.b16());
+        cc->add(dst.d2(), dst.d2(), hi.d2());
+      }
       return;
     }
 
@@ -3161,6 +4668,12 @@ void UniCompiler::emit_2v(UniOpVV op, const OpArray& dst_, const OpArray& src_)
 void UniCompiler::emit_2vi(UniOpVVI op, const Operand_& dst_, const Operand_& src_, uint32_t imm) {
   ASMJIT_ASSERT(dst_.is_vec());
 
+  // Extracting a lane of a Z register has a V register destination.
+  if (is_sve_vec(dst_) || is_sve_vec(src_)) {
+    sve_emit_2vi(*this, op, dst_.as<Vec>(), src_, imm);
+    return;
+  }
+
   Vec dst(dst_.as<Vec>());
 
   UniOpVInfo op_info = opcode_info_2vi[size_t(op)];
@@ -3305,6 +4818,36 @@ void UniCompiler::emit_2vi(UniOpVVI op, const OpArray& dst_, const OpArray& src_
 // ==================================================
 
 void UniCompiler::emit_2vs(UniOpVR op, const Operand_& dst_, const Operand_& src_, uint32_t idx) {
+  if (is_sve_vec(dst_) || is_sve_vec(src_)) {
+    // Inserting a lane by an ASIMD instruction would clear the bits of the Z register above 128 bits.
+    if (op >= UniOpVR::kInsertU8 && op <= UniOpVR::kInsertU64) {
+      ElementSize sz = ElementSize(uint32_t(op) - uint32_t(UniOpVR::kInsertU8));
+      Vec dst = dst_.as<Vec>().z();
+      Vec value = new_similar_reg(dst, "@value");
+      Gp src = src_.as<Gp>();
+
+      cc->dup(sve_typed(value, sz), sz <= ElementSize::k32 ? src.r32() : src.r64());
+      sve_select_element(*this, dst, value, sz, idx);
+      return;
+    }
+
+    // Elements above the low 128 bits are moved to the first element first.
+    if (op >= UniOpVR::kExtractU8 && op <= UniOpVR::kExtractU64 && is_sve_vec(src_)) {
+      ElementSize sz = ElementSize(uint32_t(op) - uint32_t(UniOpVR::kExtractU8));
+      if ((idx << uint32_t(sz)) >= 16u) {
+        Vec src = src_.as<Vec>().z();
+        Vec tmp = new_similar_reg(src, "@tmp");
+
+        cc->dup(sve_typed(tmp, sz), sve_typed(src, sz).at(idx));
+        emit_2vs(op, dst_, tmp.v128(), 0u);
+        return;
+      }
+    }
+
+    emit_2vs(op, sve_v128_op(dst_), sve_v128_op(src_), idx);
+    return;
+  }
+
   UniOpVInfo op_info = opcode_info_2vs[size_t(op)];
 
   switch (op) {
@@ -3425,6 +4968,11 @@ void UniCompiler::emit_vm(UniOpVM op, const Vec& dst_, const Mem& src_, Alignmen
   ASMJIT_ASSERT(dst_.is_vec());
   ASMJIT_ASSERT(src_.is_mem());
 
+  if (is_sve_vec(dst_)) {
+    sve_emit_vm(*this, op, dst_, src_, idx);
+    return;
+  }
+
   Support::maybe_unused(alignment);
 
   Vec dst(dst_);
@@ -3492,7 +5040,9 @@ void UniCompiler::emit_vm(UniOpVM op, const Vec& dst_, const Mem& src_, Alignmen
     case UniOpVM::kLoadCvtN_I16ToI32:
     case UniOpVM::kLoadCvtN_U16ToU32:
     case UniOpVM::kLoadCvtN_I32ToI64:
-    case UniOpVM::kLoadCvtN_U32ToU64: {
+    case UniOpVM::kLoadCvtN_U32ToU64:
+    case UniOpVM::kLoadCvtN_F16ToF32:
+    case UniOpVM::kLoadCvtN_BF16ToF32: {
       vec_load_mem(*this, dst, src, dst.size() / 2u);
       emit_2v(UniOpVV(op_info.cvt_op), dst, dst);
       return;
@@ -3593,6 +5143,10 @@ void UniCompiler::emit_vm(UniOpVM op, const OpArray& dst_, const Mem& src_, Alig
     const Vec& dst = dst_[i].as<Vec>();
     mem_size = dst.size();
 
+    // F16 and BF16 loads only read a half of the destination.
+    if (op == UniOpVM::kLoadCvtN_F16ToF32 || op == UniOpVM::kLoadCvtN_BF16ToF32)
+      mem_size /= 2u;
+
     emit_vm(op, dst, src, Alignment(1), idx);
 
     src.add_offset_lo32(int32_t(mem_size));
@@ -3604,6 +5158,11 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const Vec& src_, Alignmen
   ASMJIT_ASSERT(dst_.is_mem());
   ASMJIT_ASSERT(src_.is_vec());
 
+  if (is_sve_vec(src_)) {
+    sve_emit_mv(*this, op, dst_, src_, idx);
+    return;
+  }
+
   Support::maybe_unused(alignment);
 
   Mem dst(dst_);
@@ -3738,6 +5297,14 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const Vec& src_, Alignmen
       return;
     }
 
+    case UniOpMV::kStoreCvtN_F32ToF16:
+    case UniOpMV::kStoreCvtN_F32ToBF16: {
+      Vec tmp = new_similar_reg(src, "@tmp");
+      emit_2v(op == UniOpMV::kStoreCvtN_F32ToF16 ? UniOpVV::kCvtF32ToF16Lo : UniOpVV::kCvtF32ToBF16Lo, tmp, src);
+      cc->str(tmp.d(), dst);
+      return;
+    }
+
     default:
       ASMJIT_NOT_REACHED();
   }
@@ -3758,6 +5325,10 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const OpArray& src_, Alig
   uint32_t overridden_mem_size = op_info.mem_size;
   uint32_t mem_size = overridden_mem_size ? overridden_mem_size : src_[0].as<Vec>().size();
 
+  // F16 and BF16 stores only write a half of the source.
+  if (op == UniOpMV::kStoreCvtN_F32ToF16 || op == UniOpMV::kStoreCvtN_F32ToBF16)
+    mem_size /= 2u;
+
   if (op <= UniOpMV::kStoreN_F64 && mem_size >= 4) {
     bool good_offset = (uint32_t(dst.offset_lo32()) & (mem_size - 1)) == 0u;
 
@@ -3790,6 +5361,343 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const OpArray& src_, Alig
     i++;
   }}
 
+// ujit::UniCompiler - Vector Instructions - Gather & Scatter
+// ==========================================================
+
+// NEON has no gather or scatter instructions, so each element is addressed separately by moving its index to a GP
+// register (32-bit indexes are sign extended) and by using a single lane LD1/ST1, which only supports `[base]`.
+static ASMJIT_NOINLINE void vec_index_address(UniCompiler& uc, const Gp& dst, const Gp& base, const Vec& index, uint32_t element_size, uint32_t idx, uint32_t shift) {
+  BackendCompiler* cc = uc.cc;
+
+  if (element_size == 4u)
+    cc->smov(dst, index.s(idx));
+  else
+    cc->mov(dst, index.d(idx));
+
+  cc->add(dst, base, dst, a64::lsl(shift));
+}
+
+void UniCompiler::emit_gather(UniOpGather op, const Vec& dst_, const Gp& base_, const Vec& index_, uint32_t shift, int32_t disp) {
+  ASMJIT_ASSERT(dst_.size() == index_.size());
+  ASMJIT_ASSERT(shift <= 3u);
+
+  if (is_sve_vec(dst_)) {
+    uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+    Mem m = sve_gather_mem(*this, base_, index_, element_size, shift, disp);
+    cc->emit(sve_ld1_inst_id[Support::ctz(element_size)], sve_typed(dst_, ElementSize(Support::ctz(element_size))), sve_ptrue().z(), m);
+    return;
+  }
+
+  Vec dst(dst_);
+  Vec index(index_);
+
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = dst.size() / element_size;
+  ElementSize sz = element_size == 4u ? ElementSize::k32 : ElementSize::k64;
+
+  Gp base = base_.r64();
+  if (disp) {
+    base = new_gp64("@gather_base");
+    add(base, base_.r64(), Imm(disp));
+  }
+
+  Vec out = is_same_vec(dst, index) ? new_similar_reg(dst, "@gather_dst") : dst;
+  Gp addr = new_gp64("@gather_addr");
+
+  for (uint32_t i = 0; i < element_count; i++) {
+    vec_index_address(*this, addr, base, index, element_size, i, shift);
+
+    if (i == 0u) {
+      // Scalar LDR clears the rest of the register, so the destination doesn't depend on its previous content.
+      cc->ldr(element_size == 4u ? out.s() : out.d(), a64::ptr(addr));
+    }
+    else {
+      Vec lane = out;
+      vec_set_type_and_index(lane, sz, i);
+      cc->ld1(lane, a64::ptr(addr));
+    }
+  }
+
+  if (!is_same_vec(out, dst)) {
+    v_mov(dst, out);
+  }
+}
+
+void UniCompiler::emit_scatter(UniOpScatter op, const Gp& base_, const Vec& index_, uint32_t shift, const Vec& src_, int32_t disp) {
+  ASMJIT_ASSERT(src_.size() == index_.size());
+  ASMJIT_ASSERT(shift <= 3u);
+
+  if (is_sve_vec(src_)) {
+    uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+    Mem m = sve_gather_mem(*this, base_, index_, element_size, shift, disp);
+    cc->emit(sve_st1_inst_id[Support::ctz(element_size)], sve_typed(src_, ElementSize(Support::ctz(element_size))), a64::PReg(sve_ptrue().id()), m);
+    return;
+  }
+
+  Vec src(src_);
+  Vec index(index_);
+
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = src.size() / element_size;
+  ElementSize sz = element_size == 4u ? ElementSize::k32 : ElementSize::k64;
+
+  Gp base = base_.r64();
+  if (disp) {
+    base = new_gp64("@scatter_base");
+    add(base, base_.r64(), Imm(disp));
+  }
+
+  Gp addr = new_gp64("@scatter_addr");
+
+  for (uint32_t i = 0; i < element_count; i++) {
+    vec_index_address(*this, addr, base, index, element_size, i, shift);
+
+    Vec lane = src;
+    vec_set_type_and_index(lane, sz, i);
+    cc->st1(lane, a64::ptr(addr));
+  }
+}
+
+// ujit::UniCompiler - Vector Instructions - Reduce
+// ================================================
+
+// Across vector instructions that reduce a whole 128-bit vector, `kIdNone` means that the reduction is done by
+// rotating the vector by EXT and by combining the halves by the vertical operation.
+static constexpr InstId reduce_inst_id[size_t(UniOpReduce::kMaxValue) + 1] = {
+  Inst::kIdAddv_v,    // UniOpReduce::kAddU32
+  Inst::kIdAddp_v,    // UniOpReduce::kAddU64
+  Inst::kIdFaddp_v,   // UniOpReduce::kAddF32
+  Inst::kIdFaddp_v,   // UniOpReduce::kAddF64
+  Inst::kIdSminv_v,   // UniOpReduce::kMinI8
+  Inst::kIdUminv_v,   // UniOpReduce::kMinU8
+  Inst::kIdSminv_v,   // UniOpReduce::kMinI16
+  Inst::kIdUminv_v,   // UniOpReduce::kMinU16
+  Inst::kIdSminv_v,   // UniOpReduce::kMinI32
+  Inst::kIdUminv_v,   // UniOpReduce::kMinU32
+  Inst::kIdNone,      // UniOpReduce::kMinI64
+  Inst::kIdNone,      // UniOpReduce::kMinU64
+  Inst::kIdFminnmv_v, // UniOpReduce::kMinF32
+  Inst::kIdFminnmp_v, // UniOpReduce::kMinF64
+  Inst::kIdSmaxv_v,   // UniOpReduce::kMaxI8
+  Inst::kIdUmaxv_v,   // UniOpReduce::kMaxU8
+  Inst::kIdSmaxv_v,   // UniOpReduce::kMaxI16
+  Inst::kIdUmaxv_v,   // UniOpReduce::kMaxU16
+  Inst::kIdSmaxv_v,   // UniOpReduce::kMaxI32
+  Inst::kIdUmaxv_v,   // UniOpReduce::kMaxU32
+  Inst::kIdNone,      // UniOpReduce::kMaxI64
+  Inst::kIdNone,      // UniOpReduce::kMaxU64
+  Inst::kIdFmaxnmv_v, // UniOpReduce::kMaxF32
+  Inst::kIdFmaxnmp_v, // UniOpReduce::kMaxF64
+  Inst::kIdNone,      // UniOpReduce::kAndU32
+  Inst::kIdNone,      // UniOpReduce::kAndU64
+  Inst::kIdNone,      // UniOpReduce::kOrU32
+  Inst::kIdNone       // UniOpReduce::kOrU64
+};
+
+void UniCompiler::emit_reduce(UniOpReduce op, const Operand_& dst_, const Vec& src_) {
+  ASMJIT_ASSERT(dst_.is_gp() || dst_.is_vec());
+
+  UniOpReduceInfo info = uni_op_reduce_info_table[size_t(op)];
+  InstId inst_id = reduce_inst_id[size_t(op)];
+
+  Vec src = src_.v128();
+  Vec acc = dst_.is_vec() ? dst_.as<Vec>().v128() : new_vec128("@reduce_acc");
+
+  if (is_sve_vec(src_)) {
+    sve_emit_reduce(*this, op, acc, src_);
+  }
+  else if (inst_id != Inst::kIdNone) {
+    switch (info.element_size) {
+      case 1u: cc->emit(inst_id, acc.b(), src.b16()); break;
+      case 2u: cc->emit(inst_id, acc.h(), src.h8()); break;
+
+      case 4u: {
+        if (op == UniOpReduce::kAddF32) {
+          // There is no FADDV, so pairwise add twice - the second FADDP is the scalar form.
+          Vec tmp = new_vec128("@reduce_tmp");
+          cc->faddp(tmp.s4(), src.s4(), src.s4());
+          cc->faddp(acc.s(), tmp.s2());
+        }
+        else {
+          cc->emit(inst_id, acc.s(), src.s4());
+        }
+        break;
+      }
+
+      default:
+        cc->emit(inst_id, acc.d(), src.d2());
+        break;
+    }
+  }
+  else {
+    Vec cur = src;
+    uint32_t width = 16u;
+
+    while (width > info.element_size) {
+      width >>= 1;
+
+      Vec tmp = new_vec128("@reduce_tmp");
+      Vec out = width == info.element_size ? acc : tmp;
+
+      cc->ext(tmp.b16(), cur.b16(), cur.b16(), width);
+      emit_3v(info.vvv_op, out, cur, tmp);
+      cur = out;
+    }
+  }
+
+  if (dst_.is_gp()) {
+    const Gp& dst = dst_.as<Gp>();
+    switch (info.element_size) {
+      case 1u: s_extract_u8(dst, acc, 0u); break;
+      case 2u: s_extract_u16(dst, acc, 0u); break;
+      case 4u: s_mov_u32(dst, acc); break;
+      default: s_mov_u64(dst, acc); break;
+    }
+  }
+}
+
+void UniCompiler::emit_reduce(UniOpReduce op, const Operand_& dst_, const OpArray& src_) {
+  size_t n = src_.size();
+  ASMJIT_ASSERT(n > 0u);
+
+  UniOpVVV vvv_op = uni_op_reduce_info_table[size_t(op)].vvv_op;
+  Vec acc[OpArray::kMaxSize];
+
+  for (size_t i = 0; i < n; i++) {
+    acc[i] = src_[i].as<Vec>();
+  }
+
+  // Combine registers pairwise to keep the dependency chain short. The first level writes to new registers so the
+  // source registers are never modified.
+  bool is_tmp = false;
+  while (n > 1u) {
+    size_t i = 0;
+    for (; i < n / 2u; i++) {
+      Vec out = is_tmp ? acc[i * 2u] : new_similar_reg(acc[i * 2u], "@reduce_acc");
+      emit_3v(vvv_op, out, acc[i * 2u], acc[i * 2u + 1u]);
+      acc[i] = out;
+    }
+
+    if (n & 1u) {
+      acc[i] = acc[n - 1u];
+    }
+
+    n = (n + 1u) / 2u;
+    is_tmp = true;
+  }
+
+  emit_reduce(op, dst_, acc[0]);
+}
+
+// ujit::UniCompiler - Vector Instructions - Table Lookup
+// ======================================================
+
+// Looks up bytes in a table of `n` 128-bit registers. The first four registers are looked up by TBL, which zeroes
+// bytes of out of range indexes, the remaining registers by TBX, which keeps them, with indexes decreased by 64.
+static void emit_lut_u8_impl(UniCompiler& uc, const Vec& dst_, const Vec* table, uint32_t n, const Operand_& index_) {
+  ASMJIT_ASSERT(n >= 1u && n <= 8u);
+
+  BackendCompiler* cc = uc.cc;
+  Vec dst = dst_.v128();
+  Vec index = as_vec(uc, index_, dst);
+  Vec out = dst;
+
+  bool aliased = is_same_vec(dst, index);
+  for (uint32_t i = 0; i < n; i++) {
+    aliased |= is_same_vec(dst, table[i]);
+
+    // The index must not be one of consecutive table registers.
+    if (is_same_vec(index, table[i])) {
+      Vec tmp = uc.new_similar_reg(dst, "@lut_index");
+      uc.v_mov(tmp, index);
+      index = tmp;
+    }
+  }
+
+  if (aliased) {
+    out = uc.new_similar_reg(dst, "@lut_out");
+  }
+
+  Vec part_index = index;
+  for (uint32_t i = 0; i < n; i += 4u) {
+    uint32_t count = Support::min<uint32_t>(n - i, 4u);
+    Operand ops[6];
+
+    if (i != 0u) {
+      Vec bias = uc.simd_vec_const(&uc.ct().p_4040404040404040, Bcst::kNA, dst);
+      part_index = uc.new_similar_reg(dst, "@lut_part_index");
+      cc->sub(part_index.b16(), index.b16(), bias.b16());
+    }
+
+    ops[0] = out.b16();
+    for (uint32_t j = 0; j < count; j++) {
+      ops[1u + j] = table[i + j].v128().b16();
+    }
+    ops[count + 1u] = part_index.b16();
+
+    cc->emit_op_array(i == 0u ? Inst::kIdTbl_v : Inst::kIdTbx_v, ops, count + 2u);
+  }
+
+  if (aliased) {
+    uc.v_mov(dst, out);
+  }
+}
+
+void UniCompiler::emit_lut_u8(const Vec& dst_, const OpArray& table_, const Operand_& index_) {
+  uint32_t n = uint32_t(table_.size());
+  ASMJIT_ASSERT(n >= 1u && n <= 8u);
+
+  if (is_sve_vec(dst_)) {
+    // Table registers are stored to a stack area that is zero padded to a multiple of the vector length.
+    uint32_t vec_size = 16u << uint32_t(vec_width());
+    uint32_t table_size = Support::align_up(n * 16u, vec_size);
+
+    Gp base = sve_lanes_area(*this);
+    Vec zero = new_similar_reg(dst_.z(), "@zero");
+
+    cc->dup(zero.b(), Imm(0));
+    for (uint32_t i = 0; i < table_size / vec_size; i++) {
+      cc->str(zero, a64::ptr(base, int32_t(i)));
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+      cc->str(table_[i].as<Vec>().q(), a64::ptr(base, int32_t(i * 16u)));
+    }
+
+    sve_emit_lut_u8(*this, dst_, a64::ptr(base), table_size, index_);
+    return;
+  }
+
+  Vec table[8];
+  for (uint32_t i = 0; i < n; i++) {
+    table[i] = table_[i].as<Vec>().v128();
+  }
+
+  emit_lut_u8_impl(*this, dst_, table, n, index_);
+}
+
+void UniCompiler::emit_lut_u8(const Vec& dst_, const Mem& table_, uint32_t table_size, const Operand_& index_) {
+  ASMJIT_ASSERT(Support::is_power_of_2(table_size) && table_size >= 16u && table_size <= 128u);
+
+  if (is_sve_vec(dst_)) {
+    sve_emit_lut_u8(*this, dst_, table_, table_size, index_);
+    return;
+  }
+
+  uint32_t n = table_size / 16u;
+  Vec table[8];
+
+  for (uint32_t i = 0; i < n; i++) {
+    Mem m(table_);
+    m.add_offset(int32_t(i * 16u));
+
+    table[i] = new_vec128("@lut_table");
+    v_loadu128(table[i], m);
+  }
+
+  emit_lut_u8_impl(*this, dst_, table, n, index_);
+}
+
 // ujit::UniCompiler - Vector Instructions - Emit 3V
 // =================================================
 
@@ -3849,6 +5757,11 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
   ASMJIT_ASSERT(dst_.is_vec());
   ASMJIT_ASSERT(src1_.is_vec());
 
+  if (is_sve_vec(dst_)) {
+    sve_emit_3v(*this, op, dst_.as<Vec>(), src1_, src2_);
+    return;
+  }
+
   Vec dst(dst_.as<Vec>());
   Vec src1(src1_.as<Vec>().clone_as(dst));
 
@@ -4147,6 +6060,57 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
       return;
     }
 
+    case UniOpVVV::kAddF16:
+    case UniOpVVV::kSubF16:
+    case UniOpVVV::kMulF16:
+    case UniOpVVV::kDivF16: {
+      if (has_fp16()) {
+        emit_3v_op(*this, inst_id, dst, src1, src2_, op_info.float_mode, op_info.dst_element, op_info.dst_part, op_info.src_element, op_info.src_part, op_info.reverse);
+        return;
+      }
+
+      // Intrinsic - widen both halves to F32, calculate, and narrow - F32 has enough precision to round exactly.
+      Vec src2 = as_vec(*this, src2_, dst);
+      Vec lo = new_similar_reg(dst, "@lo");
+      Vec hi = new_similar_reg(dst, "@hi");
+      Vec tmp = new_similar_reg(dst, "@tmp");
+
+      cc->fcvtl(lo.s4(), src1.h4());
+      cc->fcvtl(tmp.s4(), src2.h4());
+      cc->emit(inst_id, lo.s4(), lo.s4(), tmp.s4());
+      cc->fcvtl2(hi.s4(), src1.h8());
+      cc->fcvtl2(tmp.s4(), src2.h8());
+      cc->emit(inst_id, hi.s4(), hi.s4(), tmp.s4());
+      cc->fcvtn(dst.h4(), lo.s4());
+      cc->fcvtn2(dst.h8(), hi.s4());
+      return;
+    }
+
+    case UniOpVVV::kCompressU32:
+    case UniOpVVV::kCompressU64:
+    case UniOpVVV::kExpandU32:
+    case UniOpVVV::kExpandU64: {
+      // Intrinsic - the mask is converted to a 4-bit lane mask (64-bit lanes produce pairs of bits), which selects
+      // a TBL predicate from a 16 entry table.
+      bool is_expand = op >= UniOpVVV::kExpandU32;
+      Vec src2 = as_vec(*this, src2_, dst);
+      Vec bits = new_similar_reg(dst, "@bits");
+      Vec pred = new_similar_reg(dst, "@pred");
+      Vec lane_bit = simd_vec_const(&ct().p_lane_bit_u32, Bcst::kNA, dst);
+
+      Gp idx = new_gp32("@idx");
+      Gp addr = new_gpz("@addr");
+      Mem m = _get_mem_const(is_expand ? &ct().p_expand_lut_128 : &ct().p_compress_lut_128);
+
+      cc->and_(bits.b16(), src2.b16(), lane_bit.b16());
+      cc->addv(bits.s(), bits.s4());
+      cc->mov(idx, bits.s(0));
+      cc->add(addr, m.base_reg().as<Gp>(), idx.r64(), a64::lsl(4));
+      v_loada128(pred, a64::ptr(addr, m.offset_lo32()));
+      cc->tbl(dst.b16(), src1.b16(), pred.b16());
+      return;
+    }
+
     default: {
       emit_3v_op(*this, inst_id, dst, src1, src2_, op_info.float_mode, op_info.dst_element, op_info.dst_part, op_info.src_element, op_info.src_part, op_info.reverse);
       return;
@@ -4165,6 +6129,11 @@ void UniCompiler::emit_3vi(UniOpVVVI op, const Operand_& dst_, const Operand_& s
   ASMJIT_ASSERT(dst_.is_vec());
   ASMJIT_ASSERT(src1_.is_vec());
 
+  if (is_sve_vec(dst_)) {
+    sve_emit_3vi(*this, op, dst_.as<Vec>(), src1_, src2_, imm);
+    return;
+  }
+
   Vec dst(dst_.as<Vec>());
   Vec src1(src1_.as<Vec>().clone_as(dst));
 
@@ -4248,6 +6217,11 @@ void UniCompiler::emit_4v(UniOpVVVV op, const Operand_& dst_, const Operand_& sr
   ASMJIT_ASSERT(dst_.is_vec());
   ASMJIT_ASSERT(src1_.is_vec());
 
+  if (is_sve_vec(dst_)) {
+    sve_emit_4v(*this, op, dst_.as<Vec>(), src1_, src2_, src3_);
+    return;
+  }
+
   Vec dst(dst_.as<Vec>());
   Vec src1(src1_.as<Vec>().clone_as(dst));
 
@@ -4372,6 +6346,71 @@ void UniCompiler::emit_4v(UniOpVVVV op, const Operand_& dst_, const Operand_& sr
       return;
     }
 
+    case UniOpVVVV::kDotI8_I32:
+    case UniOpVVVV::kDotU8_I32:
+    case UniOpVVVV::kDotU8I8_I32:
+    case UniOpVVVV::kDotI16_I32: {
+      Vec src2 = as_vec(*this, src2_, dst);
+      Vec src3 = as_vec(*this, src3_, dst);
+
+      bool has_native = op == UniOpVVVV::kDotU8I8_I32 ? has_i8mm() : (op != UniOpVVVV::kDotI16_I32 && has_dotprod());
+
+      if (has_native) {
+        Vec acc = dst;
+
+        if (dst.id() != src3.id() && (dst.id() == src1.id() || dst.id() == src2.id()))
+          acc = new_similar_reg(dst, "@acc");
+
+        vec_mov(*this, acc, src3);
+        cc->emit(inst_id, acc.s4(), src1.b16(), src2.b16());
+        vec_mov(*this, dst, acc);
+        return;
+      }
+
+      // Multiply low and high halves to widened products, add adjacent pairs of products to 32-bit elements, and
+      // combine both halves by ADDP. All products and sums of pairs fit 32-bit elements so wrapping matches SDOT.
+      Vec lo = new_similar_reg(dst, "@lo");
+      Vec hi = new_similar_reg(dst, "@hi");
+
+      switch (op) {
+        case UniOpVVVV::kDotI8_I32:
+          cc->smull(lo.h8(), src1.b8(), src2.b8());
+          cc->smull2(hi.h8(), src1.b16(), src2.b16());
+          cc->saddlp(lo.s4(), lo.h8());
+          cc->saddlp(hi.s4(), hi.h8());
+          break;
+
+        case UniOpVVVV::kDotU8_I32:
+          cc->umull(lo.h8(), src1.b8(), src2.b8());
+          cc->umull2(hi.h8(), src1.b16(), src2.b16());
+          cc->uaddlp(lo.s4(), lo.h8());
+          cc->uaddlp(hi.s4(), hi.h8());
+          break;
+
+        case UniOpVVVV::kDotU8I8_I32: {
+          Vec tmp = new_similar_reg(dst, "@tmp");
+          cc->uxtl(lo.h8(), src1.b8());
+          cc->sxtl(tmp.h8(), src2.b8());
+          cc->mul(lo.h8(), lo.h8(), tmp.h8());
+          cc->uxtl2(hi.h8(), src1.b16());
+          cc->sxtl2(tmp.h8(), src2.b16());
+          cc->mul(hi.h8(), hi.h8(), tmp.h8());
+          cc->saddlp(lo.s4(), lo.h8());
+          cc->saddlp(hi.s4(), hi.h8());
+          break;
+        }
+
+        default:
+          cc->smull(lo.s4(), src1.h4(), src2.h4());
+          cc->smull2(hi.s4(), src1.h8(), src2.h8());
+          break;
+      }
+
+      cc->addp(lo.s4(), lo.s4(), hi.s4());
+      cc->add(dst.s4(), lo.s4(), src3.s4());
+      return;
+    }
+
     default: {
       ASMJIT_NOT_REACHED();
     }
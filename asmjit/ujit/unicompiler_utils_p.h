@@ -24,6 +24,65 @@ static ASMJIT_INLINE UniOpDst translate_op(UniOpSrc op, UniOpSrc begin, UniOpDst
   return UniOpDst(uint32_t(target) + offset);
 }
 
+//! Describes how a \ref UniOpReduce operation combines elements.
+struct UniOpReduceInfo {
+  //! Vertical operation that combines two vectors.
+  UniOpVVV vvv_op;
+  //! Size of a single element in bytes.
+  uint8_t element_size;
+  //! Whether the elements are floating point.
+  uint8_t float_op;
+};
+
+static constexpr UniOpReduceInfo uni_op_reduce_info_table[size_t(UniOpReduce::kMaxValue) + 1] = {
+  { UniOpVVV::kAddU32, 4, 0 }, // kAddU32.
+  { UniOpVVV::kAddU64, 8, 0 }, // kAddU64.
+  { UniOpVVV::kAddF32, 4, 1 }, // kAddF32.
+  { UniOpVVV::kAddF64, 8, 1 }, // kAddF64.
+  { UniOpVVV::kMinI8 , 1, 0 }, // kMinI8.
+  { UniOpVVV::kMinU8 , 1, 0 }, // kMinU8.
+  { UniOpVVV::kMinI16, 2, 0 }, // kMinI16.
+  { UniOpVVV::kMinU16, 2, 0 }, // kMinU16.
+  { UniOpVVV::kMinI32, 4, 0 }, // kMinI32.
+  { UniOpVVV::kMinU32, 4, 0 }, // kMinU32.
+  { UniOpVVV::kMinI64, 8, 0 }, // kMinI64.
+  { UniOpVVV::kMinU64, 8, 0 }, // kMinU64.
+  { UniOpVVV::kMinF32, 4, 1 }, // kMinF32.
+  { UniOpVVV::kMinF64, 8, 1 }, // kMinF64.
+  { UniOpVVV::kMaxI8 , 1, 0 }, // kMaxI8.
+  { UniOpVVV::kMaxU8 , 1, 0 }, // kMaxU8.
+  { UniOpVVV::kMaxI16, 2, 0 }, // kMaxI16.
+  { UniOpVVV::kMaxU16, 2, 0 }, // kMaxU16.
+  { UniOpVVV::kMaxI32, 4, 0 }, // kMaxI32.
+  { UniOpVVV::kMaxU32, 4, 0 }, // kMaxU32.
+  { UniOpVVV::kMaxI64, 8, 0 }, // kMaxI64.
+  { UniOpVVV::kMaxU64, 8, 0 }, // kMaxU64.
+  { UniOpVVV::kMaxF32, 4, 1 }, // kMaxF32.
+  { UniOpVVV::kMaxF64, 8, 1 }, // kMaxF64.
+  { UniOpVVV::kAndU32, 4, 0 }, // kAndU32.
+  { UniOpVVV::kAndU64, 8, 0 }, // kAndU64.
+  { UniOpVVV::kOrU32 , 4, 0 }, // kOrU32.
+  { UniOpVVV::kOrU64 , 8, 0 }  // kOrU64.
+};
+
+//! Describes latency and throughput of operations of a \ref LatencyClass.
+struct LatencyInfo {
+  //! Latency in cycles.
+  uint8_t latency;
+  //! Number of operations issued per cycle.
+  uint8_t throughput;
+};
+
+//! Calculates an unroll factor that keeps `info.throughput` operations in flight during `info.latency` cycles, limited
+//! by `reg_count` registers available to the loop body.
+static ASMJIT_INLINE uint32_t unroll_factor_from_latency(LatencyInfo info, uint32_t reg_count, uint32_t regs_per_vec, uint32_t reserved_regs) noexcept {
+  uint32_t available = reg_count > reserved_regs ? reg_count - reserved_regs : 0u;
+  uint32_t reg_limit = available / Support::max<uint32_t>(regs_per_vec, 1u);
+  uint32_t factor = Support::min<uint32_t>(uint32_t(info.latency) * uint32_t(info.throughput), reg_limit, uint32_t(OpArray::kMaxSize));
+
+  return Support::max<uint32_t>(factor, 1u);
+}
+
 //! \}
 
 ASMJIT_END_SUB_NAMESPACE
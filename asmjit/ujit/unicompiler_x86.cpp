@@ -47,6 +47,7 @@ UniCompiler::UniCompiler(BackendCompiler* cc, const CpuFeatures& features, CpuHi
   _fmin_fmax_op_behavior = FMinFMaxOpBehavior::kTernaryLogic;
   _fmadd_op_behavior = FMAddOpBehavior::kNoFMA; // Will be changed by _init_extensions() if supported.
   _float_to_int_outside_range_behavior = FloatToIntOutsideRangeBehavior::kSmallestValue;
+  _float_to_bf16_denormal_behavior = FloatToBF16DenormalBehavior::kFlushToZero;
 
   _init_extensions(features);
 }
@@ -147,6 +148,35 @@ bool UniCompiler::has_masked_access_of(uint32_t data_size) const noexcept {
   }
 }
 
+uint32_t UniCompiler::unroll_factor(uint32_t regs_per_vec, uint32_t reserved_regs, LatencyClass latency_class) const noexcept {
+  // Latencies of common Intel and AMD cores. Most vector ALU operations can be issued on 2 or 3 ports, 512-bit
+  // operations fuse two 256-bit ports on Intel and are split to two halves on older AMD cores.
+  static constexpr LatencyInfo latency_table[size_t(LatencyClass::kMaxValue) + 1] = {
+    { 1 , 3 }, // kIntSimple.
+    { 5 , 2 }, // kIntMul16.
+    { 10, 1 }, // kIntMul32.
+    { 15, 1 }, // kIntMul64.
+    { 4 , 2 }  // kFloatArith.
+  };
+
+  LatencyInfo info = latency_table[size_t(latency_class)];
+
+  if (latency_class == LatencyClass::kIntMul32 && has_cpu_hint(CpuHints::kVecFastIntMul32)) {
+    info = LatencyInfo{3, 2};
+  }
+  else if (latency_class == LatencyClass::kIntMul64 && has_cpu_hint(CpuHints::kVecFastIntMul64)) {
+    info = LatencyInfo{3, 1};
+  }
+
+  if (vec_width() >= VecWidth::k512 && info.throughput > 1u) {
+    info.throughput--;
+  }
+
+  // 32-bit mode only provides 8 vector registers.
+  uint32_t reg_count = is_64bit() ? vec_reg_count() : 8u;
+  return unroll_factor_from_latency(info, reg_count, regs_per_vec, reserved_regs);
+}
+
 // ujit::UniCompiler - Embed
 // =========================
 
@@ -184,6 +214,17 @@ void UniCompiler::unhook_func() noexcept {
   _func_init_hook = nullptr;
 }
 
+// ujit::UniCompiler - Function Invocation
+// =======================================
+
+Error UniCompiler::new_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
+  return cc->new_invoke_node(out, inst_id, o0, signature);
+}
+
+Error UniCompiler::add_invoke_node(Out<InvokeNode*> out, InstId inst_id, const Operand_& o0, const FuncSignature& signature) {
+  return cc->add_invoke_node(out, inst_id, o0, signature);
+}
+
 // ujit::UniCompiler - Constants
 // =============================
 
@@ -2125,7 +2166,21 @@ static constexpr UniOpVInfo opcode_info_2v[size_t(UniOpVV::kMaxValue) + 1] = {
   DEFINE_OP(kIdCvttpd2dq  , 2, kIntrin, kIdVcvttpd2dq     , kIntrin     , 0, 0, kNone, 0, 0x00u, kF64V, k32, 4, kHi), // kCvtTruncF64ToI32Hi.
   DEFINE_OP(kIdCvtps2dq   , 2, kSSE2  , kIdVcvtps2dq      , kAVX        , 0, 0, kNone, 0, 0x00u, kF32V, k32, 4, kNA), // kCvtRoundF32ToI32.
   DEFINE_OP(kIdCvtpd2dq   , 2, kSSE2  , kIdVcvtpd2dq      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF64V, k32, 4, kLo), // kCvtRoundF64ToI32Lo.
-  DEFINE_OP(kIdCvtpd2dq   , 2, kIntrin, kIdVcvtpd2dq      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF64V, k32, 4, kHi)  // kCvtRoundF64ToI32Hi.
+  DEFINE_OP(kIdCvtpd2dq   , 2, kIntrin, kIdVcvtpd2dq      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF64V, k32, 4, kHi), // kCvtRoundF64ToI32Hi.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVcvtph2ps      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k32, 0, kLo), // kCvtF16LoToF32.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVcvtph2ps      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k32, 0, kHi), // kCvtF16HiToF32.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVcvtps2ph      , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k16, 4, kLo), // kCvtF32ToF16Lo.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k32, 0, kLo), // kCvtBF16LoToF32.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k32, 0, kHi), // kCvtBF16HiToF32.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVcvtneps2bf16  , kIntrin     , 0, 0, kNone, 0, 0x00u, kF32V, k16, 4, kLo), // kCvtF32ToBF16Lo.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpopcntb       , kAVX512_BITALG, 0, 0, kNone, 0, 0x00u, kNone, k8 , 0, kNA), // kPopcntU8.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpopcntw       , kAVX512_BITALG, 0, 0, kNone, 0, 0x00u, kNone, k16, 0, kNA), // kPopcntU16.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpopcntd       , kAVX512_VPOPCNTDQ, 0, 0, kNone, 0, 0x00u, kNone, k32, 4, kNA), // kPopcntU32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpopcntq       , kAVX512_VPOPCNTDQ, 0, 0, kNone, 0, 0x00u, kNone, k64, 8, kNA), // kPopcntU64.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVplzcntd       , kAVX512     , 0, 0, kNone, 0, 0x00u, kNone, k32, 4, kNA), // kLzcntU32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdVplzcntq       , kAVX512     , 0, 0, kNone, 0, 0x00u, kNone, k64, 8, kNA), // kLzcntU64.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 4, kNA), // kTzcntU32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k64, 8, kNA)  // kTzcntU64.
 };
 
 static constexpr UniOpVInfo opcode_info_2vs[size_t(UniOpVR::kMaxValue) + 1] = {
@@ -2359,6 +2414,14 @@ static constexpr UniOpVInfo opcode_info_3v[size_t(UniOpVVV::kMaxValue) + 1] = {
   DEFINE_OP(kIdPackssdw   , 2, kSSE2  , kIdVpackssdw      , kAVX        , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kPacksI32_I16.
   DEFINE_OP(kIdPackusdw   , 2, kSSE4_1, kIdVpackusdw      , kAVX        , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kPacksI32_U16.
   DEFINE_OP(kIdPshufb     , 2, kSSSE3 , kIdVpshufb        , kAVX        , 0, 0, kNone, 0, 0x00u, kNone, k8 , 0, kNA), // kSwizzlev_U8.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVaddph         , kAVX512_FP16, 1, 0, kNone, 0, 0x00u, kNone, k16, 2, kNA), // kAddF16.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVsubph         , kAVX512_FP16, 0, 0, kNone, 0, 0x00u, kNone, k16, 2, kNA), // kSubF16.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVmulph         , kAVX512_FP16, 1, 0, kNone, 0, 0x00u, kNone, k16, 2, kNA), // kMulF16.
+  DEFINE_OP(kIdNone       , 2, kIntrin, kIdVdivph         , kAVX512_FP16, 0, 0, kNone, 0, 0x00u, kNone, k16, 2, kNA), // kDivF16.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kCompressU32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k64, 0, kNA), // kCompressU64.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kExpandU32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k64, 0, kNA), // kExpandU64.
 
   DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpermb         , kAVX512_VBMI, 0, 0, kNone, 0, 0x00u, kNone, k8 , 0, kNA), // kPermuteU8.
   DEFINE_OP(kIdNone       , 0, kIntrin, kIdVpermw         , kAVX512     , 0, 0, kNone, 0, 0x00u, kNone, k16, 0, kNA), // kPermuteU16.
@@ -2401,7 +2464,11 @@ static constexpr UniOpVInfo opcode_info_4v[size_t(UniOpVVV::kMaxValue) + 1] = {
   DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x03u, kF32S, k32, 4, kNA), // kNMSubF32S.
   DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x03u, kF64S, k64, 8, kNA), // kNMSubF64S.
   DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x03u, kF32V, k32, 4, kNA), // kNMSubF32.
-  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x03u, kF64V, k64, 8, kNA)  // kNMSubF64.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x03u, kF64V, k64, 8, kNA), // kNMSubF64.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kDotI8_I32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kDotU8_I32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA), // kDotU8I8_I32.
+  DEFINE_OP(kIdNone       , 0, kIntrin, kIdNone           , kIntrin     , 0, 0, kNone, 0, 0x00u, kNone, k32, 0, kNA)  // kDotI16_I32.
 };
 
 #undef DEFINE_OP
@@ -2499,6 +2566,8 @@ static constexpr UniOpVMInfo opcode_info_2vm[size_t(UniOpVM::kMaxValue) + 1] = {
   DEFINE_OP(kIdPmovzxwd      , kIdVpmovzxwd      , kU16ToU32,  0, 1), // kLoadCvtN_U16ToU32.
   DEFINE_OP(kIdPmovsxdq      , kIdVpmovsxdq      , kI32ToI64,  0, 1), // kLoadCvtN_I32ToI64.
   DEFINE_OP(kIdPmovzxdq      , kIdVpmovzxdq      , kU32ToU64,  0, 1), // kLoadCvtN_U32ToU64.
+  DEFINE_OP(kIdNone          , kIdVcvtph2ps      , kNone    ,  0, 1), // kLoadCvtN_F16ToF32.
+  DEFINE_OP(kIdNone          , kIdNone           , kNone    ,  0, 1), // kLoadCvtN_BF16ToF32.
   DEFINE_OP(kIdPinsrb        , kIdVpinsrb        , kNone    ,  1, 0), // kLoadInsertU8.
   DEFINE_OP(kIdPinsrw        , kIdVpinsrw        , kNone    ,  2, 0), // kLoadInsertU16.
   DEFINE_OP(kIdPinsrd        , kIdVpinsrd        , kNone    ,  4, 0), // kLoadInsertU32.
@@ -2590,7 +2659,9 @@ static constexpr UniOpVMInfo opcode_info_2mv[size_t(UniOpMV::kMaxValue) + 1] = {
   */
   DEFINE_OP(kIdPextrw        , kIdVpextrw        , kNone    ,  2, 0), // kStoreExtractU16.
   DEFINE_OP(kIdPextrd        , kIdVpextrd        , kNone    ,  4, 0), // kStoreExtractU32.
-  DEFINE_OP(kIdPextrq        , kIdVpextrq        , kNone    ,  8, 0)  // kStoreExtractU64.
+  DEFINE_OP(kIdPextrq        , kIdVpextrq        , kNone    ,  8, 0), // kStoreExtractU64.
+  DEFINE_OP(kIdNone          , kIdVcvtps2ph      , kNone    ,  0, 1), // kStoreCvtN_F32ToF16.
+  DEFINE_OP(kIdNone          , kIdNone           , kNone    ,  0, 1)  // kStoreCvtN_F32ToBF16.
 };
 
 #undef DEFINE_OP
@@ -3347,6 +3418,387 @@ static ASMJIT_INLINE void emit_4v_t(UniCompiler& uc, UniOpVVVV op, const OpArray
   }
 }
 
+// ujit::UniCompiler - Vector Instructions - F16 & BF16 Conversion Helpers
+// =======================================================================
+
+// dst = msk ? b : a.
+static void select_u32(UniCompiler& uc, const Vec& dst, const Vec& a, const Vec& b, const Vec& msk) {
+  Vec tmp = uc.new_similar_reg(dst, "@sel");
+
+  uc.v_xor_i32(tmp, a, b);
+  uc.v_and_i32(tmp, tmp, msk);
+  uc.v_xor_i32(dst, a, tmp);
+}
+
+// Converts f16 values that were zero extended to 32-bit lanes to f32. The exponent and mantissa are moved to f32
+// position and multiplied by 2^112, which rebiases the exponent and normalizes denormals. Infinities and NaNs get
+// the maximum exponent (the multiplication cannot produce them as f16 exponent is narrower).
+static void f16_bits_to_f32(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  const VecConstTable& ct = uc.ct();
+
+  Vec bits = uc.new_similar_reg(dst, "@f16_bits");
+  Vec sign = uc.new_similar_reg(dst, "@f16_sign");
+  Vec special = uc.new_similar_reg(dst, "@f16_special");
+
+  uc.v_slli_u32(sign, src, 16);
+  uc.v_slli_u32(bits, src, 17);
+  uc.v_srli_u32(bits, bits, 4);
+  uc.v_and_i32(sign, sign, uc.simd_const(&ct.p_8000000080000000, Bcst::k32, dst));
+  uc.v_cmp_gt_i32(special, bits, uc.simd_const(&ct.p_0F7FFFFF0F7FFFFF, Bcst::k32, dst));
+  uc.v_mul_f32(bits, bits, uc.simd_const(&ct.p_7780000077800000, Bcst::k32, dst));
+  uc.v_and_i32(special, special, uc.simd_const(&ct.p_7F8000007F800000, Bcst::k32, dst));
+  uc.v_or_i32(bits, bits, special);
+  uc.v_or_i32(dst, bits, sign);
+}
+
+// Converts f32 values to f16 rounded to nearest even. The result is stored in the low 16 bits of each 32-bit lane,
+// the high 16 bits are undefined.
+static void f32_to_f16_bits(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  const VecConstTable& ct = uc.ct();
+
+  Vec abs = uc.new_similar_reg(dst, "@f32_abs");
+  Vec sign = uc.new_similar_reg(dst, "@f32_sign");
+  Vec res = uc.new_similar_reg(dst, "@f16_res");
+  Vec tmp = uc.new_similar_reg(dst, "@f16_tmp");
+  Vec msk = uc.new_similar_reg(dst, "@f16_msk");
+
+  uc.v_and_i32(abs, src, uc.simd_const(&ct.p_7FFFFFFF7FFFFFFF, Bcst::k32, dst));
+  uc.v_xor_i32(sign, src, abs);
+
+  // Normal range - rebias the exponent and round the mantissa by adding `0xFFF + odd` before shifting it out.
+  uc.v_slli_u32(res, abs, 18);
+  uc.v_srli_u32(res, res, 31);
+  uc.v_add_i32(res, res, abs);
+  uc.v_add_i32(res, res, uc.simd_const(&ct.p_C8000FFFC8000FFF, Bcst::k32, dst));
+  uc.v_srli_u32(res, res, 13);
+
+  // Denormal range - FP addition of 0.5 aligns and rounds the mantissa to f16 denormal precision.
+  uc.v_add_f32(tmp, abs, uc.simd_const(&ct.f32_0_5, Bcst::k32, dst));
+  uc.v_sub_i32(tmp, tmp, uc.simd_const(&ct.f32_0_5, Bcst::k32, dst));
+  uc.v_cmp_lt_i32(msk, abs, uc.simd_const(&ct.p_3880000038800000, Bcst::k32, dst));
+  select_u32(uc, res, res, tmp, msk);
+
+  // Overflow, infinity, and NaN - NaNs keep the high bits of their payload and are quieted.
+  uc.v_slli_u32(tmp, abs, 9);
+  uc.v_srli_u32(tmp, tmp, 22);
+  uc.v_or_i32(tmp, tmp, uc.simd_const(&ct.p_0000020000000200, Bcst::k32, dst));
+  uc.v_cmp_gt_i32(msk, abs, uc.simd_const(&ct.p_7F8000007F800000, Bcst::k32, dst));
+  uc.v_and_i32(tmp, tmp, msk);
+  uc.v_or_i32(tmp, tmp, uc.simd_const(&ct.p_00007C0000007C00, Bcst::k32, dst));
+  uc.v_cmp_gt_i32(msk, abs, uc.simd_const(&ct.p_477FFFFF477FFFFF, Bcst::k32, dst));
+  select_u32(uc, res, res, tmp, msk);
+
+  uc.v_srli_u32(sign, sign, 16);
+  uc.v_or_i32(dst, res, sign);
+}
+
+// Converts f32 values to bf16 rounded to nearest even. Denormals are flushed to zero to match the native conversion
+// (see \ref FloatToBF16DenormalBehavior). The result is stored in the low 16 bits of each 32-bit lane, the high 16
+// bits are zero.
+static void f32_to_bf16_bits(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  const VecConstTable& ct = uc.ct();
+
+  Vec abs = uc.new_similar_reg(dst, "@f32_abs");
+  Vec sign = uc.new_similar_reg(dst, "@f32_sign");
+  Vec res = uc.new_similar_reg(dst, "@bf16_res");
+  Vec tmp = uc.new_similar_reg(dst, "@bf16_tmp");
+  Vec msk = uc.new_similar_reg(dst, "@bf16_msk");
+
+  uc.v_and_i32(abs, src, uc.simd_const(&ct.p_7FFFFFFF7FFFFFFF, Bcst::k32, dst));
+  uc.v_xor_i32(sign, src, abs);
+  uc.v_cmp_gt_i32(msk, abs, uc.simd_const(&ct.p_007FFFFF007FFFFF, Bcst::k32, dst));
+  uc.v_and_i32(abs, abs, msk);
+
+  uc.v_slli_u32(res, abs, 15);
+  uc.v_srli_u32(res, res, 31);
+  uc.v_add_i32(res, res, abs);
+  uc.v_add_i32(res, res, uc.simd_const(&ct.p_00007FFF00007FFF, Bcst::k32, dst));
+
+  uc.v_or_i32(tmp, abs, uc.simd_const(&ct.p_0040000000400000, Bcst::k32, dst));
+  uc.v_cmp_gt_i32(msk, abs, uc.simd_const(&ct.p_7F8000007F800000, Bcst::k32, dst));
+  select_u32(uc, res, res, tmp, msk);
+
+  uc.v_or_i32(res, res, sign);
+  uc.v_srli_u32(dst, res, 16);
+}
+
+// Narrows 32-bit lanes to 16-bit lanes (truncating) into the low half of `dst`, the high half is zeroed.
+static void narrow_u32_to_u16_lo(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  if (uc.has_avx512()) {
+    Vec dst_half = dst;
+    dst_half.set_signature(signature_of_xmm_ymm_zmm[dst.size() >> 6]);
+    uc.cc->vpmovdw(dst_half, src);
+    return;
+  }
+
+  // Sign extend the low 16 bits so signed saturation preserves them.
+  Vec tmp = uc.new_vec128("@tmp");
+  uc.v_slli_u32(dst, src, 16);
+  uc.v_srai_i32(dst, dst, 16);
+
+  if (dst.is_vec256()) {
+    uc.v_extract_v128(tmp, dst, 1);
+    uc.v_packs_i32_i16(dst.xmm(), dst.xmm(), tmp);
+  }
+  else {
+    uc.v_zero_i(tmp);
+    uc.v_packs_i32_i16(dst, dst, tmp);
+  }
+}
+
+// Emulates f16 arithmetic by converting both halves of the operands to f32. The result is exact as f32 has more
+// than twice the precision of f16, so rounding the f32 result to f16 never suffers from double rounding.
+static void f16_arith_via_f32(UniCompiler& uc, UniOpVVV op, const Vec& dst, const Vec& src1, const Operand_& src2_) {
+  static constexpr UniOpVVV f32_ops[] = {
+    UniOpVVV::kAddF32,
+    UniOpVVV::kSubF32,
+    UniOpVVV::kMulF32,
+    UniOpVVV::kDivF32
+  };
+
+  UniOpVVV f32_op = f32_ops[size_t(op) - size_t(UniOpVVV::kAddF16)];
+
+  Vec src2;
+  if (src2_.is_mem()) {
+    src2 = uc.new_similar_reg(dst, "@src2");
+    uc.v_load_iany(src2, src2_.as<Mem>(), dst.size(), Alignment(1));
+  }
+  else {
+    src2 = src2_.as<Vec>().clone_as(dst);
+  }
+
+  Vec a_lo = uc.new_similar_reg(dst, "@a_lo");
+  Vec a_hi = uc.new_similar_reg(dst, "@a_hi");
+  Vec b_lo = uc.new_similar_reg(dst, "@b_lo");
+  Vec b_hi = uc.new_similar_reg(dst, "@b_hi");
+
+  uc.v_cvt_f16_lo_to_f32(a_lo, src1);
+  uc.v_cvt_f16_hi_to_f32(a_hi, src1);
+  uc.v_cvt_f16_lo_to_f32(b_lo, src2);
+  uc.v_cvt_f16_hi_to_f32(b_hi, src2);
+  uc.emit_3v(f32_op, a_lo, a_lo, b_lo);
+  uc.emit_3v(f32_op, a_hi, a_hi, b_hi);
+  uc.v_cvt_f32_to_f16_lo(a_lo, a_lo);
+  uc.v_cvt_f32_to_f16_lo(a_hi, a_hi);
+
+  if (dst.is_vec512())
+    uc.v_insert_v256_u32(dst, a_lo, a_hi.ymm(), 1);
+  else if (dst.is_vec256())
+    uc.v_insert_v128_u32(dst, a_lo, a_hi.xmm(), 1);
+  else
+    uc.v_interleave_lo_u64(dst, a_lo, a_hi);
+}
+
+// ujit::UniCompiler - Vector Instructions - Bit Counting & Compress Helpers
+// =========================================================================
+
+static Vec vec_from_op(UniCompiler& uc, const Operand_& op, const Vec& ref, const char* name) {
+  if (op.is_vec())
+    return op.as<Vec>().clone_as(ref);
+
+  Vec vec = uc.new_similar_reg(ref, name);
+  uc.v_load_iany(vec, op.as<Mem>(), ref.size(), Alignment(1));
+  return vec;
+}
+
+// Calculates a population count of each byte. Uses a nibble lookup table if PSHUFB is available, otherwise bits
+// are summed in 2-bit and 4-bit fields.
+static void popcnt_bytes(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  const VecConstTable& ct = uc.ct();
+
+  Vec lo = uc.new_similar_reg(dst, "@lo");
+  Vec hi = uc.new_similar_reg(dst, "@hi");
+  Operand m0F = uc.simd_const(&ct.p_0F0F0F0F0F0F0F0F, Bcst::kNA, dst);
+
+  if (uc.has_ssse3()) {
+    Vec lut = uc.simd_vec_const(&ct.p_popcnt_nibble_lut, Bcst::kNA, dst);
+
+    uc.v_srli_u16(hi, src, 4);
+    uc.v_and_i32(lo, src, m0F);
+    uc.v_and_i32(hi, hi, m0F);
+    uc.v_swizzlev_u8(lo, lut, lo);
+    uc.v_swizzlev_u8(hi, lut, hi);
+    uc.v_add_u8(dst, lo, hi);
+  }
+  else {
+    Operand m33 = uc.simd_const(&ct.p_3333333333333333, Bcst::kNA, dst);
+
+    uc.v_srli_u16(hi, src, 1);
+    uc.v_and_i32(hi, hi, uc.simd_const(&ct.p_5555555555555555, Bcst::kNA, dst));
+    uc.v_sub_u8(lo, src, hi);
+
+    uc.v_srli_u16(hi, lo, 2);
+    uc.v_and_i32(lo, lo, m33);
+    uc.v_and_i32(hi, hi, m33);
+    uc.v_add_u8(lo, lo, hi);
+
+    uc.v_srli_u16(hi, lo, 4);
+    uc.v_add_u8(lo, lo, hi);
+    uc.v_and_i32(dst, lo, m0F);
+  }
+}
+
+// Calculates a population count of 8-bit, 16-bit, 32-bit, or 64-bit elements by summing byte counts - 16-bit and
+// 32-bit sums are calculated by adding a shifted copy and 64-bit sums by PSADBW.
+static void popcnt_via_bytes(UniCompiler& uc, UniOpVV op, const Vec& dst, const Operand_& src_) {
+  Vec src = vec_from_op(uc, src_, dst, "@src");
+  popcnt_bytes(uc, dst, src);
+
+  if (op == UniOpVV::kPopcntU64) {
+    Vec zero = uc.simd_vec_const(&uc.ct().p_0000000000000000, Bcst::kNA, dst);
+    if (uc.has_avx())
+      uc.cc->vpsadbw(dst, dst, zero);
+    else
+      uc.cc->psadbw(dst, zero);
+    return;
+  }
+
+  Vec tmp = uc.new_similar_reg(dst, "@tmp");
+
+  if (op >= UniOpVV::kPopcntU16) {
+    uc.v_slli_u16(tmp, dst, 8);
+    uc.v_add_u8(dst, dst, tmp);
+    uc.v_srli_u16(dst, dst, 8);
+  }
+
+  if (op >= UniOpVV::kPopcntU32) {
+    uc.v_slli_u32(tmp, dst, 16);
+    uc.v_add_u16(dst, dst, tmp);
+    uc.v_srli_u32(dst, dst, 16);
+  }
+}
+
+// Calculates a biased f32 exponent of the most significant bit of each 32-bit element (0 if the element is zero).
+// Bits below the most significant bit are cleared first so the conversion to f32 is exact - the result is only
+// correct for elements that have at most a single bit set or that are not negative.
+static void msb_exponent_u32(UniCompiler& uc, const Vec& dst, const Vec& src) {
+  Vec tmp = uc.new_similar_reg(dst, "@tmp");
+
+  uc.v_srli_u32(tmp, src, 1);
+  uc.v_andn_u32(dst, tmp, src);
+  uc.v_cvt_i32_to_f32(dst, dst);
+  uc.v_slli_u32(dst, dst, 1);
+  uc.v_srli_u32(dst, dst, 24);
+}
+
+// Calculates a leading zero count of 32-bit or 64-bit elements by converting the most significant bit to f32.
+// 64-bit counts combine counts of 32-bit halves - the low half only contributes when the high half is zero.
+static void lzcnt_via_f32(UniCompiler& uc, UniOpVV op, const Vec& dst, const Operand_& src_) {
+  const VecConstTable& ct = uc.ct();
+
+  Vec src = vec_from_op(uc, src_, dst, "@src");
+  Vec sign = uc.new_similar_reg(dst, "@sign");
+  Operand c32 = uc.simd_const(&ct.p_0000002000000020, Bcst::kNA, dst);
+
+  // Elements having the most significant bit set have no leading zeros, which also handles elements that would be
+  // converted to negative f32 values.
+  uc.v_srai_i32(sign, src, 31);
+  msb_exponent_u32(uc, dst, src);
+  uc.v_sub_u32(dst, uc.simd_vec_const(&ct.p_0000009E0000009E, Bcst::kNA, dst), dst);
+  uc.v_min_i16(dst, dst, c32);
+  uc.v_andn_u32(dst, sign, dst);
+
+  if (op == UniOpVV::kLzcntU64) {
+    Vec hi = uc.new_similar_reg(dst, "@hi");
+    Vec msk = uc.new_similar_reg(dst, "@msk");
+
+    uc.v_srli_u64(hi, dst, 32);
+    uc.v_cmp_eq_u32(msk, hi, c32);
+    uc.v_and_i32(dst, dst, msk);
+    uc.v_add_u64(dst, dst, hi);
+  }
+}
+
+// Calculates a trailing zero count of 32-bit or 64-bit elements as a population count of `~x & (x - 1)`, which is
+// a mask of trailing zeros. Without VPOPCNT[D|Q] the count is derived from the leading zero count of the mask or
+// from its f32 exponent.
+static void tzcnt_via_mask(UniCompiler& uc, UniOpVV op, const Vec& dst, const Operand_& src_) {
+  const VecConstTable& ct = uc.ct();
+  bool is_64 = op == UniOpVV::kTzcntU64;
+
+  Vec src = vec_from_op(uc, src_, dst, "@src");
+  Vec msk = uc.new_similar_reg(dst, "@msk");
+
+  if (is_64)
+    uc.v_add_u64(msk, src, uc.simd_const(&ct.p_FFFFFFFFFFFFFFFF, Bcst::kNA, dst));
+  else
+    uc.v_add_u32(msk, src, uc.simd_const(&ct.p_FFFFFFFFFFFFFFFF, Bcst::kNA, dst));
+  uc.v_andn_u32(msk, src, msk);
+
+  if (uc.has_avx512_vpopcntdq() || (is_64 && !uc.has_avx512())) {
+    uc.emit_2v(is_64 ? UniOpVV::kPopcntU64 : UniOpVV::kPopcntU32, dst, msk);
+  }
+  else if (uc.has_avx512()) {
+    uc.emit_2v(is_64 ? UniOpVV::kLzcntU64 : UniOpVV::kLzcntU32, msk, msk);
+    if (is_64)
+      uc.v_sub_u64(dst, uc.simd_vec_const(&ct.p_0000000000000040, Bcst::kNA, dst), msk);
+    else
+      uc.v_sub_u32(dst, uc.simd_vec_const(&ct.p_0000002000000020, Bcst::kNA, dst), msk);
+  }
+  else {
+    // The mask is `2^n - 1`, thus its most significant bit has exponent `n + 126`, or 0 if `n` is zero.
+    msb_exponent_u32(uc, dst, msk);
+    uc.v_subs_u16(dst, dst, uc.simd_const(&ct.p_0000007E0000007E, Bcst::kNA, dst));
+  }
+}
+
+// Compresses or expands 32-bit or 64-bit elements selected by a lane mask. AVX-512 uses VPCOMPRESS[D|Q] and
+// VPEXPAND[D|Q], other targets convert the mask to a scalar and use it to index a table of permutation predicates.
+// 64-bit lanes use the same tables as 32-bit lanes as MOVMSKPS of a 64-bit lane mask always selects lane pairs.
+static void compress_expand(UniCompiler& uc, UniOpVVV op, const Vec& dst, const Vec& src, const Operand_& msk_) {
+  BackendCompiler* cc = uc.cc;
+  const VecConstTable& ct = uc.ct();
+
+  bool is_64 = op == UniOpVVV::kCompressU64 || op == UniOpVVV::kExpandU64;
+  bool is_expand = op >= UniOpVVV::kExpandU32;
+
+  Vec msk = vec_from_op(uc, msk_, dst, "@msk");
+
+  if (uc.has_avx512()) {
+    static constexpr InstId avx512_inst_table[] = {
+      Inst::kIdVpcompressd,
+      Inst::kIdVpcompressq,
+      Inst::kIdVpexpandd,
+      Inst::kIdVpexpandq
+    };
+
+    x86::KReg k = cc->new_kq("@k");
+    cc->emit(is_64 ? Inst::kIdVpmovq2m : Inst::kIdVpmovd2m, k, msk);
+    cc->k(k).z().emit(avx512_inst_table[size_t(op) - size_t(UniOpVVV::kCompressU32)], dst, src);
+    return;
+  }
+
+  Gp idx = uc.new_gpz("@idx");
+  Vec pred = uc.new_similar_reg(dst, "@pred");
+
+  if (dst.is_vec256()) {
+    Vec zero_msk = uc.new_similar_reg(dst, "@zero_msk");
+    Mem m = uc._get_mem_const(is_expand ? &ct.p_expand_lut_256 : &ct.p_compress_lut_256);
+
+    cc->vmovmskps(idx.r32(), msk);
+    m.set_index(idx, 2u);
+    m.set_size(4);
+
+    // Unpack 8 nibbles to 32-bit lanes - bits [2:0] are used by VPERMD and bit 3 marks lanes that are zeroed.
+    cc->vpbroadcastd(pred, m);
+    cc->vpsrlvd(pred, pred, uc._get_mem_const(&ct.p_compress_shift_256));
+    cc->vpslld(zero_msk, pred, 28);
+    cc->vpsrad(zero_msk, zero_msk, 31);
+    cc->vpermd(dst, pred, src);
+    cc->vpandn(dst, zero_msk, dst);
+  }
+  else {
+    Mem m = uc._get_mem_const(is_expand ? &ct.p_expand_lut_128 : &ct.p_compress_lut_128);
+
+    cc->emit(uc.has_avx() ? Inst::kIdVmovmskps : Inst::kIdMovmskps, idx.r32(), msk);
+    cc->shl(idx.r32(), 4);
+    m.set_index(idx);
+
+    uc.v_loada128(pred, m);
+    uc.v_swizzlev_u8(dst, src, pred);
+  }
+}
+
 // ujit::UniCompiler - Vector Instructions - Emit 2V
 // =================================================
 
@@ -3929,6 +4381,103 @@ void UniCompiler::emit_2v(UniOpVV op, const Operand_& dst_, const Operand_& src_
         return;
       }
 
+      case UniOpVV::kCvtF16LoToF32:
+      case UniOpVV::kCvtF16HiToF32: {
+        if (has_f16c() || has_avx512()) {
+          uint32_t w = dst.size() >> 6;
+
+          if (src.is_reg()) {
+            if (op == UniOpVV::kCvtF16HiToF32) {
+              Vec tmp = new_vec_with_width(VecWidth(w), "@tmp");
+              if (dst.is_vec512())
+                cc->vextracti32x8(tmp, src.as<Vec>().zmm(), 1u);
+              else if (dst.is_vec256())
+                cc->vextracti128(tmp, src.as<Vec>().ymm(), 1u);
+              else
+                cc->vpshufd(tmp, src.as<Vec>().xmm(), x86::shuffle_imm(3, 2, 3, 2));
+              src = tmp;
+            }
+            src.set_signature(signature_of_xmm_ymm_zmm[w]);
+          }
+          else {
+            src.as<Mem>().set_size(dst.size() / 2u);
+            if (op == UniOpVV::kCvtF16HiToF32)
+              src.as<Mem>().add_offset(dst.size() / 2u);
+          }
+
+          cc->emit(inst_id, dst, src);
+          return;
+        }
+
+        emit_2v(op == UniOpVV::kCvtF16LoToF32 ? UniOpVV::kCvtU16LoToU32 : UniOpVV::kCvtU16HiToU32, dst, src);
+        f16_bits_to_f32(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kCvtF32ToF16Lo: {
+        avx_make_vec(*this, src, dst, "@src");
+
+        if (has_f16c() || has_avx512()) {
+          Vec dst_half = dst;
+          dst_half.set_signature(signature_of_xmm_ymm_zmm[dst.size() >> 6]);
+          cc->emit(inst_id, dst_half, src, Imm(0));
+          return;
+        }
+
+        f32_to_f16_bits(*this, dst, src.as<Vec>());
+        narrow_u32_to_u16_lo(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kCvtBF16LoToF32:
+      case UniOpVV::kCvtBF16HiToF32: {
+        emit_2v(op == UniOpVV::kCvtBF16LoToF32 ? UniOpVV::kCvtU16LoToU32 : UniOpVV::kCvtU16HiToU32, dst, src);
+        v_slli_u32(dst, dst, 16);
+        return;
+      }
+
+      case UniOpVV::kCvtF32ToBF16Lo: {
+        // VEX encoded VCVTNEPS2BF16 (AVX_NE_CONVERT) cannot encode registers above 15, so it's only used without AVX-512.
+        if (has_avx512_bf16() || (has_avx_ne_convert() && !has_avx512())) {
+          Vec dst_half = dst;
+          dst_half.set_signature(signature_of_xmm_ymm_zmm[dst.size() >> 6]);
+
+          if (src.is_mem())
+            src.as<Mem>().set_size(dst.size());
+
+          if (!has_avx512_bf16())
+            cc->vex();
+
+          cc->emit(inst_id, dst_half, src);
+          return;
+        }
+
+        avx_make_vec(*this, src, dst, "@src");
+        f32_to_bf16_bits(*this, dst, src.as<Vec>());
+        narrow_u32_to_u16_lo(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kPopcntU8:
+      case UniOpVV::kPopcntU16:
+      case UniOpVV::kPopcntU32:
+      case UniOpVV::kPopcntU64: {
+        popcnt_via_bytes(*this, op, dst, src);
+        return;
+      }
+
+      case UniOpVV::kLzcntU32:
+      case UniOpVV::kLzcntU64: {
+        lzcnt_via_f32(*this, op, dst, src);
+        return;
+      }
+
+      case UniOpVV::kTzcntU32:
+      case UniOpVV::kTzcntU64: {
+        tzcnt_via_mask(*this, op, dst, src);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -4428,6 +4977,54 @@ void UniCompiler::emit_2v(UniOpVV op, const Operand_& dst_, const Operand_& src_
         return;
       }
 
+      case UniOpVV::kCvtF16LoToF32:
+      case UniOpVV::kCvtF16HiToF32: {
+        emit_2v(op == UniOpVV::kCvtF16LoToF32 ? UniOpVV::kCvtU16LoToU32 : UniOpVV::kCvtU16HiToU32, dst, src);
+        f16_bits_to_f32(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kCvtF32ToF16Lo: {
+        sse_make_vec(*this, src, "@src");
+        f32_to_f16_bits(*this, dst, src.as<Vec>());
+        narrow_u32_to_u16_lo(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kCvtBF16LoToF32:
+      case UniOpVV::kCvtBF16HiToF32: {
+        emit_2v(op == UniOpVV::kCvtBF16LoToF32 ? UniOpVV::kCvtU16LoToU32 : UniOpVV::kCvtU16HiToU32, dst, src);
+        v_slli_u32(dst, dst, 16);
+        return;
+      }
+
+      case UniOpVV::kCvtF32ToBF16Lo: {
+        sse_make_vec(*this, src, "@src");
+        f32_to_bf16_bits(*this, dst, src.as<Vec>());
+        narrow_u32_to_u16_lo(*this, dst, dst);
+        return;
+      }
+
+      case UniOpVV::kPopcntU8:
+      case UniOpVV::kPopcntU16:
+      case UniOpVV::kPopcntU32:
+      case UniOpVV::kPopcntU64: {
+        popcnt_via_bytes(*this, op, dst, src);
+        return;
+      }
+
+      case UniOpVV::kLzcntU32:
+      case UniOpVV::kLzcntU64: {
+        lzcnt_via_f32(*this, op, dst, src);
+        return;
+      }
+
+      case UniOpVV::kTzcntU32:
+      case UniOpVV::kTzcntU64: {
+        tzcnt_via_mask(*this, op, dst, src);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -5118,9 +5715,10 @@ void UniCompiler::emit_vm(UniOpVM op, const Vec& dst_, const Mem& src_, Alignmen
       case UniOpVM::kLoad16_U16:
         if (!has_avx512_fp16()) {
           dst = dst.xmm();
-          src.set_size(1);
+          src.set_size(2);
           avx_zero(*this, dst);
           cc->vpinsrw(dst, dst, src, 0);
+          return;
         }
         [[fallthrough]];
 
@@ -5237,6 +5835,13 @@ void UniCompiler::emit_vm(UniOpVM op, const Vec& dst_, const Mem& src_, Alignmen
         return;
       }
 
+      case UniOpVM::kLoadCvtN_F16ToF32:
+      case UniOpVM::kLoadCvtN_BF16ToF32: {
+        src.set_size(dst.size() / 2u);
+        emit_2v(op == UniOpVM::kLoadCvtN_F16ToF32 ? UniOpVV::kCvtF16LoToF32 : UniOpVV::kCvtBF16LoToF32, dst, src);
+        return;
+      }
+
       case UniOpVM::kLoadInsertU8:
       case UniOpVM::kLoadInsertU16:
       case UniOpVM::kLoadInsertU32:
@@ -5399,6 +6004,13 @@ void UniCompiler::emit_vm(UniOpVM op, const Vec& dst_, const Mem& src_, Alignmen
         return;
       }
 
+      case UniOpVM::kLoadCvtN_F16ToF32:
+      case UniOpVM::kLoadCvtN_BF16ToF32: {
+        src.set_size(dst.size() / 2u);
+        emit_2v(op == UniOpVM::kLoadCvtN_F16ToF32 ? UniOpVV::kCvtF16LoToF32 : UniOpVV::kCvtBF16LoToF32, dst, src);
+        return;
+      }
+
       case UniOpVM::kLoadInsertU16: {
         cc->emit(op_info.sse_inst_id, dst, dst, idx);
         return;
@@ -5596,6 +6208,21 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const Vec& src_, Alignmen
         return;
       }
 
+      case UniOpMV::kStoreCvtN_F32ToF16:
+        if (has_f16c() || has_avx512()) {
+          dst.set_size(src.size() / 2u);
+          cc->emit(op_info.avx_inst_id, dst, src, Imm(0));
+          return;
+        }
+        [[fallthrough]];
+
+      case UniOpMV::kStoreCvtN_F32ToBF16: {
+        Vec tmp = new_similar_reg(src, "@tmp");
+        emit_2v(op == UniOpMV::kStoreCvtN_F32ToF16 ? UniOpVV::kCvtF32ToF16Lo : UniOpVV::kCvtF32ToBF16Lo, tmp, src);
+        v_store_iany(dst, tmp, src.size() / 2u, alignment);
+        return;
+      }
+
       /*
       case UniOpMV::kStoreCvtz64_U16ToU8:
       case UniOpMV::kStoreCvtz64_U32ToU16:
@@ -5730,6 +6357,14 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const Vec& src_, Alignmen
 
       }
 
+      case UniOpMV::kStoreCvtN_F32ToF16:
+      case UniOpMV::kStoreCvtN_F32ToBF16: {
+        Vec tmp = new_similar_reg(src, "@tmp");
+        emit_2v(op == UniOpMV::kStoreCvtN_F32ToF16 ? UniOpVV::kCvtF32ToF16Lo : UniOpVV::kCvtF32ToBF16Lo, tmp, src);
+        v_store_iany(dst, tmp, 8u, alignment);
+        return;
+      }
+
       /*
       case UniOpMV::kStoreCvtz64_U16ToU8:
       case UniOpMV::kStoreCvtz64_U32ToU16:
@@ -5854,7 +6489,7 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const OpArray& src_, Alig
       ASMJIT_ASSERT(src_[i].is_reg() && src_[i].is_vec());
 
       const Vec& src = src_[i].as<Vec>();
-      mem_size = src.size();
+      mem_size = src.size() >> op_info.mem_size_shift;
 
       emit_mv(op, dst, src, uint32_t(alignment) > 0u ? alignment : Alignment(mem_size));
       dst.add_offset_lo32(int32_t(mem_size));
@@ -5875,6 +6510,459 @@ void UniCompiler::emit_mv(UniOpMV op, const Mem& dst_, const OpArray& src_, Alig
   }
 }
 
+// ujit::UniCompiler - Vector Instructions - Gather & Scatter
+// ==========================================================
+
+static constexpr InstId gather_inst_id[size_t(UniOpGather::kMaxValue) + 1] = {
+  Inst::kIdVpgatherdd, // UniOpGather::kGatherU32
+  Inst::kIdVpgatherqq, // UniOpGather::kGatherU64
+  Inst::kIdVgatherdps, // UniOpGather::kGatherF32
+  Inst::kIdVgatherqpd  // UniOpGather::kGatherF64
+};
+
+static constexpr InstId scatter_inst_id[size_t(UniOpScatter::kMaxValue) + 1] = {
+  Inst::kIdVpscatterdd, // UniOpScatter::kScatterU32
+  Inst::kIdVpscatterqq, // UniOpScatter::kScatterU64
+  Inst::kIdVscatterdps, // UniOpScatter::kScatterF32
+  Inst::kIdVscatterqpd  // UniOpScatter::kScatterF64
+};
+
+// Extracts an index at `idx` (having `index_size`) from a 128-bit vector to a GP register that can be used as an
+// address index - 32-bit indexes are sign extended, 64-bit indexes are truncated to 32 bits in 32-bit mode.
+static ASMJIT_NOINLINE void UniCompiler_extract_index(UniCompiler& uc, const Gp& dst, const Vec& src, uint32_t index_size, uint32_t idx) {
+  BackendCompiler* cc = uc.cc;
+  bool has_pextr = uc.has_avx() || uc.has_sse4_1();
+
+  if (index_size == 8u && uc.is_64bit()) {
+    if (idx == 0u) {
+      cc->emit(uc.has_avx() ? Inst::kIdVmovq : Inst::kIdMovq, dst, src);
+    }
+    else if (has_pextr) {
+      cc->emit(uc.has_avx() ? Inst::kIdVpextrq : Inst::kIdPextrq, dst, src, idx);
+    }
+    else {
+      Vec tmp = uc.new_vec128("@idx_tmp");
+      cc->pshufd(tmp, src, x86::shuffle_imm(3, 2, 3, 2));
+      cc->movq(dst, tmp);
+    }
+    return;
+  }
+
+  if (index_size == 8u) {
+    idx *= 2u;
+  }
+
+  Gp dst32 = dst.r32();
+  if (idx == 0u) {
+    cc->emit(uc.has_avx() ? Inst::kIdVmovd : Inst::kIdMovd, dst32, src);
+  }
+  else if (has_pextr) {
+    cc->emit(uc.has_avx() ? Inst::kIdVpextrd : Inst::kIdPextrd, dst32, src, idx);
+  }
+  else {
+    Vec tmp = uc.new_vec128("@idx_tmp");
+    cc->pshufd(tmp, src, x86::shuffle_imm(idx, idx, idx, idx));
+    cc->movd(dst32, tmp);
+  }
+
+  if (index_size == 4u && uc.is_64bit()) {
+    cc->movsxd(dst, dst32);
+  }
+}
+
+void UniCompiler::emit_gather(UniOpGather op, const Vec& dst_, const Gp& base, const Vec& index_, uint32_t shift, int32_t disp) {
+  ASMJIT_ASSERT(dst_.size() == index_.size());
+  ASMJIT_ASSERT(shift <= 3u);
+
+  Vec dst(dst_);
+  Vec index(index_);
+
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = dst.size() / element_size;
+
+  // All hardware gathers require the destination to be different than the index.
+  Vec out = is_same_vec(dst, index) ? new_similar_reg(dst, "@gather_dst") : dst;
+
+  if (has_cpu_hint(CpuHints::kVecFastGather) && (has_avx512() || (has_avx2() && !dst.is_vec512()))) {
+    // Hardware Gather (AVX2 & AVX-512)
+    // --------------------------------
+
+    InstId inst_id = gather_inst_id[size_t(op)];
+    Mem m = x86::ptr(base, index, shift, disp);
+
+    // The destination is only partially written in case of a fault, so it's always an input - zero it to break the
+    // dependency on its previous content. The mask is consumed by the instruction, so it must be recreated.
+    avx_zero(*this, out);
+
+    if (has_avx512()) {
+      x86::KReg k_mask = cc->new_kq("@gather_mask");
+      cc->kmovq(k_mask, k_const(Support::lsb_mask<uint64_t>(element_count)));
+      cc->k(k_mask).emit(inst_id, out, m);
+    }
+    else {
+      Vec v_mask = new_similar_reg(dst, "@gather_mask");
+      avx_ones(*this, v_mask);
+      cc->emit(inst_id, out, m, v_mask);
+    }
+  }
+  else {
+    // Scalar Gather (SSE2+)
+    // ---------------------
+
+    UniOpVM load_op = element_size == 4u ? UniOpVM::kLoad32_U32 : UniOpVM::kLoad64_U64;
+    UniOpVM insert_op = element_size == 4u ? UniOpVM::kLoadInsertU32 : UniOpVM::kLoadInsertU64;
+
+    uint32_t part_count = dst.size() / 16u;
+    uint32_t part_element_count = 16u / element_size;
+
+    Gp idx = new_gpz("@gather_idx");
+
+    for (uint32_t part = 0; part < part_count; part++) {
+      Vec index_part = index.xmm();
+      Vec out_part = out.xmm();
+
+      if (part != 0u) {
+        index_part = new_vec128("@gather_index_part");
+        out_part = new_vec128("@gather_out_part");
+        emit_2vi(UniOpVVI::kExtractV128_I32, index_part, index, part);
+      }
+
+      for (uint32_t i = 0; i < part_element_count; i++) {
+        UniCompiler_extract_index(*this, idx, index_part, element_size, i);
+        Mem m = mem_ptr(base, idx, shift, disp);
+
+        if (i == 0u)
+          emit_vm(load_op, out_part, m, Alignment(1));
+        else
+          emit_vm(insert_op, out_part, m, Alignment(1), i);
+      }
+
+      if (part != 0u) {
+        emit_3vi(UniOpVVVI::kInsertV128_U32, out, out, out_part, part);
+      }
+    }
+  }
+
+  if (!is_same_vec(out, dst)) {
+    v_mov(dst, out);
+  }
+}
+
+void UniCompiler::emit_scatter(UniOpScatter op, const Gp& base, const Vec& index_, uint32_t shift, const Vec& src_, int32_t disp) {
+  ASMJIT_ASSERT(src_.size() == index_.size());
+  ASMJIT_ASSERT(shift <= 3u);
+
+  Vec src(src_);
+  Vec index(index_);
+
+  uint32_t element_size = (uint32_t(op) & 1u) ? 8u : 4u;
+  uint32_t element_count = src.size() / element_size;
+
+  if (has_cpu_hint(CpuHints::kVecFastScatter) && has_avx512()) {
+    // Hardware Scatter (AVX-512)
+    // --------------------------
+
+    InstId inst_id = scatter_inst_id[size_t(op)];
+    Mem m = x86::ptr(base, index, shift, disp);
+
+    x86::KReg k_mask = cc->new_kq("@scatter_mask");
+    cc->kmovq(k_mask, k_const(Support::lsb_mask<uint64_t>(element_count)));
+    cc->k(k_mask).emit(inst_id, m, src);
+    return;
+  }
+
+  // Scalar Scatter (SSE2+)
+  // ----------------------
+
+  UniOpMV store_op = element_size == 4u ? UniOpMV::kStoreExtractU32 : UniOpMV::kStoreExtractU64;
+
+  uint32_t part_count = src.size() / 16u;
+  uint32_t part_element_count = 16u / element_size;
+
+  Gp idx = new_gpz("@scatter_idx");
+
+  for (uint32_t part = 0; part < part_count; part++) {
+    Vec index_part = index.xmm();
+    Vec src_part = src.xmm();
+
+    if (part != 0u) {
+      index_part = new_vec128("@scatter_index_part");
+      src_part = new_vec128("@scatter_src_part");
+      emit_2vi(UniOpVVI::kExtractV128_I32, index_part, index, part);
+      emit_2vi(UniOpVVI::kExtractV128_I32, src_part, src, part);
+    }
+
+    for (uint32_t i = 0; i < part_element_count; i++) {
+      UniCompiler_extract_index(*this, idx, index_part, element_size, i);
+      emit_mv(store_op, mem_ptr(base, idx, shift, disp), src_part, Alignment(1), i);
+    }
+  }
+}
+
+// ujit::UniCompiler - Vector Instructions - Reduce
+// ================================================
+
+void UniCompiler::emit_reduce(UniOpReduce op, const Operand_& dst_, const Vec& src_) {
+  ASMJIT_ASSERT(dst_.is_gp() || dst_.is_vec());
+
+  UniOpReduceInfo info = uni_op_reduce_info_table[size_t(op)];
+  UniOpVVV vvv_op = info.vvv_op;
+
+  Vec acc(src_);
+
+  // Narrow 512-bit and 256-bit vectors to 128 bits first, the combining operation is always applied to the
+  // narrower width so each step halves the number of elements.
+  if (acc.is_vec512()) {
+    Vec hi = new_vec256("@reduce_hi");
+    emit_2vi(UniOpVVI::kExtractV256_I32, hi, acc, 1);
+    emit_3v(vvv_op, hi, acc.ymm(), hi);
+    acc = hi;
+  }
+
+  if (acc.is_vec256()) {
+    Vec hi = new_vec128("@reduce_hi");
+    emit_2vi(UniOpVVI::kExtractV128_I32, hi, acc, 1);
+    emit_3v(vvv_op, hi, acc.xmm(), hi);
+    acc = hi;
+  }
+
+  uint32_t width = 16u;
+
+  // [V]PHMINPOSUW reduces eight unsigned 16-bit elements in a single instruction.
+  if (op == UniOpReduce::kMinU16 && (has_avx() || has_sse4_1())) {
+    Vec tmp = new_vec128("@reduce_tmp");
+    cc->emit(has_avx() ? Inst::kIdVphminposuw : Inst::kIdPhminposuw, tmp, acc.xmm());
+    acc = tmp;
+    width = 2u;
+  }
+
+  while (width > info.element_size) {
+    width >>= 1;
+
+    Vec tmp = new_vec128("@reduce_tmp");
+    Vec out = tmp;
+
+    if (width == info.element_size && dst_.is_vec()) {
+      out = dst_.as<Vec>().xmm();
+    }
+
+    if (width == 8u) {
+      if (info.float_op)
+        v_swizzle_f64x2(tmp, acc.xmm(), swizzle(0, 1));
+      else
+        v_swizzle_u32x4(tmp, acc.xmm(), swizzle(1, 0, 3, 2));
+    }
+    else if (width == 4u) {
+      if (info.float_op)
+        v_swizzle_f32x4(tmp, acc.xmm(), swizzle(2, 3, 0, 1));
+      else
+        v_swizzle_u32x4(tmp, acc.xmm(), swizzle(2, 3, 0, 1));
+    }
+    else {
+      v_srlb_u128(tmp, acc.xmm(), width);
+    }
+
+    emit_3v(vvv_op, out, acc.xmm(), tmp);
+    acc = out;
+  }
+
+  if (dst_.is_gp()) {
+    const Gp& dst = dst_.as<Gp>();
+    switch (info.element_size) {
+      case 1u: s_extract_u8(dst, acc, 0u); break;
+      case 2u: s_extract_u16(dst, acc, 0u); break;
+      case 4u: s_mov_u32(dst, acc); break;
+      default: s_mov_u64(dst, acc); break;
+    }
+  }
+  else {
+    Vec dst = dst_.as<Vec>().xmm();
+    if (!is_same_vec(dst, acc)) {
+      v_mov(dst, acc.xmm());
+    }
+  }
+}
+
+void UniCompiler::emit_reduce(UniOpReduce op, const Operand_& dst_, const OpArray& src_) {
+  size_t n = src_.size();
+  ASMJIT_ASSERT(n > 0u);
+
+  UniOpVVV vvv_op = uni_op_reduce_info_table[size_t(op)].vvv_op;
+  Vec acc[OpArray::kMaxSize];
+
+  for (size_t i = 0; i < n; i++) {
+    acc[i] = src_[i].as<Vec>();
+  }
+
+  // Combine registers pairwise to keep the dependency chain short. The first level writes to new registers so the
+  // source registers are never modified.
+  bool is_tmp = false;
+  while (n > 1u) {
+    size_t i = 0;
+    for (; i < n / 2u; i++) {
+      Vec out = is_tmp ? acc[i * 2u] : new_similar_reg(acc[i * 2u], "@reduce_acc");
+      emit_3v(vvv_op, out, acc[i * 2u], acc[i * 2u + 1u]);
+      acc[i] = out;
+    }
+
+    if (n & 1u) {
+      acc[i] = acc[n - 1u];
+    }
+
+    n = (n + 1u) / 2u;
+    is_tmp = true;
+  }
+
+  emit_reduce(op, dst_, acc[0]);
+}
+
+// ujit::UniCompiler - Vector Instructions - Table Lookup
+// ======================================================
+
+// Looks up bytes in a table of `n` 16-byte parts, each being either a 128-bit register or a memory operand. AVX-512
+// VBMI uses VPERMB or VPERMI2B when the table fits one or two registers of the destination width, other targets
+// look up each part by [V]PSHUFB and combine the results. The index of each part is biased by a saturating addition,
+// which sets the MSB (and thus zeroes the byte) of all indexes that are not within the part.
+static void emit_lut_u8_impl(UniCompiler& uc, const Vec& dst, const Operand_* table, uint32_t n, const Operand_& index_) {
+  ASMJIT_ASSERT(n >= 1u && n <= 8u);
+
+  BackendCompiler* cc = uc.cc;
+  const VecConstTable& ct = uc.ct();
+
+  Vec index = vec_from_op(uc, index_, dst, "@lut_index");
+  Vec out = dst;
+
+  bool aliased = is_same_vec(dst, index);
+  for (uint32_t i = 0; i < n; i++) {
+    aliased |= is_same_vec(dst, table[i]);
+  }
+
+  if (aliased) {
+    out = uc.new_similar_reg(dst, "@lut_out");
+  }
+
+  uint32_t width = dst.size();
+  uint32_t table_size = n * 16u;
+
+  if (uc.has_avx512_vbmi() && n > 1u && (table_size == width || table_size == width * 2u)) {
+    uint32_t parts_per_vec = width / 16u;
+    Operand t[2];
+
+    for (uint32_t i = 0; i < table_size / width; i++) {
+      const Operand_* parts = table + i * parts_per_vec;
+
+      if (parts[0].is_mem()) {
+        Mem m = parts[0].as<Mem>();
+        m.set_size(width);
+        t[i] = m;
+      }
+      else if (parts_per_vec == 1u) {
+        t[i] = parts[0].as<Vec>().xmm();
+      }
+      else {
+        Vec tmp = uc.new_similar_reg(dst, "@lut_table");
+        uc.v_mov(tmp.xmm(), parts[0].as<Vec>().xmm());
+        for (uint32_t j = 1; j < parts_per_vec; j++) {
+          cc->vinserti32x4(tmp, tmp, parts[j].as<Vec>().xmm(), j);
+        }
+        t[i] = tmp;
+      }
+    }
+
+    const void* limit = table_size == 32u ? static_cast<const void*>(&ct.p_2020202020202020) :
+                        table_size == 64u ? static_cast<const void*>(&ct.p_4040404040404040) :
+                                            static_cast<const void*>(&ct.p_8080808080808080);
+
+    x86::KReg k = cc->new_kq("@lut_mask");
+    cc->emit(Inst::kIdVpcmpub, k, index, uc.simd_const(limit, Bcst::kNA, dst), x86::VPCmpImm::kLT);
+
+    if (table_size == width) {
+      cc->k(k).z().emit(Inst::kIdVpermb, out, index, t[0]);
+    }
+    else {
+      if (t[0].is_mem()) {
+        Vec tmp = uc.new_similar_reg(dst, "@lut_table");
+        uc.v_loaduvec(tmp, t[0].as<Mem>());
+        t[0] = tmp;
+      }
+
+      uc.v_mov(out, index);
+      cc->k(k).z().emit(Inst::kIdVpermi2b, out, t[0], t[1]);
+    }
+  }
+  else {
+    Operand bias = uc.simd_const(&ct.p_7070707070707070, Bcst::kNA, dst);
+    Vec part_index = index;
+    Vec sel = uc.new_similar_reg(dst, "@lut_sel");
+
+    for (uint32_t i = 0; i < n; i++) {
+      if (i == 1u) {
+        part_index = uc.new_similar_reg(dst, "@lut_part_index");
+        uc.v_sub_u8(part_index, index, uc.simd_const(&ct.p_1010101010101010, Bcst::kNA, dst));
+      }
+      else if (i > 1u) {
+        uc.v_sub_u8(part_index, part_index, uc.simd_const(&ct.p_1010101010101010, Bcst::kNA, dst));
+      }
+
+      uc.v_adds_u8(sel, part_index, bias);
+
+      // Each 128-bit lane of wider vectors must see the whole part, as [V]PSHUFB never crosses lanes.
+      Vec part;
+      if (width > 16u) {
+        part = uc.new_similar_reg(dst, "@lut_part");
+        uc.v_broadcast_v128_u32(part, table[i].is_vec() ? Operand(table[i].as<Vec>().xmm()) : Operand(table[i]));
+      }
+      else if (table[i].is_mem()) {
+        part = uc.new_similar_reg(dst, "@lut_part");
+        uc.v_loadu128(part, table[i].as<Mem>());
+      }
+      else {
+        part = table[i].as<Vec>().xmm();
+      }
+
+      if (i == 0u) {
+        uc.v_swizzlev_u8(out, part, sel);
+      }
+      else {
+        uc.v_swizzlev_u8(sel, part, sel);
+        uc.v_or_i32(out, out, sel);
+      }
+    }
+  }
+
+  if (aliased) {
+    uc.v_mov(dst, out);
+  }
+}
+
+void UniCompiler::emit_lut_u8(const Vec& dst_, const OpArray& table_, const Operand_& index_) {
+  uint32_t n = uint32_t(table_.size());
+  ASMJIT_ASSERT(n >= 1u && n <= 8u);
+
+  Operand table[8];
+  for (uint32_t i = 0; i < n; i++) {
+    table[i] = table_[i].as<Vec>().xmm();
+  }
+
+  emit_lut_u8_impl(*this, dst_, table, n, index_);
+}
+
+void UniCompiler::emit_lut_u8(const Vec& dst_, const Mem& table_, uint32_t table_size, const Operand_& index_) {
+  ASMJIT_ASSERT(Support::is_power_of_2(table_size) && table_size >= 16u && table_size <= 128u);
+
+  uint32_t n = table_size / 16u;
+  Operand table[8];
+
+  for (uint32_t i = 0; i < n; i++) {
+    Mem m(table_);
+    m.add_offset(int32_t(i * 16u));
+    m.set_size(16);
+    table[i] = m;
+  }
+
+  emit_lut_u8_impl(*this, dst_, table, n, index_);
+}
+
 // ujit::UniCompiler - Vector Instructions - Emit 3V
 // =================================================
 
@@ -6276,6 +7364,22 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
         return;
       }
 
+      case UniOpVVV::kAddF16:
+      case UniOpVVV::kSubF16:
+      case UniOpVVV::kMulF16:
+      case UniOpVVV::kDivF16: {
+        f16_arith_via_f32(*this, op, dst, src1v, src2);
+        return;
+      }
+
+      case UniOpVVV::kCompressU32:
+      case UniOpVVV::kCompressU64:
+      case UniOpVVV::kExpandU32:
+      case UniOpVVV::kExpandU64: {
+        compress_expand(*this, op, dst, src1v, src2);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -6978,18 +8082,18 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
         Mem m_data = tmp_stack(StackId::kCustom, 64);
         Mem m_pred = m_data.clone_adjusted(32);
 
-        m_data.set_size(1);
-        m_pred.set_size(1);
-
         cc->movaps(m_data, src1v);
 
-        // The trick is to AND all indexes by 0x0F and then to do unsigned minimum so all indexes are in [0, 17) range,
-        // where index 16 maps to zero.
+        // The trick is to AND all indexes by 0x8F and then to do unsigned minimum so all indexes are in [0, 17) range,
+        // where index 16 maps to zero (indexes having the most significant bit set are zeroed like PSHUFB does).
         Vec tmp = new_similar_reg(dst, "@tmp");
-        cc->vmovaps(tmp, simd_mem_const(&ct().p_0F0F0F0F0F0F0F0F, Bcst::kNA, tmp));
-        cc->pand(tmp, src2.as<Vec>());
+        cc->movaps(tmp, simd_mem_const(&ct().p_8F8F8F8F8F8F8F8F, Bcst::kNA, tmp));
+        cc->emit(Inst::kIdPand, tmp, src2);
         cc->pminub(tmp, simd_mem_const(&ct().p_1010101010101010, Bcst::kNA, tmp));
         cc->movaps(m_pred, tmp);
+
+        m_data.set_size(1);
+        m_pred.set_size(1);
         cc->mov(m_data.clone_adjusted(16), 0);
 
         Gp acc = new_gpz("@acc");
@@ -7001,10 +8105,12 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
           cc->movzx(idx.r32(), m_pred); m_pred.add_offset(1);
 
           m_data.set_index(acc);
-          cc->movzx(acc, m_data);
+          cc->movzx(acc.r32(), m_data);
 
           m_data.set_index(idx);
-          cc->mov(acc.r8_hi(), m_data);
+          cc->movzx(idx.r32(), m_data);
+          cc->shl(idx.r32(), 8);
+          cc->or_(acc.r32(), idx.r32());
 
           if (i == 0)
             cc->movd(dst, acc.r32());
@@ -7015,6 +8121,22 @@ void UniCompiler::emit_3v(UniOpVVV op, const Operand_& dst_, const Operand_& src
         return;
       }
 
+      case UniOpVVV::kAddF16:
+      case UniOpVVV::kSubF16:
+      case UniOpVVV::kMulF16:
+      case UniOpVVV::kDivF16: {
+        f16_arith_via_f32(*this, op, dst, src1v, src2);
+        return;
+      }
+
+      case UniOpVVV::kCompressU32:
+      case UniOpVVV::kCompressU64:
+      case UniOpVVV::kExpandU32:
+      case UniOpVVV::kExpandU64: {
+        compress_expand(*this, op, dst, src1v, src2);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -7265,6 +8387,101 @@ void UniCompiler::emit_3vi(UniOpVVVI op, const OpArray& dst_, const Operand_& sr
 void UniCompiler::emit_3vi(UniOpVVVI op, const OpArray& dst_, const OpArray& src1_, const Operand_& src2_, uint32_t imm) { emit_3vi_t(*this, op, dst_, src1_, src2_, imm); }
 void UniCompiler::emit_3vi(UniOpVVVI op, const OpArray& dst_, const OpArray& src1_, const OpArray& src2_, uint32_t imm) { emit_3vi_t(*this, op, dst_, src1_, src2_, imm); }
 
+// ujit::UniCompiler - Vector Instructions - Dot Product
+// ====================================================
+
+// Widens even and odd bytes of each 16-bit element of `src` to 16-bit elements.
+static void dot_widen_u8_to_u16(UniCompiler& uc, const Vec& even, const Vec& odd, const Vec& src, bool is_signed) {
+  if (is_signed) {
+    uc.v_slli_i16(even, src, 8);
+    uc.v_srai_i16(even, even, 8);
+    uc.v_srai_i16(odd, src, 8);
+  }
+  else {
+    uc.v_and_i32(even, src, uc.simd_const(&uc.ct().p_00FF00FF00FF00FF, Bcst::k32, even));
+    uc.v_srli_u16(odd, src, 8);
+  }
+}
+
+// Calculates a dot product of groups of 8-bit or 16-bit elements accumulated to 32-bit elements. Uses VNNI
+// instructions if available, otherwise bytes are widened to 16-bit elements and multiplied by [V]PMADDWD, because
+// [V]PMADDUBSW saturates the 16-bit sums of products.
+static void emit_dot_i32(UniCompiler& uc, UniOpVVVV op, const Vec& dst, const Vec& src1, const Operand_& src2_, const Operand_& src3_) {
+  BackendCompiler* cc = uc.cc;
+
+  // VEX encoded forms cannot encode registers above 15, so they are only used without AVX-512.
+  bool vex_only = !uc.has_avx512();
+  InstId inst_id = Inst::kIdNone;
+
+  switch (op) {
+    case UniOpVVVV::kDotI8_I32:
+      if (uc.has_avx_vnni_int8() && vex_only)
+        inst_id = Inst::kIdVpdpbssd;
+      break;
+
+    case UniOpVVVV::kDotU8_I32:
+      if (uc.has_avx_vnni_int8() && vex_only)
+        inst_id = Inst::kIdVpdpbuud;
+      break;
+
+    case UniOpVVVV::kDotU8I8_I32:
+      if (uc.has_avx512_vnni() || (uc.has_avx_vnni() && vex_only))
+        inst_id = Inst::kIdVpdpbusd;
+      break;
+
+    case UniOpVVVV::kDotI16_I32:
+      if (uc.has_avx512_vnni() || (uc.has_avx_vnni() && vex_only))
+        inst_id = Inst::kIdVpdpwssd;
+      break;
+
+    default:
+      ASMJIT_NOT_REACHED();
+  }
+
+  if (inst_id != Inst::kIdNone) {
+    Vec acc = dst;
+    if (!is_same_vec(dst, src3_) && (is_same_vec(dst, src1) || is_same_vec(dst, src2_))) {
+      acc = uc.new_similar_reg(dst, "@dot_acc");
+    }
+
+    if (!is_same_vec(acc, src3_)) {
+      avx_mov(uc, acc, src3_);
+    }
+
+    if (!uc.has_avx512_vnni()) {
+      cc->vex();
+    }
+
+    cc->emit(inst_id, acc, src1, src2_);
+
+    if (acc.id() != dst.id()) {
+      avx_mov(uc, dst, acc);
+    }
+    return;
+  }
+
+  Vec prod = uc.new_similar_reg(dst, "@dot_prod");
+
+  if (op == UniOpVVVV::kDotI16_I32) {
+    uc.v_mhadd_i16_to_i32(prod, src1, src2_);
+  }
+  else {
+    Vec src2 = vec_from_op(uc, src2_, dst, "@dot_src2");
+    Vec a_odd = uc.new_similar_reg(dst, "@dot_a_odd");
+    Vec b_even = uc.new_similar_reg(dst, "@dot_b_even");
+    Vec b_odd = uc.new_similar_reg(dst, "@dot_b_odd");
+
+    dot_widen_u8_to_u16(uc, prod, a_odd, src1, op == UniOpVVVV::kDotI8_I32);
+    dot_widen_u8_to_u16(uc, b_even, b_odd, src2, op != UniOpVVVV::kDotU8_I32);
+
+    uc.v_mhadd_i16_to_i32(prod, prod, b_even);
+    uc.v_mhadd_i16_to_i32(a_odd, a_odd, b_odd);
+    uc.v_add_i32(prod, prod, a_odd);
+  }
+
+  uc.v_add_i32(dst, prod, src3_);
+}
+
 // ujit::UniCompiler - Vector Instructions - Emit 4V
 // =================================================
 
@@ -7455,6 +8672,14 @@ void UniCompiler::emit_4v(UniOpVVVV op, const Operand_& dst_, const Operand_& sr
         }
       }
 
+      case UniOpVVVV::kDotI8_I32:
+      case UniOpVVVV::kDotU8_I32:
+      case UniOpVVVV::kDotU8I8_I32:
+      case UniOpVVVV::kDotI16_I32: {
+        emit_dot_i32(*this, op, dst, src1, src2, src3);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -7572,6 +8797,14 @@ void UniCompiler::emit_4v(UniOpVVVV op, const Operand_& dst_, const Operand_& sr
         return;
       }
 
+      case UniOpVVVV::kDotI8_I32:
+      case UniOpVVVV::kDotU8_I32:
+      case UniOpVVVV::kDotU8I8_I32:
+      case UniOpVVVV::kDotI16_I32: {
+        emit_dot_i32(*this, op, dst, src1, src2, src3);
+        return;
+      }
+
       default:
         ASMJIT_NOT_REACHED();
     }
@@ -0,0 +1,382 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core/api-build_p.h>
+#include <asmjit/ujit/uniloop.h>
+#include <asmjit/ujit/unicondition.h>
+
+#if !defined(ASMJIT_NO_UJIT)
+
+ASMJIT_BEGIN_SUB_NAMESPACE(ujit)
+
+#if defined(ASMJIT_UJIT_X86)
+namespace Inst { using namespace x86::Inst; }
+#elif defined(ASMJIT_UJIT_AARCH64)
+namespace Inst { using namespace a64::Inst; }
+#endif
+
+// ujit::UniLoop - Utilities
+// =========================
+
+static ASMJIT_INLINE uint32_t UniLoop_element_shift(uint32_t element_size) noexcept {
+  return Support::ctz(element_size);
+}
+
+static bool UniLoop_can_mask(UniCompiler& uc, uint32_t element_size, uint32_t vec_element_count) noexcept {
+  if (!uc.has_masked_access_of(element_size)) {
+    return false;
+  }
+
+#if defined(ASMJIT_UJIT_X86)
+  // AVX-512 masks of 64 elements (8-bit elements in 512-bit vectors) require a 64-bit GP register.
+  if (uc.has_avx512()) {
+    return vec_element_count <= 32u || uc.is_64bit();
+  }
+
+  // AVX2 only provides masked loads and stores of 32-bit and 64-bit elements.
+  return uc.has_avx2() && element_size >= 4u;
+#elif defined(ASMJIT_UJIT_AARCH64)
+  // SVE predicates cover all element sizes, NEON has no masked loads and stores.
+  Support::maybe_unused(element_size, vec_element_count);
+  return uc.use_sve();
+#else
+  Support::maybe_unused(element_size, vec_element_count);
+  return false;
+#endif
+}
+
+#if defined(ASMJIT_UJIT_X86)
+static constexpr InstId UniLoop_masked_mov_avx512[4] = {
+  Inst::kIdVmovdqu8,
+  Inst::kIdVmovdqu16,
+  Inst::kIdVmovdqu32,
+  Inst::kIdVmovdqu64
+};
+#elif defined(ASMJIT_UJIT_AARCH64)
+static constexpr InstId UniLoop_masked_ld1_sve[4] = {
+  Inst::kIdLd1b_z,
+  Inst::kIdLd1h_z,
+  Inst::kIdLd1w_z,
+  Inst::kIdLd1d_z
+};
+
+static constexpr InstId UniLoop_masked_st1_sve[4] = {
+  Inst::kIdSt1b_z,
+  Inst::kIdSt1h_z,
+  Inst::kIdSt1w_z,
+  Inst::kIdSt1d_z
+};
+
+static ASMJIT_INLINE Vec UniLoop_sve_vec(const Vec& vec, uint32_t element_size) noexcept {
+  Vec out = vec.z();
+  out.set_element_type(a64::VecElementType(UniLoop_element_shift(element_size) + 1u));
+  return out;
+}
+#endif
+
+// Creates a mask that selects the first `remaining` elements, where `remaining` is less than the number of elements
+// a single vector holds and equals `count - index`.
+static Reg UniLoop_make_mask(UniCompiler& uc, const Gp& index, const Gp& count, const Gp& remaining, uint32_t element_size, uint32_t vec_element_count) {
+#if defined(ASMJIT_UJIT_X86)
+  Support::maybe_unused(index, count);
+
+  BackendCompiler* cc = uc.cc;
+
+  if (uc.has_avx512()) {
+    Gp tmp = uc.new_gpz("@tail_bits");
+    uc.mov(tmp, Imm(1));
+    uc.shl(tmp, tmp, remaining);
+    uc.sub(tmp, tmp, Imm(1));
+
+    if (vec_element_count > 32u) {
+      x86::KReg k = cc->new_kq("@tail_mask");
+      cc->kmovq(k, tmp.r64());
+      return k;
+    }
+    else {
+      x86::KReg k = cc->new_kd("@tail_mask");
+      cc->kmovd(k, tmp.r32());
+      return k;
+    }
+  }
+  else {
+    Gp offset = uc.new_gpz("@tail_offset");
+    uc.shl(offset, remaining, Imm(UniLoop_element_shift(element_size)));
+    uc.neg(offset, offset);
+
+    Mem m = uc._get_mem_const(&uc.ct().p_tail_mask_window);
+    m.set_index(offset);
+    m.add_offset(32);
+
+    Vec mask = uc.new_vec_with_width(uc.vec_width(), "@tail_mask");
+    uc.v_loaduvec(mask, m);
+    return mask;
+  }
+#elif defined(ASMJIT_UJIT_AARCH64)
+  // SVE predicate registers are not allocated by the register allocator, UniCompiler hands out a fixed one.
+  Support::maybe_unused(remaining, vec_element_count);
+
+  a64::PReg p = uc.sve_alloc_pred();
+  uc.cc->whilelo(a64::PReg::make_p_with_element_type(a64::VecElementType(UniLoop_element_shift(element_size) + 1u), p.id()), index, count);
+  return p;
+#else
+  Support::maybe_unused(uc, index, count, remaining, element_size, vec_element_count);
+  return Reg();
+#endif
+}
+
+// ujit::UniLoop - Construction & Destruction
+// ==========================================
+
+UniLoop::UniLoop(UniCompiler& uc, const Gp& count, uint32_t element_size, uint32_t unroll, UniLoopTail tail) noexcept
+  : _uc(uc),
+    _count(count),
+    _element_size(element_size),
+    _vec_element_count((16u << uint32_t(uc.vec_width())) / element_size),
+    _unroll(Support::max<uint32_t>(unroll, 1u)) {
+  ASMJIT_ASSERT(Support::is_power_of_2(element_size) && element_size <= 8u);
+  ASMJIT_ASSERT(tail <= UniLoopTail::kMaxValue);
+
+  if (tail == UniLoopTail::kAuto || tail == UniLoopTail::kMasked) {
+    tail = UniLoop_can_mask(uc, element_size, _vec_element_count) ? UniLoopTail::kMasked : UniLoopTail::kScalar;
+  }
+
+  _tail = tail;
+}
+
+// ujit::UniLoop - Loop Construction
+// =================================
+
+bool UniLoop::next() {
+  UniCompiler& uc = _uc;
+
+  if (_ended) {
+    return false;
+  }
+
+  uint32_t n = _vec_element_count;
+
+  switch (_step) {
+    case UniLoopStep::kNone: {
+      _index = uc.new_gpz("@loop_index");
+      _remaining = uc.new_gpz("@loop_remaining");
+      _done_label = uc.new_label();
+
+      uc.mov(_index, Imm(0));
+      uc.mov(_remaining, _count);
+
+      // Main loop - processes `unroll` vectors per iteration.
+      uint32_t main_count = n * _unroll;
+      _loop_label = uc.new_label();
+
+      _skip_label = uc.new_label();
+      uc.j(_skip_label, ucmp_lt(_remaining, Imm(main_count)));
+      uc.bind(_loop_label);
+
+      _step = UniLoopStep::kMain;
+      return true;
+    }
+
+    case UniLoopStep::kMain: {
+      uint32_t main_count = n * _unroll;
+
+      uc.add(_index, _index, Imm(main_count));
+      uc.sub(_remaining, _remaining, Imm(main_count));
+      uc.j(_loop_label, ucmp_ge(_remaining, Imm(main_count)));
+      uc.bind(_skip_label);
+
+      if (_unroll > 1u) {
+        // Vector loop - processes a single vector per iteration when the main loop is unrolled.
+        _loop_label = uc.new_label();
+        _skip_label = uc.new_label();
+
+        uc.j(_skip_label, ucmp_lt(_remaining, Imm(n)));
+        uc.bind(_loop_label);
+
+        _step = UniLoopStep::kVector;
+        return true;
+      }
+
+      break;
+    }
+
+    case UniLoopStep::kVector: {
+      uc.add(_index, _index, Imm(n));
+      uc.sub(_remaining, _remaining, Imm(n));
+      uc.j(_loop_label, ucmp_ge(_remaining, Imm(n)));
+      uc.bind(_skip_label);
+      break;
+    }
+
+    case UniLoopStep::kOverlap: {
+      // Scalar tail that handles loops having less elements than a single vector holds.
+      uc.j(_done_label);
+      uc.bind(_scalar_label);
+
+      _loop_label = uc.new_label();
+      uc.bind(_loop_label);
+
+      _step = UniLoopStep::kScalar;
+      return true;
+    }
+
+    case UniLoopStep::kScalar: {
+      uc.inc(_index);
+      uc.j(_loop_label, sub_nz(_remaining, Imm(1)));
+      [[fallthrough]];
+    }
+
+    case UniLoopStep::kMasked: {
+#if defined(ASMJIT_UJIT_AARCH64)
+      if (_step == UniLoopStep::kMasked) {
+        uc.sve_release_pred(_mask.as<a64::PReg>());
+      }
+#endif
+      uc.bind(_done_label);
+
+      _step = UniLoopStep::kNone;
+      _ended = true;
+      return false;
+    }
+
+    default:
+      ASMJIT_NOT_REACHED();
+  }
+
+  // Tail - less than a single vector of elements remains at this point.
+  uc.j(_done_label, cmp_eq(_remaining, Imm(0)));
+
+  switch (_tail) {
+    case UniLoopTail::kMasked: {
+      _mask = UniLoop_make_mask(uc, _index, _count, _remaining, _element_size, n);
+      _step = UniLoopStep::kMasked;
+      return true;
+    }
+
+    case UniLoopTail::kOverlap: {
+      _scalar_label = uc.new_label();
+      uc.j(_scalar_label, ucmp_lt(_count, Imm(n)));
+
+      uc.mov(_index, _count);
+      uc.sub(_index, _index, Imm(n));
+
+      _step = UniLoopStep::kOverlap;
+      return true;
+    }
+
+    default: {
+      _loop_label = uc.new_label();
+      uc.bind(_loop_label);
+
+      _step = UniLoopStep::kScalar;
+      return true;
+    }
+  }
+}
+
+// ujit::UniLoop - Loads & Stores
+// ==============================
+
+Mem UniLoop::mem(const Gp& base, uint32_t vec_index) {
+  ASMJIT_ASSERT(_step != UniLoopStep::kNone);
+  ASMJIT_ASSERT(vec_index < vec_count());
+
+  uint32_t shift = UniLoop_element_shift(_element_size);
+  int32_t disp = int32_t(vec_index * _vec_element_count * _element_size);
+
+#if defined(ASMJIT_UJIT_X86)
+  return mem_ptr(base, _index, shift, disp);
+#else
+  // AArch64 only allows the index to be shifted by the access size, which matches scalar tails and SVE loads and
+  // stores of the first vector.
+  if (_step == UniLoopStep::kScalar || (_uc.use_sve() && disp == 0)) {
+    return mem_ptr(base, _index, shift);
+  }
+
+  Gp addr = _uc.new_gpz("@loop_addr");
+  _uc.cc->add(addr, base, _index, a64::lsl(shift));
+  return mem_ptr(addr, disp);
+#endif
+}
+
+void UniLoop::load(const Vec& dst, const Gp& base, uint32_t vec_index) {
+  UniCompiler& uc = _uc;
+  Mem m = mem(base, vec_index);
+
+  switch (_step) {
+    case UniLoopStep::kScalar: {
+      uc.v_load_iany(dst, m, _element_size, Alignment(1));
+      return;
+    }
+
+#if defined(ASMJIT_UJIT_X86)
+    case UniLoopStep::kMasked: {
+      BackendCompiler* cc = uc.cc;
+      uint32_t shift = UniLoop_element_shift(_element_size);
+
+      if (_mask.is_mask_reg()) {
+        cc->k(_mask.as<x86::KReg>()).z().emit(UniLoop_masked_mov_avx512[shift], dst, m);
+      }
+      else {
+        cc->emit(_element_size == 4u ? Inst::kIdVpmaskmovd : Inst::kIdVpmaskmovq, dst, _mask.as<Vec>().clone_as(dst), m);
+      }
+      return;
+    }
+#elif defined(ASMJIT_UJIT_AARCH64)
+    case UniLoopStep::kMasked: {
+      uint32_t shift = UniLoop_element_shift(_element_size);
+      uc.cc->emit(UniLoop_masked_ld1_sve[shift], UniLoop_sve_vec(dst, _element_size), _mask.as<a64::PReg>().z(), m);
+      return;
+    }
+#endif
+
+    default: {
+      uc.v_loaduvec(dst, m);
+      return;
+    }
+  }
+}
+
+void UniLoop::store(const Gp& base, const Vec& src, uint32_t vec_index) {
+  UniCompiler& uc = _uc;
+  Mem m = mem(base, vec_index);
+
+  switch (_step) {
+    case UniLoopStep::kScalar: {
+      uc.v_store_iany(m, src, _element_size, Alignment(1));
+      return;
+    }
+
+#if defined(ASMJIT_UJIT_X86)
+    case UniLoopStep::kMasked: {
+      BackendCompiler* cc = uc.cc;
+      uint32_t shift = UniLoop_element_shift(_element_size);
+
+      if (_mask.is_mask_reg()) {
+        cc->k(_mask.as<x86::KReg>()).emit(UniLoop_masked_mov_avx512[shift], m, src);
+      }
+      else {
+        cc->emit(_element_size == 4u ? Inst::kIdVpmaskmovd : Inst::kIdVpmaskmovq, m, _mask.as<Vec>().clone_as(src), src);
+      }
+      return;
+    }
+#elif defined(ASMJIT_UJIT_AARCH64)
+    case UniLoopStep::kMasked: {
+      uint32_t shift = UniLoop_element_shift(_element_size);
+      uc.cc->emit(UniLoop_masked_st1_sve[shift], UniLoop_sve_vec(src, _element_size), _mask.as<a64::PReg>(), m);
+      return;
+    }
+#endif
+
+    default: {
+      uc.v_storeuvec(m, src);
+      return;
+    }
+  }
+}
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_UJIT
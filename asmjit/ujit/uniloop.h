@@ -0,0 +1,210 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#ifndef ASMJIT_UJIT_UNILOOP_H_INCLUDED
+#define ASMJIT_UJIT_UNILOOP_H_INCLUDED
+
+#include <asmjit/ujit/ujitbase.h>
+#include <asmjit/ujit/unicompiler.h>
+
+#if !defined(ASMJIT_NO_UJIT)
+
+ASMJIT_BEGIN_SUB_NAMESPACE(ujit)
+
+//! \addtogroup asmjit_ujit
+//! \{
+
+//! Strategy used by \ref UniLoop to process elements that remain after the last full vector.
+enum class UniLoopTail : uint8_t {
+  //! Use a masked tail if masked loads and stores of the element size are available and fast, otherwise use a
+  //! scalar tail.
+  kAuto = 0,
+  //! Process the remaining elements one by one.
+  kScalar = 1,
+  //! Process the remaining elements by a single masked iteration - AVX-512 uses K registers, AVX2 uses a vector
+  //! mask for 32-bit and 64-bit elements, and SVE uses a predicate created by `WHILELO`. Falls back to \ref kScalar
+  //! if the target cannot do masked accesses.
+  kMasked = 2,
+  //! Process the last full vector once more so it ends exactly at the element count. The loop body must produce
+  //! the same result when applied twice to the same elements (outputs must not alias inputs). Loops having less
+  //! elements than a single vector holds use \ref kScalar.
+  kOverlap = 3,
+
+  //! Maximum value of `UniLoopTail`.
+  kMaxValue = kOverlap
+};
+
+//! Describes a single copy of the loop body emitted by \ref UniLoop.
+enum class UniLoopStep : uint8_t {
+  //! No step (the loop has not started or has already ended).
+  kNone = 0,
+  //! Unrolled main loop that processes \ref UniLoop::vec_count() full vectors per iteration.
+  kMain = 1,
+  //! Loop that processes a single full vector per iteration (only emitted when the main loop is unrolled).
+  kVector = 2,
+  //! Masked tail that processes less elements than a single vector holds.
+  kMasked = 3,
+  //! Overlapping tail that processes the last full vector.
+  kOverlap = 4,
+  //! Scalar tail that processes a single element per iteration (only the lowest element of vectors is valid).
+  kScalar = 5,
+
+  //! Maximum value of `UniLoopStep`.
+  kMaxValue = kScalar
+};
+
+//! Builds a loop that processes `count` elements of arrays having `element_size` bytes per element.
+//!
+//! The loop is emitted as a sequence of steps - each call to \ref next() closes the previous step and starts a new
+//! one, and the caller emits the loop body for each step. Loads and stores done through \ref load() and \ref store()
+//! are adjusted to the current step, so the same body works for unrolled iterations, masked tails, and scalar tails:
+//!
+//! ```
+//! using namespace asmjit::ujit;
+//!
+//! void add_one(UniCompiler& uc, const Gp& dst, const Gp& src, const Gp& count, const Vec& ones) {
+//!   UniLoop loop(uc, count, 4, 2);
+//!
+//!   while (loop.next()) {
+//!     for (uint32_t i = 0; i < loop.vec_count(); i++) {
+//!       Vec v = uc.new_similar_reg(ones, "v");
+//!       loop.load(v, src, i);
+//!       uc.v_add_i32(v, v, ones);
+//!       loop.store(dst, v, i);
+//!     }
+//!   }
+//! }
+//! ```
+//!
+//! \note The `count` register must have the native size (see \ref UniCompiler::new_gpz()) and it's not modified.
+class UniLoop {
+public:
+  ASMJIT_NONCOPYABLE(UniLoop)
+
+  //! \name Members
+  //! \{
+
+  //! UniCompiler the loop is emitted to.
+  UniCompiler& _uc;
+  //! Number of elements to process (not modified).
+  Gp _count;
+  //! Index of the first element processed by the current step.
+  Gp _index;
+  //! Number of elements that have not been processed yet.
+  Gp _remaining;
+  //! Mask used by \ref UniLoopStep::kMasked step (K register, vector register, or SVE predicate register).
+  Reg _mask;
+
+  //! Label of the current loop (step).
+  Label _loop_label;
+  //! Label bound after the current loop, used to skip it when there are not enough elements.
+  Label _skip_label;
+  //! Label bound after all steps.
+  Label _done_label;
+  //! Label of the scalar tail (used by \ref UniLoopTail::kOverlap tail when the count is less than a vector).
+  Label _scalar_label;
+
+  //! Size of a single element in bytes.
+  uint32_t _element_size {};
+  //! Number of elements a single vector holds.
+  uint32_t _vec_element_count {};
+  //! Number of vectors processed by a single iteration of the main loop.
+  uint32_t _unroll {};
+  //! Tail strategy (resolved, never \ref UniLoopTail::kAuto).
+  UniLoopTail _tail {};
+  //! Current step.
+  UniLoopStep _step {};
+  //! Whether the loop has ended.
+  bool _ended {};
+
+  //! \}
+
+  //! \name Construction & Destruction
+  //! \{
+
+  //! Creates a loop that processes `count` elements of `element_size` bytes (1, 2, 4, or 8) using vectors of
+  //! \ref UniCompiler::vec_width() and `unroll` vectors per iteration of the main loop.
+  ASMJIT_API UniLoop(UniCompiler& uc, const Gp& count, uint32_t element_size, uint32_t unroll = 1, UniLoopTail tail = UniLoopTail::kAuto) noexcept;
+
+  //! \}
+
+  //! \name Accessors
+  //! \{
+
+  //! Returns UniCompiler the loop is emitted to.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG UniCompiler& uc() const noexcept { return _uc; }
+
+  //! Returns the register holding the number of elements to process.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const Gp& count() const noexcept { return _count; }
+
+  //! Returns the register holding the index of the first element processed by the current step.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG const Gp& index() const noexcept { return _index; }
+
+  //! Returns the size of a single element in bytes.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t element_size() const noexcept { return _element_size; }
+
+  //! Returns the number of elements a single vector holds.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t vec_element_count() const noexcept { return _vec_element_count; }
+
+  //! Returns the number of vectors processed by a single iteration of the main loop.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t unroll() const noexcept { return _unroll; }
+
+  //! Returns the tail strategy used by the loop (never \ref UniLoopTail::kAuto).
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG UniLoopTail tail() const noexcept { return _tail; }
+
+  //! Returns the current step.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG UniLoopStep step() const noexcept { return _step; }
+
+  //! Returns the number of vectors the loop body must process in the current step.
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t vec_count() const noexcept { return _step == UniLoopStep::kMain ? _unroll : 1u; }
+
+  //! Returns the number of elements processed by a single vector in the current step (1 in a scalar tail and
+  //! at most \ref vec_element_count() in a masked tail).
+  [[nodiscard]]
+  ASMJIT_INLINE_NODEBUG uint32_t step_element_count() const noexcept { return _step == UniLoopStep::kScalar ? 1u : _vec_element_count; }
+
+  //! \}
+
+  //! \name Loop Construction
+  //! \{
+
+  //! Closes the current step and starts the next one.
+  //!
+  //! Returns `true` if the caller must emit the loop body for the new step, or `false` if the loop has ended.
+  ASMJIT_API bool next();
+
+  //! Returns a memory operand that addresses the vector at `vec_index` of the current step in an array starting
+  //! at `base`.
+  [[nodiscard]]
+  ASMJIT_API Mem mem(const Gp& base, uint32_t vec_index = 0);
+
+  //! Loads the vector at `vec_index` of the current step from an array starting at `base` to `dst`.
+  //!
+  //! Elements not loaded by a masked or scalar tail are zero.
+  ASMJIT_API void load(const Vec& dst, const Gp& base, uint32_t vec_index = 0);
+
+  //! Stores `src` to the vector at `vec_index` of the current step in an array starting at `base`.
+  //!
+  //! A masked tail stores only the remaining elements and a scalar tail stores only the lowest element.
+  ASMJIT_API void store(const Gp& base, const Vec& src, uint32_t vec_index = 0);
+
+  //! \}
+};
+
+//! \}
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_UJIT
+#endif // ASMJIT_UJIT_UNILOOP_H_INCLUDED
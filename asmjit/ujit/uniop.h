@@ -225,6 +225,8 @@ enum class UniOpVM : uint32_t {
   kLoadCvtN_U16ToU32,         //!< N-bit load with 16-bit to 32-bit zero extension (the size depends on the vector width).
   kLoadCvtN_I32ToI64,         //!< N-bit load with 32-bit to 64-bit sign extension (the size depends on the vector width).
   kLoadCvtN_U32ToU64,         //!< N-bit load with 32-bit to 64-bit zero extension (the size depends on the vector width).
+  kLoadCvtN_F16ToF32,         //!< N-bit load with f16 to f32 conversion (the size depends on the vector width).
+  kLoadCvtN_BF16ToF32,        //!< N-bit load with bf16 to f32 conversion (the size depends on the vector width).
 
   kLoadInsertU8,              //!< 8-bit insert (int) into a vector register from memory.
   kLoadInsertU16,             //!< 16-bit insert (int) into a vector register from memory.
@@ -275,6 +277,9 @@ enum class UniOpMV : uint32_t {
   kStoreExtractU32,           //!< 32-bit extract from lane and store.
   kStoreExtractU64,           //!< 64-bit extract from lane and store.
 
+  kStoreCvtN_F32ToF16,        //!< N-bit store with f32 to f16 conversion (the size depends on the vector width).
+  kStoreCvtN_F32ToBF16,       //!< N-bit store with f32 to bf16 conversion (the size depends on the vector width).
+
   /*
   kStoreCvtz64_U16ToU8,
   kStoreCvtz64_U32ToU16,
@@ -321,7 +326,71 @@ enum class UniOpMV : uint32_t {
   kStoreCvtsN_U64ToU32,
   */
 
-  kMaxValue = kStoreExtractU64
+  kMaxValue = kStoreCvtN_F32ToBF16
+};
+
+//! Instruction with `[vec, base, vec_index]` operands.
+//!
+//! Describes gather instructions - each element of the destination is loaded from `base + (index[i] << shift) + disp`.
+//! Indexes have the same width as elements and are signed (32-bit indexes are sign extended to the address width).
+enum class UniOpGather : uint32_t {
+  kGatherU32,                 //!< Gather 32-bit elements (int) by using 32-bit indexes.
+  kGatherU64,                 //!< Gather 64-bit elements (int) by using 64-bit indexes.
+  kGatherF32,                 //!< Gather 32-bit elements (f32) by using 32-bit indexes.
+  kGatherF64,                 //!< Gather 64-bit elements (f64) by using 64-bit indexes.
+
+  kMaxValue = kGatherF64
+};
+
+//! Instruction with `[base, vec_index, vec]` operands.
+//!
+//! Describes scatter instructions - each element of the source is stored to `base + (index[i] << shift) + disp`.
+//! Elements are stored from the lowest to the highest, so the highest element wins when indexes overlap.
+enum class UniOpScatter : uint32_t {
+  kScatterU32,                //!< Scatter 32-bit elements (int) by using 32-bit indexes.
+  kScatterU64,                //!< Scatter 64-bit elements (int) by using 64-bit indexes.
+  kScatterF32,                //!< Scatter 32-bit elements (f32) by using 32-bit indexes.
+  kScatterF64,                //!< Scatter 64-bit elements (f64) by using 64-bit indexes.
+
+  kMaxValue = kScatterF64
+};
+
+//! Horizontal reduction of all elements of a vector (or all vectors of an array) into a single element.
+//!
+//! The destination is either a general-purpose register, which receives the zero extended result, or a vector
+//! register, which receives the result in its lowest element (the remaining elements are unspecified). The order
+//! in which elements are combined is unspecified, which matters only for floating point additions.
+enum class UniOpReduce : uint32_t {
+  kAddU32,                    //!< Horizontal u32 sum (wrapping).
+  kAddU64,                    //!< Horizontal u64 sum (wrapping).
+  kAddF32,                    //!< Horizontal f32 sum.
+  kAddF64,                    //!< Horizontal f64 sum.
+  kMinI8,                     //!< Horizontal i8  minimum.
+  kMinU8,                     //!< Horizontal u8  minimum.
+  kMinI16,                    //!< Horizontal i16 minimum.
+  kMinU16,                    //!< Horizontal u16 minimum.
+  kMinI32,                    //!< Horizontal i32 minimum.
+  kMinU32,                    //!< Horizontal u32 minimum.
+  kMinI64,                    //!< Horizontal i64 minimum.
+  kMinU64,                    //!< Horizontal u64 minimum.
+  kMinF32,                    //!< Horizontal f32 minimum (NaN handling follows \ref UniOpVVV::kMinF32).
+  kMinF64,                    //!< Horizontal f64 minimum (NaN handling follows \ref UniOpVVV::kMinF64).
+  kMaxI8,                     //!< Horizontal i8  maximum.
+  kMaxU8,                     //!< Horizontal u8  maximum.
+  kMaxI16,                    //!< Horizontal i16 maximum.
+  kMaxU16,                    //!< Horizontal u16 maximum.
+  kMaxI32,                    //!< Horizontal i32 maximum.
+  kMaxU32,                    //!< Horizontal u32 maximum.
+  kMaxI64,                    //!< Horizontal i64 maximum.
+  kMaxU64,                    //!< Horizontal u64 maximum.
+  kMaxF32,                    //!< Horizontal f32 maximum (NaN handling follows \ref UniOpVVV::kMaxF32).
+  kMaxF64,                    //!< Horizontal f64 maximum (NaN handling follows \ref UniOpVVV::kMaxF64).
+  kAndU32,                    //!< Horizontal u32 bitwise AND.
+  kAndU64,                    //!< Horizontal u64 bitwise AND.
+  kOrU32,                     //!< Horizontal u32 bitwise OR.
+  kOrU64,                     //!< Horizontal u64 bitwise OR.
+
+  kMaxValue = kOrU64
 };
 
 //! Instruction with `[vec, vec]` operands.
@@ -439,8 +508,22 @@ enum class UniOpVV : uint32_t {
   kCvtRoundF32ToI32,
   kCvtRoundF64ToI32Lo,
   kCvtRoundF64ToI32Hi,
-
-  kMaxValue = kCvtRoundF64ToI32Hi
+  kCvtF16LoToF32,             //!< Vector f16 to f32 conversion of the low half of the source.
+  kCvtF16HiToF32,             //!< Vector f16 to f32 conversion of the high half of the source.
+  kCvtF32ToF16Lo,             //!< Vector f32 to f16 conversion to the low half of the destination (the high half is zeroed).
+  kCvtBF16LoToF32,            //!< Vector bf16 to f32 conversion of the low half of the source.
+  kCvtBF16HiToF32,            //!< Vector bf16 to f32 conversion of the high half of the source.
+  kCvtF32ToBF16Lo,            //!< Vector f32 to bf16 conversion to the low half of the destination (the high half is zeroed).
+  kPopcntU8,                  //!< Vector u8 population count.
+  kPopcntU16,                 //!< Vector u16 population count.
+  kPopcntU32,                 //!< Vector u32 population count.
+  kPopcntU64,                 //!< Vector u64 population count.
+  kLzcntU32,                  //!< Vector u32 leading zero count (32 if the element is zero).
+  kLzcntU64,                  //!< Vector u64 leading zero count (64 if the element is zero).
+  kTzcntU32,                  //!< Vector u32 trailing zero count (32 if the element is zero).
+  kTzcntU64,                  //!< Vector u64 trailing zero count (64 if the element is zero).
+
+  kMaxValue = kTzcntU64
 };
 
 //! Instruction with `[vec, vec, imm]` operands.
@@ -706,6 +789,16 @@ enum class UniOpVVV : uint32_t {
 
   kSwizzlev_U8,               //!< Swizzle 16xu8 elements in each 128-bit lane.
 
+  kAddF16,                    //!< Vector f16 add.
+  kSubF16,                    //!< Vector f16 sub.
+  kMulF16,                    //!< Vector f16 mul.
+  kDivF16,                    //!< Vector f16 div.
+
+  kCompressU32,               //!< Compress u32 elements selected by a lane mask (src2) to the beginning of the vector.
+  kCompressU64,               //!< Compress u64 elements selected by a lane mask (src2) to the beginning of the vector.
+  kExpandU32,                 //!< Expand consecutive u32 elements to the lanes selected by a lane mask (src2).
+  kExpandU64,                 //!< Expand consecutive u64 elements to the lanes selected by a lane mask (src2).
+
 #if defined(ASMJIT_UJIT_AARCH64)
 
   kMulwLoI8,
@@ -747,7 +840,7 @@ enum class UniOpVVV : uint32_t {
 
 #else
 
-  kMaxValue = kSwizzlev_U8
+  kMaxValue = kExpandU64
 
 #endif // ASMJIT_UJIT_AARCH64
 };
@@ -808,7 +901,12 @@ enum class UniOpVVVV : uint32_t {
   kNMSubF32,                  //!< Vector f32 negated-multiply-sub (FMA if available, or separate MUL+ADD if not).
   kNMSubF64,                  //!< Vector f64 negated-multiply-sub (FMA if available, or separate MUL+ADD if not).
 
-  kMaxValue = kNMSubF64
+  kDotI8_I32,                 //!< Vector i8 x i8 dot product of 4 elements accumulated to i32 (VNNI/SDOT if available).
+  kDotU8_I32,                 //!< Vector u8 x u8 dot product of 4 elements accumulated to i32 (VNNI/UDOT if available).
+  kDotU8I8_I32,               //!< Vector u8 x i8 dot product of 4 elements accumulated to i32 (VNNI/USDOT if available).
+  kDotI16_I32,                //!< Vector i16 x i16 dot product of 2 elements accumulated to i32 (VNNI if available).
+
+  kMaxValue = kDotI16_I32
 };
 
 //! \}
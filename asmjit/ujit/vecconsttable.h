@@ -401,6 +401,78 @@ static ASMJIT_INLINE_CONSTEXPR V make_const(
   }};
 }
 
+//! \cond INTERNAL
+
+//! Sixteen 128-bit byte shuffle predicates indexed by a 4-bit lane mask, used by compress and expand operations.
+struct VecConstCompressTable128 {
+  VecConst128<uint8_t> data[16];
+};
+
+//! Compress (`kExpand == false`) or expand (`kExpand == true`) predicates of 32-bit lanes of a 128-bit vector.
+//!
+//! Bytes of lanes that are not written are 0x80, which zeroes them when used by `PSHUFB` or `TBL`.
+template<bool kExpand>
+static ASMJIT_INLINE_CONSTEXPR VecConstCompressTable128 make_compress_table_128() noexcept {
+  VecConstCompressTable128 table {};
+
+  for (uint32_t mask = 0; mask < 16u; mask++) {
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < 16u; i++)
+      table.data[mask].data[i] = uint8_t(0x80u);
+
+    for (uint32_t i = 0; i < 4u; i++) {
+      if (!(mask & (1u << i)))
+        continue;
+
+      uint32_t dst_lane = kExpand ? i : n;
+      uint32_t src_lane = kExpand ? n : i;
+
+      for (uint32_t b = 0; b < 4u; b++)
+        table.data[mask].data[dst_lane * 4u + b] = uint8_t(src_lane * 4u + b);
+      n++;
+    }
+  }
+
+  return table;
+}
+
+#if ASMJIT_ARCH_X86
+//! 256 permutation predicates indexed by an 8-bit lane mask, used by compress and expand operations of 256-bit
+//! vectors - each predicate packs 8 nibbles, where bits [2:0] of a nibble select a source lane and bit 3 marks a
+//! lane that is zeroed.
+struct VecConstCompressTable256 {
+  uint32_t data[256];
+};
+
+template<bool kExpand>
+static ASMJIT_INLINE_CONSTEXPR VecConstCompressTable256 make_compress_table_256() noexcept {
+  VecConstCompressTable256 table {};
+
+  for (uint32_t mask = 0; mask < 256u; mask++) {
+    uint32_t predicate = 0x88888888u;
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < 8u; i++) {
+      if (!(mask & (1u << i)))
+        continue;
+
+      uint32_t dst_lane = kExpand ? i : n;
+      uint32_t src_lane = kExpand ? n : i;
+
+      predicate = (predicate & ~(0xFu << (dst_lane * 4u))) | (src_lane << (dst_lane * 4u));
+      n++;
+    }
+
+    table.data[mask] = predicate;
+  }
+
+  return table;
+}
+#endif // ASMJIT_ARCH_X86
+
+//! \endcond
+
 struct VecConstTable {
   VecConstNative<uint64_t> p_0000000000000000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000000000000000u));
   VecConstNative<uint64_t> p_FFFFFFFFFFFFFFFF = make_const<VecConstNative<uint64_t>>(uint64_t(0xFFFFFFFFFFFFFFFFu));
@@ -418,13 +490,41 @@ struct VecConstTable {
   VecConstNative<uint64_t> p_0100010001000100 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0100010001000100u));
   VecConstNative<uint64_t> p_00FF00FF00FF00FF = make_const<VecConstNative<uint64_t>>(uint64_t(0x00FF00FF00FF00FFu));
   VecConstNative<uint64_t> p_0F0F0F0F0F0F0F0F = make_const<VecConstNative<uint64_t>>(uint64_t(0x0F0F0F0F0F0F0F0Fu));
+  VecConstNative<uint64_t> p_8F8F8F8F8F8F8F8F = make_const<VecConstNative<uint64_t>>(uint64_t(0x8F8F8F8F8F8F8F8Fu));
 
   VecConstNative<uint64_t> p_1010101010101010 = make_const<VecConstNative<uint64_t>>(uint64_t(0x1010101010101010u));
+  VecConstNative<uint64_t> p_2020202020202020 = make_const<VecConstNative<uint64_t>>(uint64_t(0x2020202020202020u));
+  VecConstNative<uint64_t> p_4040404040404040 = make_const<VecConstNative<uint64_t>>(uint64_t(0x4040404040404040u));
+  VecConstNative<uint64_t> p_7070707070707070 = make_const<VecConstNative<uint64_t>>(uint64_t(0x7070707070707070u));
 
   VecConstNative<uint64_t> p_FFFFFFFF00000000 = make_const<VecConstNative<uint64_t>>(uint64_t(0xFFFFFFFF00000000u));
 
   VecConstNative<uint64_t> p_0000800000008000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000800000008000u));
 
+  // Used by F16 and BF16 conversions that are not provided natively by the target.
+  VecConstNative<uint64_t> p_0000020000000200 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000020000000200u));
+  VecConstNative<uint64_t> p_00007C0000007C00 = make_const<VecConstNative<uint64_t>>(uint64_t(0x00007C0000007C00u));
+  VecConstNative<uint64_t> p_00007FFF00007FFF = make_const<VecConstNative<uint64_t>>(uint64_t(0x00007FFF00007FFFu));
+  VecConstNative<uint64_t> p_0040000000400000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0040000000400000u));
+  VecConstNative<uint64_t> p_007FFFFF007FFFFF = make_const<VecConstNative<uint64_t>>(uint64_t(0x007FFFFF007FFFFFu));
+  VecConstNative<uint64_t> p_0F7FFFFF0F7FFFFF = make_const<VecConstNative<uint64_t>>(uint64_t(0x0F7FFFFF0F7FFFFFu));
+  VecConstNative<uint64_t> p_3880000038800000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x3880000038800000u));
+  VecConstNative<uint64_t> p_477FFFFF477FFFFF = make_const<VecConstNative<uint64_t>>(uint64_t(0x477FFFFF477FFFFFu));
+  VecConstNative<uint64_t> p_7780000077800000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x7780000077800000u));
+  VecConstNative<uint64_t> p_7F8000007F800000 = make_const<VecConstNative<uint64_t>>(uint64_t(0x7F8000007F800000u));
+  VecConstNative<uint64_t> p_C8000FFFC8000FFF = make_const<VecConstNative<uint64_t>>(uint64_t(0xC8000FFFC8000FFFu));
+
+  // Used by bit counting operations that are not provided natively by the target.
+  VecConstNative<uint64_t> p_0000000000000040 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000000000000040u));
+  VecConstNative<uint64_t> p_0000002000000020 = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000002000000020u));
+  VecConstNative<uint64_t> p_0000007E0000007E = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000007E0000007Eu));
+  VecConstNative<uint64_t> p_0000009E0000009E = make_const<VecConstNative<uint64_t>>(uint64_t(0x0000009E0000009Eu));
+  VecConstNative<uint64_t> p_3333333333333333 = make_const<VecConstNative<uint64_t>>(uint64_t(0x3333333333333333u));
+  VecConstNative<uint64_t> p_5555555555555555 = make_const<VecConstNative<uint64_t>>(uint64_t(0x5555555555555555u));
+  VecConstNative<uint8_t> p_popcnt_nibble_lut = make_const<VecConstNative<uint8_t>>(
+    uint8_t(4), uint8_t(3), uint8_t(3), uint8_t(2), uint8_t(3), uint8_t(2), uint8_t(2), uint8_t(1),
+    uint8_t(3), uint8_t(2), uint8_t(2), uint8_t(1), uint8_t(2), uint8_t(1), uint8_t(1), uint8_t(0));
+
   VecConst128<uint32_t> sign32_scalar         = make_const<VecConst128<uint32_t>>(0u, 0u, 0u, uint32_t(0x80000000u));
   VecConst128<uint64_t> sign64_scalar         = make_const<VecConst128<uint64_t>>(uint64_t(0u), uint64_t(0x8000000000000000u));
 
@@ -437,6 +537,26 @@ struct VecConstTable {
   VecConstNative<double> f64_0_5              = make_const<VecConstNative<double>>(0.5);
   VecConstNative<double> f64_1                = make_const<VecConstNative<double>>(1.0);
   VecConstNative<double> f64_round_magic      = make_const<VecConstNative<double>>(4503599627370496.0);
+
+#if ASMJIT_ARCH_X86
+  // Eight 32-bit all-ones elements followed by eight zeros - an unaligned load at `32 - n * sizeof(element)` bytes
+  // provides a mask having the first `n` elements set, which is used by AVX2 masked loads and stores in loop tails.
+  VecConst512<uint32_t> p_tail_mask_window = make_const<VecConst512<uint32_t>>(
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu);
+
+  // Shifts that unpack nibbles of \ref VecConstCompressTable256 predicates to 32-bit lanes (by `VPSRLVD`).
+  VecConst256<uint32_t> p_compress_shift_256 = make_const<VecConst256<uint32_t>>(28u, 24u, 20u, 16u, 12u, 8u, 4u, 0u);
+
+  VecConstCompressTable256 p_compress_lut_256 = make_compress_table_256<false>();
+  VecConstCompressTable256 p_expand_lut_256 = make_compress_table_256<true>();
+#endif
+
+  // Bits of 32-bit lanes used to convert a vector mask to a scalar lane mask (AND followed by ADDV).
+  VecConst128<uint32_t> p_lane_bit_u32 = make_const<VecConst128<uint32_t>>(8u, 4u, 2u, 1u);
+
+  VecConstCompressTable128 p_compress_lut_128 = make_compress_table_128<false>();
+  VecConstCompressTable128 p_expand_lut_128 = make_compress_table_128<true>();
 };
 
 ASMJIT_VARAPI const VecConstTable vec_const_table;
@@ -53,6 +53,10 @@ Error Builder::finalize() {
   return serialize_to(&a);
 }
 
+Error Builder::finalize_parallel(TaskExecutor& executor) {
+  return _finalize_parallel_t<Assembler>(executor);
+}
+
 ASMJIT_END_SUB_NAMESPACE
 
 #endif // !ASMJIT_NO_X86 && !ASMJIT_NO_BUILDER
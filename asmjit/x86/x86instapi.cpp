@@ -1245,6 +1245,28 @@ Error query_rw_info(Arch arch, const BaseInst& inst, const Operand_* operands, s
       break;
     }
 
+    case InstDB::RWInfo::kCategoryMovl64: {
+      // Special case for 'movlpd|movlps' instructions. The load form only writes the low 64 bits of the destination
+      // and preserves the rest, which cannot be described by generic RW information as the store form of the same
+      // instruction writes its first operand (memory) entirely. AVX variants are in `kCategoryGeneric` category.
+      if (op_count == 2) {
+        if (operands[0].is_vec() && operands[1].is_mem()) {
+          out->_operands[0].reset(W, 8);
+          out->_operands[0].set_write_byte_mask(Support::lsb_mask<uint64_t>(8));
+          out->_operands[1].reset(R | MibRead, 8);
+          return Error::kOk;
+        }
+
+        if (operands[0].is_mem() && operands[1].is_vec()) {
+          out->_operands[0].reset(W | MibRead, 8);
+          out->_operands[1].reset(R, 8);
+          out->_operands[1].set_read_byte_mask(Support::lsb_mask<uint64_t>(8));
+          return Error::kOk;
+        }
+      }
+      break;
+    }
+
     case InstDB::RWInfo::kCategoryPunpcklxx: {
       // Special case for 'punpcklbw|punpckldq|punpcklwd' instructions.
       if (op_count == 2) {
@@ -1762,6 +1784,519 @@ Error query_features(Arch arch, const BaseInst& inst, const Operand_* operands,
 }
 #endif // !ASMJIT_NO_INTROSPECTION
 
+// x86::InstInternal - QuerySchedClass
+// ===================================
+
+#ifndef ASMJIT_NO_INTROSPECTION
+static inline bool InstInternal_is_schedulable_reg_group(RegGroup group) noexcept {
+  return group == RegGroup::kGp || group == RegGroup::kVec || group == RegGroup::kMask;
+}
+
+static inline bool InstInternal_uses_vec(const Operand_* operands, size_t op_count) noexcept {
+  for (size_t i = 0; i < op_count; i++) {
+    if (operands[i].is_vec()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static InstSchedClass InstInternal_vec_sched_class(InstId inst_id) noexcept {
+  switch (inst_id) {
+    case Inst::kIdMovapd:
+    case Inst::kIdMovaps:
+    case Inst::kIdMovd:
+    case Inst::kIdMovdqa:
+    case Inst::kIdMovdqu:
+    case Inst::kIdMovq:
+    case Inst::kIdMovupd:
+    case Inst::kIdMovups:
+    case Inst::kIdVmovapd:
+    case Inst::kIdVmovaps:
+    case Inst::kIdVmovd:
+    case Inst::kIdVmovdqa:
+    case Inst::kIdVmovdqa32:
+    case Inst::kIdVmovdqa64:
+    case Inst::kIdVmovdqu:
+    case Inst::kIdVmovdqu8:
+    case Inst::kIdVmovdqu16:
+    case Inst::kIdVmovdqu32:
+    case Inst::kIdVmovdqu64:
+    case Inst::kIdVmovq:
+    case Inst::kIdVmovupd:
+    case Inst::kIdVmovups:
+      return InstSchedClass::kMov;
+
+    case Inst::kIdDivpd:
+    case Inst::kIdDivps:
+    case Inst::kIdDivsd:
+    case Inst::kIdDivss:
+    case Inst::kIdSqrtpd:
+    case Inst::kIdSqrtps:
+    case Inst::kIdSqrtsd:
+    case Inst::kIdSqrtss:
+    case Inst::kIdVdivpd:
+    case Inst::kIdVdivph:
+    case Inst::kIdVdivps:
+    case Inst::kIdVdivsd:
+    case Inst::kIdVdivsh:
+    case Inst::kIdVdivss:
+    case Inst::kIdVsqrtpd:
+    case Inst::kIdVsqrtph:
+    case Inst::kIdVsqrtps:
+    case Inst::kIdVsqrtsd:
+    case Inst::kIdVsqrtsh:
+    case Inst::kIdVsqrtss:
+      return InstSchedClass::kVecDiv;
+
+    case Inst::kIdPmaddubsw:
+    case Inst::kIdPmaddwd:
+    case Inst::kIdPmuldq:
+    case Inst::kIdPmulhrsw:
+    case Inst::kIdPmulhuw:
+    case Inst::kIdPmulhw:
+    case Inst::kIdPmulld:
+    case Inst::kIdPmullw:
+    case Inst::kIdPmuludq:
+    case Inst::kIdPsadbw:
+    case Inst::kIdVpdpbusd:
+    case Inst::kIdVpdpbusds:
+    case Inst::kIdVpdpwssd:
+    case Inst::kIdVpdpwssds:
+    case Inst::kIdVpmadd52huq:
+    case Inst::kIdVpmadd52luq:
+    case Inst::kIdVpmaddubsw:
+    case Inst::kIdVpmaddwd:
+    case Inst::kIdVpmuldq:
+    case Inst::kIdVpmulhrsw:
+    case Inst::kIdVpmulhuw:
+    case Inst::kIdVpmulhw:
+    case Inst::kIdVpmulld:
+    case Inst::kIdVpmullq:
+    case Inst::kIdVpmullw:
+    case Inst::kIdVpmuludq:
+    case Inst::kIdVpsadbw:
+      return InstSchedClass::kVecMul;
+
+    case Inst::kIdAddpd:
+    case Inst::kIdAddps:
+    case Inst::kIdAddsd:
+    case Inst::kIdAddss:
+    case Inst::kIdAddsubpd:
+    case Inst::kIdAddsubps:
+    case Inst::kIdCmppd:
+    case Inst::kIdCmpps:
+    case Inst::kIdCmpsd:
+    case Inst::kIdCmpss:
+    case Inst::kIdCvtdq2pd:
+    case Inst::kIdCvtdq2ps:
+    case Inst::kIdCvtpd2dq:
+    case Inst::kIdCvtpd2ps:
+    case Inst::kIdCvtps2dq:
+    case Inst::kIdCvtps2pd:
+    case Inst::kIdCvtsd2si:
+    case Inst::kIdCvtsd2ss:
+    case Inst::kIdCvtsi2sd:
+    case Inst::kIdCvtsi2ss:
+    case Inst::kIdCvtss2sd:
+    case Inst::kIdCvtss2si:
+    case Inst::kIdCvttpd2dq:
+    case Inst::kIdCvttps2dq:
+    case Inst::kIdCvttsd2si:
+    case Inst::kIdCvttss2si:
+    case Inst::kIdDppd:
+    case Inst::kIdDpps:
+    case Inst::kIdHaddpd:
+    case Inst::kIdHaddps:
+    case Inst::kIdHsubpd:
+    case Inst::kIdHsubps:
+    case Inst::kIdMaxpd:
+    case Inst::kIdMaxps:
+    case Inst::kIdMaxsd:
+    case Inst::kIdMaxss:
+    case Inst::kIdMinpd:
+    case Inst::kIdMinps:
+    case Inst::kIdMinsd:
+    case Inst::kIdMinss:
+    case Inst::kIdMulpd:
+    case Inst::kIdMulps:
+    case Inst::kIdMulsd:
+    case Inst::kIdMulss:
+    case Inst::kIdRoundpd:
+    case Inst::kIdRoundps:
+    case Inst::kIdRoundsd:
+    case Inst::kIdRoundss:
+    case Inst::kIdSubpd:
+    case Inst::kIdSubps:
+    case Inst::kIdSubsd:
+    case Inst::kIdSubss:
+    case Inst::kIdVaddpd:
+    case Inst::kIdVaddph:
+    case Inst::kIdVaddps:
+    case Inst::kIdVaddsd:
+    case Inst::kIdVaddsh:
+    case Inst::kIdVaddss:
+    case Inst::kIdVaddsubpd:
+    case Inst::kIdVaddsubps:
+    case Inst::kIdVcmppd:
+    case Inst::kIdVcmpph:
+    case Inst::kIdVcmpps:
+    case Inst::kIdVcmpsd:
+    case Inst::kIdVcmpsh:
+    case Inst::kIdVcmpss:
+    case Inst::kIdVcvtdq2pd:
+    case Inst::kIdVcvtdq2ps:
+    case Inst::kIdVcvtpd2dq:
+    case Inst::kIdVcvtpd2ps:
+    case Inst::kIdVcvtph2ps:
+    case Inst::kIdVcvtps2dq:
+    case Inst::kIdVcvtps2pd:
+    case Inst::kIdVcvtps2ph:
+    case Inst::kIdVcvtsd2si:
+    case Inst::kIdVcvtsd2ss:
+    case Inst::kIdVcvtsi2sd:
+    case Inst::kIdVcvtsi2ss:
+    case Inst::kIdVcvtss2sd:
+    case Inst::kIdVcvtss2si:
+    case Inst::kIdVcvttpd2dq:
+    case Inst::kIdVcvttps2dq:
+    case Inst::kIdVcvttsd2si:
+    case Inst::kIdVcvttss2si:
+    case Inst::kIdVdppd:
+    case Inst::kIdVdpps:
+    case Inst::kIdVhaddpd:
+    case Inst::kIdVhaddps:
+    case Inst::kIdVhsubpd:
+    case Inst::kIdVhsubps:
+    case Inst::kIdVmaxpd:
+    case Inst::kIdVmaxph:
+    case Inst::kIdVmaxps:
+    case Inst::kIdVmaxsd:
+    case Inst::kIdVmaxsh:
+    case Inst::kIdVmaxss:
+    case Inst::kIdVminpd:
+    case Inst::kIdVminph:
+    case Inst::kIdVminps:
+    case Inst::kIdVminsd:
+    case Inst::kIdVminsh:
+    case Inst::kIdVminss:
+    case Inst::kIdVmulpd:
+    case Inst::kIdVmulph:
+    case Inst::kIdVmulps:
+    case Inst::kIdVmulsd:
+    case Inst::kIdVmulsh:
+    case Inst::kIdVmulss:
+    case Inst::kIdVrndscalepd:
+    case Inst::kIdVrndscaleps:
+    case Inst::kIdVrndscalesd:
+    case Inst::kIdVrndscaless:
+    case Inst::kIdVroundpd:
+    case Inst::kIdVroundps:
+    case Inst::kIdVroundsd:
+    case Inst::kIdVroundss:
+    case Inst::kIdVsubpd:
+    case Inst::kIdVsubph:
+    case Inst::kIdVsubps:
+    case Inst::kIdVsubsd:
+    case Inst::kIdVsubsh:
+    case Inst::kIdVsubss:
+      return InstSchedClass::kVecFP;
+
+    case Inst::kIdExtractps:
+    case Inst::kIdInsertps:
+    case Inst::kIdMovddup:
+    case Inst::kIdMovhlps:
+    case Inst::kIdMovlhps:
+    case Inst::kIdMovshdup:
+    case Inst::kIdMovsldup:
+    case Inst::kIdPackssdw:
+    case Inst::kIdPacksswb:
+    case Inst::kIdPackusdw:
+    case Inst::kIdPackuswb:
+    case Inst::kIdPalignr:
+    case Inst::kIdPextrb:
+    case Inst::kIdPextrd:
+    case Inst::kIdPextrq:
+    case Inst::kIdPextrw:
+    case Inst::kIdPinsrb:
+    case Inst::kIdPinsrd:
+    case Inst::kIdPinsrq:
+    case Inst::kIdPinsrw:
+    case Inst::kIdPmovsxbd:
+    case Inst::kIdPmovsxbq:
+    case Inst::kIdPmovsxbw:
+    case Inst::kIdPmovsxdq:
+    case Inst::kIdPmovsxwd:
+    case Inst::kIdPmovsxwq:
+    case Inst::kIdPmovzxbd:
+    case Inst::kIdPmovzxbq:
+    case Inst::kIdPmovzxbw:
+    case Inst::kIdPmovzxdq:
+    case Inst::kIdPmovzxwd:
+    case Inst::kIdPmovzxwq:
+    case Inst::kIdPshufb:
+    case Inst::kIdPshufd:
+    case Inst::kIdPshufhw:
+    case Inst::kIdPshuflw:
+    case Inst::kIdPslldq:
+    case Inst::kIdPsrldq:
+    case Inst::kIdPunpckhbw:
+    case Inst::kIdPunpckhdq:
+    case Inst::kIdPunpckhqdq:
+    case Inst::kIdPunpckhwd:
+    case Inst::kIdPunpcklbw:
+    case Inst::kIdPunpckldq:
+    case Inst::kIdPunpcklqdq:
+    case Inst::kIdPunpcklwd:
+    case Inst::kIdShufpd:
+    case Inst::kIdShufps:
+    case Inst::kIdUnpckhpd:
+    case Inst::kIdUnpckhps:
+    case Inst::kIdUnpcklpd:
+    case Inst::kIdUnpcklps:
+    case Inst::kIdValignd:
+    case Inst::kIdValignq:
+    case Inst::kIdVbroadcastf128:
+    case Inst::kIdVbroadcasti128:
+    case Inst::kIdVbroadcastsd:
+    case Inst::kIdVbroadcastss:
+    case Inst::kIdVcompresspd:
+    case Inst::kIdVcompressps:
+    case Inst::kIdVexpandpd:
+    case Inst::kIdVexpandps:
+    case Inst::kIdVextractf128:
+    case Inst::kIdVextractf32x4:
+    case Inst::kIdVextractf64x4:
+    case Inst::kIdVextracti128:
+    case Inst::kIdVextracti32x4:
+    case Inst::kIdVextracti64x4:
+    case Inst::kIdVextractps:
+    case Inst::kIdVinsertf128:
+    case Inst::kIdVinsertf32x4:
+    case Inst::kIdVinsertf64x4:
+    case Inst::kIdVinserti128:
+    case Inst::kIdVinserti32x4:
+    case Inst::kIdVinserti64x4:
+    case Inst::kIdVinsertps:
+    case Inst::kIdVmovddup:
+    case Inst::kIdVmovhlps:
+    case Inst::kIdVmovlhps:
+    case Inst::kIdVmovshdup:
+    case Inst::kIdVmovsldup:
+    case Inst::kIdVpackssdw:
+    case Inst::kIdVpacksswb:
+    case Inst::kIdVpackusdw:
+    case Inst::kIdVpackuswb:
+    case Inst::kIdVpalignr:
+    case Inst::kIdVpbroadcastb:
+    case Inst::kIdVpbroadcastd:
+    case Inst::kIdVpbroadcastq:
+    case Inst::kIdVpbroadcastw:
+    case Inst::kIdVpcompressb:
+    case Inst::kIdVpcompressd:
+    case Inst::kIdVpcompressq:
+    case Inst::kIdVpcompressw:
+    case Inst::kIdVperm2f128:
+    case Inst::kIdVperm2i128:
+    case Inst::kIdVpermb:
+    case Inst::kIdVpermd:
+    case Inst::kIdVpermi2b:
+    case Inst::kIdVpermi2d:
+    case Inst::kIdVpermi2pd:
+    case Inst::kIdVpermi2ps:
+    case Inst::kIdVpermi2q:
+    case Inst::kIdVpermi2w:
+    case Inst::kIdVpermilpd:
+    case Inst::kIdVpermilps:
+    case Inst::kIdVpermpd:
+    case Inst::kIdVpermps:
+    case Inst::kIdVpermq:
+    case Inst::kIdVpermt2b:
+    case Inst::kIdVpermt2d:
+    case Inst::kIdVpermt2pd:
+    case Inst::kIdVpermt2ps:
+    case Inst::kIdVpermt2q:
+    case Inst::kIdVpermt2w:
+    case Inst::kIdVpermw:
+    case Inst::kIdVpexpandb:
+    case Inst::kIdVpexpandd:
+    case Inst::kIdVpexpandq:
+    case Inst::kIdVpexpandw:
+    case Inst::kIdVpextrb:
+    case Inst::kIdVpextrd:
+    case Inst::kIdVpextrq:
+    case Inst::kIdVpextrw:
+    case Inst::kIdVpinsrb:
+    case Inst::kIdVpinsrd:
+    case Inst::kIdVpinsrq:
+    case Inst::kIdVpinsrw:
+    case Inst::kIdVpmovsxbd:
+    case Inst::kIdVpmovsxbq:
+    case Inst::kIdVpmovsxbw:
+    case Inst::kIdVpmovsxdq:
+    case Inst::kIdVpmovsxwd:
+    case Inst::kIdVpmovsxwq:
+    case Inst::kIdVpmovzxbd:
+    case Inst::kIdVpmovzxbq:
+    case Inst::kIdVpmovzxbw:
+    case Inst::kIdVpmovzxdq:
+    case Inst::kIdVpmovzxwd:
+    case Inst::kIdVpmovzxwq:
+    case Inst::kIdVpshufb:
+    case Inst::kIdVpshufd:
+    case Inst::kIdVpshufhw:
+    case Inst::kIdVpshuflw:
+    case Inst::kIdVpslldq:
+    case Inst::kIdVpsrldq:
+    case Inst::kIdVpunpckhbw:
+    case Inst::kIdVpunpckhdq:
+    case Inst::kIdVpunpckhqdq:
+    case Inst::kIdVpunpckhwd:
+    case Inst::kIdVpunpcklbw:
+    case Inst::kIdVpunpckldq:
+    case Inst::kIdVpunpcklqdq:
+    case Inst::kIdVpunpcklwd:
+    case Inst::kIdVshuff32x4:
+    case Inst::kIdVshuff64x2:
+    case Inst::kIdVshufi32x4:
+    case Inst::kIdVshufi64x2:
+    case Inst::kIdVshufpd:
+    case Inst::kIdVshufps:
+    case Inst::kIdVunpckhpd:
+    case Inst::kIdVunpckhps:
+    case Inst::kIdVunpcklpd:
+    case Inst::kIdVunpcklps:
+      return InstSchedClass::kVecShuffle;
+
+    default:
+      if (inst_id >= Inst::kIdVfmadd132pd && inst_id <= Inst::kIdVfnmsub231ss) {
+        // All FMA instructions (including FMA4) are grouped together.
+        return InstSchedClass::kVecFP;
+      }
+      return InstSchedClass::kVecALU;
+  }
+}
+
+Error query_sched_class(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept {
+  // Only called when `arch` matches X86 family.
+  ASMJIT_ASSERT(Environment::is_family_x86(arch));
+  Support::maybe_unused(arch);
+
+  InstId inst_id = inst.inst_id();
+  if (ASMJIT_UNLIKELY(!Inst::is_defined_id(inst_id))) {
+    return make_error(Error::kInvalidInstruction);
+  }
+
+  *out = InstSchedClass::kBarrier;
+
+  const InstDB::InstInfo& inst_info = InstDB::inst_info_by_id(inst_id);
+  const InstDB::CommonInfo& common_info = inst_info.common_info();
+
+  constexpr InstOptions kBarrierOptions = InstOptions::kX86_Lock | InstOptions::kX86_Rep | InstOptions::kX86_Repne |
+                                          InstOptions::kX86_XAcquire | InstOptions::kX86_XRelease;
+
+  // Instructions without operands (fences, vzeroupper, cpuid, rdtsc, ...), control flow instructions, x87 FPU
+  // instructions, and prefixed instructions are never reordered. MMX forms are rejected later by register group.
+  if (op_count == 0u ||
+      common_info.control_flow() != InstControlFlow::kRegular ||
+      common_info.has_flag(InstDB::InstFlags::kFpu) ||
+      Support::test(inst.options(), kBarrierOptions)) {
+    return Error::kOk;
+  }
+
+  // Instructions that access stack pointer implicitly, act as fences, access I/O ports or model specific registers,
+  // or change the state of the CPU in a way that's not described by RW information.
+  switch (inst_id) {
+    case Inst::kIdClflush:
+    case Inst::kIdClflushopt:
+    case Inst::kIdClwb:
+    case Inst::kIdCpuid:
+    case Inst::kIdEnter:
+    case Inst::kIdFxrstor:
+    case Inst::kIdFxrstor64:
+    case Inst::kIdFxsave:
+    case Inst::kIdFxsave64:
+    case Inst::kIdIn:
+    case Inst::kIdIns:
+    case Inst::kIdLdmxcsr:
+    case Inst::kIdLdtilecfg:
+    case Inst::kIdLeave:
+    case Inst::kIdOut:
+    case Inst::kIdOuts:
+    case Inst::kIdPop:
+    case Inst::kIdPush:
+    case Inst::kIdRdfsbase:
+    case Inst::kIdRdgsbase:
+    case Inst::kIdRdmsr:
+    case Inst::kIdRdpmc:
+    case Inst::kIdRdtsc:
+    case Inst::kIdRdtscp:
+    case Inst::kIdStmxcsr:
+    case Inst::kIdVldmxcsr:
+    case Inst::kIdVstmxcsr:
+    case Inst::kIdWrfsbase:
+    case Inst::kIdWrgsbase:
+    case Inst::kIdWrmsr:
+    case Inst::kIdXchg:
+    case Inst::kIdXgetbv:
+      return Error::kOk;
+
+    default:
+      break;
+  }
+
+  // If the instruction has a signature with implicit operands that matches the number of explicit operands it's
+  // used in a form that reads or writes registers that are not part of its operands.
+  for (const InstDB::InstSignature& signature : inst_info.inst_signatures()) {
+    if (signature.has_implicit_operands() && signature.op_count() - signature.implicit_op_count() == op_count) {
+      return Error::kOk;
+    }
+  }
+
+  for (size_t i = 0; i < op_count; i++) {
+    const Operand_& op = operands[i];
+    if (op.is_reg() && !InstInternal_is_schedulable_reg_group(op.as<Reg>().reg_group())) {
+      return Error::kOk;
+    }
+  }
+
+  if (InstInternal_uses_vec(operands, op_count)) {
+    *out = InstInternal_vec_sched_class(inst_id);
+    return Error::kOk;
+  }
+
+  switch (inst_id) {
+    case Inst::kIdMov:
+    case Inst::kIdMovabs:
+    case Inst::kIdMovsx:
+    case Inst::kIdMovsxd:
+    case Inst::kIdMovzx:
+      *out = InstSchedClass::kMov;
+      break;
+
+    case Inst::kIdImul:
+    case Inst::kIdMul:
+    case Inst::kIdMulx:
+    case Inst::kIdPdep:
+    case Inst::kIdPext:
+    case Inst::kIdCrc32:
+      *out = InstSchedClass::kMul;
+      break;
+
+    case Inst::kIdDiv:
+    case Inst::kIdIdiv:
+      *out = InstSchedClass::kDiv;
+      break;
+
+    default:
+      *out = InstSchedClass::kALU;
+      break;
+  }
+
+  return Error::kOk;
+}
+#endif // !ASMJIT_NO_INTROSPECTION
+
 } // {InstInternal}
 
 // x86::InstInternal - Tests
@@ -1929,6 +2464,36 @@ UNIT(x86_inst_api_rm_features) {
     EXPECT_EQ(rwi.rm_feature(), 0u);
   }
 }
+
+template<typename... Args>
+static InstSchedClass query_sched_class_inline(Arch arch, BaseInst inst, Args&&... args) {
+  Operand_ op_array[] = { std::forward<Args>(args)... };
+  InstSchedClass sched_class = InstSchedClass::kMaxValue;
+  InstInternal::query_sched_class(arch, inst, op_array, sizeof...(args), &sched_class);
+  return sched_class;
+}
+
+UNIT(x86_inst_api_sched_class) {
+  INFO("Verifying whether scheduling classes of general purpose instructions are reported correctly");
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdMov), rax, rcx), InstSchedClass::kMov);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdMov), rax, ptr(rcx)), InstSchedClass::kMov);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdAdd), rax, rcx), InstSchedClass::kALU);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdImul), rax, rcx), InstSchedClass::kMul);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdDiv), rdx, rax, rcx), InstSchedClass::kDiv);
+
+  INFO("Verifying whether scheduling classes of vector instructions are reported correctly");
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdPaddd), xmm0, xmm1), InstSchedClass::kVecALU);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdPmulld), xmm0, xmm1), InstSchedClass::kVecMul);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdVfmadd231ps), ymm0, ymm1, ymm2), InstSchedClass::kVecFP);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdDivps), xmm0, xmm1), InstSchedClass::kVecDiv);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdPshufb), xmm0, xmm1), InstSchedClass::kVecShuffle);
+
+  INFO("Verifying whether instructions that cannot be reordered are reported as barriers");
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdJmp), rax), InstSchedClass::kBarrier);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdPush), rax), InstSchedClass::kBarrier);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdAdd, InstOptions::kX86_Lock), ptr(rax), rcx), InstSchedClass::kBarrier);
+  EXPECT_EQ(query_sched_class_inline(Arch::kX64, BaseInst(Inst::kIdCpuid), eax, ebx, ecx, edx), InstSchedClass::kBarrier);
+}
 #endif // !ASMJIT_NO_INTROSPECTION
 
 #endif // ASMJIT_TEST
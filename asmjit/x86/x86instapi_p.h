@@ -27,6 +27,7 @@ Error ASMJIT_CDECL validate_x86(const BaseInst& inst, const Operand_* operands,
 Error ASMJIT_CDECL validate_x64(const BaseInst& inst, const Operand_* operands, size_t op_count, ValidationFlags validation_flags) noexcept;
 Error ASMJIT_CDECL query_rw_info(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, InstRWInfo* out) noexcept;
 Error ASMJIT_CDECL query_features(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, CpuFeatures* out) noexcept;
+Error ASMJIT_CDECL query_sched_class(Arch arch, const BaseInst& inst, const Operand_* operands, size_t op_count, InstSchedClass* out) noexcept;
 #endif // !ASMJIT_NO_INTROSPECTION
 
 } // {InstInternal}
@@ -209,6 +209,7 @@ struct RWInfo {
     kCategoryMovabs,
     kCategoryImul,
     kCategoryMovh64,
+    kCategoryMovl64,
     kCategoryPunpcklxx,
     kCategoryVmaskmov,
     kCategoryVmovddup,
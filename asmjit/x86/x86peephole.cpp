@@ -0,0 +1,373 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#include <asmjit/core/api-build_p.h>
+#if !defined(ASMJIT_NO_X86) && !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/x86/x86builder.h>
+#include <asmjit/x86/x86globals.h>
+#include <asmjit/x86/x86operand.h>
+#include <asmjit/x86/x86peephole_p.h>
+
+ASMJIT_BEGIN_SUB_NAMESPACE(x86)
+
+namespace PeepholeInternal {
+
+// x86::PeepholeInternal - Utilities
+// =================================
+
+//! Maximum number of instructions between a store and a load that the store is forwarded to.
+static constexpr uint32_t kMaxForwardDistance = 8u;
+
+static ASMJIT_INLINE bool is_gp_reg(const Operand_& op) noexcept {
+  return op.is_reg() && op.as<Reg>().is_gp();
+}
+
+// Returns whether `inst_id` is a move that copies the whole register (or the whole memory location of the same size)
+// and whose register to register form has the same semantics as its load form.
+static bool is_full_move(InstId inst_id) noexcept {
+  switch (inst_id) {
+    case Inst::kIdMov:
+    case Inst::kIdMovapd:
+    case Inst::kIdMovaps:
+    case Inst::kIdMovdqa:
+    case Inst::kIdMovdqu:
+    case Inst::kIdMovupd:
+    case Inst::kIdMovups:
+    case Inst::kIdVmovapd:
+    case Inst::kIdVmovaps:
+    case Inst::kIdVmovdqa:
+    case Inst::kIdVmovdqa32:
+    case Inst::kIdVmovdqa64:
+    case Inst::kIdVmovdqu:
+    case Inst::kIdVmovdqu8:
+    case Inst::kIdVmovdqu16:
+    case Inst::kIdVmovdqu32:
+    case Inst::kIdVmovdqu64:
+    case Inst::kIdVmovupd:
+    case Inst::kIdVmovups:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+static ASMJIT_INLINE bool is_same_phys_reg(const Reg& reg, RegGroup group, uint32_t id) noexcept {
+  return reg.reg_group() == group && reg.id() == id;
+}
+
+// Returns whether `node` writes register `group:id` or memory.
+static bool writes_reg_or_mem(PeepholePass& pass, const InstNode* node, RegGroup group, uint32_t id, bool* writes_mem) noexcept {
+  InstRWInfo rw_info;
+  InstSchedClass sched_class;
+
+  // Instructions that have implicit operands not described by RW information are barriers.
+  if (pass.query_rw_info(node, &rw_info) != Error::kOk ||
+      InstAPI::query_sched_class(pass.arch(), node->baseInst(), node->operands_data(), node->op_count(), &sched_class) != Error::kOk ||
+      sched_class == InstSchedClass::kBarrier) {
+    return true;
+  }
+
+  for (uint32_t i = 0; i < node->op_count(); i++) {
+    const Operand& op = node->op(i);
+    const OpRWInfo& op_rw = rw_info.operand(i);
+
+    if (op.is_reg()) {
+      if (op_rw.is_write() && is_same_phys_reg(op.as<Reg>(), group, id)) {
+        return true;
+      }
+    }
+    else if (op.is_mem()) {
+      *writes_mem |= op_rw.is_write();
+    }
+  }
+
+  if (node->has_extra_reg() && rw_info.extra_reg().is_write()) {
+    const RegOnly& extra_reg = node->extra_reg();
+    if (extra_reg.group() == group && extra_reg.id() == id) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// x86::PeepholeInternal - Rules
+// =============================
+
+// Removes instructions that don't change their destination register:
+//
+//   - `and reg, -1`
+//   - `or|xor|add|sub reg, 0`
+//   - `shl|shr|sar|rol|ror reg, 0` (the shift count is masked, flags are not affected if it's zero)
+//
+// The instruction must not zero extend the destination and the flags it writes (if any) must not be read later.
+static PeepholeResult ASMJIT_CDECL peephole_identity_imm(PeepholePass& pass, InstNode* node) {
+  if (node->op_count() != 2u || !is_gp_reg(node->op(0)) || !node->op(1).is_imm()) {
+    return PeepholeResult::kNone;
+  }
+
+  uint32_t reg_size = node->op(0).as<Gp>().size();
+  uint64_t mask = Support::lsb_mask<uint64_t>(reg_size * 8u);
+  uint64_t value = node->op(1).as<Imm>().value_as<uint64_t>() & mask;
+  bool is_shift = false;
+
+  switch (node->inst_id()) {
+    case Inst::kIdAnd:
+      if (value != mask) {
+        return PeepholeResult::kNone;
+      }
+      break;
+
+    case Inst::kIdOr:
+    case Inst::kIdXor:
+    case Inst::kIdAdd:
+    case Inst::kIdSub:
+      if (value != 0u) {
+        return PeepholeResult::kNone;
+      }
+      break;
+
+    case Inst::kIdShl:
+    case Inst::kIdShr:
+    case Inst::kIdSar:
+    case Inst::kIdRol:
+    case Inst::kIdRor:
+      if ((value & (reg_size == 8u ? 0x3Fu : 0x1Fu)) != 0u) {
+        return PeepholeResult::kNone;
+      }
+      is_shift = true;
+      break;
+
+    default:
+      return PeepholeResult::kNone;
+  }
+
+  InstRWInfo rw_info;
+  if (pass.query_rw_info(node, &rw_info) != Error::kOk || rw_info.operand(0).extend_byte_mask() != 0u) {
+    return PeepholeResult::kNone;
+  }
+
+  if (!is_shift && !pass.are_flags_dead_after(node, rw_info.write_flags())) {
+    return PeepholeResult::kNone;
+  }
+
+  return PeepholeResult::kRemove;
+}
+
+// Rewrites `cmp reg, 0` to `test reg, reg`, which is shorter and sets the same flags except AF, which is undefined
+// after `test` (thus AF must not be read later).
+static PeepholeResult ASMJIT_CDECL peephole_cmp_zero(PeepholePass& pass, InstNode* node) {
+  if (node->op_count() != 2u || !is_gp_reg(node->op(0)) || !node->op(1).is_imm()) {
+    return PeepholeResult::kNone;
+  }
+
+  uint64_t mask = Support::lsb_mask<uint64_t>(node->op(0).as<Gp>().size() * 8u);
+  if ((node->op(1).as<Imm>().value_as<uint64_t>() & mask) != 0u) {
+    return PeepholeResult::kNone;
+  }
+
+  if (!pass.are_flags_dead_after(node, CpuRWFlags::kX86_AF)) {
+    return PeepholeResult::kNone;
+  }
+
+  node->set_inst_id(Inst::kIdTest);
+  node->set_op(1, node->op(0));
+  return PeepholeResult::kRewritten;
+}
+
+// Removes `test reg, reg` if the previous instruction already set flags based on the value of `reg`, which is the
+// case of `test reg, reg`, and logical `and|or|xor reg, ...` instructions (all clear CF and OF and leave AF
+// undefined).
+static PeepholeResult ASMJIT_CDECL peephole_redundant_test(PeepholePass& pass, InstNode* node) {
+  Support::maybe_unused(pass);
+
+  if (node->op_count() != 2u || !is_gp_reg(node->op(0)) || node->op(0) != node->op(1)) {
+    return PeepholeResult::kNone;
+  }
+
+  InstNode* prev = PeepholePass::prev_inst(node);
+  if (!prev || prev->op_count() != 2u || prev->op(0) != node->op(0)) {
+    return PeepholeResult::kNone;
+  }
+
+  switch (prev->inst_id()) {
+    case Inst::kIdTest:
+      return prev->op(1) == node->op(0) ? PeepholeResult::kRemove : PeepholeResult::kNone;
+
+    case Inst::kIdAnd:
+    case Inst::kIdOr:
+    case Inst::kIdXor:
+      return PeepholeResult::kRemove;
+
+    default:
+      return PeepholeResult::kNone;
+  }
+}
+
+// Forwards a register stored to memory to a subsequent load from the same memory (store followed by a reload):
+//
+//   mov [rsp + 16], rax         mov [rsp + 16], rax
+//   ...                  =>     ...
+//   mov rcx, [rsp + 16]         mov rcx, rax
+//
+// Instructions between the store and the load must not write memory (there is no alias analysis), the stored
+// register, and registers used to address the memory. If the load then becomes a copy to self it's removed by
+// the generic redundant copy rule.
+static PeepholeResult ASMJIT_CDECL peephole_forward_store(PeepholePass& pass, InstNode* node) {
+  if (node->op_count() != 2u || node->has_extra_reg() || !node->op(0).is_reg() || !node->op(1).is_mem() || !is_full_move(node->inst_id())) {
+    return PeepholeResult::kNone;
+  }
+
+  const Reg& dst = node->op(0).as<Reg>();
+  const Mem& mem = node->op(1).as<Mem>();
+
+  InstNode* store = PeepholePass::prev_inst(node);
+  for (uint32_t i = 0; store && i < kMaxForwardDistance; i++) {
+    if (store->op_count() == 2u && store->op(0).is_mem() && store->op(0) == mem) {
+      break;
+    }
+    store = PeepholePass::prev_inst(store);
+  }
+
+  if (!store || store->op_count() != 2u || !store->op(0).is_mem() || store->op(0) != mem) {
+    return PeepholeResult::kNone;
+  }
+
+  if (store->has_extra_reg() || !is_full_move(store->inst_id()) || !store->op(1).is_reg()) {
+    return PeepholeResult::kNone;
+  }
+
+  const Reg& src = store->op(1).as<Reg>();
+  if (src.reg_type() != dst.reg_type() || (dst.is_gp() ? node->inst_id() != Inst::kIdMov : !dst.is_vec())) {
+    return PeepholeResult::kNone;
+  }
+
+  for (InstNode* inst = PeepholePass::next_inst(store); inst != node; inst = PeepholePass::next_inst(inst)) {
+    bool writes_mem = false;
+
+    if (writes_reg_or_mem(pass, inst, src.reg_group(), src.id(), &writes_mem) || writes_mem ||
+        (mem.has_base_reg() && writes_reg_or_mem(pass, inst, RegUtils::group_of(mem.base_type()), mem.base_id(), &writes_mem)) ||
+        (mem.has_index_reg() && writes_reg_or_mem(pass, inst, RegUtils::group_of(mem.index_type()), mem.index_id(), &writes_mem))) {
+      return PeepholeResult::kNone;
+    }
+  }
+
+  node->set_op(1, src);
+  return PeepholeResult::kRewritten;
+}
+
+static const PeepholeRule peephole_rules[] = {
+  { Inst::kIdAdd        , peephole_identity_imm  },
+  { Inst::kIdAnd        , peephole_identity_imm  },
+  { Inst::kIdOr         , peephole_identity_imm  },
+  { Inst::kIdRol        , peephole_identity_imm  },
+  { Inst::kIdRor        , peephole_identity_imm  },
+  { Inst::kIdSar        , peephole_identity_imm  },
+  { Inst::kIdShl        , peephole_identity_imm  },
+  { Inst::kIdShr        , peephole_identity_imm  },
+  { Inst::kIdSub        , peephole_identity_imm  },
+  { Inst::kIdXor        , peephole_identity_imm  },
+  { Inst::kIdCmp        , peephole_cmp_zero      },
+  { Inst::kIdTest       , peephole_redundant_test},
+  { Inst::kIdMov        , peephole_forward_store },
+  { Inst::kIdMovapd     , peephole_forward_store },
+  { Inst::kIdMovaps     , peephole_forward_store },
+  { Inst::kIdMovdqa     , peephole_forward_store },
+  { Inst::kIdMovdqu     , peephole_forward_store },
+  { Inst::kIdMovupd     , peephole_forward_store },
+  { Inst::kIdMovups     , peephole_forward_store },
+  { Inst::kIdVmovapd    , peephole_forward_store },
+  { Inst::kIdVmovaps    , peephole_forward_store },
+  { Inst::kIdVmovdqa    , peephole_forward_store },
+  { Inst::kIdVmovdqa32  , peephole_forward_store },
+  { Inst::kIdVmovdqa64  , peephole_forward_store },
+  { Inst::kIdVmovdqu    , peephole_forward_store },
+  { Inst::kIdVmovdqu8   , peephole_forward_store },
+  { Inst::kIdVmovdqu16  , peephole_forward_store },
+  { Inst::kIdVmovdqu32  , peephole_forward_store },
+  { Inst::kIdVmovdqu64  , peephole_forward_store },
+  { Inst::kIdVmovupd    , peephole_forward_store },
+  { Inst::kIdVmovups    , peephole_forward_store }
+};
+
+Span<const PeepholeRule> default_rules() noexcept {
+  return Span<const PeepholeRule>(peephole_rules, ASMJIT_ARRAY_SIZE(peephole_rules));
+}
+
+} // {PeepholeInternal}
+
+// x86::PeepholeInternal - Tests
+// =============================
+
+#if defined(ASMJIT_TEST)
+UNIT(x86_peephole_pass) {
+  CodeHolder code;
+  code.init(Environment(Arch::kX64));
+
+  Builder cb(&code);
+  EXPECT_EQ(cb.add_pass<PeepholePass>(), Error::kOk);
+
+  Label L0 = cb.new_label();
+
+  cb.mov(rax, rax);                    // Removed - copy to self.
+  cb.mov(eax, eax);                    // Kept - zero extends.
+  cb.mov(rcx, rdx);
+  cb.mov(rdx, rcx);                    // Removed - copy back.
+  cb.and_(rcx, -1);                    // Removed - flags are overwritten by the next `add`.
+  cb.add(rdx, 1);
+  cb.and_(ecx, -1);                    // Kept - zero extends.
+  cb.shl(rsi, 0);                      // Removed - doesn't change flags.
+  cb.mov(ptr(rsp, 8), rbx);
+  cb.add(rsi, 2);
+  cb.mov(rbx, ptr(rsp, 8));            // Removed - forwarded to `mov rbx, rbx`, which is a copy to self.
+  cb.mov(rdi, ptr(rsp, 8));            // Rewritten - forwarded to `mov rdi, rbx`.
+  cb.mov(ptr(rsp, 16), rbx);
+  cb.mov(ptr(rsi), rdi);
+  cb.mov(r8, ptr(rsp, 16));            // Kept - there is a store between.
+  cb.cmp(rax, 0);                      // Rewritten - `test rax, rax`.
+  cb.test(rax, rax);                   // Removed - flags set by the previous `test`.
+  cb.jz(L0);
+  cb.xor_(r9, r10);
+  cb.test(r9, r9);                     // Removed - flags set by the previous `xor`.
+  cb.setz(al);
+  cb.bind(L0);
+  cb.ret();
+
+  EXPECT_EQ(cb.run_passes(), Error::kOk);
+
+  PeepholePass* pass = static_cast<PeepholePass*>(cb.pass_by_name("PeepholePass"));
+  EXPECT_NOT_NULL(pass);
+  EXPECT_EQ(pass->removed_count(), 7u);
+  EXPECT_EQ(pass->rewritten_count(), 2u);
+  EXPECT_EQ(pass->func_stats().size(), 1u);
+
+  static const InstId expected_ids[] = {
+    Inst::kIdMov, Inst::kIdMov, Inst::kIdAdd, Inst::kIdAnd, Inst::kIdMov, Inst::kIdAdd, Inst::kIdMov,
+    Inst::kIdMov, Inst::kIdMov, Inst::kIdMov, Inst::kIdTest, Inst::kIdJz, Inst::kIdXor, Inst::kIdSetz, Inst::kIdRet
+  };
+
+  size_t index = 0;
+  for (BaseNode* node = cb.first_node(); node; node = node->next()) {
+    if (!node->is_inst()) {
+      continue;
+    }
+
+    if (index < ASMJIT_ARRAY_SIZE(expected_ids)) {
+      EXPECT_EQ(node->as<InstNode>()->inst_id(), expected_ids[index]);
+      if (index == 6u) {
+        EXPECT_TRUE(node->as<InstNode>()->op(1) == rbx);
+      }
+    }
+    index++;
+  }
+  EXPECT_EQ(index, ASMJIT_ARRAY_SIZE(expected_ids));
+}
+#endif // ASMJIT_TEST
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_X86 && !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
@@ -0,0 +1,33 @@
+// This file is part of AsmJit project <https://asmjit.com>
+//
+// See <asmjit/core.h> or LICENSE.md for license and copyright information
+// SPDX-License-Identifier: Zlib
+
+#ifndef ASMJIT_X86_X86PEEPHOLE_P_H_INCLUDED
+#define ASMJIT_X86_X86PEEPHOLE_P_H_INCLUDED
+
+#include <asmjit/core/api-config.h>
+#if !defined(ASMJIT_NO_BUILDER) && !defined(ASMJIT_NO_INTROSPECTION)
+
+#include <asmjit/core/peepholepass.h>
+
+ASMJIT_BEGIN_SUB_NAMESPACE(x86)
+
+//! \cond INTERNAL
+//! \addtogroup asmjit_x86
+//! \{
+
+namespace PeepholeInternal {
+
+//! Returns built-in X86|X64 peephole rules used by \ref PeepholePass.
+Span<const PeepholeRule> default_rules() noexcept;
+
+} // {PeepholeInternal}
+
+//! \}
+//! \endcond
+
+ASMJIT_END_SUB_NAMESPACE
+
+#endif // !ASMJIT_NO_BUILDER && !ASMJIT_NO_INTROSPECTION
+#endif // ASMJIT_X86_X86PEEPHOLE_P_H_INCLUDED
@@ -5,6 +5,9 @@
 
 "use strict";
 
+const fs = require("fs");
+const path = require("path");
+
 const core = require("./tablegen.js");
 const commons = require("./generator-commons.js");
 
@@ -19,8 +22,13 @@ const FATAL = commons.FATAL;
 // [ArmDB]
 // ============================================================================
 
+function readJSON(fileName) {
+  const content = fs.readFileSync(fileName);
+  return JSON.parse(content);
+}
+
 // Create AArch64 ISA.
-const isa = new asmdb.aarch64.ISA();
+const isa = new asmdb.aarch64.ISA(readJSON(path.join(__dirname, "..", "db", asmdb.aarch64.dbName)));
 
 /*
 class GenUtils {
@@ -139,7 +147,7 @@ class ArmTableGen extends core.TableGen {
       var instFlags = m[5].trim();
 
       var displayName = name;
-      if (name.endsWith("_v"))
+      if (name.endsWith("_v") || name.endsWith("_z"))
         displayName = name.substring(0, name.length - 2);
 
       // We have just matched #define INST()
@@ -220,6 +228,11 @@ class IdEnum extends core.IdEnum {
       ext.push("ASIMD");
     }
 
+    if (name.endsWith("_z")) {
+      name = name.substr(0, name.length - 2);
+      ext.push("SVE");
+    }
+
     let exts = "";
     if (ext.length)
       exts = " {" + ext.join("&") + "}";
@@ -313,6 +326,71 @@ class EncodingTable extends core.Task {
            this.ctx.inject("EncodingData"       , StringUtils.disclaimer(tableSource), 0);
   }
 }
+// ============================================================================
+// [tablegen.arm.SveOpcodeCheck]
+// ============================================================================
+
+// Verifies opcodes of SVE instructions (having `_z` suffix) against the ISA database. Each 32-bit opcode stored
+// in opcode data must match fixed bits of at least one SVE record of the same name - the element size at bits
+// [23:22] is inserted by the assembler, so records that have fixed element sizes are matched with all of them.
+// Instructions that are not in the database (for example SVE loads and stores) are not checked.
+class SveOpcodeCheck extends core.Task {
+  constructor() {
+    super("SveOpcodeCheck");
+  }
+
+  run() {
+    const insts = this.ctx.insts;
+
+    var checked = 0;
+    var missing = [];
+
+    for (var i = 0; i < insts.length; i++) {
+      const inst = insts[i];
+      if (!inst.name.endsWith("_z"))
+        continue;
+
+      const opcodes = (inst.opcodeData.match(/0x[0-9A-Fa-f]{8}/g) || []).map((s) => parseInt(s, 16) >>> 0);
+      if (!opcodes.length)
+        continue;
+
+      const records = isa.query(inst.displayName).filter((record) => {
+        return record.ext && (record.ext.SVE || record.ext.SVE2);
+      });
+
+      if (!records.length) {
+        missing.push(inst.displayName);
+        continue;
+      }
+
+      for (var j = 0; j < opcodes.length; j++) {
+        const opcode = opcodes[j];
+        const matches = records.some((record) => {
+          var varMask = 0;
+          for (var k in record.fields) {
+            for (var value of record.fields[k].values)
+              varMask |= ((1 << value.size) - 1) << value.index;
+          }
+
+          const fixedMask = ~varMask >>> 0;
+          for (var sz = 0; sz < 4; sz++) {
+            if ((((opcode | (sz << 22)) & fixedMask) >>> 0) === ((record.opcodeValue & fixedMask) >>> 0))
+              return true;
+          }
+          return false;
+        });
+
+        if (!matches)
+          FATAL(`SveOpcodeCheck: Opcode 0x${opcode.toString(16).toUpperCase()} of '${inst.name}' doesn't match any SVE record of '${inst.displayName}'`);
+        checked++;
+      }
+    }
+
+    console.log(`SVE opcodes checked: ${checked}` + (missing.length ? ` (not in database: ${missing.join(" ")})` : ""));
+    return 0;
+  }
+}
+
 // ============================================================================
 // [tablegen.arm.CommonTable]
 // ============================================================================
@@ -347,5 +425,6 @@ new ArmTableGen()
   .addTask(new IdEnum())
   .addTask(new NameTable())
   .addTask(new EncodingTable())
+  .addTask(new SveOpcodeCheck())
   .addTask(new CommonTable())
   .run();
@@ -1925,6 +1925,8 @@ class InstRWInfoTable extends core.Task {
       "movabs"    : "Movabs",
       "movhpd"    : "Movh64",
       "movhps"    : "Movh64",
+      "movlpd"    : "Movl64",
+      "movlps"    : "Movl64",
       "punpcklbw" : "Punpcklxx",
       "punpckldq" : "Punpcklxx",
       "punpcklwd" : "Punpcklxx",